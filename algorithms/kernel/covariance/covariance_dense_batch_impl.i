@@ -49,13 +49,11 @@ services::Status CovarianceDenseBatchKernel<algorithmFPType, method, cpu>::compu
     const size_t nVectors   = dataTable->getNumberOfRows();
     const bool isNormalized = dataTable->isNormalized(NumericTableIface::standardScoreNormalized);
 
-    DEFINE_TABLE_BLOCK(ReadRows, dataBlock, dataTable);
     DEFINE_TABLE_BLOCK(WriteOnlyRows, sumBlock, meanTable);
     DEFINE_TABLE_BLOCK(WriteOnlyRows, crossProductBlock, covTable);
 
     algorithmFPType * sums         = sumBlock.get();
     algorithmFPType * crossProduct = crossProductBlock.get();
-    algorithmFPType * data         = const_cast<algorithmFPType *>(dataBlock.get());
 
     services::Status status;
 
@@ -65,8 +63,19 @@ services::Status CovarianceDenseBatchKernel<algorithmFPType, method, cpu>::compu
     status |= prepareCrossProduct<algorithmFPType, cpu>(nFeatures, crossProduct);
     DAAL_CHECK_STATUS_VAR(status);
 
-    status |=
-        updateDenseCrossProductAndSums<algorithmFPType, method, cpu>(isNormalized, nFeatures, nVectors, data, crossProduct, sums, &nObservations);
+    /* Features stored contiguously are read in place instead of being transposed into blocks of rows */
+    if ((isNormalized || method == defaultDense || method == sumDense) && hasColumnViews<algorithmFPType, cpu>(*dataTable))
+    {
+        status |= updateDenseCrossProductAndSumsByColumns<algorithmFPType, method, cpu>(isNormalized, dataTable, crossProduct, sums, &nObservations);
+    }
+    else
+    {
+        DEFINE_TABLE_BLOCK(ReadRows, dataBlock, dataTable);
+        algorithmFPType * data = const_cast<algorithmFPType *>(dataBlock.get());
+
+        status |=
+            updateDenseCrossProductAndSums<algorithmFPType, method, cpu>(isNormalized, nFeatures, nVectors, data, crossProduct, sums, &nObservations);
+    }
     DAAL_CHECK_STATUS_VAR(status);
 
     status |= finalizeCovariance<algorithmFPType, cpu>(nFeatures, nObservations, crossProduct, sums, crossProduct, sums, parameter);
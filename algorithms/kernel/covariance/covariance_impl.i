@@ -141,129 +141,153 @@ inline size_t getBlockSize<avx512>(size_t nrows)
     return (nrows > 5000 && nrows <= 50000) ? 1024 : 140;
 }
 
-/********************* updateDenseCrossProductAndSums ********************************************/
-template <typename algorithmFPType, Method method, CpuType cpu>
-services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatures, size_t nVectors, algorithmFPType * dataBlock,
-                                                algorithmFPType * crossProduct, algorithmFPType * sums, algorithmFPType * nObservations)
+/********************* computeDenseCrossProductAndSums *******************************************/
+/* Splits the rows by blocks, accumulates cross products and sums of the blocks in thread local storage
+   and merges them. processBlock(startRow, nRows, tlsData) updates the local cross product and sums with the block */
+template <typename algorithmFPType, Method method, CpuType cpu, typename ProcessBlock>
+services::Status computeDenseCrossProductAndSums(bool isNormalized, size_t nFeatures, size_t nVectors, algorithmFPType * crossProduct,
+                                                 algorithmFPType * sums, const ProcessBlock & processBlock)
 {
-    DAAL_ITTNOTIFY_SCOPED_TASK(compute.updateDenseCrossProductAndSums);
-    if (((isNormalized) || ((!isNormalized) && ((method == defaultDense) || (method == sumDense)))))
+    /* Inverse number of rows (for normalization) */
+    algorithmFPType nVectorsInv = 1.0 / (double)(nVectors);
+
+    /* Split rows by blocks */
+    size_t numRowsInBlock = getBlockSize<cpu>(nVectors);
+    size_t numBlocks      = nVectors / numRowsInBlock;
+    if (numBlocks * numRowsInBlock < nVectors)
     {
-        /* Inverse number of rows (for normalization) */
-        algorithmFPType nVectorsInv = 1.0 / (double)(nVectors);
+        numBlocks++;
+    }
 
-        /* Split rows by blocks */
-        size_t numRowsInBlock = getBlockSize<cpu>(nVectors);
-        size_t numBlocks      = nVectors / numRowsInBlock;
-        if (numBlocks * numRowsInBlock < nVectors)
+    /* TLS data initialization */
+    SafeStatus safeStat;
+    daal::tls<tls_data_t<algorithmFPType, cpu> *> tls_data([=, &safeStat]() {
+        auto tlsData = tls_data_t<algorithmFPType, cpu>::create(isNormalized, nFeatures);
+        if (!tlsData)
         {
-            numBlocks++;
+            safeStat.add(services::ErrorMemoryAllocationFailed);
         }
+        return tlsData;
+    });
 
-        /* TLS data initialization */
-        SafeStatus safeStat;
-        daal::tls<tls_data_t<algorithmFPType, cpu> *> tls_data([=, &safeStat]() {
-            auto tlsData = tls_data_t<algorithmFPType, cpu>::create(isNormalized, nFeatures);
-            if (!tlsData)
-            {
-                safeStat.add(services::ErrorMemoryAllocationFailed);
-            }
-            return tlsData;
-        });
-
-        /* Threaded loop with syrk seq calls */
-        daal::threader_for(numBlocks, numBlocks, [&](int iBlock) {
-            struct tls_data_t<algorithmFPType, cpu> * tls_data_local = tls_data.local();
-            if (!tls_data_local)
-            {
-                return;
-            }
+    /* Threaded loop with syrk seq calls */
+    daal::threader_for(numBlocks, numBlocks, [&](int iBlock) {
+        struct tls_data_t<algorithmFPType, cpu> * tls_data_local = tls_data.local();
+        if (!tls_data_local)
+        {
+            return;
+        }
 
-            char uplo             = 'U';
-            char trans            = 'N';
-            algorithmFPType alpha = 1.0;
-            algorithmFPType beta  = 1.0;
+        size_t startRow = iBlock * numRowsInBlock;
+        size_t endRow   = startRow + numRowsInBlock;
+        if (endRow > nVectors)
+        {
+            endRow = nVectors;
+        }
 
-            size_t startRow = iBlock * numRowsInBlock;
-            size_t endRow   = startRow + numRowsInBlock;
-            if (endRow > nVectors)
-            {
-                endRow = nVectors;
-            }
-            DAAL_INT nFeatures_local             = nFeatures;
-            DAAL_INT nVectors_local              = endRow - startRow;
-            algorithmFPType * dataBlock_local    = dataBlock + startRow * nFeatures;
-            algorithmFPType * crossProduct_local = tls_data_local->crossProduct;
-            algorithmFPType * sums_local         = tls_data_local->sums;
+        safeStat |= processBlock(startRow, endRow - startRow, tls_data_local);
+    });
 
-            {
-                DAAL_ITTNOTIFY_SCOPED_TASK(gemmData);
-                Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, (DAAL_INT *)&nFeatures_local, (DAAL_INT *)&nVectors_local, &alpha, dataBlock_local,
-                                                   (DAAL_INT *)&nFeatures_local, &beta, crossProduct_local, (DAAL_INT *)&nFeatures_local);
-            }
+    /* TLS reduction: sum all partial cross products and sums */
+    tls_data.reduce([=](tls_data_t<algorithmFPType, cpu> * tls_data_local) {
+        DAAL_ITTNOTIFY_SCOPED_TASK(computeSums.reduce);
+        if (!tls_data_local)
+        {
+            return;
+        }
 
-            if (!isNormalized && (method == defaultDense))
+        /* Sum all cross products */
+        if (tls_data_local->crossProduct)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < (nFeatures * nFeatures); i++)
             {
-                DAAL_ITTNOTIFY_SCOPED_TASK(cumputeSums.local);
-                /* Sum input array elements in case of non-normalized data */
-                for (int i = 0; i < nVectors_local; i++)
-                {
-                    PRAGMA_IVDEP
-                    PRAGMA_VECTOR_ALWAYS
-                    for (int j = 0; j < nFeatures_local; j++)
-                    {
-                        sums_local[j] += dataBlock_local[i * nFeatures_local + j];
-                    }
-                }
+                crossProduct[i] += tls_data_local->crossProduct[i];
             }
-        });
-        DAAL_CHECK_SAFE_STATUS();
+        }
 
-        /* TLS reduction: sum all partial cross products and sums */
-        tls_data.reduce([=](tls_data_t<algorithmFPType, cpu> * tls_data_local) {
-            DAAL_ITTNOTIFY_SCOPED_TASK(computeSums.reduce);
-            /* Sum all cross products */
-            if (tls_data_local->crossProduct)
+        /* Update sums vector in case of non-normalized data */
+        if (!isNormalized && (method == defaultDense))
+        {
+            if (tls_data_local->sums)
             {
                 PRAGMA_IVDEP
                 PRAGMA_VECTOR_ALWAYS
-                for (size_t i = 0; i < (nFeatures * nFeatures); i++)
+                for (int i = 0; i < nFeatures; i++)
                 {
-                    crossProduct[i] += tls_data_local->crossProduct[i];
+                    sums[i] += tls_data_local->sums[i];
                 }
             }
+        }
+
+        delete tls_data_local;
+    });
+    DAAL_CHECK_SAFE_STATUS();
 
-            /* Update sums vector in case of non-normalized data */
-            if (!isNormalized && (method == defaultDense))
+    /* If data is not normalized, perform subtractions of(sums[i]*sums[j])/n */
+    if (!isNormalized)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(gemmSums);
+        for (int i = 0; i < nFeatures; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (int j = 0; j < nFeatures; j++)
             {
-                if (tls_data_local->sums)
-                {
-                    PRAGMA_IVDEP
-                    PRAGMA_VECTOR_ALWAYS
-                    for (int i = 0; i < nFeatures; i++)
-                    {
-                        sums[i] += tls_data_local->sums[i];
-                    }
-                }
+                crossProduct[i * nFeatures + j] -= (nVectorsInv * sums[i] * sums[j]);
             }
+        }
+    }
+    return services::Status();
+}
 
-            delete tls_data_local;
-        });
+/********************* updateDenseCrossProductAndSums ********************************************/
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatures, size_t nVectors, algorithmFPType * dataBlock,
+                                                algorithmFPType * crossProduct, algorithmFPType * sums, algorithmFPType * nObservations)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.updateDenseCrossProductAndSums);
+    if (((isNormalized) || ((!isNormalized) && ((method == defaultDense) || (method == sumDense)))))
+    {
+        services::Status status = computeDenseCrossProductAndSums<algorithmFPType, method, cpu>(
+            isNormalized, nFeatures, nVectors, crossProduct, sums,
+            [=](size_t startRow, size_t nRows, tls_data_t<algorithmFPType, cpu> * tls_data_local) -> services::Status {
+                char uplo             = 'U';
+                char trans            = 'N';
+                algorithmFPType alpha = 1.0;
+                algorithmFPType beta  = 1.0;
+
+                DAAL_INT nFeatures_local             = nFeatures;
+                DAAL_INT nVectors_local              = nRows;
+                algorithmFPType * dataBlock_local    = dataBlock + startRow * nFeatures;
+                algorithmFPType * crossProduct_local = tls_data_local->crossProduct;
+                algorithmFPType * sums_local         = tls_data_local->sums;
 
-        /* If data is not normalized, perform subtractions of(sums[i]*sums[j])/n */
-        if (!isNormalized)
-        {
-            DAAL_ITTNOTIFY_SCOPED_TASK(gemmSums);
-            for (int i = 0; i < nFeatures; i++)
-            {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (int j = 0; j < nFeatures; j++)
                 {
-                    crossProduct[i * nFeatures + j] -= (nVectorsInv * sums[i] * sums[j]);
+                    DAAL_ITTNOTIFY_SCOPED_TASK(gemmData);
+                    Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, (DAAL_INT *)&nFeatures_local, (DAAL_INT *)&nVectors_local, &alpha,
+                                                       dataBlock_local, (DAAL_INT *)&nFeatures_local, &beta, crossProduct_local,
+                                                       (DAAL_INT *)&nFeatures_local);
                 }
-            }
-        }
+
+                if (!isNormalized && (method == defaultDense))
+                {
+                    DAAL_ITTNOTIFY_SCOPED_TASK(cumputeSums.local);
+                    /* Sum input array elements in case of non-normalized data */
+                    for (int i = 0; i < nVectors_local; i++)
+                    {
+                        PRAGMA_IVDEP
+                        PRAGMA_VECTOR_ALWAYS
+                        for (int j = 0; j < nFeatures_local; j++)
+                        {
+                            sums_local[j] += dataBlock_local[i * nFeatures_local + j];
+                        }
+                    }
+                }
+                return services::Status();
+            });
+        DAAL_CHECK_STATUS_VAR(status);
     }
     else
     {
@@ -285,6 +309,70 @@ services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatu
     return services::Status();
 }
 
+/********************* updateDenseCrossProductAndSumsByColumns ***********************************/
+/* Version of updateDenseCrossProductAndSums for the tables that store the features contiguously.
+   The slices of the columns are referenced in the table and copied into a feature-major block without transposition */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status updateDenseCrossProductAndSumsByColumns(bool isNormalized, NumericTable * dataTable, algorithmFPType * crossProduct,
+                                                         algorithmFPType * sums, algorithmFPType * nObservations)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.updateDenseCrossProductAndSums);
+    DAAL_ASSERT(isNormalized || method == defaultDense || method == sumDense);
+
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+
+    services::Status status = computeDenseCrossProductAndSums<algorithmFPType, method, cpu>(
+        isNormalized, nFeatures, nVectors, crossProduct, sums,
+        [=](size_t startRow, size_t nRows, tls_data_t<algorithmFPType, cpu> * tls_data_local) -> services::Status {
+            TArrayScalable<algorithmFPType, cpu> columnsArray(nRows * nFeatures);
+            algorithmFPType * columns = columnsArray.get();
+            DAAL_CHECK_MALLOC(columns);
+
+            algorithmFPType * sums_local = tls_data_local->sums;
+            const bool computeSums       = !isNormalized && (method == defaultDense);
+
+            ReadColumns<algorithmFPType, cpu> columnBlock;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType * column = columnBlock.set(dataTable, j, startRow, nRows);
+                DAAL_CHECK_BLOCK_STATUS(columnBlock);
+
+                algorithmFPType * columns_j = columns + j * nRows;
+                algorithmFPType sum         = 0;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    columns_j[i] = column[i];
+                    sum += column[i];
+                }
+                if (computeSums)
+                {
+                    sums_local[j] += sum;
+                }
+            }
+
+            char uplo             = 'U';
+            char trans            = 'T';
+            algorithmFPType alpha = 1.0;
+            algorithmFPType beta  = 1.0;
+
+            DAAL_INT nFeatures_local = nFeatures;
+            DAAL_INT nVectors_local  = nRows;
+            {
+                DAAL_ITTNOTIFY_SCOPED_TASK(gemmData);
+                Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, (DAAL_INT *)&nFeatures_local, (DAAL_INT *)&nVectors_local, &alpha, columns,
+                                                   (DAAL_INT *)&nVectors_local, &beta, tls_data_local->crossProduct, (DAAL_INT *)&nFeatures_local);
+            }
+            return services::Status();
+        });
+    DAAL_CHECK_STATUS_VAR(status);
+
+    *nObservations += (algorithmFPType)nVectors;
+    return services::Status();
+}
+
 /********************** updateCSRCrossProductAndSums *********************************************/
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status updateCSRCrossProductAndSums(size_t nFeatures, size_t nVectors, algorithmFPType * dataBlock, size_t * colIndices,
@@ -151,6 +151,8 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeNoMemSave(const N
 
     const size_t nRows = ntData->getNumberOfRows();
 
+    /* Observations are identified by int indices in the disjoint sets and in the assignments */
+    DAAL_CHECK(nRows <= size_t(MaxVal<int>::get()), services::ErrorIncorrectNumberOfObservations);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(Neighborhood<algorithmFPType, cpu>));
 
     TArray<Neighborhood<algorithmFPType, cpu>, cpu> neighs(nRows);
@@ -163,50 +165,95 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeNoMemSave(const N
     DAAL_CHECK_BLOCK_STATUS(assignRows);
     int * const assignments = assignRows.get();
 
-    service_memset<int, cpu>(assignments, undefined, nRows);
-
     TArray<int, cpu> isCoreArray(nRows);
     DAAL_CHECK_MALLOC(isCoreArray.get());
     int * const isCore = isCoreArray.get();
 
-    service_memset<int, cpu>(isCore, 0, nRows);
-
-    size_t nClusters = 0;
-    Queue<size_t, cpu> qu;
+    const size_t blockSize = 256;
+    const size_t nBlocks   = nRows / blockSize + (nRows % blockSize > 0);
 
-    for (size_t i = 0; i < nRows; i++)
-    {
-        if (assignments[i] != undefined) continue;
-
-        Neighborhood<algorithmFPType, cpu> & curNeigh = neighs[i];
-        if (curNeigh.weight() < minObservations)
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t i2 = (iBlock + 1 == nBlocks ? nRows : (iBlock + 1) * blockSize);
+        for (size_t i = iBlock * blockSize; i < i2; i++)
         {
-            assignments[i] = noise;
-            continue;
+            isCore[i] = (neighs[i].weight() < minObservations ? 0 : 1);
         }
+    });
 
-        nClusters++;
-        isCore[i]      = 1;
-        assignments[i] = nClusters - 1;
+    /* Clusters are the connected components of the graph of core observations,
+       the root of each component is its core observation with the smallest index */
+    DisjointSets<cpu> components;
+    DAAL_CHECK_STATUS_VAR(components.init(nRows));
 
-        qu.reset();
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t i2 = (iBlock + 1 == nBlocks ? nRows : (iBlock + 1) * blockSize);
+        for (size_t i = iBlock * blockSize; i < i2; i++)
+        {
+            if (!isCore[i]) continue;
 
-        DAAL_CHECK_STATUS_VAR(processNeighborhood(nClusters - 1, assignments, curNeigh, qu));
+            const Neighborhood<algorithmFPType, cpu> & curNeigh = neighs[i];
+            for (size_t j = 0; j < curNeigh.size(); j++)
+            {
+                const size_t nextObs = curNeigh.get(j);
+                if (nextObs < i && isCore[nextObs])
+                {
+                    components.unite((int)i, (int)nextObs);
+                }
+            }
+        }
+    });
 
-        while (!qu.empty())
+    /* Clusters are numbered in the order of their roots, i.e. in the same order as the sequential expansion finds them */
+    size_t nClusters = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (isCore[i] && components.find((int)i) == (int)i)
         {
-            const size_t curObs = qu.pop();
+            assignments[i] = nClusters;
+            nClusters++;
+        }
+    }
 
-            Neighborhood<algorithmFPType, cpu> & curNeigh = neighs[curObs];
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t i2 = (iBlock + 1 == nBlocks ? nRows : (iBlock + 1) * blockSize);
+        for (size_t i = iBlock * blockSize; i < i2; i++)
+        {
+            if (isCore[i])
+            {
+                const int root = components.find((int)i);
+                if (root != (int)i)
+                {
+                    assignments[i] = assignments[root];
+                }
+            }
+        }
+    });
 
-            assignments[curObs] = nClusters - 1;
-            if (curNeigh.weight() < minObservations) continue;
+    /* Border observation is assigned to the first found cluster among the clusters of the core observations in its neighborhood */
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t i2 = (iBlock + 1 == nBlocks ? nRows : (iBlock + 1) * blockSize);
+        for (size_t i = iBlock * blockSize; i < i2; i++)
+        {
+            if (isCore[i]) continue;
 
-            isCore[curObs] = 1;
+            int clusterId = noise;
 
-            DAAL_CHECK_STATUS_VAR(processNeighborhood(nClusters - 1, assignments, curNeigh, qu));
+            const Neighborhood<algorithmFPType, cpu> & curNeigh = neighs[i];
+            for (size_t j = 0; j < curNeigh.size(); j++)
+            {
+                const size_t nextObs = curNeigh.get(j);
+                if (isCore[nextObs])
+                {
+                    const int nextClusterId = assignments[nextObs];
+                    if (clusterId == noise || nextClusterId < clusterId)
+                    {
+                        clusterId = nextClusterId;
+                    }
+                }
+            }
+            assignments[i] = clusterId;
         }
-    }
+    });
 
     WriteRows<int, cpu> nClustersRows(ntNClusters, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(nClustersRows);
@@ -34,6 +34,11 @@
 #include "service_math.h"
 #include "service_kernel_math.h"
 #include "service_error_handling.h"
+#include "service_data_utils.h"
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -50,6 +55,8 @@ namespace internal
 #define __DBSCAN_DEFAULT_QUEUE_SIZE        8
 #define __DBSCAN_DEFAULT_VECTOR_SIZE       8
 #define __DBSCAN_DEFAULT_NEIGHBORHOOD_SIZE 8
+#define __DBSCAN_KDTREE_LEAF_SIZE          32
+#define __DBSCAN_KDTREE_STACK_SIZE         128
 
 template <typename T, CpuType cpu>
 class Queue
@@ -295,6 +302,109 @@ private:
     FPType _weight;
 };
 
+/* Disjoint sets of the observations that can be united concurrently without locks.
+   Sets are linked by the smaller index of the root, so the root of each set is its element with the smallest index */
+template <CpuType cpu>
+class DisjointSets
+{
+public:
+    DAAL_NEW_DELETE();
+
+    DisjointSets() {}
+
+    DisjointSets(const DisjointSets &) = delete;
+    DisjointSets & operator=(const DisjointSets &) = delete;
+
+    services::Status init(size_t n)
+    {
+        DAAL_CHECK(n <= size_t(MaxVal<int>::get()), services::ErrorIncorrectNumberOfObservations);
+        _parent.reset(n);
+        DAAL_CHECK_MALLOC(_parent.get());
+
+        int * const parent     = _parent.get();
+        const size_t blockSize = 1024;
+        const size_t nBlocks   = n / blockSize + (n % blockSize > 0);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t i2 = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+            for (size_t i = iBlock * blockSize; i < i2; i++)
+            {
+                store(&parent[i], (int)i);
+            }
+        });
+        return services::Status();
+    }
+
+    int find(int x)
+    {
+        int * const parent = _parent.get();
+        int p              = load(&parent[x]);
+        while (p != x)
+        {
+            /* Path halving: the node is linked to its grandparent if the parent was not changed concurrently */
+            const int gp = load(&parent[p]);
+            if (gp != p)
+            {
+                compareExchange(&parent[x], p, gp);
+            }
+            x = gp;
+            p = load(&parent[x]);
+        }
+        return x;
+    }
+
+    void unite(int x, int y)
+    {
+        int * const parent = _parent.get();
+        for (;;)
+        {
+            x = find(x);
+            y = find(y);
+            if (x == y) return;
+            if (x < y)
+            {
+                const int t = x;
+                x           = y;
+                y           = t;
+            }
+            if (compareExchange(&parent[x], x, y) == x) return;
+        }
+    }
+
+private:
+    /* Parents are read and modified concurrently, hence they are accessed with the atomic operations below.
+       The operations are inlined since they are called at each step of the search of the root */
+    static int load(const int * ptr)
+    {
+#if defined(_MSC_VER)
+        return *(const volatile int *)ptr; /* volatile loads have acquire semantics on x86 */
+#else
+        return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+#endif
+    }
+
+    static void store(int * ptr, int value)
+    {
+#if defined(_MSC_VER)
+        *(volatile int *)ptr = value; /* volatile stores have release semantics on x86 */
+#else
+        __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+#endif
+    }
+
+    /* Atomically replaces the value pointed by ptr with desired if it is equal to expected.
+       Returns the value pointed by ptr before the call */
+    static int compareExchange(int * ptr, int expected, int desired)
+    {
+#if defined(_MSC_VER)
+        return (int)_InterlockedCompareExchange((volatile long *)ptr, (long)desired, (long)expected);
+#else
+        return __sync_val_compare_and_swap(ptr, expected, desired);
+#endif
+    }
+
+    TArray<int, cpu> _parent; /* Parents of the observations in the trees of the sets */
+};
+
 template <typename FPType, CpuType cpu>
 struct TlsNTask
 {
@@ -575,6 +685,387 @@ private:
     FPType _p;
 };
 
+/* Neighborhood engine that answers range queries through KD-tree built over the observations of outTable.
+   The tree is built at the first query: the nodes are split at the median of the dimension with the largest spread
+   until they contain at most __DBSCAN_KDTREE_LEAF_SIZE observations, all nodes of the same level are split in parallel.
+   The observations are reordered so that the observations of each leaf are stored contiguously */
+template <typename FPType, CpuType cpu>
+class NeighborhoodEngine<kdTreeDense, FPType, cpu>
+{
+    DAAL_NEW_DELETE();
+
+    struct KDTreeNode
+    {
+        size_t first; /* Index of the first observation of the node in the reordered data */
+        size_t last;  /* Index of the observation following the last observation of the node */
+        size_t left;  /* Index of the left child, the right one follows it. Zero for leaves */
+    };
+
+public:
+    NeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps, FPType p)
+        : _inTable(inTable), _outTable(outTable), _weights(weights), _eps(eps), _p(p), _dim(0), _nNodes(0), _stackSize(0), _isBuilt(false)
+    {}
+
+    ~NeighborhoodEngine() {}
+
+    NeighborhoodEngine(const NeighborhoodEngine &) = delete;
+    NeighborhoodEngine & operator=(const NeighborhoodEngine &) = delete;
+
+    services::Status queryFull(Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        SafeStatus safeStat;
+        services::Status s;
+
+        const size_t inRows  = _inTable->getNumberOfRows();
+        const size_t outRows = _outTable->getNumberOfRows();
+
+        if (outRows == 0)
+        {
+            return s;
+        }
+
+        DAAL_CHECK_STATUS(s, build());
+
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        const size_t inBlockSize = 256;
+        const size_t nInBlocks   = inRows / inBlockSize + (inRows % inBlockSize > 0);
+
+        daal::threader_for(nInBlocks, nInBlocks, [&](size_t inBlock) {
+            const size_t i1 = inBlock * inBlockSize;
+            const size_t i2 = (inBlock + 1 == nInBlocks ? inRows : i1 + inBlockSize);
+
+            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, i2 - i1);
+            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+            const FPType * const inData = inDataRows.get();
+
+            for (size_t i = 0; i < i2 - i1; i++)
+            {
+                if (doReset)
+                {
+                    neighs[i + i1].reset();
+                }
+                DAAL_CHECK_STATUS_THR(queryPoint(&inData[i * _dim], epsP, neighs[i + i1]));
+            }
+        });
+        s = safeStat.detach();
+
+        return s;
+    }
+
+    services::Status query(size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        SafeStatus safeStat;
+        services::Status s;
+
+        const size_t outRows = _outTable->getNumberOfRows();
+
+        if (outRows == 0)
+        {
+            return s;
+        }
+
+        DAAL_CHECK_STATUS(s, build());
+
+        const FPType epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        daal::threader_for(n, n, [&](size_t i) {
+            ReadRows<FPType, cpu> queryRow(const_cast<NumericTable *>(_inTable), indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(queryRow);
+
+            if (doReset)
+            {
+                neighs[i].reset();
+            }
+            DAAL_CHECK_STATUS_THR(queryPoint(queryRow.get(), epsP, neighs[i]));
+        });
+        s = safeStat.detach();
+
+        return s;
+    }
+
+private:
+    services::Status queryPoint(const FPType * const point, FPType epsP, Neighborhood<FPType, cpu> & neigh) const
+    {
+        const size_t dim = _dim;
+
+        /* The stack is placed on the heap if the tree is too deep for the fixed size one */
+        size_t localStack[__DBSCAN_KDTREE_STACK_SIZE];
+        TArray<size_t, cpu> heapStack(_stackSize > __DBSCAN_KDTREE_STACK_SIZE ? _stackSize : 0);
+        size_t * stack = localStack;
+        if (_stackSize > __DBSCAN_KDTREE_STACK_SIZE)
+        {
+            DAAL_CHECK_MALLOC(heapStack.get());
+            stack = heapStack.get();
+        }
+
+        size_t stackSize   = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            const size_t iNode      = stack[--stackSize];
+            const KDTreeNode & node = _nodes[iNode];
+            const FPType * const lo = &_bounds[2 * iNode * dim];
+            const FPType * const hi = lo + dim;
+
+            FPType boxDist = 0;
+            for (size_t d = 0; d < dim; d++)
+            {
+                const FPType diff = (point[d] < lo[d] ? lo[d] - point[d] : (point[d] > hi[d] ? point[d] - hi[d] : (FPType)0));
+                boxDist += diff * diff;
+            }
+            if (boxDist > epsP) continue;
+
+            if (node.left)
+            {
+                DAAL_ASSERT(stackSize + 2 <= _stackSize);
+                stack[stackSize++] = node.left + 1;
+                stack[stackSize++] = node.left;
+                continue;
+            }
+
+            for (size_t j = node.first; j < node.last; j++)
+            {
+                const FPType dist = distancePow2<FPType, cpu>(point, &_data[j * dim], dim);
+                if (dist <= epsP)
+                {
+                    DAAL_CHECK_STATUS_VAR(neigh.add(_indices[j], (_weights ? _weightValues[j] : (FPType)1.0)));
+                }
+            }
+        }
+
+        return services::Status();
+    }
+
+    services::Status build()
+    {
+        if (_isBuilt)
+        {
+            return services::Status();
+        }
+
+        SafeStatus safeStat;
+
+        const size_t n      = _outTable->getNumberOfRows();
+        const size_t dim    = _inTable->getNumberOfColumns();
+        const size_t outDim = _outTable->getNumberOfColumns();
+        DAAL_ASSERT(outDim >= dim);
+        _dim = dim;
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, dim);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * dim, sizeof(FPType));
+
+        TArray<FPType, cpu> data(n * dim);
+        TArray<size_t, cpu> indices(n);
+        TArray<FPType, cpu> weightValues(_weights ? n : 0);
+        DAAL_CHECK_MALLOC(data.get() && indices.get());
+        DAAL_CHECK_MALLOC(!_weights || weightValues.get());
+
+        const size_t blockSize = 256;
+        const size_t nBlocks   = n / blockSize + (n % blockSize > 0);
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t j1 = iBlock * blockSize;
+            const size_t j2 = (iBlock + 1 == nBlocks ? n : j1 + blockSize);
+
+            ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), j1, j2 - j1);
+            DAAL_CHECK_BLOCK_STATUS_THR(outDataRows);
+            const FPType * const outData = outDataRows.get();
+
+            for (size_t j = j1; j < j2; j++)
+            {
+                indices[j] = j;
+                for (size_t d = 0; d < dim; d++)
+                {
+                    data[j * dim + d] = outData[(j - j1) * outDim + d];
+                }
+            }
+
+            if (_weights)
+            {
+                ReadRows<FPType, cpu> weightsRows(const_cast<NumericTable *>(_weights), j1, j2 - j1);
+                DAAL_CHECK_BLOCK_STATUS_THR(weightsRows);
+                const FPType * const weights = weightsRows.get();
+                for (size_t j = j1; j < j2; j++)
+                {
+                    weightValues[j] = weights[j - j1];
+                }
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        const size_t leafSize = __DBSCAN_KDTREE_LEAF_SIZE;
+        const size_t maxNodes = 4 * (n / leafSize + 1) + 1;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, maxNodes, 2 * dim * sizeof(FPType));
+
+        _nodes.reset(maxNodes);
+        _bounds.reset(maxNodes * 2 * dim);
+        DAAL_CHECK_MALLOC(_nodes.get() && _bounds.get());
+
+        KDTreeNode * const nodes = _nodes.get();
+        FPType * const bounds    = _bounds.get();
+
+        nodes[0].first = 0;
+        nodes[0].last  = n;
+        nodes[0].left  = 0;
+        _nNodes        = 1;
+
+        size_t levelBegin = 0;
+        size_t levelEnd   = 1;
+        size_t nLevels    = 0;
+        while (levelBegin < levelEnd)
+        {
+            nLevels++;
+            /* Children of the nodes of the current level are placed one after another */
+            for (size_t iNode = levelBegin; iNode < levelEnd; iNode++)
+            {
+                if (nodes[iNode].last - nodes[iNode].first > leafSize)
+                {
+                    DAAL_ASSERT(_nNodes + 2 <= maxNodes);
+                    nodes[iNode].left = _nNodes;
+                    _nNodes += 2;
+                }
+            }
+
+            const size_t nLevelNodes = levelEnd - levelBegin;
+            daal::threader_for(nLevelNodes, nLevelNodes, [&](size_t iLevelNode) {
+                KDTreeNode & node = nodes[levelBegin + iLevelNode];
+                FPType * const lo = &bounds[2 * (levelBegin + iLevelNode) * dim];
+                FPType * const hi = lo + dim;
+
+                for (size_t d = 0; d < dim; d++)
+                {
+                    lo[d] = MaxVal<FPType>::get();
+                    hi[d] = -MaxVal<FPType>::get();
+                }
+                for (size_t j = node.first; j < node.last; j++)
+                {
+                    const FPType * const x = &data[indices[j] * dim];
+                    for (size_t d = 0; d < dim; d++)
+                    {
+                        lo[d] = (x[d] < lo[d] ? x[d] : lo[d]);
+                        hi[d] = (x[d] > hi[d] ? x[d] : hi[d]);
+                    }
+                }
+
+                if (!node.left) return;
+
+                size_t splitDim = 0;
+                for (size_t d = 1; d < dim; d++)
+                {
+                    if (hi[d] - lo[d] > hi[splitDim] - lo[splitDim]) splitDim = d;
+                }
+
+                const size_t mid = node.first + (node.last - node.first) / 2;
+                selectKth(&indices[node.first], node.last - node.first, mid - node.first, data.get(), dim, splitDim);
+
+                KDTreeNode & left  = nodes[node.left];
+                KDTreeNode & right = nodes[node.left + 1];
+                left.first         = node.first;
+                left.last          = mid;
+                left.left          = 0;
+                right.first        = mid;
+                right.last         = node.last;
+                right.left         = 0;
+            });
+
+            levelBegin = levelEnd;
+            levelEnd   = _nNodes;
+        }
+        /* Depth-first traversal of the tree keeps at most one node per level and two children of the last visited split node */
+        _stackSize = nLevels + 1;
+
+        /* Observations of each leaf are stored contiguously */
+        _data.reset(n * dim);
+        _indices.reset(n);
+        DAAL_CHECK_MALLOC(_data.get() && _indices.get());
+        if (_weights)
+        {
+            _weightValues.reset(n);
+            DAAL_CHECK_MALLOC(_weightValues.get());
+        }
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t j1 = iBlock * blockSize;
+            const size_t j2 = (iBlock + 1 == nBlocks ? n : j1 + blockSize);
+
+            for (size_t j = j1; j < j2; j++)
+            {
+                const size_t index = indices[j];
+                _indices[j]        = index;
+                for (size_t d = 0; d < dim; d++)
+                {
+                    _data[j * dim + d] = data[index * dim + d];
+                }
+                if (_weights)
+                {
+                    _weightValues[j] = weightValues[index];
+                }
+            }
+        });
+
+        _isBuilt = true;
+        return services::Status();
+    }
+
+    /* Reorders the indices so that the k-th of them points to the observation with the k-th smallest value of the feature d */
+    static void selectKth(size_t * indices, size_t nElements, size_t k, const FPType * data, size_t dim, size_t d)
+    {
+        DAAL_INT64 l = 0;
+        DAAL_INT64 r = nElements - 1;
+        while (l < r)
+        {
+            const FPType med = data[indices[l + (r - l) / 2] * dim + d];
+            DAAL_INT64 i     = l;
+            DAAL_INT64 j     = r;
+            while (i <= j)
+            {
+                while (data[indices[i] * dim + d] < med)
+                {
+                    i++;
+                }
+                while (med < data[indices[j] * dim + d])
+                {
+                    j--;
+                }
+                if (i <= j)
+                {
+                    daal::services::internal::swap<cpu, size_t>(indices[i], indices[j]);
+                    i++;
+                    j--;
+                }
+            }
+            if (j < (DAAL_INT64)k)
+            {
+                l = i;
+            }
+            if ((DAAL_INT64)k < i)
+            {
+                r = j;
+            }
+        }
+    }
+
+    const NumericTable * _inTable;
+    const NumericTable * _outTable;
+    const NumericTable * _weights;
+
+    FPType _eps;
+    FPType _p;
+
+    size_t _dim;
+    size_t _nNodes;
+    size_t _stackSize; /* Maximal number of nodes in the stack of the tree traversal */
+    bool _isBuilt;
+
+    TArray<KDTreeNode, cpu> _nodes;
+    TArray<FPType, cpu> _bounds;       /* Bounding boxes of the nodes: minimums followed by maximums of the features */
+    TArray<FPType, cpu> _data;         /* Observations reordered by leaves */
+    TArray<size_t, cpu> _indices;      /* Indices of the reordered observations in outTable */
+    TArray<FPType, cpu> _weightValues; /* Weights of the reordered observations */
+};
+
 template <typename FPType, CpuType cpu>
 FPType findKthStatistic(FPType * values, size_t nElements, size_t k)
 {
@@ -103,6 +103,13 @@ IndexedFeatures::~IndexedFeatures()
     _entries = nullptr;
 }
 
+void IndexedFeatures::releaseData()
+{
+    if (_data) daal::services::daal_free(_data);
+    _data     = nullptr;
+    _capacity = 0;
+}
+
 IndexedFeatures::FeatureEntry::~FeatureEntry()
 {
     if (binBorders) daal::services::daal_free(binBorders);
@@ -141,6 +148,12 @@ services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
         DAAL_CHECK_MALLOC(_data);
         _capacity = newCapacity;
     }
+    _nRows = nR;
+    return allocEntries(nC);
+}
+
+services::Status IndexedFeatures::allocEntries(size_t nC)
+{
     if (_entries)
     {
         delete[] _entries;
@@ -149,7 +162,6 @@ services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
     _entries = new FeatureEntry[nC];
     DAAL_CHECK_MALLOC(_entries);
     _nCols = nC;
-    _nRows = nR;
     return services::Status();
 }
 
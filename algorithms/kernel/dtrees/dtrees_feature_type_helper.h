@@ -103,6 +103,11 @@ public:
     template <typename algorithmFPType, CpuType cpu>
     services::Status init(const NumericTable & nt, const FeatureTypes * featureTypes = nullptr, const BinParams * pBimPrm = nullptr);
 
+    //computes the bin borders of the features on the sample of the data of nRows rows without creating the indices,
+    //the values are mapped to the bins by binIndex() then
+    template <typename algorithmFPType, CpuType cpu>
+    services::Status initBins(const NumericTable & sample, size_t nRows, const FeatureTypes & featureTypes, const BinParams & binPrm);
+
     //get max number of indices for that feature
     IndexType numIndices(size_t iCol) const { return _entries[iCol].numIndices; }
 
@@ -124,6 +129,30 @@ public:
         return _entries[iCol].binBorders[iBin];
     }
 
+    //returns the bin of the feature value for the features initialized by initBins(),
+    //the values of an unordered feature that are absent in the sample are mapped to its last bin
+    IndexType binIndex(size_t iCol, ModelFPType value, bool bUnordered) const
+    {
+        const FeatureEntry & entry = _entries[iCol];
+        const IndexType nBins      = bUnordered ? entry.numIndices - 1 : entry.numIndices;
+        //the first bin which right border is not less than the value
+        IndexType iLeft = 0, iRight = nBins;
+        while (iLeft < iRight)
+        {
+            const IndexType iMid = (iLeft + iRight) / 2;
+            if (entry.binBorders[iMid] < value)
+                iLeft = iMid + 1;
+            else
+                iRight = iMid;
+        }
+        if (bUnordered) return ((iLeft < nBins) && (entry.binBorders[iLeft] == value)) ? iLeft : nBins;
+        return (iLeft < nBins) ? iLeft : nBins - 1;
+    }
+
+    //frees the indices of the features keeping the numbers of indices and bin borders,
+    //used when the indices are converted to a more compact representation
+    void releaseData();
+
     //for low-level optimization
     const IndexType * data(size_t iFeature) const { return (IndexType *)(((char *)_data) + _nRows * iFeature * _sizeOfIndex); }
 
@@ -132,6 +161,10 @@ public:
 
 protected:
     services::Status alloc(size_t nCols, size_t nRows);
+    services::Status allocEntries(size_t nCols);
+    //computes the bin borders of the features of the CSR numeric table on its non-zero values
+    template <typename algorithmFPType, CpuType cpu>
+    services::Status initBinsSparse(const NumericTable & nt, const FeatureTypes & featureTypes, const BinParams & binPrm);
 
 protected:
     IndexType * _data;
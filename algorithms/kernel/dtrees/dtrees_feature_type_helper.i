@@ -35,11 +35,77 @@ namespace dtrees
 {
 namespace internal
 {
+//////////////////////////////////////////////////////////////////////////////////////////
+// Columns of the CSR numeric table. The non-zero values are transposed once,
+// so that a column is read without the scan of the whole table.
+// Row indices of a column are zero-based and sorted in increasing order
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class SparseColumns
+{
+public:
+    SparseColumns() : _maxSize(0) {}
+
+    services::Status init(NumericTable & nt)
+    {
+        const size_t nRows = nt.getNumberOfRows();
+        const size_t nCols = nt.getNumberOfColumns();
+        daal::internal::ReadRowsCSR<algorithmFPType, cpu> csr(dynamic_cast<CSRNumericTableIface *>(&nt), 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(csr);
+        const algorithmFPType * const values = csr.values();
+        const size_t * const cols            = csr.cols();
+        const size_t * const rowOffsets      = csr.rows();
+        const size_t nValues                 = rowOffsets[nRows] - rowOffsets[0];
+
+        _colOffsets.reset(nCols + 1);
+        _values.reset(nValues);
+        _rows.reset(nValues);
+        DAAL_CHECK_MALLOC(_colOffsets.get() && (!nValues || (_values.get() && _rows.get())));
+
+        size_t * const colOffsets = _colOffsets.get();
+        services::internal::service_memset_seq<size_t, cpu>(colOffsets, 0, nCols + 1);
+        for (size_t i = 0; i < nValues; ++i) ++colOffsets[cols[i]];
+        _maxSize = 0;
+        for (size_t iCol = 0; iCol < nCols; ++iCol)
+        {
+            if (_maxSize < colOffsets[iCol + 1]) _maxSize = colOffsets[iCol + 1];
+            colOffsets[iCol + 1] += colOffsets[iCol];
+        }
+        //colOffsets[iCol] is the next free position of the column while the values are placed, then it is shifted back
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            for (size_t i = rowOffsets[iRow] - rowOffsets[0], iEnd = rowOffsets[iRow + 1] - rowOffsets[0]; i < iEnd; ++i)
+            {
+                const size_t pos = colOffsets[cols[i] - 1]++;
+                _values[pos]     = values[i];
+                _rows[pos]       = iRow;
+            }
+        }
+        for (size_t iCol = nCols; iCol > 0; --iCol) colOffsets[iCol] = colOffsets[iCol - 1];
+        colOffsets[0] = 0;
+        return services::Status();
+    }
+
+    size_t size(size_t iCol) const { return _colOffsets[iCol + 1] - _colOffsets[iCol]; }
+    size_t maxSize() const { return _maxSize; }
+    const algorithmFPType * values(size_t iCol) const { return _values.get() + _colOffsets[iCol]; }
+    const size_t * rows(size_t iCol) const { return _rows.get() + _colOffsets[iCol]; }
+
+protected:
+    TVector<size_t, cpu, DefaultAllocator<cpu> > _colOffsets;
+    TVector<algorithmFPType, cpu, DefaultAllocator<cpu> > _values;
+    TVector<size_t, cpu, DefaultAllocator<cpu> > _rows;
+    size_t _maxSize;
+};
+
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTask
 {
     DAAL_NEW_DELETE();
-    ColIndexTask(size_t nRows) : _index(nRows), maxNumDiffValues(1) {}
+    typedef SparseColumns<algorithmFPType, cpu> SparseColumnsType;
+    ColIndexTask(size_t nRows, const SparseColumnsType * sparseColumns = nullptr)
+        : _index(nRows), maxNumDiffValues(1), _sparseColumns(sparseColumns)
+    {}
     bool isValid() const { return _index.get(); }
 
     struct FeatureIdx
@@ -98,6 +164,7 @@ public:
 protected:
     Status getSorted(NumericTable & nt, size_t iCol, size_t nRows)
     {
+        if (_sparseColumns) return getSortedSparse(iCol, nRows);
         const algorithmFPType * pBlock = _block.set(&nt, iCol, 0, nRows);
         DAAL_CHECK_BLOCK_STATUS(_block);
         FeatureIdx * index = _index.get();
@@ -110,16 +177,59 @@ protected:
         return Status();
     }
 
+    //sorts the non-zero values of the column only, the zero values are placed between the negative and the positive ones
+    Status getSortedSparse(size_t iCol, size_t nRows)
+    {
+        const size_t nValues                 = _sparseColumns->size(iCol);
+        const algorithmFPType * const values = _sparseColumns->values(iCol);
+        const size_t * const rows            = _sparseColumns->rows(iCol);
+        FeatureIdx * index                   = _index.get();
+        for (size_t i = 0; i < nValues; ++i)
+        {
+            index[i].key = values[i];
+            index[i].val = rows[i];
+        }
+        if (nValues > 1) daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nValues, index);
+
+        size_t nNegative = 0;
+        for (; (nNegative < nValues) && (index[nNegative].key < 0); ++nNegative)
+            ;
+        size_t nPositive = 0;
+        for (; (nPositive < nValues - nNegative) && (index[nValues - 1 - nPositive].key > 0); ++nPositive)
+            ;
+        //move the positive values to the end, the stored zero values stay in place
+        for (size_t i = 0; i < nPositive; ++i) index[nRows - 1 - i] = index[nValues - 1 - i];
+
+        //the rows that are absent in the column follow the stored zero values
+        size_t iZero = nValues - nPositive;
+        for (size_t iRow = 0, i = 0; iRow < nRows; ++iRow)
+        {
+            if ((i < nValues) && (rows[i] == iRow))
+            {
+                ++i;
+                continue;
+            }
+            index[iZero].key = algorithmFPType(0);
+            index[iZero].val = iRow;
+            ++iZero;
+        }
+        DAAL_ASSERT(iZero == nRows - nPositive);
+        return Status();
+    }
+
 protected:
     daal::internal::ReadColumns<algorithmFPType, cpu> _block;
     TVector<FeatureIdx, cpu, DefaultAllocator<cpu> > _index;
+    const SparseColumnsType * _sparseColumns;
 };
 
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTaskBins : public ColIndexTask<IndexType, algorithmFPType, cpu>
 {
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> super;
-    ColIndexTaskBins(size_t nRows, const BinParams & prm) : super(nRows), _prm(prm), _bins(_prm.maxBins) {}
+    ColIndexTaskBins(size_t nRows, const BinParams & prm, const typename super::SparseColumnsType * sparseColumns = nullptr)
+        : super(nRows, sparseColumns), _prm(prm), _bins(_prm.maxBins)
+    {}
     virtual services::Status makeIndex(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                        bool bUnorderedFeature) DAAL_C11_OVERRIDE;
 
@@ -293,6 +403,151 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     return assignIndexAccordingToBins(entry, aRes, nBins, nRows);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Computes the bin borders of a feature on a sample of the data.
+// The features that are not binned get the borders equal to their unique values,
+// unordered features get an extra bin for the values that are absent in the sample
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename IndexType, typename algorithmFPType, CpuType cpu>
+struct ColBinBordersTask : public ColIndexTaskBins<IndexType, algorithmFPType, cpu>
+{
+    typedef ColIndexTaskBins<IndexType, algorithmFPType, cpu> super;
+    ColBinBordersTask(size_t nRows, const BinParams & prm) : super(nRows, prm), _aIdx(nRows) {}
+    bool isValid() const { return super::isValid() && _aIdx.get(); }
+
+    services::Status makeBorders(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, size_t iCol, size_t nRows, bool bUnorderedFeature)
+    {
+        services::Status s = this->makeIndex(nt, entry, _aIdx.get(), iCol, nRows, bUnorderedFeature);
+        if (!s || entry.binBorders) return s;
+
+        const typename super::FeatureIdx * index = this->_index.get();
+        const IndexType nUnique                  = entry.numIndices;
+        entry.numIndices                         = bUnorderedFeature ? nUnique + 1 : nUnique;
+        s                                        = entry.allocBorders();
+        if (!s) return s;
+
+        for (size_t i = 0; i < nRows; ++i) entry.binBorders[_aIdx[index[i].val]] = index[i].key;
+        if (bUnorderedFeature) entry.binBorders[nUnique] = index[nRows - 1].key; //never used for the split
+        if (this->maxNumDiffValues < entry.numIndices) this->maxNumDiffValues = entry.numIndices;
+        return s;
+    }
+
+protected:
+    TVector<IndexType, cpu, DefaultAllocator<cpu> > _aIdx;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Computes the bin borders of a feature of the CSR numeric table.
+// The sorted non-zero values are merged with the zero values that are not stored into
+// the runs of equal values, so the cost does not depend on the number of rows
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+struct ColSparseBordersTask
+{
+    DAAL_NEW_DELETE();
+    ColSparseBordersTask(size_t maxColumnSize, const BinParams & prm)
+        : _prm(prm), _sorted(maxColumnSize + 1), _runValues(maxColumnSize + 1), _runSizes(maxColumnSize + 1), _borders(prm.maxBins),
+          maxNumDiffValues(1)
+    {}
+    bool isValid() const { return _sorted.get() && _runValues.get() && _runSizes.get() && _borders.get(); }
+
+    services::Status makeBorders(const SparseColumns<algorithmFPType, cpu> & columns, IndexedFeatures::FeatureEntry & entry, size_t iCol,
+                                 size_t nRows, bool bUnorderedFeature)
+    {
+        const size_t nRuns = makeRuns(columns, iCol, nRows);
+        if (bUnorderedFeature || nRows <= _prm.maxBins * _prm.minBinSize)
+        {
+            //every unique value is a bin, unordered features get an extra bin for the values that are absent in the data
+            entry.numIndices   = bUnorderedFeature ? nRuns + 1 : nRuns;
+            services::Status s = entry.allocBorders();
+            if (!s) return s;
+            for (size_t i = 0; i < nRuns; ++i) entry.binBorders[i] = _runValues[i];
+            if (bUnorderedFeature) entry.binBorders[nRuns] = _runValues[nRuns - 1]; //never used for the split
+        }
+        else
+        {
+            const size_t nBins = makeBins(nRuns, nRows);
+            entry.numIndices   = nBins;
+            services::Status s = entry.allocBorders();
+            if (!s) return s;
+            for (size_t i = 0; i < nBins; ++i) entry.binBorders[i] = _borders[i];
+        }
+        if (maxNumDiffValues < size_t(entry.numIndices)) maxNumDiffValues = entry.numIndices;
+        return services::Status();
+    }
+
+public:
+    size_t maxNumDiffValues;
+
+protected:
+    //fills the values and the sizes of the runs of equal values in increasing order, returns the number of the runs
+    size_t makeRuns(const SparseColumns<algorithmFPType, cpu> & columns, size_t iCol, size_t nRows)
+    {
+        const size_t nValues           = columns.size(iCol);
+        algorithmFPType * sorted       = _sorted.get();
+        const algorithmFPType * values = columns.values(iCol);
+        for (size_t i = 0; i < nValues; ++i) sorted[i] = values[i];
+        //the zero values that are not stored
+        const size_t nZeros = nRows - nValues;
+        if (nZeros) sorted[nValues] = algorithmFPType(0);
+        const size_t n = nValues + !!nZeros;
+        if (n > 1) daal::algorithms::internal::qSort<algorithmFPType, cpu>(n, sorted);
+
+        size_t nRuns = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const size_t size = (sorted[i] == algorithmFPType(0)) && nZeros && (!i || sorted[i - 1] != sorted[i]) ? nZeros : 1;
+            if (nRuns && (_runValues[nRuns - 1] == sorted[i]))
+            {
+                _runSizes[nRuns - 1] += size;
+                continue;
+            }
+            _runValues[nRuns] = sorted[i];
+            _runSizes[nRuns]  = size;
+            ++nRuns;
+        }
+        return nRuns;
+    }
+
+    //splits the runs into the bins of about equal size, the borders are placed between different values only.
+    //A run that is much bigger than the bin gets its own bin if the values before it fill a bin of at least minBinSize
+    size_t makeBins(size_t nRuns, size_t nRows)
+    {
+        const size_t binSize = nRows / _prm.maxBins;
+        size_t nBins         = 0;
+        size_t size          = 0;
+        for (size_t i = 0; i < nRuns; ++i)
+        {
+            if (size && (nBins < _prm.maxBins) && (size + _runSizes[i] >= 2 * binSize) && (size > _prm.minBinSize))
+            {
+                _borders[nBins++] = _runValues[i - 1];
+                size              = 0;
+            }
+            size += _runSizes[i];
+            if ((size >= binSize) && (nBins < _prm.maxBins))
+            {
+                _borders[nBins++] = _runValues[i];
+                size              = 0;
+            }
+        }
+        if (size)
+        {
+            if (!nBins || ((nBins < _prm.maxBins) && (size >= _prm.minBinSize)))
+                _borders[nBins++] = _runValues[nRuns - 1];
+            else
+                _borders[nBins - 1] = _runValues[nRuns - 1];
+        }
+        return nBins;
+    }
+
+protected:
+    const BinParams _prm;
+    TVector<algorithmFPType, cpu, DefaultAllocator<cpu> > _sorted;
+    TVector<algorithmFPType, cpu, DefaultAllocator<cpu> > _runValues;
+    TVector<size_t, cpu, DefaultAllocator<cpu> > _runSizes;
+    TVector<ModelFPType, cpu, DefaultAllocator<cpu> > _borders;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTypes * featureTypes, const BinParams * pBimPrm)
 {
@@ -313,9 +568,19 @@ services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTyp
     typedef ColIndexTask<IndexType, algorithmFPType, cpu> DefaultTask;
     typedef ColIndexTaskBins<IndexType, algorithmFPType, cpu> BinningTask;
 
+    //the columns of the CSR numeric table are transposed once instead of the scan of the table per column
+    SparseColumns<algorithmFPType, cpu> sparseColumns;
+    const SparseColumns<algorithmFPType, cpu> * pSparseColumns = nullptr;
+    if (nt.getDataLayout() == NumericTableIface::csrArray)
+    {
+        s = sparseColumns.init(const_cast<NumericTable &>(nt));
+        if (!s) return s;
+        pSparseColumns = &sparseColumns;
+    }
+
     daal::tls<TlsTask *> tlsData([=, &nt]() -> TlsTask * {
         const size_t nRows = nt.getNumberOfRows();
-        TlsTask * res      = (pBimPrm ? new BinningTask(nRows, *pBimPrm) : new DefaultTask(nRows));
+        TlsTask * res      = (pBimPrm ? new BinningTask(nRows, *pBimPrm, pSparseColumns) : new DefaultTask(nRows, pSparseColumns));
         if (res && !res->isValid())
         {
             delete res;
@@ -339,6 +604,76 @@ services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTyp
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status IndexedFeatures::initBins(const NumericTable & sample, size_t nRows, const FeatureTypes & featureTypes, const BinParams & binPrm)
+{
+    _maxNumIndices = 0;
+    releaseData();
+    services::Status s = allocEntries(sample.getNumberOfColumns());
+    if (!s) return s;
+    _nRows = nRows;
+
+    const size_t nC       = sample.getNumberOfColumns();
+    const size_t nSampleR = sample.getNumberOfRows();
+    if (sample.getDataLayout() == NumericTableIface::csrArray) return initBinsSparse<algorithmFPType, cpu>(sample, featureTypes, binPrm);
+    typedef ColBinBordersTask<IndexType, algorithmFPType, cpu> TlsTask;
+
+    daal::tls<TlsTask *> tlsData([=]() -> TlsTask * {
+        TlsTask * res = new TlsTask(nSampleR, binPrm);
+        if (res && !res->isValid())
+        {
+            delete res;
+            res = nullptr;
+        }
+        return res;
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nC, nC, [&](size_t iCol) {
+        TlsTask * task = tlsData.local();
+        DAAL_CHECK_THR(task, services::ErrorMemoryAllocationFailed);
+        safeStat |= task->makeBorders(const_cast<NumericTable &>(sample), _entries[iCol], iCol, nSampleR, featureTypes.isUnordered(iCol));
+    });
+    tlsData.reduce([&](TlsTask * task) -> void {
+        if (_maxNumIndices < task->maxNumDiffValues) _maxNumIndices = task->maxNumDiffValues;
+        delete task;
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status IndexedFeatures::initBinsSparse(const NumericTable & sample, const FeatureTypes & featureTypes, const BinParams & binPrm)
+{
+    const size_t nC       = sample.getNumberOfColumns();
+    const size_t nSampleR = sample.getNumberOfRows();
+    SparseColumns<algorithmFPType, cpu> columns;
+    services::Status s = columns.init(const_cast<NumericTable &>(sample));
+    if (!s) return s;
+
+    typedef ColSparseBordersTask<algorithmFPType, cpu> TlsTask;
+    daal::tls<TlsTask *> tlsData([=, &columns]() -> TlsTask * {
+        TlsTask * res = new TlsTask(columns.maxSize(), binPrm);
+        if (res && !res->isValid())
+        {
+            delete res;
+            res = nullptr;
+        }
+        return res;
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nC, nC, [&](size_t iCol) {
+        TlsTask * task = tlsData.local();
+        DAAL_CHECK_THR(task, services::ErrorMemoryAllocationFailed);
+        safeStat |= task->makeBorders(columns, _entries[iCol], iCol, nSampleR, featureTypes.isUnordered(iCol));
+    });
+    tlsData.reduce([&](TlsTask * task) -> void {
+        if (_maxNumIndices < task->maxNumDiffValues) _maxNumIndices = task->maxNumDiffValues;
+        delete task;
+    });
+    return safeStat.detach();
+}
+
 } /* namespace internal */
 } /* namespace dtrees */
 } /* namespace algorithms */
@@ -46,12 +46,14 @@ ModelImpl::~ModelImpl()
 void ModelImpl::destroy()
 {
     _serializationData.reset();
+    resetFlatForests();
 }
 
 bool ModelImpl::reserve(const size_t nTrees)
 {
     if (_serializationData.get()) return false;
     _nTree.set(0);
+    resetFlatForests();
     _serializationData.reset(new DataCollection());
     _serializationData->resize(nTrees);
 
@@ -71,6 +73,7 @@ bool ModelImpl::resize(const size_t nTrees)
 {
     if (_serializationData.get()) return false;
     _nTree.set(0);
+    resetFlatForests();
     _serializationData.reset(new DataCollection(nTrees));
     _impurityTables.reset(new DataCollection(nTrees));
     _nNodeSampleTables.reset(new DataCollection(nTrees));
@@ -89,6 +92,7 @@ void ModelImpl::clear()
     if (_probTbl.get()) _probTbl.reset();
 
     _nTree.set(0);
+    resetFlatForests();
 }
 
 void MemoryManager::destroy()
@@ -30,6 +30,7 @@
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "service_memory.h"
+#include "service_threading.h"
 
 typedef size_t ClassIndexType;
 typedef double ModelFPType;
@@ -91,27 +92,27 @@ public:
     ClassifierResponse & operator=(const ClassifierResponse & o) = delete;
 };
 
+//Nodes are not polymorphic, the type of the node is defined by the tag stored in the base
 struct TreeNodeBase
 {
-    virtual ~TreeNodeBase() {}
-    virtual bool isSplit() const       = 0;
-    virtual size_t numChildren() const = 0;
+    DAAL_FORCEINLINE bool isSplit() const { return bSplit; }
 
-    TreeNodeBase() : count(0), impurity(0) {}
+    TreeNodeBase(bool bIsSplit) : count(0), impurity(0), bSplit(bIsSplit) {}
     size_t count;
     double impurity;
+    bool bSplit; //split: true, leaf: false
 };
 
 template <typename algorithmFPType>
 struct TreeNodeSplit : public TreeNodeBase
 {
     typedef algorithmFPType FeatureType;
+    bool featureUnordered; //placed first to reuse the tail padding of the base
+    int featureIdx;
     FeatureType featureValue;
     TreeNodeBase * kid[2];
-    int featureIdx;
-    bool featureUnordered;
 
-    TreeNodeSplit() { kid[0] = kid[1] = nullptr; }
+    TreeNodeSplit() : TreeNodeBase(true) { kid[0] = kid[1] = nullptr; }
     const TreeNodeBase * left() const { return kid[0]; }
     const TreeNodeBase * right() const { return kid[1]; }
     TreeNodeBase * left() { return kid[0]; }
@@ -124,8 +125,6 @@ struct TreeNodeSplit : public TreeNodeBase
         featureIdx       = featIdx;
         featureUnordered = bUnordered;
     }
-    virtual bool isSplit() const { return true; }
-    virtual size_t numChildren() const { return (kid[0] ? kid[0]->numChildren() + 1 : 0) + (kid[1] ? kid[1]->numChildren() + 1 : 0); }
 };
 
 template <typename TResponseType>
@@ -134,15 +133,10 @@ struct TreeNodeLeaf : public TreeNodeBase
     TResponseType response;
     double * hist;
 
-    TreeNodeLeaf() {}
+    TreeNodeLeaf() : TreeNodeBase(false) {}
 
     // nCLasses = 0 for regression
-    TreeNodeLeaf(double * memoryForHist) : hist(memoryForHist) {}
-
-    virtual ~TreeNodeLeaf() {}
-
-    virtual bool isSplit() const { return false; }
-    virtual size_t numChildren() const { return 0; }
+    TreeNodeLeaf(double * memoryForHist) : TreeNodeBase(false), hist(memoryForHist) {}
 };
 
 template <typename algorithmFPType>
@@ -197,7 +191,10 @@ typename NodeType::Split * HeapMemoryAllocator<NodeType>::allocSplit()
 template <typename NodeType>
 void HeapMemoryAllocator<NodeType>::free(typename NodeType::Base * n)
 {
-    delete n;
+    if (n->isSplit())
+        delete NodeType::castSplit(n);
+    else
+        delete NodeType::castLeaf(n);
 }
 
 class MemoryManager
@@ -271,6 +268,14 @@ void deleteNode(typename NodeType::Base * n, Allocator & a)
     a.free(n);
 }
 
+template <typename NodeType>
+size_t numChildren(const typename NodeType::Base * n)
+{
+    if (!n->isSplit()) return 0;
+    const typename NodeType::Split * s = NodeType::castSplit(n);
+    return (s->left() ? numChildren<NodeType>(s->left()) + 1 : 0) + (s->right() ? numChildren<NodeType>(s->right()) + 1 : 0);
+}
+
 class Tree : public Base
 {
 public:
@@ -302,7 +307,7 @@ public:
     const typename NodeType::Base * top() const { return _top; }
     Allocator & allocator() { return _allocator; }
     bool hasUnorderedFeatureSplits() const { return _hasUnorderedFeatureSplits; }
-    size_t getNumberOfNodes() const { return top() ? top()->numChildren() + 1 : 0; }
+    size_t getNumberOfNodes() const { return top() ? numChildren<NodeType>(top()) + 1 : 0; }
     void convertToTable(DecisionTreeTable * treeTable, data_management::HomogenNumericTable<double> * impurities,
                         data_management::HomogenNumericTable<int> * nNodeSamples, data_management::HomogenNumericTable<double> * prob,
                         size_t nClasses) const;
@@ -448,6 +453,17 @@ static services::Status addLeafNodeInternal(data_management::DataCollectionPtr &
     return s;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Base class of the representations of the trees built from the model for the prediction
+//////////////////////////////////////////////////////////////////////////////////////////
+class FlatForestIface
+{
+public:
+    DAAL_NEW_DELETE();
+    virtual ~FlatForestIface() {}
+};
+typedef services::SharedPtr<FlatForestIface> FlatForestIfacePtr;
+
 class ModelImpl
 {
 public:
@@ -478,6 +494,40 @@ public:
         return _probTbl ? ((const data_management::HomogenNumericTable<double> *)(*_probTbl)[i].get())->getArray() : nullptr;
     }
 
+    //Returns the flattened trees of the model for the prediction on the data of algorithmFPType.
+    //The trees are flattened on the first call and are kept in the model until its trees are changed
+    template <typename algorithmFPType, typename FlatForestType>
+    services::SharedPtr<const FlatForestType> getFlatForest(services::Status & s) const
+    {
+        AUTOLOCK(_flatForestLock);
+        FlatForestIfacePtr & cached = _flatForest[IsSameType<algorithmFPType, float>::value ? 0 : 1];
+        if (!dynamic_cast<FlatForestType *>(cached.get()))
+        {
+            FlatForestType * forest = new FlatForestType();
+            if (!forest)
+            {
+                s = services::Status(services::ErrorMemoryAllocationFailed);
+                return services::SharedPtr<const FlatForestType>();
+            }
+            s = forest->init(*this);
+            if (!s)
+            {
+                delete forest;
+                return services::SharedPtr<const FlatForestType>();
+            }
+            cached.reset(forest);
+        }
+        return services::staticPointerCast<const FlatForestType>(cached);
+    }
+
+    //Drops the flattened trees, must be called on every change of the trees of the model
+    void resetFlatForests()
+    {
+        AUTOLOCK(_flatForestLock);
+        _flatForest[0].reset();
+        _flatForest[1].reset();
+    }
+
 protected:
     void destroy();
     template <typename Archive, bool onDeserialize>
@@ -495,7 +545,11 @@ protected:
             arch->setSharedPtrObj(_probTbl);
         }
 
-        if (onDeserialize) _nTree.set(_serializationData->size());
+        if (onDeserialize)
+        {
+            _nTree.set(_serializationData->size());
+            resetFlatForests();
+        }
 
         return services::Status();
     }
@@ -507,6 +561,9 @@ protected:
     data_management::DataCollectionPtr _impurityTables;
     data_management::DataCollectionPtr _nNodeSampleTables;
     data_management::DataCollectionPtr _probTbl;
+
+    mutable daal::Mutex _flatForestLock;
+    mutable FlatForestIfacePtr _flatForest[2]; //flattened trees for float and double data
 };
 
 template <typename NodeType, typename Allocator>
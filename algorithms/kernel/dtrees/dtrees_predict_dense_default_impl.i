@@ -29,6 +29,10 @@
 #include "service_data_utils.h"
 #include "dtrees_feature_type_helper.h"
 #include "service_environment.h"
+#include "service_arrays.h"
+#include "service_defines.h"
+#include "service_numeric_table.h"
+#include "service_threading.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -110,6 +114,258 @@ const DecisionTreeNode * findNode(const dtrees::internal::DecisionTreeTable & t,
     return pNode;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Converts split point stored in the model to the type of the input data.
+// The value is rounded towards minus infinity so that comparison x > splitPoint gives
+// the same result as the comparison with the split point in the model type
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType>
+struct SplitPoint
+{
+    static algorithmFPType get(ModelFPType val) { return algorithmFPType(val); }
+};
+
+template <>
+struct SplitPoint<float>
+{
+    static float get(ModelFPType val)
+    {
+        _daal_sp_union_t res;
+        res.fp = float(val);
+        if (ModelFPType(res.fp) > val)
+        {
+            //one ulp towards minus infinity
+            if (res.fp > 0.f)
+                --res.hex[0];
+            else if (res.fp < 0.f)
+                ++res.hex[0];
+            else
+                res.hex[0] = 0x80000001;
+        }
+        return res.fp;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Flattened representation of a decision tree used for inference.
+// Nodes are packed breadth-first, so the top levels visited by every observation
+// occupy a few contiguous cache lines. Kids of a split node are adjacent.
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType>
+struct FlatTree
+{
+    typedef int32_t FeatureIndexType;
+    typedef int32_t NodeIndexType;
+
+    const FeatureIndexType * featureIndex;          //split: index of the feature, leaf: -1
+    const NodeIndexType * leftIndexOrClass;         //split: index of the left kid in this tree, classification leaf: class index
+    const algorithmFPType * featureValueOrResponse; //split: feature value, regression tree leaf: response
+    const NodeIndexType * sourceIndex;              //index of the node in the DecisionTreeTable
+    size_t nNodes;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Flattened trees of the model stored in the common buffers.
+// Built once per model and floating-point type, see ModelImpl::getFlatForest
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class FlatForest : public FlatForestIface
+{
+public:
+    typedef FlatTree<algorithmFPType> TreeType;
+    typedef typename TreeType::FeatureIndexType FeatureIndexType;
+    typedef typename TreeType::NodeIndexType NodeIndexType;
+
+    services::Status init(const dtrees::internal::ModelImpl & model)
+    {
+        const size_t nTrees = model.size();
+        size_t nNodesTotal  = 0;
+        for (size_t i = 0; i < nTrees; ++i) nNodesTotal += model.at(i)->getNumberOfRows();
+        DAAL_CHECK(nNodesTotal <= size_t(services::internal::MaxVal<int>::get()), services::ErrorBufferSizeIntegerOverflow);
+
+        _aTree.reset(nTrees);
+        _featureIndex.reset(nNodesTotal);
+        _leftIndexOrClass.reset(nNodesTotal);
+        _featureValueOrResponse.reset(nNodesTotal);
+        _sourceIndex.reset(nNodesTotal);
+        DAAL_CHECK_MALLOC(_aTree.get() && _featureIndex.get() && _leftIndexOrClass.get() && _featureValueOrResponse.get() && _sourceIndex.get());
+
+        size_t iFirstNode = 0;
+        for (size_t i = 0; i < nTrees; ++i)
+        {
+            TreeType & t = _aTree[i];
+            DAAL_CHECK(flatten(*model.at(i), iFirstNode, t), services::ErrorModelNotFullInitialized);
+            iFirstNode += t.nNodes;
+        }
+        return services::Status();
+    }
+
+    size_t size() const { return _aTree.size(); }
+    const TreeType & operator[](size_t i) const { return _aTree[i]; }
+
+    //size of the node data accessed on the traversal of the tree
+    static size_t nodeSize() { return sizeof(FeatureIndexType) + sizeof(NodeIndexType) + sizeof(algorithmFPType); }
+
+protected:
+    //breadth-first traversal of the table, the array of source indices is used as the queue
+    bool flatten(const DecisionTreeTable & table, size_t iFirstNode, TreeType & t)
+    {
+        const DecisionTreeNode * aNode = (const DecisionTreeNode *)table.getArray();
+        const size_t nNodes            = table.getNumberOfRows();
+        FeatureIndexType * fi          = _featureIndex.get() + iFirstNode;
+        NodeIndexType * lc             = _leftIndexOrClass.get() + iFirstNode;
+        algorithmFPType * fv           = _featureValueOrResponse.get() + iFirstNode;
+        NodeIndexType * src            = _sourceIndex.get() + iFirstNode;
+
+        t.featureIndex           = fi;
+        t.leftIndexOrClass       = lc;
+        t.featureValueOrResponse = fv;
+        t.sourceIndex            = src;
+        t.nNodes                 = 0;
+        if (!nNodes || !aNode) return true;
+
+        size_t nQueued = 1;
+        src[0]         = 0;
+        for (size_t i = 0; i < nQueued; ++i)
+        {
+            const DecisionTreeNode & node = aNode[src[i]];
+            fi[i]                         = node.featureIndex;
+            if (node.isSplit())
+            {
+                if (node.leftIndexOrClass == 0 || node.leftIndexOrClass + 1 >= nNodes || nQueued + 2 > nNodes) return false;
+                lc[i]            = NodeIndexType(nQueued);
+                fv[i]            = SplitPoint<algorithmFPType>::get(node.featureValue());
+                src[nQueued]     = NodeIndexType(node.leftIndexOrClass);
+                src[nQueued + 1] = NodeIndexType(node.leftIndexOrClass + 1);
+                nQueued += 2;
+            }
+            else
+            {
+                lc[i] = NodeIndexType(node.leftIndexOrClass);
+                fv[i] = algorithmFPType(node.featureValueOrResponse);
+            }
+        }
+        t.nNodes = nQueued;
+        return true;
+    }
+
+protected:
+    TArray<TreeType, cpu> _aTree;
+    TArray<FeatureIndexType, cpu> _featureIndex;
+    TArray<NodeIndexType, cpu> _leftIndexOrClass;
+    TArray<algorithmFPType, cpu> _featureValueOrResponse;
+    TArray<NodeIndexType, cpu> _sourceIndex;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Finds a leaf of the flattened tree corresponding to the given observation
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+typename FlatTree<algorithmFPType>::NodeIndexType findNode(const FlatTree<algorithmFPType> & t, const FeatureTypes & featTypes,
+                                                           const algorithmFPType * x)
+{
+    typedef typename FlatTree<algorithmFPType>::NodeIndexType NodeIndexType;
+    const typename FlatTree<algorithmFPType>::FeatureIndexType * const fi = t.featureIndex;
+    const NodeIndexType * const lc                                        = t.leftIndexOrClass;
+    const algorithmFPType * const fv                                      = t.featureValueOrResponse;
+    NodeIndexType iNode                                                   = 0;
+    if (featTypes.hasUnorderedFeatures())
+    {
+        for (; fi[iNode] != -1;)
+        {
+            const NodeIndexType sn =
+                (featTypes.isUnordered(fi[iNode]) ? (int(x[fi[iNode]]) != int(fv[iNode])) : (x[fi[iNode]] > fv[iNode]));
+            iNode = lc[iNode] + sn;
+        }
+    }
+    else
+    {
+        for (; fi[iNode] != -1;)
+        {
+            const NodeIndexType sn = x[fi[iNode]] > fv[iNode];
+            iNode                  = lc[iNode] + sn;
+        }
+    }
+    return iNode;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Finds leaves of the flattened tree for the block of observations.
+// Observations are moved through the tree level by level, supports ordered features only
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+void findNodes(const FlatTree<algorithmFPType> & t, const algorithmFPType * x, size_t nRows, size_t nCols,
+               typename FlatTree<algorithmFPType>::NodeIndexType * aNode)
+{
+    typedef typename FlatTree<algorithmFPType>::NodeIndexType NodeIndexType;
+    typedef typename FlatTree<algorithmFPType>::FeatureIndexType FeatureIndexType;
+    const FeatureIndexType * const fi = t.featureIndex;
+    const NodeIndexType * const lc    = t.leftIndexOrClass;
+    const algorithmFPType * const fv  = t.featureValueOrResponse;
+
+    for (size_t i = 0; i < nRows; ++i) aNode[i] = 0;
+    for (size_t nSplits = (fi[0] != -1) ? nRows : 0; nSplits > 0;)
+    {
+        nSplits = 0;
+        PRAGMA_IVDEP
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const NodeIndexType iNode    = aNode[i];
+            const FeatureIndexType iFeat = fi[iNode];
+            const bool bSplit            = (iFeat != -1);
+            const NodeIndexType sn       = x[i * nCols + (bSplit ? iFeat : 0)] > fv[iNode];
+            aNode[i]                     = bSplit ? lc[iNode] + sn : iNode;
+            nSplits += bSplit;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Rows of the CSR numeric table for the prediction. Non-zero values of a row are scattered
+// into the thread local row of zeros and are reset after the row is processed,
+// so the cost of the row depends on the number of its non-zero values only
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class SparseRows
+{
+public:
+    typedef daal::TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > RowTls;
+
+    SparseRows(const NumericTable & data)
+        : _data(data.getDataLayout() == NumericTableIface::csrArray ? dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&data)) :
+                                                                     nullptr),
+          _row(data.getNumberOfColumns())
+    {}
+
+    bool isSparse() const { return _data != nullptr; }
+
+    //calls func(iRow, x) for every row of the block, x is the dense row
+    template <typename Func>
+    services::Status forEach(size_t iStartRow, size_t nRows, const Func & func)
+    {
+        algorithmFPType * const x = _row.local();
+        DAAL_CHECK_MALLOC(x);
+        ReadRowsCSR<algorithmFPType, cpu> xBD(_data, iStartRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(xBD);
+        const algorithmFPType * const values = xBD.values();
+        const size_t * const cols            = xBD.cols();
+        const size_t * const rowOffsets      = xBD.rows();
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            const size_t iBegin = rowOffsets[iRow] - rowOffsets[0];
+            const size_t iEnd   = rowOffsets[iRow + 1] - rowOffsets[0];
+            for (size_t i = iBegin; i < iEnd; ++i) x[cols[i] - 1] = values[i];
+            func(iRow, x);
+            for (size_t i = iBegin; i < iEnd; ++i) x[cols[i] - 1] = algorithmFPType(0);
+        }
+        return services::Status();
+    }
+
+private:
+    CSRNumericTableIface * _data;
+    RowTls _row;
+};
+
 template <typename algorithmFPType>
 struct TileDimensions
 {
@@ -131,6 +131,70 @@ struct SResponse
     IndexType idx;
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Keeps work buffers used by the split search of response-specific helpers.
+// In sequential mode a single set of buffers is used, in parallel mode every concurrent
+// split search acquires its own set of buffers from the local storage
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename WorkBuffers>
+class WorkBuffersHolder
+{
+public:
+    template <typename... Args>
+    explicit WorkBuffersHolder(Args... args) : _main(args...), _ls(nullptr)
+    {}
+    ~WorkBuffersHolder() { setParallelMode(false); }
+
+    WorkBuffers & main() { return _main; }
+    bool isParallelMode() const { return _ls != nullptr; }
+
+    //returns nullptr if buffers could not be allocated
+    WorkBuffers * acquire() { return _ls ? _ls->local() : &_main; }
+    void release(WorkBuffers * p)
+    {
+        if (_ls && p) _ls->release(p);
+    }
+
+    //buffers acquired in parallel mode have the same sizes as the main ones
+    bool setParallelMode(bool bParallel)
+    {
+        if (_ls)
+        {
+            _ls->reduce([](WorkBuffers * p) -> void { delete p; });
+            delete _ls;
+            _ls = nullptr;
+        }
+        if (!bParallel) return true;
+        _ls = new daal::ls<WorkBuffers *>([=]() -> WorkBuffers * {
+            WorkBuffers * p = new WorkBuffers();
+            if (p && !p->reserveAs(this->_main))
+            {
+                delete p;
+                p = nullptr;
+            }
+            return p;
+        });
+        return _ls != nullptr;
+    }
+
+private:
+    WorkBuffers _main;
+    daal::ls<WorkBuffers *> * _ls;
+};
+
+template <typename WorkBuffers>
+class WorkBuffersLock
+{
+public:
+    WorkBuffersLock(WorkBuffersHolder<WorkBuffers> & holder) : _holder(holder), _p(holder.acquire()) {}
+    ~WorkBuffersLock() { _holder.release(_p); }
+    WorkBuffers * get() const { return _p; }
+
+private:
+    WorkBuffersHolder<WorkBuffers> & _holder;
+    WorkBuffers * _p;
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // DataHelper. Base class for response-specific services classes.
 // Keeps indices of the bootstrap samples and provides optimal access to columns in case
@@ -140,6 +204,8 @@ template <typename algorithmFPType, CpuType cpu>
 class DataHelperBase
 {
 public:
+    typedef SparseColumns<algorithmFPType, cpu> SparseColumnsType;
+
     DataHelperBase(const dtrees::internal::IndexedFeatures * indexedFeatures) : _indexedFeatures(indexedFeatures) {}
     const NumericTable * data() const { return _data; }
     const dtrees::internal::IndexedFeatures & indexedFeatures() const
@@ -154,9 +220,12 @@ public:
         const HomogenNumericTable<algorithmFPType> * hmg = dynamic_cast<const HomogenNumericTable<algorithmFPType> *>(data);
         _dataDirect                                      = (hmg ? hmg->getArray() : nullptr);
     }
+    //columns of the CSR numeric table transposed once, they are read instead of the table
+    void setSparseColumns(const SparseColumnsType * sparseColumns) { _sparseColumns = sparseColumns; }
     algorithmFPType getValue(size_t iCol, size_t iRow) const
     {
         if (_dataDirect) return _dataDirect[iRow * _nCols + iCol];
+        if (_sparseColumns) return findSparseValue(_sparseColumns->rows(iCol), _sparseColumns->values(iCol), _sparseColumns->size(iCol), iRow);
 
         data_management::BlockDescriptor<algorithmFPType> bd;
         _data->getBlockOfColumnValues(iCol, iRow, 1, readOnly, bd);
@@ -165,11 +234,29 @@ public:
         return val;
     }
 
+protected:
+    //binary search of the row in the sorted row indices of the non-zero values of a sparse column
+    static algorithmFPType findSparseValue(const size_t * rows, const algorithmFPType * values, size_t nValues, size_t iRow)
+    {
+        size_t iFirst = 0;
+        size_t iLast  = nValues;
+        while (iFirst < iLast)
+        {
+            const size_t iMid = (iFirst + iLast) / 2;
+            if (rows[iMid] < iRow)
+                iFirst = iMid + 1;
+            else
+                iLast = iMid;
+        }
+        return (iFirst < nValues && rows[iFirst] == iRow) ? values[iFirst] : algorithmFPType(0);
+    }
+
 protected:
     const dtrees::internal::IndexedFeatures * _indexedFeatures;
-    const algorithmFPType * _dataDirect = nullptr;
-    NumericTable * _data                = nullptr;
-    size_t _nCols                       = 0;
+    const algorithmFPType * _dataDirect      = nullptr;
+    NumericTable * _data                     = nullptr;
+    size_t _nCols                            = 0;
+    const SparseColumnsType * _sparseColumns = nullptr;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -234,6 +321,14 @@ public:
                 aVal[i]              = this->_dataDirect[iRow * this->_nCols + iCol];
             }
         }
+        else if (this->_sparseColumns)
+        {
+            //the column is located once for all the observations of the node
+            const size_t * const rows            = this->_sparseColumns->rows(iCol);
+            const algorithmFPType * const values = this->_sparseColumns->values(iCol);
+            const size_t nValues                 = this->_sparseColumns->size(iCol);
+            for (size_t i = 0; i < n; ++i) aVal[i] = super::findSparseValue(rows, values, nValues, getObsIdx(aIdx[i]));
+        }
         else
         {
             data_management::BlockDescriptor<algorithmFPType> bd;
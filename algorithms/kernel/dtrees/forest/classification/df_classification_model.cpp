@@ -215,6 +215,7 @@ services::Status ModelImpl::deserializeImpl(const data_management::OutputDataArc
 bool ModelImpl::add(const TreeType & tree, size_t nClasses)
 {
     DAAL_CHECK_STATUS_VAR(!(size() >= _serializationData->size()));
+    resetFlatForests();
     size_t i           = _nTree.inc();
     const size_t nNode = tree.getNumberOfNodes();
 
@@ -60,6 +60,7 @@ services::Status ModelBuilder::createTreeInternal(size_t nNodes, TreeId & resId)
 {
     decision_forest::classification::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<decision_forest::classification::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetFlatForests();
     return daal::algorithms::dtrees::internal::createTreeInternal(modelImplRef._serializationData, nNodes, resId);
 }
 
@@ -67,6 +68,7 @@ services::Status ModelBuilder::addLeafNodeInternal(TreeId treeId, NodeId parentI
 {
     decision_forest::classification::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<decision_forest::classification::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetFlatForests();
     return daal::algorithms::dtrees::internal::addLeafNodeInternal<size_t>(modelImplRef._serializationData, treeId, parentId, position, classLabel,
                                                                            res);
 }
@@ -76,6 +78,7 @@ services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parent
 {
     decision_forest::classification::internal::ModelImpl & modelImplRef =
         daal::algorithms::dtrees::internal::getModelRef<decision_forest::classification::internal::ModelImpl, ModelPtr>(_model);
+    modelImplRef.resetFlatForests();
     return daal::algorithms::dtrees::internal::addSplitNodeInternal(modelImplRef._serializationData, treeId, parentId, position, featureIndex,
                                                                     featureValue, res);
 }
@@ -71,6 +71,8 @@ class PredictClassificationTask
 protected:
     typedef dtrees::internal::TreeImpClassification<> TreeType;
     typedef dtrees::prediction::internal::TileDimensions<algorithmFPType> DimType;
+    typedef dtrees::prediction::internal::FlatForest<algorithmFPType, cpu> FlatForestType;
+    typedef typename FlatForestType::TreeType FlatTreeType;
     typedef daal::tls<algorithmFPType *> ClassesCounterTlsBase;
     class ClassesCounterTls : public ClassesCounterTlsBase
     {
@@ -98,8 +100,8 @@ protected:
                        const algorithmFPType * tFV, algorithmFPType * prob, size_t iTree);
     void predictByTreeCommon(const algorithmFPType * x, size_t sizeOfBlock, size_t nCols, const featureIndexType * tFI, const leftOrClassType * tLC,
                              const algorithmFPType * tFV, algorithmFPType * prob, size_t iTree);
-    void parallelPredict(const algorithmFPType * aX, const DecisionTreeNode * aNode, size_t treeSize, size_t nBlocks, size_t nCols, size_t blockSize,
-                         size_t residualSize, algorithmFPType * prob, size_t iTree);
+    void parallelPredict(const algorithmFPType * aX, const FlatTreeType & t, size_t nBlocks, size_t nCols, size_t blockSize, size_t residualSize,
+                         algorithmFPType * prob, size_t iTree);
     Status predictByAllTrees(size_t nTreesTotal, const DimType & dim);
     Status predictAllPointsByAllTrees(size_t nTreesTotal);
     Status predictByBlocksOfTrees(services::HostAppIface * pHostApp, size_t nTreesTotal, const DimType & dim, algorithmFPType * aClsCounters);
@@ -141,13 +143,15 @@ protected:
         }
         else
         {
+            const leftOrClassType * src = (*_flatForest)[iTree].sourceIndex;
             for (size_t i = 0; i < blockSize; i++)
             {
+                const size_t idx = src[currentNodes[i]];
                 PRAGMA_IVDEP
                 PRAGMA_VECTOR_ALWAYS
                 for (size_t j = 0; j < _nClasses; ++j)
                 {
-                    resPtr[i * _nClasses + j] += probas[currentNodes[i] * _nClasses + j];
+                    resPtr[i * _nClasses + j] += probas[idx * _nClasses + j];
                 }
             }
         }
@@ -155,7 +159,7 @@ protected:
 
 protected:
     dtrees::internal::FeatureTypes _featHelper;
-    TArray<const dtrees::internal::DecisionTreeTable *, cpu> _aTree;
+    services::SharedPtr<const FlatForestType> _flatForest;
     const NumericTable * _data;
     NumericTable * _res;
     NumericTable * _prob;
@@ -186,19 +190,17 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTrees(size_t iFir
     const size_t iLastTree            = iFirstTree + nTrees;
     for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
     {
-        const dtrees::internal::DecisionTreeNode * pNode =
-            dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(*_aTree[iTree], _featHelper, x);
-        DAAL_ASSERT(pNode);
-        const dtrees::internal::DecisionTreeNode * top = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
-        size_t idx                                     = pNode - top;
-        const double * probas                          = _model->getProbas(iTree);
+        const FlatTreeType & t      = (*_flatForest)[iTree];
+        const leftOrClassType iNode = dtrees::prediction::internal::findNode<algorithmFPType, cpu>(t, _featHelper, x);
+        const double * probas       = _model->getProbas(iTree);
 
         if (probas == nullptr)
         {
-            resPtr[pNode->leftIndexOrClass]++;
+            resPtr[t.leftIndexOrClass[iNode]]++;
         }
         else
         {
+            const size_t idx = t.sourceIndex[iNode];
             PRAGMA_IVDEP
             PRAGMA_VECTOR_ALWAYS
             for (size_t i = 0; i < _nClasses; i++)
@@ -210,26 +212,13 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTrees(size_t iFir
 }
 
 template <typename algorithmFPType, CpuType cpu>
-void PredictClassificationTask<algorithmFPType, cpu>::parallelPredict(const algorithmFPType * aX, const DecisionTreeNode * aNode, size_t treeSize,
-                                                                      size_t nBlocks, size_t nCols, size_t blockSize, size_t residualSize,
-                                                                      algorithmFPType * prob, size_t iTree)
+void PredictClassificationTask<algorithmFPType, cpu>::parallelPredict(const algorithmFPType * aX, const FlatTreeType & t, size_t nBlocks,
+                                                                      size_t nCols, size_t blockSize, size_t residualSize, algorithmFPType * prob,
+                                                                      size_t iTree)
 {
-    services::internal::TArray<featureIndexType, cpu> tFI(treeSize);
-    services::internal::TArray<leftOrClassType, cpu> tLC(treeSize);
-    services::internal::TArray<algorithmFPType, cpu> tFV(treeSize);
-
-    featureIndexType * fi = tFI.get();
-    leftOrClassType * lc  = tLC.get();
-    algorithmFPType * fv  = tFV.get();
-
-    PRAGMA_IVDEP
-    PRAGMA_VECTOR_ALWAYS
-    for (size_t i = 0; i < treeSize; i++)
-    {
-        fi[i] = aNode[i].featureIndex;
-        lc[i] = aNode[i].leftIndexOrClass;
-        fv[i] = (algorithmFPType)aNode[i].featureValueOrResponse;
-    }
+    const featureIndexType * fi = t.featureIndex;
+    const leftOrClassType * lc  = t.leftIndexOrClass;
+    const algorithmFPType * fv  = t.featureValueOrResponse;
 
     daal::threader_for(nBlocks, nBlocks, [&, nCols](size_t iBlock) {
         predictByTree(aX + iBlock * blockSize * nCols, blockSize, nCols, fi, lc, fv, prob + iBlock * blockSize * _nClasses, iTree);
@@ -344,13 +333,14 @@ void PredictClassificationTask<float, avx512>::predictByTree(const float * x, co
         }
         else
         {
+            const leftOrClassType * src = (*_flatForest)[iTree].sourceIndex;
             for (size_t i = 0; i < _DEFAULT_BLOCK_SIZE; ++i)
             {
                 PRAGMA_IVDEP
                 PRAGMA_VECTOR_ALWAYS
                 for (size_t j = 0; j < _nClasses; ++j)
                 {
-                    resPtr[i * _nClasses + j] += probas[idx[i] * _nClasses + j];
+                    resPtr[i * _nClasses + j] += probas[src[idx[i]] * _nClasses + j];
                 }
             }
         }
@@ -418,13 +408,14 @@ void PredictClassificationTask<double, avx512>::predictByTree(const double * x,
         }
         else
         {
+            const leftOrClassType * src = (*_flatForest)[iTree].sourceIndex;
             for (size_t i = 0; i < _DEFAULT_BLOCK_SIZE; ++i)
             {
                 PRAGMA_IVDEP
                 PRAGMA_VECTOR_ALWAYS
                 for (size_t j = 0; j < _nClasses; ++j)
                 {
-                    resPtr[i * _nClasses + j] += probas[idx[i] * _nClasses + j];
+                    resPtr[i * _nClasses + j] += probas[src[idx[i]] * _nClasses + j];
                 }
             }
         }
@@ -445,6 +436,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictByAllTrees(size_t
     DAAL_CHECK_BLOCK_STATUS(probBD);
     const bool bUseTLS(_nClasses > s_cMaxClassesBufSize);
     const size_t nCols(_data->getNumberOfColumns());
+    dtrees::prediction::internal::SparseRows<algorithmFPType, cpu> sparseRows(*_data);
     daal::SafeStatus safeStat;
     algorithmFPType * const probPtr = probBD.get();
 
@@ -453,10 +445,21 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictByAllTrees(size_t
         daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iStartRow : dim.nRowsInBlock;
+            algorithmFPType * res       = resBD.get() + iStartRow;
+            algorithmFPType * prob      = probPtr + iStartRow * _nClasses;
+            if (sparseRows.isSparse())
+            {
+                safeStat |= sparseRows.forEach(iStartRow, nRowsToProcess, [&](size_t iRow, const algorithmFPType * x) {
+                    predictByTrees(0, nTreesTotal, x, prob + iRow * _nClasses, nTreesTotal);
+                    if (_res)
+                    {
+                        res[iRow] = algorithmFPType(getMaxClass(prob + iRow * _nClasses));
+                    }
+                });
+                return;
+            }
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res  = resBD.get() + iStartRow;
-            algorithmFPType * prob = probPtr + iStartRow * _nClasses;
             daal::threader_for(nRowsToProcess, nRowsToProcess, [&](size_t iRow) {
                 predictByTrees(0, nTreesTotal, xBD.get() + iRow * nCols, prob + iRow * _nClasses, nTreesTotal);
                 if (_res)
@@ -472,9 +475,24 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictByAllTrees(size_t
         daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iStartRow : dim.nRowsInBlock;
+            algorithmFPType * res       = resBD.get() + iStartRow;
+            if (sparseRows.isSparse())
+            {
+                algorithmFPType buf[s_cMaxClassesBufSize];
+                algorithmFPType * val = bUseTLS ? lsData.local() : buf;
+                DAAL_CHECK_THR(val, services::ErrorMemoryAllocationFailed);
+                safeStat |= sparseRows.forEach(iStartRow, nRowsToProcess, [&](size_t iRow, const algorithmFPType * x) {
+                    for (size_t i = 0; i < _nClasses; ++i) val[i] = 0;
+                    predictByTrees(0, nTreesTotal, x, val, nTreesTotal);
+                    if (_res)
+                    {
+                        res[iRow] = algorithmFPType(getMaxClass(val));
+                    }
+                });
+                return;
+            }
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() + iStartRow;
             daal::threader_for(nRowsToProcess, nRowsToProcess, [&](size_t iRow) {
                 algorithmFPType buf[s_cMaxClassesBufSize];
                 algorithmFPType * val = bUseTLS ? lsData.local() : buf;
@@ -530,9 +548,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
     {
         daal::TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(_nClasses * nRowsOfRes);
         daal::threader_for(numberOfTrees, numberOfTrees, [&, nCols](const size_t iTree) {
-            const size_t treeSize          = _aTree[iTree]->getNumberOfRows();
-            const DecisionTreeNode * aNode = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
-            parallelPredict(aX, aNode, treeSize, nBlocks, nCols, blockSize, residualSize, tlsData.local(), iTree);
+            parallelPredict(aX, (*_flatForest)[iTree], nBlocks, nCols, blockSize, residualSize, tlsData.local(), iTree);
         });
         if (threader_get_threads_number())
         {
@@ -566,9 +582,7 @@ Status PredictClassificationTask<algorithmFPType, cpu>::predictAllPointsByAllTre
     {
         for (size_t iTree = 0; iTree < numberOfTrees; iTree++)
         {
-            const size_t treeSize          = _aTree[iTree]->getNumberOfRows();
-            const DecisionTreeNode * aNode = (const DecisionTreeNode *)(*_aTree[iTree]).getArray();
-            parallelPredict(aX, aNode, treeSize, nBlocks, nCols, blockSize, residualSize, commonBufVal, iTree);
+            parallelPredict(aX, (*_flatForest)[iTree], nBlocks, nCols, blockSize, residualSize, commonBufVal, iTree);
         }
     }
     const size_t nBlocksExtendet             = (residualSize != 0) ? (nBlocks + 1) : nBlocks;
@@ -611,26 +625,27 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
 {
     DAAL_CHECK_MALLOC(_featHelper.init(*_data));
     const auto nTreesTotal = _model->size();
-    _aTree.reset(nTreesTotal);
-    DAAL_CHECK_MALLOC(_aTree.get());
     size_t averageTreeSize = 0;
+    Status s;
+    _flatForest = _model->getFlatForest<algorithmFPType, FlatForestType>(s);
+    DAAL_CHECK_STATUS_VAR(s);
     for (size_t i = 0; i < nTreesTotal; ++i)
     {
-        _aTree[i] = _model->at(i);
-        averageTreeSize += _aTree[i]->getNumberOfRows();
+        averageTreeSize += (*_flatForest)[i].nNodes;
     }
     averageTreeSize = averageTreeSize / nTreesTotal;
 
-    if (_featHelper.hasUnorderedFeatures()
+    const bool bSparse = (_data->getDataLayout() == NumericTableIface::csrArray);
+    if (bSparse || _featHelper.hasUnorderedFeatures()
         || (_res->getNumberOfRows() < averageTreeSize * _SCALE_FACTOR_FOR_VECT_PARALLEL_COMPUTE && daal::threader_get_threads_number() > 1)
         || (_res->getNumberOfRows() < _MIN_NUMBER_OF_ROWS_FOR_VECT_SEQ_COMPUTE && daal::threader_get_threads_number() == 1))
     {
-        const auto treeSize = _aTree[0]->getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
+        const auto treeSize = (*_flatForest)[0].nNodes * FlatForestType::nodeSize();
         DimType dim(*_data, nTreesTotal, treeSize, _nClasses);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nClasses, dim.nRowsTotal);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nClasses * dim.nRowsTotal, sizeof(ClassIndexType));
 
-        if (dim.nTreeBlocks == 1) //all fit into LL cache
+        if (dim.nTreeBlocks == 1 || bSparse) //all fit into LL cache or the rows are scattered one by one
             return predictByAllTrees(nTreesTotal, dim);
 
         services::internal::TArrayCalloc<algorithmFPType, cpu> aClsCounters(dim.nRowsTotal * _nClasses);
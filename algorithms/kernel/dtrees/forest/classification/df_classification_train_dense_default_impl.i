@@ -82,9 +82,11 @@ public:
 
 public:
     UnorderedRespHelper(const dtrees::internal::IndexedFeatures * indexedFeatures, size_t nClasses)
-        : super(indexedFeatures), _nClasses(nClasses), _histLeft(nClasses), _impLeft(nClasses), _impRight(nClasses)
+        : super(indexedFeatures), _nClasses(nClasses), _buffers(nClasses)
     {}
     virtual bool init(const NumericTable * data, const NumericTable * resp, const IndexType * aSample) DAAL_C11_OVERRIDE;
+    //enables split search for several nodes or features of the same tree at the same time
+    bool setParallelMode(bool bParallel) { return _buffers.setParallelMode(bParallel); }
     void convertLeftImpToRight(size_t n, const ImpurityData & total, TSplitData & split)
     {
         computeRightHistogramm(total.hist, split.left.hist, split.left.hist);
@@ -101,8 +103,8 @@ public:
     }
     bool terminateCriteria(ImpurityData & imp, algorithmFPType impurityThreshold, size_t nSamples) const { return imp.value() < impurityThreshold; }
 
-    int findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx, size_t n, size_t nMinSplitPart,
-                                      const ImpurityData & curImpurity, TSplitData & split) const;
+    int findBestSplitForFeatureSorted(IndexType iFeature, const IndexType * aIdx, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+                                      TSplitData & split) const;
     void finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
                            IndexType * bestSplitIdx) const;
     void simpleSplit(const algorithmFPType * featureVal, const IndexType * aIdx, TSplitData & split) const;
@@ -217,15 +219,37 @@ private:
     bool findBestSplitCategoricalFeature(const algorithmFPType * featureVal, const IndexType * aIdx, size_t n, size_t nMinSplitPart,
                                          const algorithmFPType accuracy, const ImpurityData & curImpurity, TSplitData & split) const;
 
+private:
+    struct WorkBuffers
+    {
+        DAAL_NEW_DELETE();
+        WorkBuffers() {}
+        WorkBuffers(size_t nClasses) : histLeft(nClasses), impLeft(nClasses), impRight(nClasses) {}
+        bool reserveAs(const WorkBuffers & o)
+        {
+            idxFeatureBuf.reset(o.idxFeatureBuf.size());
+            samplesPerClassBuf.reset(o.samplesPerClassBuf.size());
+            histLeft.reset(o.histLeft.size());
+            impLeft.hist.reset(o.impLeft.hist.size());
+            impRight.hist.reset(o.impRight.hist.size());
+            return (idxFeatureBuf.size() == o.idxFeatureBuf.size()) && (samplesPerClassBuf.size() == o.samplesPerClassBuf.size())
+                   && (histLeft.size() == o.histLeft.size()) && (impLeft.hist.size() == o.impLeft.hist.size())
+                   && (impRight.hist.size() == o.impRight.hist.size());
+        }
+
+        //set of buffers for indexed features processing, used in findBestSplitForFeatureSorted only
+        TVector<IndexType, cpu> idxFeatureBuf;
+        TVector<float, cpu> samplesPerClassBuf;
+        Histogramm histLeft;
+        //work variables used in memory saving mode only
+        ImpurityData impLeft;
+        ImpurityData impRight;
+    };
+    typedef WorkBuffersLock<WorkBuffers> WorkBuffersGuard;
+
 private:
     const size_t _nClasses;
-    //set of buffers for indexed features processing, used in findBestSplitForFeatureIndexed only
-    mutable TVector<IndexType, cpu> _idxFeatureBuf;
-    mutable TVector<float, cpu> _samplesPerClassBuf;
-    mutable Histogramm _histLeft;
-    //work variables used in memory saving mode only
-    mutable ImpurityData _impLeft;
-    mutable ImpurityData _impRight;
+    mutable WorkBuffersHolder<WorkBuffers> _buffers;
 };
 
 #ifdef DEBUG_CHECK_IMPURITY
@@ -255,9 +279,10 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::init(const NumericTable * data,
     {
         //init work buffers for the computation using indexed features
         const auto nDiffFeatMax = this->indexedFeatures().maxNumIndices();
-        _idxFeatureBuf.reset(nDiffFeatMax);
-        _samplesPerClassBuf.reset(nClasses() * nDiffFeatMax);
-        return _idxFeatureBuf.get() && _samplesPerClassBuf.get();
+        WorkBuffers & buf       = _buffers.main();
+        buf.idxFeatureBuf.reset(nDiffFeatMax);
+        buf.samplesPerClassBuf.reset(nClasses() * nDiffFeatMax);
+        return buf.idxFeatureBuf.get() && buf.samplesPerClassBuf.get();
     }
     return true;
 }
@@ -290,9 +315,14 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(cons
                                                                             size_t nMinSplitPart, const algorithmFPType accuracy,
                                                                             const ImpurityData & curImpurity, TSplitData & split) const
 {
+    WorkBuffersGuard guard(_buffers);
+    if (!guard.get()) return false;
+    ImpurityData & impLeft  = guard.get()->impLeft;
+    ImpurityData & impRight = guard.get()->impRight;
+
     ClassIndexType xi = this->_aResponse[aIdx[0]].val;
-    _impLeft.init(_nClasses);
-    _impRight = curImpurity;
+    impLeft.init(_nClasses);
+    impRight = curImpurity;
 
     const bool bBestFromOtherFeatures            = !(split.impurityDecrease < 0);
     const algorithmFPType vBestFromOtherFeatures = bBestFromOtherFeatures ? algorithmFPType(n) * (curImpurity.var - split.impurityDecrease) : -1;
@@ -318,10 +348,10 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(cons
             }
             else
             {
-                flush(_impLeft, _impRight, xi, n, iStartEqualRespValues, nEqualRespValues);
+                flush(impLeft, impRight, xi, n, iStartEqualRespValues, nEqualRespValues);
 #ifdef DEBUG_CHECK_IMPURITY
-                checkImpurity(aIdx, i, _impLeft);
-                checkImpurity(aIdx + i, n - i, _impRight);
+                checkImpurity(aIdx, i, impLeft);
+                checkImpurity(aIdx + i, n - i, impRight);
 #endif
                 xi                    = this->_aResponse[aIdx[i]].val;
                 nEqualRespValues      = 1;
@@ -331,18 +361,18 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(cons
         }
 
         DAAL_ASSERT(nEqualRespValues);
-        flush(_impLeft, _impRight, xi, n, iStartEqualRespValues, nEqualRespValues);
+        flush(impLeft, impRight, xi, n, iStartEqualRespValues, nEqualRespValues);
 #ifdef DEBUG_CHECK_IMPURITY
-        checkImpurity(aIdx, i, _impLeft);
-        checkImpurity(aIdx + i, n - i, _impRight);
+        checkImpurity(aIdx, i, impLeft);
+        checkImpurity(aIdx + i, n - i, impRight);
 #endif
         xi                    = this->_aResponse[aIdx[i]].val;
         nEqualRespValues      = 1;
         iStartEqualRespValues = i;
-        if (!isPositive<algorithmFPType, cpu>(_impLeft.var)) _impLeft.var = 0;
-        if (!isPositive<algorithmFPType, cpu>(_impRight.var)) _impRight.var = 0;
+        if (!isPositive<algorithmFPType, cpu>(impLeft.var)) impLeft.var = 0;
+        if (!isPositive<algorithmFPType, cpu>(impRight.var)) impRight.var = 0;
 
-        const algorithmFPType v = algorithmFPType(i) * _impLeft.var + algorithmFPType(n - i) * _impRight.var;
+        const algorithmFPType v = algorithmFPType(i) * impLeft.var + algorithmFPType(n - i) * impRight.var;
         if (iBest < 0)
         {
             if (bBestFromOtherFeatures && isGreater<algorithmFPType, cpu>(v, vBestFromOtherFeatures))
@@ -358,8 +388,8 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitOrderedFeature(cons
         }
         bFound          = true;
         vBest           = v;
-        split.left.var  = _impLeft.var;
-        split.left.hist = _impLeft.hist;
+        split.left.var  = impLeft.var;
+        split.left.hist = impLeft.hist;
         iBest           = i;
         split.nLeft     = i;
         if (featureVal[i] < last) continue;
@@ -388,7 +418,11 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(
                                                                                 const ImpurityData & curImpurity, TSplitData & split) const
 {
     DAAL_ASSERT(n >= 2 * nMinSplitPart);
-    _impRight.init(_nClasses);
+    WorkBuffersGuard guard(_buffers);
+    if (!guard.get()) return false;
+    ImpurityData & impLeft  = guard.get()->impLeft;
+    ImpurityData & impRight = guard.get()->impRight;
+    impRight.init(_nClasses);
     bool bFound                                  = false;
     const bool bBestFromOtherFeatures            = !(split.impurityDecrease < 0);
     const algorithmFPType vBestFromOtherFeatures = bBestFromOtherFeatures ? algorithmFPType(n) * (curImpurity.var - split.impurityDecrease) : -1;
@@ -397,23 +431,23 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(
     for (size_t i = 0; i < n - nMinSplitPart;)
     {
         size_t count = 1;
-        _impLeft.init(_nClasses);
+        impLeft.init(_nClasses);
         const algorithmFPType first = featureVal[i];
         ClassIndexType xi           = this->_aResponse[aIdx[i]].val;
-        _impLeft.hist[xi]           = 1;
+        impLeft.hist[xi]            = 1;
         const size_t iStart         = i;
         for (++i; (i < n) && (featureVal[i] == first); ++count, ++i)
         {
             xi = this->_aResponse[aIdx[i]].val;
-            ++_impLeft.hist[xi];
+            ++impLeft.hist[xi];
         }
         if ((count < nMinSplitPart) || ((n - count) < nMinSplitPart)) continue;
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
-        for (size_t j = 0; j < _nClasses; ++j) _impRight.hist[j] = curImpurity.hist[j] - _impLeft.hist[j];
-        calcGini(count, _impLeft);
-        calcGini(n - count, _impRight);
-        const algorithmFPType v = algorithmFPType(count) * _impLeft.var + algorithmFPType(n - count) * _impRight.var;
+        for (size_t j = 0; j < _nClasses; ++j) impRight.hist[j] = curImpurity.hist[j] - impLeft.hist[j];
+        calcGini(count, impLeft);
+        calcGini(n - count, impRight);
+        const algorithmFPType v = algorithmFPType(count) * impLeft.var + algorithmFPType(n - count) * impRight.var;
         if (iBest < 0)
         {
             if (bBestFromOtherFeatures && isGreater<algorithmFPType, cpu>(v, vBestFromOtherFeatures)) continue;
@@ -422,8 +456,8 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(
             continue;
         iBest              = i;
         vBest              = v;
-        split.left.var     = _impLeft.var;
-        split.left.hist    = _impLeft.hist;
+        split.left.var     = impLeft.var;
+        split.left.hist    = impLeft.hist;
         split.nLeft        = count;
         split.iStart       = iStart;
         split.featureValue = first;
@@ -458,15 +492,19 @@ void countResponses(SizeType nClasses, SizeType n, const IndexType * aIdx, const
 }
 
 template <typename algorithmFPType, CpuType cpu>
-int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx,
-                                                                             size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(IndexType iFeature, const IndexType * aIdx, size_t n,
+                                                                             size_t nMinSplitPart, const ImpurityData & curImpurity,
                                                                              TSplitData & split) const
 {
+    WorkBuffersGuard guard(_buffers);
+    if (!guard.get()) return -1;
+    WorkBuffers & buf = *guard.get();
+
     const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
-    _idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-    _samplesPerClassBuf.setValues(nClasses() * nDiffFeatMax, 0);
-    auto nFeatIdx         = _idxFeatureBuf.get();
-    auto nSamplesPerClass = _samplesPerClassBuf.get();
+    buf.idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
+    buf.samplesPerClassBuf.setValues(nClasses() * nDiffFeatMax, 0);
+    auto nFeatIdx         = buf.idxFeatureBuf.get();
+    auto nSamplesPerClass = buf.samplesPerClassBuf.get();
 
     countResponses<typename super::Response, IndexType, typename IndexedFeatures::IndexType, size_t, cpu>(
         _nClasses, n, aIdx, this->_aResponse.get(), this->indexedFeatures().data(iFeature), nFeatIdx, nSamplesPerClass);
@@ -475,8 +513,8 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         split.impurityDecrease < 0 ? split.impurityDecrease : algorithmFPType(n) * (split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
 
     //init histogram for the left part
-    _histLeft.setAll(0);
-    auto histLeft           = _histLeft.get();
+    buf.histLeft.setAll(0);
+    auto histLeft           = buf.histLeft.get();
     size_t nLeft            = 0;
     int idxFeatureBestSplit = -1; //index of best feature value in the array of sorted feature values
     for (size_t i = 0; i < nDiffFeatMax; ++i)
@@ -516,7 +554,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         const algorithmFPType decrease = sumLeft / algorithmFPType(nLeft) + sumRight / algorithmFPType(n - nLeft);
         if (decrease > bestImpDecrease)
         {
-            split.left.hist     = _histLeft;
+            split.left.hist     = buf.histLeft;
             split.left.var      = sumLeft;
             split.nLeft         = nLeft;
             idxFeatureBestSplit = i;
@@ -549,15 +587,19 @@ void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexTyp
 }
 #else
 template <typename algorithmFPType, CpuType cpu>
-int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx,
-                                                                             size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(IndexType iFeature, const IndexType * aIdx, size_t n,
+                                                                             size_t nMinSplitPart, const ImpurityData & curImpurity,
                                                                              TSplitData & split) const
 {
+    WorkBuffersGuard guard(_buffers);
+    if (!guard.get()) return -1;
+    WorkBuffers & buf = *guard.get();
+
     const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
-    _idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
-    _samplesPerClassBuf.setValues(nClasses() * nDiffFeatMax, 0);
-    auto nFeatIdx         = _idxFeatureBuf.get();
-    auto nSamplesPerClass = _samplesPerClassBuf.get();
+    buf.idxFeatureBuf.setValues(nDiffFeatMax, algorithmFPType(0));
+    buf.samplesPerClassBuf.setValues(nClasses() * nDiffFeatMax, 0);
+    auto nFeatIdx         = buf.idxFeatureBuf.get();
+    auto nSamplesPerClass = buf.samplesPerClassBuf.get();
 
     algorithmFPType bestImpDecrease =
         split.impurityDecrease < 0 ? split.impurityDecrease : algorithmFPType(n) * (split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
@@ -577,8 +619,8 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         }
     }
     //init histogram for the left part
-    _histLeft.setAll(0);
-    auto histLeft           = _histLeft.get();
+    buf.histLeft.setAll(0);
+    auto histLeft           = buf.histLeft.get();
     size_t nLeft            = 0;
     int idxFeatureBestSplit = -1; //index of best feature value in the array of sorted feature values
     for (size_t i = 0; i < nDiffFeatMax; ++i)
@@ -619,7 +661,7 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
         const algorithmFPType decrease = sumLeft / algorithmFPType(nLeft) + sumRight / algorithmFPType(n - nLeft);
         if (decrease > bestImpDecrease)
         {
-            split.left.hist     = _histLeft;
+            split.left.hist     = buf.histLeft;
             split.left.var      = sumLeft;
             split.nLeft         = nLeft;
             idxFeatureBestSplit = i;
@@ -50,8 +50,8 @@ template <typename algorithmFPType>
 DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * prm, const int method)
 {
     services::Status status;
-    const daal::algorithms::decision_forest::training::Parameter * parameter =
-        dynamic_cast<const daal::algorithms::decision_forest::training::Parameter *>(prm);
+    const daal::algorithms::decision_forest::training::interface1::Parameter * parameter =
+        dynamic_cast<const daal::algorithms::decision_forest::training::interface1::Parameter *>(prm);
     const classifier::training::Input * inp = static_cast<const classifier::training::Input *>(input);
     const size_t nFeatures                  = inp->get(classifier::training::data)->getNumberOfColumns();
 
@@ -87,8 +87,8 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     DAAL_CHECK(m.get(), ErrorNullModel);
 
     services::Status s;
-    const daal::algorithms::decision_forest::training::Parameter * algParameter =
-        dynamic_cast<const daal::algorithms::decision_forest::training::Parameter *>(par);
+    const daal::algorithms::decision_forest::training::interface1::Parameter * algParameter =
+        dynamic_cast<const daal::algorithms::decision_forest::training::interface1::Parameter *>(par);
     DAAL_CHECK(algParameter, ErrorNullParameterNotSupported);
     if (algParameter->resultsToCompute & decision_forest::training::computeOutOfBagError)
     {
@@ -27,6 +27,7 @@
 
 #include "dtrees_train_data_helper.i"
 #include "threading.h"
+#include "service_threading.h"
 #include "dtrees_model_impl.h"
 #include "engine_types_internal.h"
 #include "service_defines.h"
@@ -233,6 +234,15 @@ services::Status selectParallelizationTechnique(const Parameter & par, engines::
 //////////////////////////////////////////////////////////////////////////////////////////
 // compute() implementation
 //////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////
+// Returns true if sibling nodes and features of a node of the same tree are processed in parallel,
+// i.e. if there are more threads available than trees to be built in parallel
+//////////////////////////////////////////////////////////////////////////////////////////
+inline bool isParallelNodeSplitting(const Parameter & par)
+{
+    return par.parallelNodeSplitting && (threader_get_max_threads_number() > par.nTrees);
+}
+
 template <typename algorithmFPType, CpuType cpu, typename ModelType, typename TaskType>
 services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, ModelType & md, ResultData & res,
                              const Parameter & par, size_t nClasses)
@@ -247,6 +257,15 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
         s = indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes);
         DAAL_CHECK_STATUS_VAR(s);
     }
+    //the columns of the CSR numeric table are transposed once and shared by the tasks instead of reading the table value by value
+    dtrees::internal::SparseColumns<algorithmFPType, cpu> sparseColumns;
+    const dtrees::internal::SparseColumns<algorithmFPType, cpu> * pSparseColumns = nullptr;
+    if (x->getDataLayout() == NumericTableIface::csrArray)
+    {
+        s = sparseColumns.init(*const_cast<NumericTable *>(x));
+        DAAL_CHECK_STATUS_VAR(s);
+        pSparseColumns = &sparseColumns;
+    }
 
     const auto nFeatures = x->getNumberOfColumns();
     WriteOnlyRows<algorithmFPType, cpu> varImpBD(res.varImp, 0, 1);
@@ -270,7 +289,10 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
     daal::tls<TaskType *> tlsTask([&]() -> TaskType * {
         //in case of single thread no need to allocate
         Ctx * ctx = tlsCtx.local();
-        return ctx ? new TaskType(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, *ctx, nClasses) : nullptr;
+        if (!ctx) return nullptr;
+        TaskType * task = new TaskType(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, *ctx, nClasses);
+        if (task) task->setSparseColumns(pSparseColumns);
+        return task;
     });
 
     engines::internal::ParallelizationTechnique technique = engines::internal::family;
@@ -287,20 +309,33 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
 
     services::internal::TArray<size_t, cpu> numElems(par.nTrees);
 
+    //when nodes of a tree are processed in parallel the thread can pick up another tree while waiting for the nested tasks,
+    //hence the task is created for each tree instead of being reused by the thread
+    const bool bParallelNodes = isParallelNodeSplitting(par);
     daal::SafeStatus safeStat;
     daal::threader_for(par.nTrees, par.nTrees, [&](size_t i) {
         if (!safeStat.ok()) return;
-        TaskType * task = tlsTask.local();
+        auto engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(engines[i].get());
+        DAAL_CHECK_THR(engineImpl, ErrorEngineNotSupported);
+        TaskType * task = nullptr;
+        if (bParallelNodes)
+        {
+            Ctx * ctx = tlsCtx.local();
+            DAAL_CHECK_MALLOC_THR(ctx);
+            task = new TaskType(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, *ctx, nClasses);
+            if (task) task->setSparseColumns(pSparseColumns);
+        }
+        else
+            task = tlsTask.local();
         DAAL_CHECK_MALLOC_THR(task);
         dtrees::internal::Tree * pTree = nullptr;
         numElems[i]                    = 0;
-        auto engineImpl                = dynamic_cast<engines::internal::BatchBaseImpl *>(engines[i].get());
-        DAAL_CHECK_THR(engineImpl, ErrorEngineNotSupported);
-        services::Status s = task->run(engineImpl, pTree, numElems[i]);
+        services::Status s             = task->run(engineImpl, pTree, numElems[i]);
         if (pTree)
         {
             md.add((typename ModelType::TreeType &)*pTree, nClasses);
         }
+        if (bParallelNodes) delete task;
         DAAL_CHECK_STATUS_THR(s);
     });
     s                = safeStat.detach();
@@ -349,6 +384,7 @@ class TrainBatchTaskBase
 public:
     typedef TreeThreadCtxBase<algorithmFPType, cpu> ThreadCtxType;
     services::Status run(engines::internal::BatchBaseImpl * engineImpl, dtrees::internal::Tree *& pTree, size_t & numElems);
+    void setSparseColumns(const typename DataHelper::SparseColumnsType * sparseColumns) { _helper.setSparseColumns(sparseColumns); }
 
 protected:
     typedef dtrees::internal::TVector<algorithmFPType, cpu> algorithmFPTypeArray;
@@ -366,6 +402,7 @@ protected:
           _helper(indexedFeatures, nClasses),
           _impurityThreshold(_par.impurityThreshold),
           _nFeatureBufs(1), //for sequential processing
+          _bThreaded(isParallelNodeSplitting(par)),
           _featHelper(featTypes),
           _threadCtx(threadCtx),
           _accuracy(daal::services::internal::EpsilonVal<algorithmFPType>::get())
@@ -397,12 +434,12 @@ protected:
                                                      algorithmFPType imp);
     typename DataHelper::NodeType::Leaf * makeLeaf(const IndexType * idx, size_t n, typename DataHelper::ImpurityData & imp, size_t makeLeaf);
 
-    bool findBestSplit(size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity, IndexType & iBestFeature,
-                       typename DataHelper::TSplitData & split);
-    bool findBestSplitSerial(size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity, IndexType & iBestFeature,
-                             typename DataHelper::TSplitData & split);
-    bool findBestSplitThreaded(size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity, IndexType & iBestFeature,
-                               typename DataHelper::TSplitData & split);
+    bool findBestSplit(services::Status & s, size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity,
+                       IndexType & iBestFeature, typename DataHelper::TSplitData & split);
+    bool findBestSplitSerial(size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity, const IndexType * aFeatureIdx,
+                             IndexType & iBestFeature, typename DataHelper::TSplitData & split);
+    bool findBestSplitThreaded(services::Status & s, size_t iStart, size_t n, const typename DataHelper::ImpurityData & curImpurity,
+                               const IndexType * aFeatureIdx, IndexType & iBestFeature, typename DataHelper::TSplitData & split);
     bool simpleSplit(size_t iStart, const typename DataHelper::ImpurityData & curImpurity, IndexType & iFeatureBest,
                      typename DataHelper::TSplitData & split);
     void addImpurityDecrease(IndexType iFeature, size_t n, const typename DataHelper::ImpurityData & curImpurity,
@@ -415,24 +452,39 @@ protected:
     }
 
     //find features to check in the current split node
-    void chooseFeatures()
+    //aFeatureIdx should have 2*_nFeaturesPerNode elements
+    void chooseFeatures(IndexType * aFeatureIdx)
     {
         const size_t n = nFeatures();
         if (n == _nFeaturesPerNode)
         {
             PRAGMA_IVDEP
             PRAGMA_VECTOR_ALWAYS
-            for (size_t i = 0; i < n; ++i) _aFeatureIdx[i] = i;
+            for (size_t i = 0; i < n; ++i) aFeatureIdx[i] = i;
         }
         else
         {
+            AUTOLOCK(_mtEngine);
             *_numElems += n;
             RNGs<IndexType, cpu> rng;
-            rng.uniformWithoutReplacement(_nFeaturesPerNode, _aFeatureIdx.get(), _aFeatureIdx.get() + _nFeaturesPerNode, _engineImpl->getState(), 0,
-                                          n);
+            rng.uniformWithoutReplacement(_nFeaturesPerNode, aFeatureIdx, aFeatureIdx + _nFeaturesPerNode, _engineImpl->getState(), 0, n);
         }
     }
 
+    bool isCancelled(services::Status & s, size_t n)
+    {
+        if (!_bThreaded) return _hostApp.isCancelled(s, n);
+        AUTOLOCK(_mtHostApp);
+        return _hostApp.isCancelled(s, n);
+    }
+
+    void deleteNode(typename DataHelper::NodeType::Base * node)
+    {
+        if (_bThreaded) _mtAlloc.lock();
+        dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(node, _tree.allocator());
+        if (_bThreaded) _mtAlloc.unlock();
+    }
+
     services::Status computeResults(const dtrees::internal::Tree & t);
 
     algorithmFPType computeOOBError(const dtrees::internal::Tree & t, size_t n, const IndexType * aInd);
@@ -462,6 +514,13 @@ protected:
     const size_t _nSamples;
     const size_t _nFeaturesPerNode;
     const size_t _nFeatureBufs; //number of buffers to get feature values (to process features independently in parallel)
+    const bool _bThreaded;      //sibling nodes and features of a node are processed in parallel
+
+    daal::Mutex _mtEngine;                         //guards random numbers generation
+    daal::Mutex _mtAlloc;                          //guards allocation of the tree nodes
+    daal::Mutex _mtHostApp;                        //guards cancellation checks
+    daal::Mutex _mtVarImp;                         //guards _varImpThr
+    TArrayCalloc<algorithmFPType, cpu> _varImpThr; //MDI variable importance of the tree built in threaded mode
 
     const FeatureTypes & _featHelper;
     algorithmFPType _accuracy;
@@ -514,6 +573,8 @@ services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::run(engin
     }
     //init responses buffer, keep _aSample values in it
     DAAL_CHECK_MALLOC(_helper.init(_data, _resp, _aSample.get()));
+    DAAL_CHECK_MALLOC(_helper.setParallelMode(_bThreaded));
+    if (_bThreaded && (_par.varImportance == training::MDI)) DAAL_CHECK_MALLOC(_varImpThr.reset(nFeatures()));
 
     //use _aSample as an array of response indices stored by helper from now on
     PRAGMA_IVDEP
@@ -532,6 +593,10 @@ services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::run(engin
         //to prevent memory leak in case of general allocator
         _tree.reset(nd, bUnorderedFeaturesUsed);
         _threadCtx.nTrees++;
+        if (_varImpThr.get())
+        {
+            for (size_t i = 0, nVars = nFeatures(); i < nVars; ++i) _threadCtx.varImp[i] += _varImpThr[i];
+        }
     }
 
     if (s && ((_par.resultsToCompute & (computeOutOfBagError | computeOutOfBagErrorPerObservation)) || (_par.varImportance > MDI)))
@@ -547,7 +612,16 @@ typename DataHelper::NodeType::Split * TrainBatchTaskBase<algorithmFPType, DataH
                                                                                                        typename DataHelper::NodeType::Base * right,
                                                                                                        algorithmFPType imp)
 {
-    typename DataHelper::NodeType::Split * pNode = _tree.allocator().allocSplit();
+    typename DataHelper::NodeType::Split * pNode = nullptr;
+    if (_bThreaded)
+    {
+        _mtAlloc.lock();
+        pNode = _tree.allocator().allocSplit();
+        _mtAlloc.unlock();
+    }
+    else
+        pNode = _tree.allocator().allocSplit();
+    if (!pNode) return nullptr;
     pNode->set(iFeature, featureValue, bUnordered);
     pNode->kid[0]   = left;
     pNode->kid[1]   = right;
@@ -560,8 +634,16 @@ typename DataHelper::NodeType::Leaf * TrainBatchTaskBase<algorithmFPType, DataHe
                                                                                                      typename DataHelper::ImpurityData & imp,
                                                                                                      size_t nClasses)
 {
-    typename DataHelper::NodeType::Leaf * pNode = _tree.allocator().allocLeaf(_nClasses);
-    _helper.setLeafData(*pNode, idx, n, imp);
+    typename DataHelper::NodeType::Leaf * pNode = nullptr;
+    if (_bThreaded)
+    {
+        _mtAlloc.lock();
+        pNode = _tree.allocator().allocLeaf(_nClasses);
+        _mtAlloc.unlock();
+    }
+    else
+        pNode = _tree.allocator().allocLeaf(_nClasses);
+    if (pNode) _helper.setLeafData(*pNode, idx, n, imp);
     return pNode;
 }
 
@@ -571,26 +653,46 @@ typename DataHelper::NodeType::Base * TrainBatchTaskBase<algorithmFPType, DataHe
                                                                                                   typename DataHelper::ImpurityData & curImpurity,
                                                                                                   bool & bUnorderedFeaturesUsed, size_t nClasses)
 {
-    if (_hostApp.isCancelled(s, n)) return nullptr;
+    if (isCancelled(s, n)) return nullptr;
 
     if (terminateCriteria(n, level, curImpurity)) return makeLeaf(_aSample.get() + iStart, n, curImpurity, nClasses);
 
     typename DataHelper::TSplitData split;
     IndexType iFeature;
-    if (findBestSplit(iStart, n, curImpurity, iFeature, split))
+    if (findBestSplit(s, iStart, n, curImpurity, iFeature, split))
     {
         if (_par.varImportance == training::MDI) addImpurityDecrease(iFeature, n, curImpurity, split);
-        typename DataHelper::NodeType::Base * left = build(s, iStart, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses);
-        const size_t nLeft                         = split.nLeft;
-        _helper.convertLeftImpToRight(n, curImpurity, split);
-        typename DataHelper::NodeType::Base * right =
-            s.ok() ? build(s, iStart + nLeft, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses) : nullptr;
+        const size_t nMinSamplesToBuildInParallel   = 1024; //min number of samples in a node to build its subtrees in parallel
+        const size_t nLeft                          = split.nLeft;
+        typename DataHelper::NodeType::Base * left  = nullptr;
+        typename DataHelper::NodeType::Base * right = nullptr;
+        if (_bThreaded && (n >= nMinSamplesToBuildInParallel))
+        {
+            //left subtree is built by a separate task, right one is built by the current thread
+            typename DataHelper::ImpurityData impLeft = split.left;
+            _helper.convertLeftImpToRight(n, curImpurity, split);
+            services::Status sLeft;
+            bool bUnorderedFeaturesUsedLeft = false;
+            auto buildLeft                  = [&]() { left = build(sLeft, iStart, nLeft, level + 1, impLeft, bUnorderedFeaturesUsedLeft, nClasses); };
+            daal::task_group tg;
+            tg.run(buildLeft);
+            right = build(s, iStart + nLeft, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses);
+            tg.wait();
+            s |= sLeft;
+            bUnorderedFeaturesUsed |= bUnorderedFeaturesUsedLeft;
+        }
+        else
+        {
+            left = build(s, iStart, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses);
+            _helper.convertLeftImpToRight(n, curImpurity, split);
+            right = s.ok() ? build(s, iStart + nLeft, split.nLeft, level + 1, split.left, bUnorderedFeaturesUsed, nClasses) : nullptr;
+        }
         typename DataHelper::NodeType::Base * res = nullptr;
-        if (!left || !right || !(res = makeSplit(iFeature, split.featureValue, split.featureUnordered, left, right, curImpurity.var)))
+        if (!left || !right || !s.ok() || !(res = makeSplit(iFeature, split.featureValue, split.featureUnordered, left, right, curImpurity.var)))
         {
-            if (left) dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(left, _tree.allocator());
-            if (right)
-                dtrees::internal::deleteNode<typename DataHelper::NodeType, typename DataHelper::TreeType::Allocator>(right, _tree.allocator());
+            if (left) deleteNode(left);
+            if (right) deleteNode(right);
+            if (s.ok()) s.add(services::ErrorMemoryAllocationFailed);
             return nullptr;
         }
         bUnorderedFeaturesUsed |= split.featureUnordered;
@@ -612,8 +714,11 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::simpleSplit(size_t iS
     for (size_t i = 0; i < _nFeaturesPerNode; ++i)
     {
         IndexType iFeature;
-        *_numElems += 1;
-        rng.uniform(1, &iFeature, _engineImpl->getState(), 0, _data->getNumberOfColumns());
+        {
+            AUTOLOCK(_mtEngine);
+            *_numElems += 1;
+            rng.uniform(1, &iFeature, _engineImpl->getState(), 0, _data->getNumberOfColumns());
+        }
         featureValuesToBuf(iFeature, featBuf, aIdx, 2);
         if (featBuf[1] - featBuf[0] <= _accuracy) //all values of the feature are the same
             continue;
@@ -627,7 +732,7 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::simpleSplit(size_t iS
 }
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
-bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplit(size_t iStart, size_t n,
+bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplit(services::Status & s, size_t iStart, size_t n,
                                                                          const typename DataHelper::ImpurityData & curImpurity,
                                                                          IndexType & iFeatureBest, typename DataHelper::TSplitData & split)
 {
@@ -639,17 +744,33 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplit(size_t
 #endif
         return simpleSplit(iStart, curImpurity, iFeatureBest, split);
     }
-    if (_nFeatureBufs == 1) return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, split);
-    return findBestSplitThreaded(iStart, n, curImpurity, iFeatureBest, split);
+    if (!_bThreaded)
+    {
+        chooseFeatures(_aFeatureIdx.get());
+        return findBestSplitSerial(iStart, n, curImpurity, _aFeatureIdx.get(), iFeatureBest, split);
+    }
+
+    //several nodes of the tree can be split at the same time, hence features are chosen to the local buffer
+    TArray<IndexType, cpu> aFeatureIdx(_nFeaturesPerNode * 2);
+    if (!aFeatureIdx.get())
+    {
+        s.add(services::ErrorMemoryAllocationFailed);
+        return false;
+    }
+    chooseFeatures(aFeatureIdx.get());
+    const size_t nMinSamplesToSplitInParallel = 4096; //min number of samples in a node to process its features in parallel
+    if ((n < nMinSamplesToSplitInParallel) || (_nFeaturesPerNode == 1))
+        return findBestSplitSerial(iStart, n, curImpurity, aFeatureIdx.get(), iFeatureBest, split);
+    return findBestSplitThreaded(s, iStart, n, curImpurity, aFeatureIdx.get(), iFeatureBest, split);
 }
 
 //find best split and put it to featureIndexBuf
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
 bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(size_t iStart, size_t n,
                                                                                const typename DataHelper::ImpurityData & curImpurity,
-                                                                               IndexType & iBestFeature, typename DataHelper::TSplitData & bestSplit)
+                                                                               const IndexType * aFeatureIdx, IndexType & iBestFeature,
+                                                                               typename DataHelper::TSplitData & bestSplit)
 {
-    chooseFeatures();
     const float qMax             = 0.02; //min fracture of observations to be handled as indexed feature values
     IndexType * bestSplitIdx     = featureIndexBuf(0) + iStart;
     IndexType * aIdx             = _aSample.get() + iStart;
@@ -659,7 +780,7 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(s
     const float fact = float(n);
     for (size_t i = 0; i < _nFeaturesPerNode; ++i)
     {
-        const auto iFeature            = _aFeatureIdx[i];
+        const auto iFeature            = aFeatureIdx[i];
         const bool bUseIndexedFeatures = (!_par.memorySavingMode) && (fact > qMax * float(_helper.indexedFeatures().numIndices(iFeature)));
 
         if (bUseIndexedFeatures)
@@ -668,7 +789,7 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(s
             split.featureUnordered = _featHelper.isUnordered(iFeature);
             //index of best feature value in the array of sorted feature values
             const int idxFeatureValue =
-                _helper.findBestSplitForFeatureSorted(featureBuf(0), iFeature, aIdx, n, _par.minObservationsInLeafNode, curImpurity, split);
+                _helper.findBestSplitForFeatureSorted(iFeature, aIdx, n, _par.minObservationsInLeafNode, curImpurity, split);
             if (idxFeatureValue < 0) continue;
             iBestSplit = i;
             split.copyTo(bestSplit);
@@ -698,7 +819,7 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(s
     }
     if (iBestSplit < 0) return false; //not found
 
-    iBestFeature    = _aFeatureIdx[iBestSplit];
+    iBestFeature    = aFeatureIdx[iBestSplit];
     bool bCopyToIdx = true;
     if (idxFeatureValueBestSplit >= 0)
     {
@@ -729,14 +850,92 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitSerial(s
 }
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
-bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitThreaded(size_t iStart, size_t n,
+bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitThreaded(services::Status & s, size_t iStart, size_t n,
                                                                                  const typename DataHelper::ImpurityData & curImpurity,
-                                                                                 IndexType & iFeatureBest, typename DataHelper::TSplitData & split)
+                                                                                 const IndexType * aFeatureIdx, IndexType & iBestFeature,
+                                                                                 typename DataHelper::TSplitData & bestSplit)
 {
-    chooseFeatures();
+    const float qMax         = 0.02; //min fracture of observations to be handled as indexed feature values
+    const int splitNotFound  = -2;
+    const int splitUnindexed = -1;
+    IndexType * aIdx         = _aSample.get() + iStart;
+    //best split found for each feature and index of its feature value in the array of sorted feature values,
+    //splitUnindexed if the feature values were sorted explicitly
     TArray<typename DataHelper::TSplitData, cpu> aFeatureSplit(_nFeaturesPerNode);
-    //TODO, if parallel for features
-    return false;
+    TArray<int, cpu> aIdxFeatureValue(_nFeaturesPerNode);
+    if (!aFeatureSplit.get() || !aIdxFeatureValue.get())
+    {
+        s.add(services::ErrorMemoryAllocationFailed);
+        return false;
+    }
+
+    const float fact = float(n);
+    daal::SafeStatus safeStat;
+    daal::threader_for(_nFeaturesPerNode, _nFeaturesPerNode, [&](size_t i) {
+        aIdxFeatureValue[i]                     = splitNotFound;
+        const auto iFeature                     = aFeatureIdx[i];
+        typename DataHelper::TSplitData & split = aFeatureSplit[i];
+        split.featureUnordered                  = _featHelper.isUnordered(iFeature);
+
+        const bool bUseIndexedFeatures = (!_par.memorySavingMode) && (fact > qMax * float(_helper.indexedFeatures().numIndices(iFeature)));
+        if (bUseIndexedFeatures)
+        {
+            if (!_helper.hasDiffFeatureValues(iFeature, aIdx, n)) return; //all values of the feature are the same
+            const int idxFeatureValue = _helper.findBestSplitForFeatureSorted(iFeature, aIdx, n, _par.minObservationsInLeafNode, curImpurity, split);
+            if (idxFeatureValue >= 0) aIdxFeatureValue[i] = idxFeatureValue;
+            return;
+        }
+        //feature values are sorted in the buffers local to the feature
+        TArrayScalable<algorithmFPType, cpu> featBuf(n);
+        TArrayScalable<IndexType, cpu> idxBuf(n);
+        DAAL_CHECK_MALLOC_THR(featBuf.get() && idxBuf.get());
+        services::internal::tmemcpy<IndexType, cpu>(idxBuf.get(), aIdx, n);
+        featureValuesToBuf(iFeature, featBuf.get(), idxBuf.get(), n);
+        if (featBuf[n - 1] - featBuf[0] <= _accuracy) return; //all values of the feature are the same
+        if (_helper.findBestSplitForFeature(featBuf.get(), idxBuf.get(), n, _par.minObservationsInLeafNode, _accuracy, curImpurity, split))
+            aIdxFeatureValue[i] = splitUnindexed;
+    });
+    s |= safeStat.detach();
+    if (!s) return false;
+
+    //the first of the features with the maximal impurity decrease is chosen
+    int iBestSplit = -1;
+    for (size_t i = 0; i < _nFeaturesPerNode; ++i)
+    {
+        if (aIdxFeatureValue[i] == splitNotFound) continue;
+        if ((iBestSplit < 0) || (aFeatureSplit[i].impurityDecrease > aFeatureSplit[iBestSplit].impurityDecrease)) iBestSplit = i;
+    }
+    if (iBestSplit < 0) return false; //not found
+
+    iBestFeature = aFeatureIdx[iBestSplit];
+    aFeatureSplit[iBestSplit].copyTo(bestSplit);
+    IndexType * bestSplitIdx = featureIndexBuf(0) + iStart;
+    if (aIdxFeatureValue[iBestSplit] >= 0)
+    {
+        //sorted feature was used
+        //calculate impurity and get split to bestSplitIdx
+        _helper.finalizeBestSplit(aIdx, n, iBestFeature, aIdxFeatureValue[iBestSplit], bestSplit, bestSplitIdx);
+        services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, n);
+        return true;
+    }
+
+    //sort the indices by the best feature values again, this gives the same order as in the split search
+    services::internal::tmemcpy<IndexType, cpu>(bestSplitIdx, aIdx, n);
+    featureValuesToBuf(iBestFeature, featureBuf(0) + iStart, bestSplitIdx, n);
+    if (bestSplit.featureUnordered && bestSplit.iStart)
+    {
+        DAAL_ASSERT(bestSplit.iStart + bestSplit.nLeft <= n);
+        services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx + bestSplit.iStart, bestSplit.nLeft);
+        aIdx += bestSplit.nLeft;
+        services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, bestSplit.iStart);
+        aIdx += bestSplit.iStart;
+        bestSplitIdx += bestSplit.iStart + bestSplit.nLeft;
+        if (n > (bestSplit.iStart + bestSplit.nLeft))
+            services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, n - bestSplit.iStart - bestSplit.nLeft);
+    }
+    else
+        services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, n);
+    return true;
 }
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
@@ -745,7 +944,15 @@ void TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::addImpurityDecrease(I
                                                                                const typename DataHelper::TSplitData & split)
 {
     DAAL_ASSERT(_threadCtx.varImp);
-    if (!isZero<algorithmFPType, cpu>(split.impurityDecrease)) _threadCtx.varImp[iFeature] += split.impurityDecrease;
+    if (isZero<algorithmFPType, cpu>(split.impurityDecrease)) return;
+    if (_bThreaded)
+    {
+        //the context can be shared with the trees built by the same thread, hence importance of this tree is kept aside
+        AUTOLOCK(_mtVarImp);
+        _varImpThr[iFeature] += split.impurityDecrease;
+    }
+    else
+        _threadCtx.varImp[iFeature] += split.impurityDecrease;
 }
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
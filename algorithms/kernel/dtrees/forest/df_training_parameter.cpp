@@ -36,7 +36,7 @@ namespace decision_forest
 namespace training
 {
 using namespace daal::services;
-Status checkImpl(const decision_forest::training::Parameter & prm)
+Status checkImpl(const decision_forest::training::interface1::Parameter & prm)
 {
     DAAL_CHECK_EX(prm.nTrees, ErrorIncorrectParameter, ParameterName, nTreesStr());
     DAAL_CHECK_EX(prm.minObservationsInLeafNode, ErrorIncorrectParameter, ParameterName, minObservationsInLeafNodeStr());
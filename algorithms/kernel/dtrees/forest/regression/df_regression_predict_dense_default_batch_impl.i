@@ -82,11 +82,10 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const decision
                                                                   services::HostAppIface * pHostApp)
 {
     DAAL_CHECK_MALLOC(this->_featHelper.init(*this->_data));
-    const auto nTreesTotal = m->size();
-    this->_aTree.reset(nTreesTotal);
-    DAAL_CHECK_MALLOC(this->_aTree.get());
-    for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
-    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(nTreesTotal);
+    services::Status s;
+    this->_flatForest = m->template getFlatForest<algorithmFPType, typename super::FlatForestType>(s);
+    DAAL_CHECK_STATUS_VAR(s);
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(m->size());
     return super::run(pHostApp, div);
 }
 
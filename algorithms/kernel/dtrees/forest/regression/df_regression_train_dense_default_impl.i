@@ -102,6 +102,8 @@ public:
 public:
     OrderedRespHelper(const dtrees::internal::IndexedFeatures * indexedFeatures, size_t dummy) : super(indexedFeatures) {}
     virtual bool init(const NumericTable * data, const NumericTable * resp, const IndexType * aSample) DAAL_C11_OVERRIDE;
+    //enables split search for several nodes or features of the same tree at the same time
+    bool setParallelMode(bool bParallel) { return _buffers.setParallelMode(bParallel); }
     void convertLeftImpToRight(size_t n, const ImpurityData & total, TSplitData & split)
     {
         subtractImpurity<algorithmFPType, cpu>(total.var, total.mean, split.left.var, split.left.mean, split.nLeft, split.left.var, split.left.mean,
@@ -112,8 +114,8 @@ public:
     void calcImpurity(const IndexType * aIdx, size_t n, ImpurityData & imp) const;
     bool findBestSplitForFeature(const algorithmFPType * featureVal, const IndexType * aIdx, size_t n, size_t nMinSplitPart,
                                  const algorithmFPType accuracy, const ImpurityData & curImpurity, TSplitData & split) const;
-    int findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx, size_t n, size_t nMinSplitPart,
-                                      const ImpurityData & curImpurity, TSplitData & split) const;
+    int findBestSplitForFeatureSorted(IndexType iFeature, const IndexType * aIdx, size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+                                      TSplitData & split) const;
     void finalizeBestSplit(const IndexType * aIdx, size_t n, IndexType iFeature, size_t idxFeatureValueBestSplit, TSplitData & bestSplit,
                            IndexType * bestSplitIdx) const;
     void simpleSplit(const algorithmFPType * featureVal, const IndexType * aIdx, TSplitData & split) const;
@@ -171,8 +173,24 @@ private:
                                          const algorithmFPType accuracy, const ImpurityData & curImpurity, TSplitData & split) const;
 
 private:
-    //buffer for the computation using indexed features
-    mutable TVector<IndexType, cpu, DefaultAllocator<cpu> > _idxFeatureBuf;
+    //buffers for the computation using indexed features
+    struct WorkBuffers
+    {
+        DAAL_NEW_DELETE();
+        bool reserveAs(const WorkBuffers & o)
+        {
+            idxFeatureBuf.reset(o.idxFeatureBuf.size());
+            sumBuf.reset(o.sumBuf.size());
+            return (idxFeatureBuf.size() == o.idxFeatureBuf.size()) && (sumBuf.size() == o.sumBuf.size());
+        }
+
+        TVector<IndexType, cpu, DefaultAllocator<cpu> > idxFeatureBuf; //number of samples for each of unique feature values
+        TVector<algorithmFPType, cpu, DefaultAllocator<cpu> > sumBuf;  //sums of responses for each of unique feature values
+    };
+    typedef WorkBuffersLock<WorkBuffers> WorkBuffersGuard;
+
+private:
+    mutable WorkBuffersHolder<WorkBuffers> _buffers;
 };
 
 #ifdef DEBUG_CHECK_IMPURITY
@@ -197,10 +215,12 @@ bool OrderedRespHelper<algorithmFPType, cpu>::init(const NumericTable * data, co
     DAAL_CHECK_STATUS_VAR(super::init(data, resp, aSample));
     if (this->_indexedFeatures)
     {
-        //init work buffer for the computation using indexed features
+        //init work buffers for the computation using indexed features
         const auto nDiffFeatMax = this->indexedFeatures().maxNumIndices();
-        _idxFeatureBuf.reset(nDiffFeatMax);
-        return _idxFeatureBuf.get();
+        WorkBuffers & buf       = _buffers.main();
+        buf.idxFeatureBuf.reset(nDiffFeatMax);
+        buf.sumBuf.reset(nDiffFeatMax);
+        return buf.idxFeatureBuf.get() && buf.sumBuf.get();
     }
     return true;
 }
@@ -312,14 +332,18 @@ void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType
 }
 
 template <typename algorithmFPType, CpuType cpu>
-int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * buf, IndexType iFeature, const IndexType * aIdx,
-                                                                           size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
+int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(IndexType iFeature, const IndexType * aIdx, size_t n,
+                                                                           size_t nMinSplitPart, const ImpurityData & curImpurity,
                                                                            TSplitData & split) const
 {
+    WorkBuffersGuard guard(_buffers);
+    if (!guard.get()) return -1;
+
     const auto nDiffFeatMax = this->indexedFeatures().numIndices(iFeature);
-    _idxFeatureBuf.setValues(nDiffFeatMax, 0);
+    guard.get()->idxFeatureBuf.setValues(nDiffFeatMax, 0);
 
     //the buffer keeps sums of responses for each of unique feature values
+    algorithmFPType * buf = guard.get()->sumBuf.get();
     for (size_t i = 0; i < nDiffFeatMax; ++i) buf[i] = algorithmFPType(0);
 
     typedef double intermSummFPType;
@@ -327,7 +351,7 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algor
     intermSummFPType bestImpDecreasePart =
         split.impurityDecrease < 0 ? -1 : (split.impurityDecrease + curImpurity.mean * curImpurity.mean) * algorithmFPType(n);
 
-    auto nFeatIdx             = _idxFeatureBuf.get(); //number of indexed feature values, array
+    auto nFeatIdx             = guard.get()->idxFeatureBuf.get(); //number of indexed feature values, array
     intermSummFPType sumTotal = 0;                    //total sum of responses in the set being split
     {
         const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
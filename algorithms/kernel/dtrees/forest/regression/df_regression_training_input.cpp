@@ -35,7 +35,7 @@ namespace decision_forest
 {
 namespace training
 {
-Status checkImpl(const decision_forest::training::Parameter & prm);
+Status checkImpl(const decision_forest::training::interface1::Parameter & prm);
 }
 
 namespace regression
@@ -264,6 +264,7 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
 
     const size_t nCols(_data->getNumberOfColumns());
     const size_t nRows(_data->getNumberOfRows());
+    dtrees::prediction::internal::SparseRows<algorithmFPType, cpu> sparseRows(*_data);
     daal::SafeStatus safeStat;
     if (_prob)
     {
@@ -280,9 +281,21 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             const size_t nRowsToProcess = (iBlock == (dim.nDataBlocks - 1)) ? dim.nRowsTotal - iStartRow : dim.nRowsInBlock;
             algorithmFPType * valL      = valFull + iStartRow * nClasses;
             algorithmFPType * val       = valL;
+            algorithmFPType * res       = resBD.get() ? resBD.get() + iStartRow : nullptr;
+            if (sparseRows.isSparse())
+            {
+                safeStat |= sparseRows.forEach(iStartRow, nRowsToProcess, [&](size_t iRow, const algorithmFPType * x) {
+                    val = valL + iRow * nClasses;
+                    predictByTrees(val, 0, nTreesTotal, nClasses, x);
+                    if (res)
+                    {
+                        res[iRow] = algorithmFPType(getMaxClass(val, nClasses));
+                    }
+                });
+                return;
+            }
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() ? resBD.get() + iStartRow : nullptr;
 
             size_t iRow = 0;
             for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
@@ -319,9 +332,18 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             algorithmFPType * const val = lsData.local();
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == (dim.nDataBlocks - 1)) ? dim.nRowsTotal - iStartRow : dim.nRowsInBlock;
+            algorithmFPType * res       = resBD.get() + iStartRow;
+            if (sparseRows.isSparse())
+            {
+                safeStat |= sparseRows.forEach(iStartRow, nRowsToProcess, [&](size_t iRow, const algorithmFPType * x) {
+                    services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses);
+                    predictByTrees(val, 0, nTreesTotal, nClasses, x);
+                    res[iRow] = algorithmFPType(getMaxClass(val, nClasses));
+                });
+                return;
+            }
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() + iStartRow;
 
             size_t iRow = 0;
             for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
@@ -29,6 +29,7 @@
 #include "gbt_classification_model_impl.h"
 #include "gbt_train_dense_default_impl.i"
 #include "gbt_train_tree_builder.i"
+#include "gbt_train_external_tree_builder.i"
 #include "service_error_handling.h"
 #include "service_algo_utils.h"
 
@@ -55,10 +56,11 @@ template <typename algorithmFPType, CpuType cpu>
 class LogisticLoss : public LossFunction<algorithmFPType, cpu>
 {
 public:
-    virtual void getGradients(size_t n, size_t nRows, const algorithmFPType * y, const algorithmFPType * f, const IndexType * sampleInd,
-                              algorithmFPType * gh) DAAL_C11_OVERRIDE
+    virtual services::Status getGradients(size_t n, size_t nRows, const algorithmFPType * y, const algorithmFPType * f, const IndexType * sampleInd,
+                                          algorithmFPType * gh) DAAL_C11_OVERRIDE
     {
         TVector<algorithmFPType, cpu, ScalableAllocator<cpu> > aExp(n);
+        DAAL_CHECK_MALLOC(aExp.get());
         auto exp                           = aExp.get();
         const algorithmFPType expThreshold = daal::internal::Math<algorithmFPType, cpu>::vExpThreshold();
         if (sampleInd)
@@ -109,6 +111,7 @@ public:
                 gh[2 * i + 1]   = sigm * (algorithmFPType(1.0) - sigm); //hessian
             }
         }
+        return services::Status();
     }
 };
 
@@ -120,8 +123,8 @@ class CrossEntropyLoss : public LossFunction<algorithmFPType, cpu>
 {
 public:
     CrossEntropyLoss(size_t numClasses) : _nClasses(numClasses) {}
-    virtual void getGradients(size_t n, size_t nRows, const algorithmFPType * y, const algorithmFPType * f, const IndexType * sampleInd,
-                              algorithmFPType * gh) DAAL_C11_OVERRIDE
+    virtual services::Status getGradients(size_t n, size_t nRows, const algorithmFPType * y, const algorithmFPType * f, const IndexType * sampleInd,
+                                          algorithmFPType * gh) DAAL_C11_OVERRIDE
     {
         static const size_t s_cMaxClassesBufSize = 12;
         const bool bUseTLS(_nClasses > s_cMaxClassesBufSize);
@@ -145,6 +148,7 @@ public:
                     gh_ik[0] = pk;
             }
         });
+        return services::Status();
     }
 
 protected:
@@ -195,7 +199,10 @@ public:
     TrainBatchTask(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const gbt::training::Parameter & par,
                    const dtrees::internal::FeatureTypes & featTypes, const dtrees::internal::IndexedFeatures * indexedFeatures,
                    engines::internal::BatchBaseImpl & engine, size_t nClasses)
-        : super(pHostApp, x, y, par, featTypes, indexedFeatures, engine, nClasses), _builder(nullptr), _ls(nullptr)
+        : super(pHostApp, x, y, par, static_cast<const gbt::classification::training::Parameter &>(par).externalMemoryPageSize, featTypes,
+                indexedFeatures, engine, nClasses),
+          _builder(nullptr),
+          _ls(nullptr)
     {}
 
     ~TrainBatchTask()
@@ -224,7 +231,8 @@ public:
             DAAL_CHECK_MALLOC(_ls);
             return s;
         }
-        _builder = TreeBuilderType::create(*this);
+        _builder = this->isExternalMemoryMode() ? ExternalMemoryTreeBuilder<algorithmFPType, int, BinIndexType, cpu>::create(*this)
+                                                : TreeBuilderType::create(*this);
         DAAL_CHECK_MALLOC(_builder);
         return _builder->init();
     }
@@ -329,13 +337,24 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
     const bool inexactWithHistMethod =
         !par.memorySavingMode && par.splitMethod == gbt::training::inexact && x->getNumberOfColumns() == nFeaturesPerNode;
+    const bool externalMemoryMode = isExternalMemoryMode(par, par.externalMemoryPageSize);
 
     services::Status s;
     dtrees::internal::IndexedFeatures indexedFeatures;
     dtrees::internal::FeatureTypes featTypes;
     DAAL_CHECK_MALLOC(featTypes.init(*x));
 
-    if (!par.memorySavingMode)
+    if (externalMemoryMode)
+    {
+        DAAL_CHECK_STATUS(s, (initBinsOnSample<algorithmFPType, cpu>(*x, featTypes, par, par.externalMemoryPageSize, indexedFeatures)));
+    }
+    else if (inexactWithHistMethod && (x->getDataLayout() == NumericTableIface::csrArray))
+    {
+        //the bins of the CSR data are computed on its non-zero values, the indices of the features are not created
+        BinParams prm(par.maxBins, par.minBinSize);
+        DAAL_CHECK_STATUS(s, (indexedFeatures.initBins<algorithmFPType, cpu>(*x, x->getNumberOfRows(), featTypes, prm)));
+    }
+    else if (!par.memorySavingMode)
     {
         BinParams prm(par.maxBins, par.minBinSize);
         DAAL_CHECK_STATUS(s,
@@ -376,7 +395,7 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     algorithmFPType * ptrTotalGain  = totalGainRows.get();
     algorithmFPType * ptrGain       = gainRows.get();
 
-    if (inexactWithHistMethod)
+    if (inexactWithHistMethod || externalMemoryMode)
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu>, Result>(
@@ -214,7 +214,7 @@ public:
         getMaxLvl(*super::top(), nLvls, static_cast<size_t>(-1));
         const size_t nNodes = getNumberOfNodesByLvls(nLvls);
 
-        *pTbl        = new GbtDecisionTree(nNodes, nLvls, super::top()->numChildren() + 1);
+        *pTbl        = new GbtDecisionTree(nNodes, nLvls, super::getNumberOfNodes());
         *pTblImp     = new HomogenNumericTable<double>(1, nNodes, NumericTable::doAllocate);
         *pTblSmplCnt = new HomogenNumericTable<int>(1, nNodes, NumericTable::doAllocate);
 
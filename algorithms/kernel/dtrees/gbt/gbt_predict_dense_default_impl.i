@@ -30,6 +30,11 @@
 #include "dtrees_predict_dense_default_impl.i"
 #include "dtrees_feature_type_helper.h"
 #include "gbt_internal.h"
+#include "service_data_utils.h"
+
+#if defined(__INTEL_COMPILER)
+    #include <immintrin.h>
+#endif
 
 namespace daal
 {
@@ -45,18 +50,162 @@ typedef float ModelFPType;
 typedef uint32_t FeatureIndexType;
 const FeatureIndexType VECTOR_BLOCK_SIZE = 64;
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// SIMD traversal of the tree by VECTOR_BLOCK_SIZE observations in lockstep, ordered
+// features only. Returns false if there is no implementation for the given CPU
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+struct PredictForTreeSimd
+{
+    static bool run(const ModelFPType * values, const FeatureIndexType * fIndexes, FeatureIndexType maxLvl, FeatureIndexType nFeat,
+                    const algorithmFPType * x, algorithmFPType v[])
+    {
+        return false;
+    }
+};
+
+#if defined(__INTEL_COMPILER)
+template <>
+struct PredictForTreeSimd<float, avx512>
+{
+    static bool run(const ModelFPType * values, const FeatureIndexType * fIndexes, FeatureIndexType maxLvl, FeatureIndexType nFeat, const float * x,
+                    float v[])
+    {
+        const FeatureIndexType simdWidth = 16;
+        const FeatureIndexType nVectors  = VECTOR_BLOCK_SIZE / simdWidth;
+        if (nFeat > FeatureIndexType(services::internal::MaxVal<int>::get()) / VECTOR_BLOCK_SIZE) return false;
+
+        const __m512i one       = _mm512_set1_epi32(1);
+        const __m512i rowOffset =
+            _mm512_mullo_epi32(_mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), _mm512_set1_epi32(nFeat));
+        __m512i idx[nVectors];
+        for (FeatureIndexType k = 0; k < nVectors; k++) idx[k] = one;
+
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            for (FeatureIndexType k = 0; k < nVectors; k++)
+            {
+                const __m512i fi   = _mm512_i32gather_epi32(idx[k], fIndexes, 4);
+                const __m512 sp    = _mm512_i32gather_ps(idx[k], values, 4);
+                const __m512 xv    = _mm512_i32gather_ps(_mm512_add_epi32(rowOffset, fi), x + k * simdWidth * nFeat, 4);
+                const __mmask16 gt = _mm512_cmp_ps_mask(xv, sp, _CMP_GT_OS);
+                idx[k]             = _mm512_add_epi32(idx[k], idx[k]);
+                idx[k]             = _mm512_mask_add_epi32(idx[k], gt, idx[k], one);
+            }
+        }
+        for (FeatureIndexType k = 0; k < nVectors; k++) _mm512_storeu_ps(v + k * simdWidth, _mm512_i32gather_ps(idx[k], values, 4));
+        return true;
+    }
+};
+
+template <>
+struct PredictForTreeSimd<double, avx512>
+{
+    static bool run(const ModelFPType * values, const FeatureIndexType * fIndexes, FeatureIndexType maxLvl, FeatureIndexType nFeat, const double * x,
+                    double v[])
+    {
+        const FeatureIndexType simdWidth = 8;
+        const FeatureIndexType nVectors  = VECTOR_BLOCK_SIZE / simdWidth;
+        if (nFeat > FeatureIndexType(services::internal::MaxVal<int>::get()) / VECTOR_BLOCK_SIZE) return false;
+
+        const __m256i one       = _mm256_set1_epi32(1);
+        const __m256i rowOffset = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(nFeat));
+        __m256i idx[nVectors];
+        for (FeatureIndexType k = 0; k < nVectors; k++) idx[k] = one;
+
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            for (FeatureIndexType k = 0; k < nVectors; k++)
+            {
+                const __m256i fi  = _mm256_i32gather_epi32((const int *)fIndexes, idx[k], 4);
+                const __m512d sp  = _mm512_cvtps_pd(_mm256_i32gather_ps(values, idx[k], 4));
+                const __m512d xv  = _mm512_i32gather_pd(_mm256_add_epi32(rowOffset, fi), x + k * simdWidth * nFeat, 8);
+                const __mmask8 gt = _mm512_cmp_pd_mask(xv, sp, _CMP_GT_OS);
+                idx[k]            = _mm256_add_epi32(idx[k], idx[k]);
+                idx[k]            = _mm256_mask_add_epi32(idx[k], gt, idx[k], one);
+            }
+        }
+        for (FeatureIndexType k = 0; k < nVectors; k++) _mm512_storeu_pd(v + k * simdWidth, _mm512_cvtps_pd(_mm256_i32gather_ps(values, idx[k], 4)));
+        return true;
+    }
+};
+
+template <>
+struct PredictForTreeSimd<float, avx2>
+{
+    static bool run(const ModelFPType * values, const FeatureIndexType * fIndexes, FeatureIndexType maxLvl, FeatureIndexType nFeat, const float * x,
+                    float v[])
+    {
+        const FeatureIndexType simdWidth = 8;
+        const FeatureIndexType nVectors  = VECTOR_BLOCK_SIZE / simdWidth;
+        if (nFeat > FeatureIndexType(services::internal::MaxVal<int>::get()) / VECTOR_BLOCK_SIZE) return false;
+
+        const __m256i rowOffset = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(nFeat));
+        __m256i idx[nVectors];
+        for (FeatureIndexType k = 0; k < nVectors; k++) idx[k] = _mm256_set1_epi32(1);
+
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            for (FeatureIndexType k = 0; k < nVectors; k++)
+            {
+                const __m256i fi = _mm256_i32gather_epi32((const int *)fIndexes, idx[k], 4);
+                const __m256 sp  = _mm256_i32gather_ps(values, idx[k], 4);
+                const __m256 xv  = _mm256_i32gather_ps(x + k * simdWidth * nFeat, _mm256_add_epi32(rowOffset, fi), 4);
+                const __m256i gt = _mm256_castps_si256(_mm256_cmp_ps(xv, sp, _CMP_GT_OS)); //-1 if greater, 0 otherwise
+                idx[k]           = _mm256_sub_epi32(_mm256_add_epi32(idx[k], idx[k]), gt);
+            }
+        }
+        for (FeatureIndexType k = 0; k < nVectors; k++) _mm256_storeu_ps(v + k * simdWidth, _mm256_i32gather_ps(values, idx[k], 4));
+        return true;
+    }
+};
+
+template <>
+struct PredictForTreeSimd<double, avx2>
+{
+    static bool run(const ModelFPType * values, const FeatureIndexType * fIndexes, FeatureIndexType maxLvl, FeatureIndexType nFeat, const double * x,
+                    double v[])
+    {
+        const FeatureIndexType simdWidth = 4;
+        const FeatureIndexType nVectors  = VECTOR_BLOCK_SIZE / simdWidth;
+        if (nFeat > FeatureIndexType(services::internal::MaxVal<int>::get()) / VECTOR_BLOCK_SIZE) return false;
+
+        const __m128i rowOffset = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(nFeat));
+        const __m256i lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+        __m128i idx[nVectors];
+        for (FeatureIndexType k = 0; k < nVectors; k++) idx[k] = _mm_set1_epi32(1);
+
+        for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
+        {
+            for (FeatureIndexType k = 0; k < nVectors; k++)
+            {
+                const __m128i fi   = _mm_i32gather_epi32((const int *)fIndexes, idx[k], 4);
+                const __m256d sp   = _mm256_cvtps_pd(_mm_i32gather_ps(values, idx[k], 4));
+                const __m256d xv   = _mm256_i32gather_pd(x + k * simdWidth * nFeat, _mm_add_epi32(rowOffset, fi), 8);
+                const __m256i gt64 = _mm256_castpd_si256(_mm256_cmp_pd(xv, sp, _CMP_GT_OS));
+                const __m128i gt   = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(gt64, lowHalves)); //-1 if greater, 0 otherwise
+                idx[k]             = _mm_sub_epi32(_mm_add_epi32(idx[k], idx[k]), gt);
+            }
+        }
+        for (FeatureIndexType k = 0; k < nVectors; k++) _mm256_storeu_pd(v + k * simdWidth, _mm256_cvtps_pd(_mm_i32gather_ps(values, idx[k], 4)));
+        return true;
+    }
+};
+#endif
+
 template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
 inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes & featTypes, const algorithmFPType * x, algorithmFPType v[])
 {
     const ModelFPType * const values        = t.getSplitPoints() - 1;
     const FeatureIndexType * const fIndexes = t.getFeatureIndexesForSplit() - 1;
     const FeatureIndexType nFeat            = featTypes.getNumberOfFeatures();
+    const FeatureIndexType maxLvl           = t.getMaxLvl();
+
+    if (!featTypes.hasUnorderedFeatures() && PredictForTreeSimd<algorithmFPType, cpu>::run(values, fIndexes, maxLvl, nFeat, x, v)) return;
 
     FeatureIndexType i[VECTOR_BLOCK_SIZE];
     services::internal::service_memset_seq<FeatureIndexType, cpu>(i, FeatureIndexType(1), VECTOR_BLOCK_SIZE);
 
-    const FeatureIndexType maxLvl = t.getMaxLvl();
-
     if (featTypes.hasUnorderedFeatures())
     {
         for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
@@ -32,6 +32,7 @@
 #include "gbt_model_impl.h"
 #include "daal_atomic_int.h"
 #include "service_service.h"
+#include "service_sort.h"
 
 namespace daal
 {
@@ -76,6 +77,13 @@ public:
     services::Status init(const NumericTable * data, const NumericTable * resp, const IndexType * aIdxToRow)
     {
         super::init(data, resp);
+        if (!this->_dataDirect && (data->getDataLayout() == NumericTableIface::csrArray))
+        {
+            //the columns are transposed once instead of reading the CSR numeric table value by value
+            services::Status s = _sparseColumnsData.init(*const_cast<NumericTable *>(data));
+            if (!s) return s;
+            this->setSparseColumns(&_sparseColumnsData);
+        }
         _y.reset(data->getNumberOfRows());
         DAAL_CHECK_MALLOC(_y.get());
         ReadRows<algorithmFPType, cpu> bd(const_cast<NumericTable *>(resp), 0, _y.size());
@@ -91,6 +99,14 @@ public:
         {
             for (size_t i = 0; i < n; ++i) aVal[i] = this->_dataDirect[aIdx[i] * this->_nCols + iCol];
         }
+        else if (this->_sparseColumns)
+        {
+            //the column is located once for all the observations of the node
+            const size_t * const rows            = this->_sparseColumns->rows(iCol);
+            const algorithmFPType * const values = this->_sparseColumns->values(iCol);
+            const size_t nValues                 = this->_sparseColumns->size(iCol);
+            for (size_t i = 0; i < n; ++i) aVal[i] = super::findSparseValue(rows, values, nValues, aIdx[i]);
+        }
         else
         {
             data_management::BlockDescriptor<algorithmFPType> bd;
@@ -120,6 +136,7 @@ public:
 
 protected:
     TArray<algorithmFPType, cpu> _y;
+    typename super::SparseColumnsType _sparseColumnsData;
     const IndexType * _aIdxToRow; //for the methods that take in array of indices, this is the
                                   // mapping of the index to the row, if required
 };
@@ -169,8 +186,8 @@ template <typename algorithmFPType, CpuType cpu>
 class LossFunction : public Base
 {
 public:
-    virtual void getGradients(size_t n, size_t nRows, const algorithmFPType * y, const algorithmFPType * f, const IndexType * sampleInd,
-                              algorithmFPType * gh) = 0;
+    virtual services::Status getGradients(size_t n, size_t nRows, const algorithmFPType * y, const algorithmFPType * f, const IndexType * sampleInd,
+                                          algorithmFPType * gh) = 0;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -456,6 +473,8 @@ template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
 class TrainBatchTaskBaseXBoost;
 template <typename algorithmFPType, CpuType cpu>
 class MemHelperBase;
+template <typename BinIndexType, CpuType cpu>
+class BinPages;
 
 template <CpuType cpu>
 struct EmptyResult
@@ -716,6 +735,121 @@ public:
     }
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Bin indices of the features of the CSR numeric table stored row by row in the CSR format.
+// The values that fall into the bin of zero of the feature are not stored,
+// so the memory and the cost of the histograms depend on the number of non-zero values only
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename BinIndexType, CpuType cpu>
+class SparseBins
+{
+public:
+    typedef uint32_t FeatureIndexType;
+
+    //reads the data, maps the non-zero values to the bins and keeps the ones that differ from the bins of zero
+    template <typename algorithmFPType>
+    services::Status init(const NumericTable & x, const IndexedFeatures & indexedFeatures, const FeatureTypes & featTypes);
+
+    const BinIndexType * zeroBins() const { return _zeroBins.get(); }
+    const size_t * rowOffsets() const { return _rowOffsets.get(); }
+    const FeatureIndexType * features() const { return _features.get(); }
+    const BinIndexType * bins() const { return _bins.get(); }
+
+    //returns the bin of the feature in the row, the features of a row are sorted in increasing order
+    BinIndexType get(size_t iRow, size_t iFeature) const
+    {
+        const size_t iEnd = _rowOffsets[iRow + 1];
+        size_t iLeft = _rowOffsets[iRow], iRight = iEnd;
+        while (iLeft < iRight)
+        {
+            const size_t iMid = (iLeft + iRight) / 2;
+            if (_features[iMid] < iFeature)
+                iLeft = iMid + 1;
+            else
+                iRight = iMid;
+        }
+        return ((iLeft < iEnd) && (_features[iLeft] == iFeature)) ? _bins[iLeft] : _zeroBins[iFeature];
+    }
+
+protected:
+    TVector<BinIndexType, cpu, ScalableAllocator<cpu> > _zeroBins;
+    TVector<size_t, cpu, ScalableAllocator<cpu> > _rowOffsets;
+    TVector<FeatureIndexType, cpu, ScalableAllocator<cpu> > _features;
+    TVector<BinIndexType, cpu, ScalableAllocator<cpu> > _bins;
+};
+
+template <typename BinIndexType, CpuType cpu>
+template <typename algorithmFPType>
+services::Status SparseBins<BinIndexType, cpu>::init(const NumericTable & x, const IndexedFeatures & indexedFeatures, const FeatureTypes & featTypes)
+{
+    const size_t sizeOfBlock = 1024;
+    const size_t nRows       = x.getNumberOfRows();
+    const size_t nCols       = x.getNumberOfColumns();
+    const size_t nBlocks     = nRows / sizeOfBlock + !!(nRows % sizeOfBlock);
+    DAAL_CHECK(nCols <= size_t(FeatureIndexType(-1)), services::ErrorIncorrectNumberOfFeatures);
+
+    ReadRowsCSR<algorithmFPType, cpu> csr(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&x)), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(csr);
+    const algorithmFPType * const values = csr.values();
+    const size_t * const cols            = csr.cols();
+    const size_t * const csrRowOffsets   = csr.rows();
+
+    TVector<bool, cpu> aUnordered(nCols);
+    _zeroBins.reset(nCols);
+    _rowOffsets.reset(nRows + 1);
+    DAAL_CHECK_MALLOC(aUnordered.get() && _zeroBins.get() && _rowOffsets.get());
+    for (size_t j = 0; j < nCols; ++j)
+    {
+        aUnordered[j] = featTypes.isUnordered(j);
+        _zeroBins[j]  = (BinIndexType)indexedFeatures.binIndex(j, ModelFPType(0), aUnordered[j]);
+    }
+
+    //the number of the stored bins of every row
+    _rowOffsets[0] = 0;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iEnd = ((iBlock + 1) * sizeOfBlock < nRows) ? (iBlock + 1) * sizeOfBlock : nRows;
+        for (size_t iRow = iBlock * sizeOfBlock; iRow < iEnd; ++iRow)
+        {
+            size_t n = 0;
+            for (size_t i = csrRowOffsets[iRow] - csrRowOffsets[0], iLast = csrRowOffsets[iRow + 1] - csrRowOffsets[0]; i < iLast; ++i)
+            {
+                const size_t j = cols[i] - 1;
+                n += ((BinIndexType)indexedFeatures.binIndex(j, values[i], aUnordered[j]) != _zeroBins[j]);
+            }
+            _rowOffsets[iRow + 1] = n;
+        }
+    });
+    for (size_t iRow = 0; iRow < nRows; ++iRow) _rowOffsets[iRow + 1] += _rowOffsets[iRow];
+
+    const size_t nStored = _rowOffsets[nRows];
+    _features.reset(nStored);
+    _bins.reset(nStored);
+    DAAL_CHECK_MALLOC(!nStored || (_features.get() && _bins.get()));
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iEnd = ((iBlock + 1) * sizeOfBlock < nRows) ? (iBlock + 1) * sizeOfBlock : nRows;
+        for (size_t iRow = iBlock * sizeOfBlock; iRow < iEnd; ++iRow)
+        {
+            FeatureIndexType * const features = _features.get() + _rowOffsets[iRow];
+            BinIndexType * const bins         = _bins.get() + _rowOffsets[iRow];
+            size_t n                          = 0;
+            bool bSorted                      = true;
+            for (size_t i = csrRowOffsets[iRow] - csrRowOffsets[0], iLast = csrRowOffsets[iRow + 1] - csrRowOffsets[0]; i < iLast; ++i)
+            {
+                const size_t j         = cols[i] - 1;
+                const BinIndexType bin = (BinIndexType)indexedFeatures.binIndex(j, values[i], aUnordered[j]);
+                if (bin == _zeroBins[j]) continue;
+                bSorted     = bSorted && (!n || (features[n - 1] < j));
+                features[n] = FeatureIndexType(j);
+                bins[n]     = bin;
+                ++n;
+            }
+            if (!bSorted) daal::algorithms::internal::qSort<FeatureIndexType, BinIndexType, cpu>(n, features, bins);
+        }
+    });
+    return services::Status();
+}
+
 template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
 struct GlobalStorages
 {
@@ -723,7 +857,7 @@ struct GlobalStorages
     using TlsType   = TlsGHSumMerge<GHSumForTLS<GHSumType, cpu>, algorithmFPType, cpu>;
 
     GlobalStorages(size_t nFeatures, size_t nStor, size_t nUniq, size_t nGlobal)
-        : singleGHSums(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures)
+        : singleGHSums(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures), newFI(nullptr), pages(nullptr), sparseBins(nullptr)
     {}
 
     GroupOfStorages<GHSumType, cpu> singleGHSums;
@@ -731,7 +865,11 @@ struct GlobalStorages
     TVector<size_t, cpu, ScalableAllocator<cpu> > nUniquesArr;
     size_t nDiffFeatMax;
 
-    BinIndexType * newFI;
+    BinIndexType * newFI; //row-major bin indices of the features, used by the histogram method only
+
+    BinPages<BinIndexType, cpu> * pages; //bin indices of the features stored in the external memory mode only
+
+    const SparseBins<BinIndexType, cpu> * sparseBins; //bin indices of the features of the CSR data, used by the histogram method only
 };
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
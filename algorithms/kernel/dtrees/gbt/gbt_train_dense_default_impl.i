@@ -30,6 +30,7 @@
 #include "dtrees_predict_dense_default_impl.i"
 #include "gbt_internal.h"
 #include "gbt_train_aux.i"
+#include "gbt_train_external_memory.i"
 
 namespace daal
 {
@@ -81,6 +82,8 @@ public:
     const RowIndexType * aSampleToF() const { return _aSampleToF.get(); }
     bool isThreaded() const { return _bThreaded; }
     bool isIndexedMode() const { return !par().memorySavingMode; }
+    bool isExternalMemoryMode() const { return gbt::training::internal::isExternalMemoryMode(_par, _externalMemoryPageSize); }
+    size_t externalMemoryPageSize() const { return _externalMemoryPageSize; }
     RowIndexType numAvailableThreads() const
     {
         auto n = _nParallelNodes.get();
@@ -95,6 +98,14 @@ public:
     virtual services::Status init();
     bool isIndirect() const { return _bIndirect; }
     double computeLeafWeightUpdateF(const int * idx, size_t n, const ImpurityType & imp, size_t iTree);
+    //returns the response of the leaf, inc is set to the increment of f of the observations of the leaf
+    double computeLeafWeight(const ImpurityType & imp, algorithmFPType & inc) const
+    {
+        const algorithmFPType val = imp.h + _par.lambda;
+        inc                       = isZero<algorithmFPType, cpu>(val) ? algorithmFPType(0) : (-imp.g / val) * _par.shrinkage;
+        return _initialF + inc;
+    }
+    void updateF(size_t iRow, size_t iTree, algorithmFPType inc) { _aF[iRow * _nTrees + iTree] += inc; }
     void updateOOB(size_t iTree, TreeType & t);
     bool terminateCriteria(size_t nSamples, size_t level, const ImpurityType & imp) const
     {
@@ -128,11 +139,13 @@ public:
 protected:
     typedef dtrees::internal::TVector<algorithmFPType, cpu> algorithmFPTypeArray;
 
-    TrainBatchTaskBase(const NumericTable * x, const NumericTable * y, const Parameter & par, const dtrees::internal::FeatureTypes & featTypes,
-                       const dtrees::internal::IndexedFeatures * indexedFeatures, engines::internal::BatchBaseImpl & engine, size_t nClasses)
+    TrainBatchTaskBase(const NumericTable * x, const NumericTable * y, const Parameter & par, size_t externalMemoryPageSize,
+                       const dtrees::internal::FeatureTypes & featTypes, const dtrees::internal::IndexedFeatures * indexedFeatures,
+                       engines::internal::BatchBaseImpl & engine, size_t nClasses)
         : _data(x),
           _resp(y),
           _par(par),
+          _externalMemoryPageSize(externalMemoryPageSize),
           _engine(engine),
           _nClasses(nClasses),
           _nSamples(par.observationsPerTreeFraction * x->getNumberOfRows()),
@@ -145,7 +158,8 @@ protected:
           _nParallelNodes(0)
     {
         int internalOptions = par.internalOptions;
-        if (_nTrees < 2 || par.memorySavingMode) internalOptions &= ~parallelTrees; //clear parallelTrees flag
+        if (_nTrees < 2 || par.memorySavingMode || gbt::training::internal::isExternalMemoryMode(par, externalMemoryPageSize))
+            internalOptions &= ~parallelTrees; //clear parallelTrees flag, the trees share the pages of the external memory
         _bThreaded = ((_nThreadsMax > 1) && ((internalOptions & parallelAll) != 0));
         if (_bThreaded)
         {
@@ -164,7 +178,7 @@ protected:
     virtual services::Status buildTrees(gbt::internal::GbtDecisionTree ** aTbl, HomogenNumericTable<double> ** aTblImp,
                                         HomogenNumericTable<int> ** aTblSmplCnt,
                                         GlobalStorages<algorithmFPType, BinIndexType, cpu> & GH_SUMS_BUF) = 0;
-    virtual void step(const algorithmFPType * y)                                                          = 0;
+    virtual services::Status step(const algorithmFPType * y)                                              = 0;
     virtual bool getInitialF(algorithmFPType & val) { return false; }
 
     //loss function arguments (current estimation of y)
@@ -198,6 +212,7 @@ protected:
     const NumericTable * _data;
     const NumericTable * _resp;
     const Parameter & _par;
+    const size_t _externalMemoryPageSize;
     const RowIndexType _nSamples;
     const RowIndexType _nFeaturesPerNode;
     const int _nThreadsMax;
@@ -294,7 +309,8 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
         }
         daal::algorithms::internal::qSort<RowIndexType, cpu>(nSamples(), aSampleToF);
     }
-    step(this->_dataHelper.y());
+    services::Status s = step(this->_dataHelper.y());
+    DAAL_CHECK_STATUS_VAR(s);
     _nParallelNodes.set(0);
     return buildTrees(aTbl, aTblImp, aTblSmplCnt, GH_SUMS_BUF);
 }
@@ -328,17 +344,17 @@ public:
     typedef gh<algorithmFPType, cpu> ghType;
 
     TrainBatchTaskBaseXBoost(HostAppIface * hostApp, const NumericTable * x, const NumericTable * y, const Parameter & par,
-                             const dtrees::internal::FeatureTypes & featTypes, const dtrees::internal::IndexedFeatures * indexedFeatures,
-                             engines::internal::BatchBaseImpl & engine, size_t nClasses)
-        : super(x, y, par, featTypes, indexedFeatures, engine, nClasses), _hostApp(hostApp)
+                             size_t externalMemoryPageSize, const dtrees::internal::FeatureTypes & featTypes,
+                             const dtrees::internal::IndexedFeatures * indexedFeatures, engines::internal::BatchBaseImpl & engine, size_t nClasses)
+        : super(x, y, par, externalMemoryPageSize, featTypes, indexedFeatures, engine, nClasses), _hostApp(hostApp)
     {}
 
     //loss function gradient and hessian values calculated in f() points
     ghType * grad(size_t iTree) { return _aGH.get() + iTree * this->_data->getNumberOfRows(); }
-    void step(const algorithmFPType * y) DAAL_C11_OVERRIDE
+    services::Status step(const algorithmFPType * y) DAAL_C11_OVERRIDE
     {
-        this->lossFunc()->getGradients(this->_nSamples, this->_data->getNumberOfRows(), y, this->f(), this->aSampleToF(),
-                                       (algorithmFPType *)_aGH.get());
+        return this->lossFunc()->getGradients(this->_nSamples, this->_data->getNumberOfRows(), y, this->f(), this->aSampleToF(),
+                                              (algorithmFPType *)_aGH.get());
     }
     virtual services::Status init() DAAL_C11_OVERRIDE
     {
@@ -365,13 +381,14 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 {
     services::Status s;
 
-    const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
-    const bool inexactWithHistMethod =
-        !par.memorySavingMode && par.splitMethod == gbt::training::inexact && x->getNumberOfColumns() == nFeaturesPerNode;
-
     TaskType task(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, engine, nClasses);
     DAAL_CHECK_STATUS(s, task.init());
 
+    const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
+    const bool externalMemoryMode = task.isExternalMemoryMode();
+    const bool inexactWithHistMethod =
+        !externalMemoryMode && !par.memorySavingMode && par.splitMethod == gbt::training::inexact && x->getNumberOfColumns() == nFeaturesPerNode;
+
     const size_t nTrees = task.nTrees();
     DAAL_CHECK_MALLOC(md.reserve(par.maxIterations * nTrees));
 
@@ -435,8 +452,21 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
     }
 
     TVector<BinIndexType, cpu, ScalableAllocator<cpu> > newFIArr;
+    BinPages<BinIndexType, cpu> pages;
+    SparseBins<BinIndexType, cpu> sparseBins;
 
-    if (inexactWithHistMethod)
+    if (externalMemoryMode)
+    {
+        DAAL_CHECK_STATUS(s, pages.template init<algorithmFPType>(*x, indexedFeatures, featTypes, task.externalMemoryPageSize()));
+        storage.pages = &pages;
+    }
+    else if (inexactWithHistMethod && (x->getDataLayout() == NumericTableIface::csrArray))
+    {
+        // the bins of the CSR data are computed by IndexedFeatures::initBins(), the bin indices are kept sparse
+        DAAL_CHECK_STATUS(s, sparseBins.template init<algorithmFPType>(*x, indexedFeatures, featTypes));
+        storage.sparseBins = &sparseBins;
+    }
+    else if (inexactWithHistMethod)
     {
         size_t nThreads    = threader_get_threads_number();
         size_t nRows       = x->getNumberOfRows();
@@ -465,6 +495,9 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
             }
         });
         storage.newFI = newFI;
+
+        // only the compact bin indices are used by the histogram method further on
+        indexedFeatures.releaseData();
     }
 
     size_t * totalCoverFeature  = nullptr;
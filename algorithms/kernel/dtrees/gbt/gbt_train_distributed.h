@@ -0,0 +1,125 @@
+/* file: gbt_train_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Layout of the messages and of the internal data of the distributed
+//  processing mode of gradient boosted trees training.
+//
+//  The messages are numeric tables of one row of doubles whatever the type
+//  used in the computations is, so that the sums and the numbers of the
+//  observations are exact. Every kind of the messages has its own identifier
+//  of the input and of the partial result, the layouts are:
+//
+//  binSketches, step 1 to step 2:
+//      [nRows, sum of responses, nFeatures, {nBins, {border, nObservations} x nBins} x nFeatures]
+//  histograms, step 1 to step 2:
+//      [nNodes, nBinsTotal, {{g, h, nObservations} x nBinsTotal} x nNodes]
+//  binBorders, step 2 to step 1:
+//      [initial f, nFeatures, {nBins, {border} x nBins} x nFeatures]
+//  levelSplits, step 2 to step 1:
+//      [isNewTree, nNodes, {DistributedNodeSplitField} x nNodes, nNext, {isHistogramRequired} x nNext]
+//--
+*/
+
+#ifndef __GBT_TRAIN_DISTRIBUTED_H__
+#define __GBT_TRAIN_DISTRIBUTED_H__
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+//fields of the split of a node of the level in levelSplits
+enum DistributedNodeSplitField
+{
+    splitFeature,   //split feature, -1 if the node is not split
+    splitBin,       //last bin of the left kid
+    splitIncLeft,   //increment of f of the observations moving to the left kid
+    splitIncRight,  //increment of f of the observations moving to the right kid
+    splitNextLeft,  //index of the left kid in the next level, -1 if it is not there
+    splitNextRight, //index of the right kid in the next level, -1 if it is not there
+    nSplitFields
+};
+
+//internal data of step 1 kept between the calls
+enum DistributedLocalDataId
+{
+    localBinnedData, //bin indices of the features of the observations, HomogenNumericTable<BinIndexType>
+    localF,          //current approximation of the response of the observations
+    localRowNodes,   //index of the node of the observation at the current level, -1 if it is in a leaf, HomogenNumericTable<int>
+    localNBins,      //number of bins of the features, HomogenNumericTable<int>
+    nLocalData
+};
+
+//internal data of step 2 kept between the calls
+enum DistributedMasterDataId
+{
+    masterState,          //scalar values of DistributedMasterStateField
+    masterBinBorders,     //[nFeatures, {nBins, {border} x nBins} x nFeatures]
+    masterLevelNodes,     //DistributedLevelNodeField of the nodes of the current level
+    masterParentHist,     //histograms of the nodes of the previous level
+    masterCurrentTree,    //DistributedTreeNodeField of the nodes of the tree being built
+    masterTrees,          //collection of the built trees in the same format as masterCurrentTree
+    nMasterData
+};
+
+enum DistributedMasterStateField
+{
+    stateNFeatures,
+    stateNRows,
+    stateInitialF,
+    stateITree,
+    stateLevel,
+    stateIsFinished,
+    nStateFields
+};
+
+enum DistributedLevelNodeField
+{
+    levelTreeNode,  //index of the node in masterCurrentTree
+    levelParent,    //index of the parent in the previous level, -1 for the root
+    levelSibling,   //index of the sibling whose histograms are subtracted from the ones of the parent, -1 if the histograms are computed
+    levelIsLeaf,    //1 if the node is a leaf whose histograms are required to derive the ones of the sibling only
+    levelG,         //sum of the gradients
+    levelH,         //sum of the hessians
+    levelN,         //number of the observations
+    nLevelNodeFields
+};
+
+enum DistributedTreeNodeField
+{
+    treeFeature,  //split feature, -1 for a leaf
+    treeLeftKid,  //index of the left kid, the right kid follows it
+    treeValue,    //split value or response of the leaf
+    treeImpurity, //impurity of the node
+    treeCount,    //number of the observations in the node
+    nTreeNodeFields
+};
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -0,0 +1,988 @@
+/* file: gbt_train_distributed.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the distributed processing mode of gradient boosted trees
+//  training.
+//
+//  The local nodes keep the bin indices of their observations, the current
+//  approximation of the response and the node of every observation at the
+//  current level of the tree being built. The master node keeps the bin
+//  borders, the histograms of the previous level and the trees.
+//
+//  On the first call the local nodes send the summaries of the values of the
+//  features, and the master node merges them into the global bin borders.
+//  Then every iteration of the local nodes applies the splits of the previous
+//  level and computes the histograms of the nodes of the next level, and every
+//  iteration of the master node sums the histograms over the local nodes and
+//  finds the splits. The histograms of the bigger kid are derived from the ones
+//  of the parent and its sibling, so they are not computed on the local nodes.
+//--
+*/
+
+#ifndef __GBT_TRAIN_DISTRIBUTED_I__
+#define __GBT_TRAIN_DISTRIBUTED_I__
+
+#include "gbt_train_distributed.h"
+#include "gbt_train_aux.i"
+#include "gbt_model_impl.h"
+#include "service_numeric_table.h"
+#include "service_sort.h"
+#include "service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+
+//number of the values of a bin of the histogram in the messages: sums of the gradients and the hessians, number of the observations
+const size_t nDistributedBinValues = 3;
+
+template <typename T, CpuType cpu>
+T * getInternalArray(const DataCollection & data, size_t id, size_t & nRows)
+{
+    HomogenNumericTable<T> * pTbl = (id < data.size()) ? dynamic_cast<HomogenNumericTable<T> *>(data[id].get()) : nullptr;
+    nRows                         = pTbl ? pTbl->getNumberOfRows() : 0;
+    return pTbl ? pTbl->getArray() : nullptr;
+}
+
+template <typename T, CpuType cpu>
+T * createInternalTable(DataCollection & data, size_t id, size_t nCols, size_t nRows, services::Status & s)
+{
+    services::SharedPtr<HomogenNumericTableCPU<T, cpu> > pTbl = HomogenNumericTableCPU<T, cpu>::create(nCols, nRows, &s);
+    if (!s) return nullptr;
+    data[id] = pTbl;
+    return pTbl->getArray();
+}
+
+template <CpuType cpu>
+double * createMessage(NumericTablePtr & msg, size_t size, services::Status & s)
+{
+    services::SharedPtr<HomogenNumericTableCPU<double, cpu> > pTbl = HomogenNumericTableCPU<double, cpu>::create(size, 1, &s);
+    if (!s) return nullptr;
+    msg = pTbl;
+    return pTbl->getArray();
+}
+
+template <CpuType cpu>
+void resetInternalData(DataCollection & data, size_t nData)
+{
+    data.clear();
+    for (size_t i = 0; i < nData; ++i) data.push_back(SerializationIfacePtr());
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// First step of the distributed processing mode, computations on the local node
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+class DistributedLocalStep
+{
+public:
+    typedef LossFunction<algorithmFPType, cpu> LossType;
+
+    DistributedLocalStep(const NumericTable & x, const NumericTable & y, DataCollection & data, const Parameter & par)
+        : _x(x), _y(y), _data(data), _par(par), _nRows(x.getNumberOfRows()), _nFeatures(x.getNumberOfColumns())
+    {}
+
+    //computes the bin sketches if none of the messages of step 2 is given, the histograms otherwise
+    services::Status compute(const NumericTable * binBordersMsg, const NumericTable * levelSplitsMsg, LossType & loss,
+                             NumericTablePtr & binSketchesMsg, NumericTablePtr & histogramsMsg);
+
+protected:
+    services::Status computeSketches(NumericTablePtr & binSketchesMsg);
+    services::Status binData(const double * msg, size_t msgSize);
+    services::Status applySplits(const double * splits, size_t nNodes, bool isNewTree);
+    services::Status computeHistograms(LossType & loss, const double * isRequired, size_t nNext, NumericTablePtr & histogramsMsg);
+
+protected:
+    const NumericTable & _x;
+    const NumericTable & _y;
+    DataCollection & _data;
+    const Parameter & _par;
+    const size_t _nRows;
+    const size_t _nFeatures;
+    static const size_t _blockSize = 1024;
+};
+
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status DistributedLocalStep<algorithmFPType, BinIndexType, cpu>::compute(const NumericTable * binBordersMsg,
+                                                                                  const NumericTable * levelSplitsMsg, LossType & loss,
+                                                                                  NumericTablePtr & binSketchesMsg, NumericTablePtr & histogramsMsg)
+{
+    if (!binBordersMsg && !levelSplitsMsg)
+    {
+        resetInternalData<cpu>(_data, nLocalData);
+        return computeSketches(binSketchesMsg);
+    }
+
+    const NumericTable * pTbl = binBordersMsg ? binBordersMsg : levelSplitsMsg;
+    const size_t msgSize      = pTbl->getNumberOfColumns();
+    ReadRows<double, cpu> msgRows(const_cast<NumericTable *>(pTbl), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(msgRows);
+    const double * msg = msgRows.get();
+
+    services::Status s;
+    if (binBordersMsg)
+    {
+        DAAL_CHECK_STATUS(s, binData(msg, msgSize));
+        const double isRootRequired = 1;
+        return computeHistograms(loss, &isRootRequired, 1, histogramsMsg);
+    }
+
+    DAAL_CHECK(msgSize >= 2, services::ErrorIncorrectSizeOfInputNumericTable);
+    const bool isNewTree = (msg[0] != 0);
+    const size_t nNodes  = size_t(msg[1]);
+    const size_t iNext   = 2 + nNodes * nSplitFields;
+    DAAL_CHECK(msgSize > iNext, services::ErrorIncorrectSizeOfInputNumericTable);
+    const size_t nNext = size_t(msg[iNext]);
+    DAAL_CHECK(msgSize == iNext + 1 + nNext, services::ErrorIncorrectSizeOfInputNumericTable);
+    DAAL_CHECK_STATUS(s, applySplits(msg + 2, nNodes, isNewTree));
+    return computeHistograms(loss, msg + iNext + 1, nNext, histogramsMsg);
+}
+
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status DistributedLocalStep<algorithmFPType, BinIndexType, cpu>::computeSketches(NumericTablePtr & binSketchesMsg)
+{
+    //every feature is split into at most maxBins parts of sorted values, equal values are not split
+    const size_t maxBins = _par.maxBins;
+    const size_t nPerBin = _nRows / maxBins + !!(_nRows % maxBins);
+    const size_t binSize = (nPerBin > _par.minBinSize) ? nPerBin : (_par.minBinSize ? _par.minBinSize : 1);
+    const size_t nValues = 2 * maxBins;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nFeatures, nValues);
+
+    TArray<double, cpu> sketches(_nFeatures * nValues);
+    TArray<size_t, cpu> nSketchBins(_nFeatures);
+    DAAL_CHECK_MALLOC(sketches.get() && nSketchBins.get());
+
+    SafeStatus safeStat;
+    daal::threader_for(_nFeatures, _nFeatures, [&](size_t iFeature) {
+        TArray<algorithmFPType, cpu> values(_nRows);
+        DAAL_CHECK_MALLOC_THR(values.get());
+        ReadColumns<algorithmFPType, cpu> col(const_cast<NumericTable *>(&_x), iFeature, 0, _nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(col);
+        services::internal::tmemcpy<algorithmFPType, cpu>(values.get(), col.get(), _nRows);
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(_nRows, values.get());
+
+        double * sketch = sketches.get() + iFeature * nValues;
+        size_t nBins    = 0;
+        for (size_t i = 0; i < _nRows;)
+        {
+            size_t iEnd = (i + binSize < _nRows) ? i + binSize : _nRows;
+            while ((iEnd < _nRows) && (values[iEnd] == values[iEnd - 1])) ++iEnd;
+            sketch[2 * nBins]     = values[iEnd - 1];
+            sketch[2 * nBins + 1] = double(iEnd - i);
+            ++nBins;
+            i = iEnd;
+        }
+        nSketchBins[iFeature] = nBins;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    ReadColumns<algorithmFPType, cpu> yCol(const_cast<NumericTable *>(&_y), 0, 0, _nRows);
+    DAAL_CHECK_BLOCK_STATUS(yCol);
+    double sumY = 0;
+    for (size_t i = 0; i < _nRows; ++i) sumY += yCol.get()[i];
+
+    size_t msgSize = 3;
+    for (size_t iFeature = 0; iFeature < _nFeatures; ++iFeature) msgSize += 1 + 2 * nSketchBins[iFeature];
+
+    services::Status s;
+    double * msg = createMessage<cpu>(binSketchesMsg, msgSize, s);
+    DAAL_CHECK_STATUS_VAR(s);
+    msg[0]     = double(_nRows);
+    msg[1]     = sumY;
+    msg[2]     = double(_nFeatures);
+    size_t pos = 3;
+    for (size_t iFeature = 0; iFeature < _nFeatures; ++iFeature)
+    {
+        const size_t nBins = nSketchBins[iFeature];
+        msg[pos++]         = double(nBins);
+        services::internal::tmemcpy<double, cpu>(msg + pos, sketches.get() + iFeature * nValues, 2 * nBins);
+        pos += 2 * nBins;
+    }
+    return s;
+}
+
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status DistributedLocalStep<algorithmFPType, BinIndexType, cpu>::binData(const double * msg, size_t msgSize)
+{
+    DAAL_CHECK(msgSize >= 2, services::ErrorIncorrectSizeOfInputNumericTable);
+    DAAL_CHECK(size_t(msg[1]) == _nFeatures, services::ErrorIncorrectNumberOfFeatures);
+    DAAL_CHECK(_data.size() == nLocalData, services::ErrorIncorrectValueInTheNumericTable);
+
+    services::Status s;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nRows, _nFeatures);
+    services::SharedPtr<HomogenNumericTable<BinIndexType> > binnedTbl =
+        HomogenNumericTable<BinIndexType>::create(_nFeatures, _nRows, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    _data[localBinnedData] = binnedTbl;
+    BinIndexType * binned  = binnedTbl->getArray();
+    algorithmFPType * f    = createInternalTable<algorithmFPType, cpu>(_data, localF, 1, _nRows, s);
+    int * rowNodes         = createInternalTable<int, cpu>(_data, localRowNodes, 1, _nRows, s);
+    int * nBins            = createInternalTable<int, cpu>(_data, localNBins, _nFeatures, 1, s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    TArray<const double *, cpu> borders(_nFeatures);
+    DAAL_CHECK_MALLOC(borders.get());
+    size_t pos = 2;
+    for (size_t iFeature = 0; iFeature < _nFeatures; ++iFeature)
+    {
+        DAAL_CHECK(pos < msgSize, services::ErrorIncorrectSizeOfInputNumericTable);
+        nBins[iFeature] = int(msg[pos]);
+        //the bin indices are stored in the type chosen by maxBins as in the batch processing mode
+        DAAL_CHECK((nBins[iFeature] > 0) && (size_t(nBins[iFeature]) <= _par.maxBins), services::ErrorIncorrectValueInTheNumericTable);
+        borders[iFeature] = msg + pos + 1;
+        pos += 1 + nBins[iFeature];
+    }
+    DAAL_CHECK(pos == msgSize, services::ErrorIncorrectSizeOfInputNumericTable);
+
+    const algorithmFPType initialF = algorithmFPType(msg[0]);
+    const size_t nBlocks           = _nRows / _blockSize + !!(_nRows % _blockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * _blockSize;
+        const size_t n      = (iStart + _blockSize < _nRows) ? _blockSize : _nRows - iStart;
+        ReadRows<algorithmFPType, cpu> xRows(const_cast<NumericTable *>(&_x), iStart, n);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        const algorithmFPType * px = xRows.get();
+        for (size_t i = 0; i < n; ++i)
+        {
+            BinIndexType * rowBins = binned + (iStart + i) * _nFeatures;
+            for (size_t j = 0; j < _nFeatures; ++j)
+            {
+                //the first bin whose right border is not less than the value, the values beyond the last border go to the last bin
+                const double value     = px[i * _nFeatures + j];
+                const double * aBorder = borders[j];
+                int lo = 0, hi = nBins[j] - 1;
+                while (lo < hi)
+                {
+                    const int mid = (lo + hi) / 2;
+                    if (aBorder[mid] < value)
+                        lo = mid + 1;
+                    else
+                        hi = mid;
+                }
+                rowBins[j] = BinIndexType(lo);
+            }
+            f[iStart + i]        = initialF;
+            rowNodes[iStart + i] = 0;
+        }
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status DistributedLocalStep<algorithmFPType, BinIndexType, cpu>::applySplits(const double * splits, size_t nNodes, bool isNewTree)
+{
+    size_t nRows                = 0;
+    const BinIndexType * binned = getInternalArray<BinIndexType, cpu>(_data, localBinnedData, nRows);
+    algorithmFPType * f         = getInternalArray<algorithmFPType, cpu>(_data, localF, nRows);
+    int * rowNodes              = getInternalArray<int, cpu>(_data, localRowNodes, nRows);
+    DAAL_CHECK(binned && f && rowNodes && (nRows == _nRows), services::ErrorIncorrectValueInTheNumericTable);
+
+    const size_t nBlocks = _nRows / _blockSize + !!(_nRows % _blockSize);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iEnd = ((iBlock + 1) * _blockSize < _nRows) ? (iBlock + 1) * _blockSize : _nRows;
+        for (size_t i = iBlock * _blockSize; i < iEnd; ++i)
+        {
+            const int iNode = rowNodes[i];
+            if ((iNode < 0) || (size_t(iNode) >= nNodes))
+            {
+                if (isNewTree) rowNodes[i] = 0;
+                continue;
+            }
+            const double * split = splits + iNode * nSplitFields;
+            const int iFeature   = int(split[splitFeature]);
+            const size_t iKid    = (iFeature >= 0) ? (size_t(binned[i * _nFeatures + iFeature]) > size_t(split[splitBin])) : 0;
+            f[i] += algorithmFPType(split[splitIncLeft + iKid]);
+            rowNodes[i] = isNewTree ? 0 : int(split[splitNextLeft + iKid]);
+        }
+    });
+    return services::Status();
+}
+
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status DistributedLocalStep<algorithmFPType, BinIndexType, cpu>::computeHistograms(LossType & loss, const double * isRequired, size_t nNext,
+                                                                                            NumericTablePtr & histogramsMsg)
+{
+    size_t nRows                = 0;
+    const BinIndexType * binned = getInternalArray<BinIndexType, cpu>(_data, localBinnedData, nRows);
+    const algorithmFPType * f   = getInternalArray<algorithmFPType, cpu>(_data, localF, nRows);
+    const int * rowNodes        = getInternalArray<int, cpu>(_data, localRowNodes, nRows);
+    const int * nBins           = getInternalArray<int, cpu>(_data, localNBins, nRows);
+    DAAL_CHECK(binned && f && rowNodes && nBins, services::ErrorIncorrectValueInTheNumericTable);
+
+    TArray<size_t, cpu> binOffsets(_nFeatures);
+    TArray<int, cpu> slots(nNext ? nNext : 1);
+    DAAL_CHECK_MALLOC(binOffsets.get() && slots.get());
+    size_t nBinsTotal = 0;
+    for (size_t j = 0; j < _nFeatures; ++j)
+    {
+        binOffsets[j] = nBinsTotal;
+        nBinsTotal += nBins[j];
+    }
+    size_t nRequired = 0;
+    for (size_t i = 0; i < nNext; ++i) slots[i] = (isRequired[i] != 0) ? int(nRequired++) : -1;
+
+    const size_t histSize = nBinsTotal * nDistributedBinValues;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRequired, histSize);
+    services::Status s;
+    double * msg = createMessage<cpu>(histogramsMsg, 2 + nRequired * histSize, s);
+    DAAL_CHECK_STATUS_VAR(s);
+    msg[0] = double(nRequired);
+    msg[1] = double(nBinsTotal);
+    if (!nRequired) return s;
+
+    double * hist = msg + 2;
+    services::internal::service_memset<double, cpu>(hist, double(0), nRequired * histSize);
+
+    ReadColumns<algorithmFPType, cpu> yCol(const_cast<NumericTable *>(&_y), 0, 0, _nRows);
+    DAAL_CHECK_BLOCK_STATUS(yCol);
+    TArray<algorithmFPType, cpu> ghArr(2 * _nRows);
+    DAAL_CHECK_MALLOC(ghArr.get());
+    algorithmFPType * gh = ghArr.get();
+
+    SafeStatus safeStat;
+    const size_t nBlocks = _nRows / _blockSize + !!(_nRows % _blockSize);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * _blockSize;
+        const size_t n      = (iStart + _blockSize < _nRows) ? _blockSize : _nRows - iStart;
+        DAAL_CHECK_STATUS_THR(loss.getGradients(n, n, yCol.get() + iStart, f + iStart, nullptr, gh + 2 * iStart));
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    //every thread updates the histograms of its own features of the nodes
+    const size_t maxFeatureBlockSize = 16;
+    const size_t nThreads            = threader_get_threads_number();
+    size_t featureBlockSize          = _nFeatures / (2 * nThreads);
+    if (featureBlockSize < 1) featureBlockSize = 1;
+    if (featureBlockSize > maxFeatureBlockSize) featureBlockSize = maxFeatureBlockSize;
+    const size_t nFeatureBlocks = _nFeatures / featureBlockSize + !!(_nFeatures % featureBlockSize);
+
+    daal::threader_for(nFeatureBlocks, nFeatureBlocks, [&](size_t iBlock) {
+        const size_t jStart = iBlock * featureBlockSize;
+        const size_t jEnd   = (jStart + featureBlockSize < _nFeatures) ? jStart + featureBlockSize : _nFeatures;
+        for (size_t i = 0; i < _nRows; ++i)
+        {
+            const int iNode = rowNodes[i];
+            if ((iNode < 0) || (size_t(iNode) >= nNext) || (slots[iNode] < 0)) continue;
+
+            const double g               = gh[2 * i];
+            const double h               = gh[2 * i + 1];
+            double * nodeHist            = hist + slots[iNode] * histSize;
+            const BinIndexType * rowBins = binned + i * _nFeatures;
+            for (size_t j = jStart; j < jEnd; ++j)
+            {
+                double * bin = nodeHist + (binOffsets[j] + rowBins[j]) * nDistributedBinValues;
+                bin[0] += g;
+                bin[1] += h;
+                bin[2] += 1;
+            }
+        }
+    });
+    return s;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Second step of the distributed processing mode, computations on the master node
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class DistributedMasterStep
+{
+public:
+    DistributedMasterStep(DataCollection & data, const Parameter & par) : _data(data), _par(par) {}
+
+    //merges the bin sketches if they are given, processes the histograms otherwise
+    services::Status compute(const DataCollection & binSketchesMsgs, const DataCollection & histogramsMsgs, NumericTablePtr & binBordersMsg,
+                             NumericTablePtr & levelSplitsMsg);
+    services::Status finalizeCompute(gbt::internal::ModelImpl & md);
+
+protected:
+    //best split of a node on a feature
+    struct FeatureSplit
+    {
+        double impurityDecrease;
+        double g;
+        double h;
+        double n;
+        int iBin;
+    };
+
+    services::Status mergeSketches(const DataCollection & binSketchesMsgs, NumericTablePtr & binBordersMsg);
+    services::Status processHistograms(const DataCollection & histogramsMsgs, NumericTablePtr & levelSplitsMsg);
+    services::Status sumHistograms(const DataCollection & histogramsMsgs, const double * levelNodes, size_t nLevel, size_t histSize, double * hist);
+    void findFeatureSplit(const double * node, const double * hist, size_t nBins, FeatureSplit & split) const;
+    services::Status startTree(bool isFirstTree);
+    void finishTraining() { _state[stateIsFinished] = 1; }
+
+    double impurity(double g, double h) const { return (g / (h + _par.lambda)) * g; }
+    bool terminateCriteria(double n, size_t level) const
+    {
+        return ((n < 2 * _par.minObservationsInLeafNode) || ((_par.maxTreeDepth > 0) && (level >= _par.maxTreeDepth)));
+    }
+    //writes the leaf to the tree, returns the increment of f of its observations
+    algorithmFPType makeLeaf(double * treeNode, double g, double h, double n, size_t iTree) const
+    {
+        const algorithmFPType val = algorithmFPType(h) + algorithmFPType(_par.lambda);
+        const algorithmFPType inc =
+            isZero<algorithmFPType, cpu>(val) ? algorithmFPType(0) : (-algorithmFPType(g) / val) * algorithmFPType(_par.shrinkage);
+        treeNode[treeFeature]  = -1;
+        treeNode[treeLeftKid]  = -1;
+        treeNode[treeValue]    = (iTree ? 0 : _state[stateInitialF]) + inc;
+        treeNode[treeImpurity] = impurity(g, h);
+        treeNode[treeCount]    = n;
+        return inc;
+    }
+
+protected:
+    DataCollection & _data;
+    const Parameter & _par;
+    double * _state = nullptr;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DistributedMasterStep<algorithmFPType, cpu>::compute(const DataCollection & binSketchesMsgs, const DataCollection & histogramsMsgs,
+                                                                     NumericTablePtr & binBordersMsg, NumericTablePtr & levelSplitsMsg)
+{
+    if (binSketchesMsgs.size()) return mergeSketches(binSketchesMsgs, binBordersMsg);
+
+    size_t nRows = 0;
+    _state       = getInternalArray<double, cpu>(_data, masterState, nRows);
+    DAAL_CHECK(_state, services::ErrorIncorrectValueInTheNumericTable);
+    //the trees are built, there are no splits to send
+    if (_state[stateIsFinished] != 0) return services::Status();
+    return processHistograms(histogramsMsgs, levelSplitsMsg);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DistributedMasterStep<algorithmFPType, cpu>::mergeSketches(const DataCollection & binSketchesMsgs, NumericTablePtr & binBordersMsg)
+{
+    const size_t nBlocks = binSketchesMsgs.size();
+    double nRowsTotal    = 0;
+    double sumY          = 0;
+    size_t nFeatures     = 0;
+    TArray<size_t, cpu> pairsStart;
+    TArray<double, cpu> pairBorders;
+    TArray<double, cpu> pairCounts;
+    for (size_t iPass = 0; iPass < 2; ++iPass)
+    {
+        //the numbers of the pairs (border, number of the observations) of the features are found on the first pass,
+        //the pairs are gathered on the second one
+        for (size_t i = 0; i < nBlocks; ++i)
+        {
+            NumericTable * pTbl  = static_cast<NumericTable *>(binSketchesMsgs[i].get());
+            const size_t msgSize = pTbl->getNumberOfColumns();
+            DAAL_CHECK(msgSize >= 3, services::ErrorIncorrectSizeOfInputNumericTable);
+            ReadRows<double, cpu> msgRows(pTbl, 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(msgRows);
+            const double * msg = msgRows.get();
+            if (!iPass)
+            {
+                DAAL_CHECK(!i || (size_t(msg[2]) == nFeatures), services::ErrorIncorrectNumberOfFeatures);
+                nRowsTotal += msg[0];
+                sumY += msg[1];
+                nFeatures = size_t(msg[2]);
+                if (!i)
+                {
+                    DAAL_CHECK(nFeatures > 0, services::ErrorIncorrectNumberOfFeatures);
+                    //all the features are tried in every node
+                    DAAL_CHECK(!_par.featuresPerNode || (_par.featuresPerNode == nFeatures), services::ErrorMethodNotSupported);
+                    pairsStart.reset(nFeatures + 1);
+                    DAAL_CHECK_MALLOC(pairsStart.get());
+                    for (size_t j = 0; j <= nFeatures; ++j) pairsStart[j] = 0;
+                }
+            }
+            size_t pos = 3;
+            for (size_t j = 0; j < nFeatures; ++j)
+            {
+                DAAL_CHECK(pos < msgSize, services::ErrorIncorrectSizeOfInputNumericTable);
+                const size_t nBins = size_t(msg[pos]);
+                DAAL_CHECK(pos + 1 + 2 * nBins <= msgSize, services::ErrorIncorrectSizeOfInputNumericTable);
+                if (!iPass)
+                    pairsStart[j + 1] += nBins;
+                else
+                {
+                    for (size_t iBin = 0; iBin < nBins; ++iBin, ++pairsStart[j])
+                    {
+                        pairBorders[pairsStart[j]] = msg[pos + 1 + 2 * iBin];
+                        pairCounts[pairsStart[j]]  = msg[pos + 2 + 2 * iBin];
+                    }
+                }
+                pos += 1 + 2 * nBins;
+            }
+            DAAL_CHECK(pos == msgSize, services::ErrorIncorrectSizeOfInputNumericTable);
+        }
+        if (!iPass)
+        {
+            for (size_t j = 0; j < nFeatures; ++j) pairsStart[j + 1] += pairsStart[j];
+            pairBorders.reset(pairsStart[nFeatures]);
+            pairCounts.reset(pairsStart[nFeatures]);
+            DAAL_CHECK_MALLOC(pairBorders.get() && pairCounts.get());
+        }
+    }
+    DAAL_CHECK(nRowsTotal > 0, services::ErrorIncorrectValueInTheNumericTable);
+    //pairsStart is moved to the ends of the pairs of the features by the second pass
+    for (size_t j = nFeatures; j > 0; --j) pairsStart[j] = pairsStart[j - 1];
+    pairsStart[0] = 0;
+
+    //the summaries are merged into the bins of about the same number of the observations as in the batch processing mode
+    const size_t maxBins = _par.maxBins;
+    const double nPerBin = double(size_t(nRowsTotal) / maxBins + !!(size_t(nRowsTotal) % maxBins));
+    const double binSize = (nPerBin > double(_par.minBinSize)) ? nPerBin : double(_par.minBinSize ? _par.minBinSize : 1);
+    TArray<double, cpu> mergedBorders(nFeatures * maxBins);
+    TArray<size_t, cpu> nMergedBins(nFeatures);
+    DAAL_CHECK_MALLOC(mergedBorders.get() && nMergedBins.get());
+
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+        const size_t n  = pairsStart[j + 1] - pairsStart[j];
+        double * border = pairBorders.get() + pairsStart[j];
+        double * count  = pairCounts.get() + pairsStart[j];
+        daal::algorithms::internal::qSort<double, double, cpu>(n, border, count);
+
+        double * merged = mergedBorders.get() + j * maxBins;
+        size_t nMerged  = 0;
+        double nInBin   = 0;
+        for (size_t k = 0; k < n; ++k)
+        {
+            nInBin += count[k];
+            if ((k + 1 < n) && (border[k + 1] == border[k])) continue;
+            if ((k + 1 == n) || ((nInBin >= binSize) && (nMerged + 1 < maxBins)))
+            {
+                merged[nMerged++] = border[k];
+                nInBin            = 0;
+            }
+        }
+        nMergedBins[j] = nMerged;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    size_t bordersSize = 1;
+    for (size_t j = 0; j < nFeatures; ++j) bordersSize += 1 + nMergedBins[j];
+
+    services::Status s;
+    resetInternalData<cpu>(_data, nMasterData);
+    double * aBorders = createInternalTable<double, cpu>(_data, masterBinBorders, bordersSize, 1, s);
+    _state            = createInternalTable<double, cpu>(_data, masterState, nStateFields, 1, s);
+    double * msg      = createMessage<cpu>(binBordersMsg, bordersSize + 1, s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    size_t pos      = 0;
+    aBorders[pos++] = double(nFeatures);
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        aBorders[pos++] = double(nMergedBins[j]);
+        services::internal::tmemcpy<double, cpu>(aBorders + pos, mergedBorders.get() + j * maxBins, nMergedBins[j]);
+        pos += nMergedBins[j];
+    }
+
+    _state[stateNFeatures]  = double(nFeatures);
+    _state[stateNRows]      = nRowsTotal;
+    _state[stateInitialF]   = sumY / nRowsTotal;
+    _state[stateITree]      = 0;
+    _state[stateLevel]      = 0;
+    _state[stateIsFinished] = 0;
+
+    msg[0] = _state[stateInitialF];
+    services::internal::tmemcpy<double, cpu>(msg + 1, aBorders, bordersSize);
+
+    _data[masterTrees] = DataCollectionPtr(new DataCollection());
+    return startTree(true);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DistributedMasterStep<algorithmFPType, cpu>::startTree(bool isFirstTree)
+{
+    services::Status s;
+    double * root = createInternalTable<double, cpu>(_data, masterLevelNodes, nLevelNodeFields, 1, s);
+    double * tree = createInternalTable<double, cpu>(_data, masterCurrentTree, nTreeNodeFields, 1, s);
+    double * hist = createInternalTable<double, cpu>(_data, masterParentHist, 1, 1, s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    root[levelTreeNode] = 0;
+    root[levelParent]   = -1;
+    root[levelSibling]  = -1;
+    root[levelIsLeaf]   = 0;
+    //the sums of the root are computed from its histograms
+    root[levelG] = root[levelH] = root[levelN] = 0;
+    for (size_t i = 0; i < nTreeNodeFields; ++i) tree[i] = 0;
+    hist[0]            = 0;
+    _state[stateLevel] = 0;
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DistributedMasterStep<algorithmFPType, cpu>::sumHistograms(const DataCollection & histogramsMsgs, const double * levelNodes,
+                                                                           size_t nLevel, size_t histSize, double * hist)
+{
+    size_t nComputed = 0;
+    for (size_t i = 0; i < nLevel; ++i) nComputed += (levelNodes[i * nLevelNodeFields + levelSibling] < 0);
+
+    services::internal::service_memset<double, cpu>(hist, double(0), nLevel * histSize);
+    for (size_t iBlock = 0; iBlock < histogramsMsgs.size(); ++iBlock)
+    {
+        NumericTable * pTbl = static_cast<NumericTable *>(histogramsMsgs[iBlock].get());
+        DAAL_CHECK(pTbl->getNumberOfColumns() == 2 + nComputed * histSize, services::ErrorIncorrectSizeOfInputNumericTable);
+        ReadRows<double, cpu> msgRows(pTbl, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(msgRows);
+        const double * msg = msgRows.get();
+        DAAL_CHECK((size_t(msg[0]) == nComputed) && (size_t(msg[1]) * nDistributedBinValues == histSize),
+                   services::ErrorIncorrectValueInTheNumericTable);
+
+        daal::threader_for(nLevel, nLevel, [&](size_t iNode) {
+            if (levelNodes[iNode * nLevelNodeFields + levelSibling] >= 0) return;
+            size_t iComputed = 0;
+            for (size_t i = 0; i < iNode; ++i) iComputed += (levelNodes[i * nLevelNodeFields + levelSibling] < 0);
+            double * nodeHist            = hist + iNode * histSize;
+            const double * localNodeHist = msg + 2 + iComputed * histSize;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < histSize; ++i) nodeHist[i] += localNodeHist[i];
+        });
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void DistributedMasterStep<algorithmFPType, cpu>::findFeatureSplit(const double * node, const double * hist, size_t nBins,
+                                                                  FeatureSplit & split) const
+{
+    const double minObservationsInLeafNode = double(_par.minObservationsInLeafNode);
+    const double nodeN                     = node[levelN];
+
+    split.iBin             = -1;
+    split.impurityDecrease = -services::internal::MaxVal<double>::get();
+
+    double g = 0, h = 0, nLeft = 0;
+    for (size_t i = 0; i < nBins; ++i)
+    {
+        const double * bin = hist + i * nDistributedBinValues;
+        if (!bin[2]) continue;
+        nLeft += bin[2];
+        if ((nodeN - nLeft) < minObservationsInLeafNode) break;
+        g += bin[0];
+        h += bin[1];
+        if (nLeft < minObservationsInLeafNode) continue;
+
+        const double impDecrease = impurity(g, h) + impurity(node[levelG] - g, node[levelH] - h);
+        if (impDecrease > split.impurityDecrease)
+        {
+            split.impurityDecrease = impDecrease;
+            split.g                = g;
+            split.h                = h;
+            split.n                = nLeft;
+            split.iBin             = int(i);
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DistributedMasterStep<algorithmFPType, cpu>::processHistograms(const DataCollection & histogramsMsgs,
+                                                                               NumericTablePtr & levelSplitsMsg)
+{
+    size_t nRows = 0, nLevel = 0, nTreeNodes = 0, nParents = 0;
+    const double * aBorders   = getInternalArray<double, cpu>(_data, masterBinBorders, nRows);
+    double * levelNodes       = getInternalArray<double, cpu>(_data, masterLevelNodes, nLevel);
+    const double * tree       = getInternalArray<double, cpu>(_data, masterCurrentTree, nTreeNodes);
+    const double * parentHist = getInternalArray<double, cpu>(_data, masterParentHist, nParents);
+    DataCollection * trees    = dynamic_cast<DataCollection *>(_data[masterTrees].get());
+    DAAL_CHECK(aBorders && levelNodes && tree && parentHist && trees, services::ErrorIncorrectValueInTheNumericTable);
+
+    const size_t nFeatures = size_t(_state[stateNFeatures]);
+    const size_t level     = size_t(_state[stateLevel]);
+    const size_t iTree     = size_t(_state[stateITree]);
+
+    TArray<size_t, cpu> binOffsets(nFeatures + 1);
+    TArray<const double *, cpu> borders(nFeatures);
+    DAAL_CHECK_MALLOC(binOffsets.get() && borders.get());
+    size_t pos    = 1;
+    binOffsets[0] = 0;
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        const size_t nBins = size_t(aBorders[pos]);
+        borders[j]         = aBorders + pos + 1;
+        binOffsets[j + 1]  = binOffsets[j] + nBins;
+        pos += 1 + nBins;
+    }
+    const size_t histSize = binOffsets[nFeatures] * nDistributedBinValues;
+
+    //histograms of the nodes of the level: summed over the local nodes or derived from the ones of the parent and the sibling
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nLevel, histSize);
+    services::Status s;
+    services::SharedPtr<HomogenNumericTableCPU<double, cpu> > levelHistTbl = HomogenNumericTableCPU<double, cpu>::create(histSize, nLevel, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    double * hist = levelHistTbl->getArray();
+    DAAL_CHECK_STATUS(s, sumHistograms(histogramsMsgs, levelNodes, nLevel, histSize, hist));
+
+    daal::threader_for(nLevel, nLevel, [&](size_t iNode) {
+        const double * node = levelNodes + iNode * nLevelNodeFields;
+        if (node[levelSibling] < 0) return;
+        double * nodeHist          = hist + iNode * histSize;
+        const double * pParentHist = parentHist + size_t(node[levelParent]) * histSize;
+        const double * pSibling    = hist + size_t(node[levelSibling]) * histSize;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < histSize; ++i) nodeHist[i] = pParentHist[i] - pSibling[i];
+    });
+
+    if (!level)
+    {
+        //the sums of the root are the ones of any feature
+        double * root = levelNodes;
+        root[levelG] = root[levelH] = root[levelN] = 0;
+        for (size_t i = 0; i < binOffsets[1]; ++i)
+        {
+            root[levelG] += hist[i * nDistributedBinValues];
+            root[levelH] += hist[i * nDistributedBinValues + 1];
+            root[levelN] += hist[i * nDistributedBinValues + 2];
+        }
+    }
+
+    //best splits of the nodes
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nLevel, nFeatures);
+    TArray<FeatureSplit, cpu> featureSplits(nLevel * nFeatures);
+    DAAL_CHECK_MALLOC(featureSplits.get());
+    daal::threader_for(nLevel * nFeatures, nLevel * nFeatures, [&](size_t i) {
+        const size_t iNode    = i / nFeatures;
+        const size_t j        = i % nFeatures;
+        const double * node   = levelNodes + iNode * nLevelNodeFields;
+        featureSplits[i].iBin = -1;
+        if (node[levelIsLeaf] != 0 || (!level && terminateCriteria(node[levelN], 0))) return;
+        findFeatureSplit(node, hist + iNode * histSize + binOffsets[j] * nDistributedBinValues, binOffsets[j + 1] - binOffsets[j],
+                         featureSplits[i]);
+    });
+
+    size_t nSplit = 0;
+    TArray<int, cpu> bestFeature(nLevel);
+    DAAL_CHECK_MALLOC(bestFeature.get());
+    for (size_t iNode = 0; iNode < nLevel; ++iNode)
+    {
+        const double * node       = levelNodes + iNode * nLevelNodeFields;
+        bestFeature[iNode]        = -1;
+        const FeatureSplit * best = nullptr;
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            const FeatureSplit & split = featureSplits[iNode * nFeatures + j];
+            if (split.iBin < 0) continue;
+            if (!best || (split.impurityDecrease > best->impurityDecrease))
+            {
+                best               = &split;
+                bestFeature[iNode] = int(j);
+            }
+        }
+        if (!best || (best->impurityDecrease - impurity(node[levelG], node[levelH]) < _par.minSplitLoss))
+            bestFeature[iNode] = -1;
+        else
+            ++nSplit;
+    }
+
+    //the kids of the split nodes are appended to the tree, the kids of a node are consecutive
+    const size_t nNewTreeNodes = nTreeNodes + 2 * nSplit;
+    double * newTree           = createInternalTable<double, cpu>(_data, masterCurrentTree, nTreeNodeFields, nNewTreeNodes, s);
+    TArray<double, cpu> splits(nLevel * nSplitFields);
+    TArray<double, cpu> nextNodes(2 * nLevel * nLevelNodeFields);
+    DAAL_CHECK_STATUS_VAR(s);
+    DAAL_CHECK_MALLOC(splits.get() && nextNodes.get());
+    services::internal::tmemcpy<double, cpu>(newTree, tree, nTreeNodes * nTreeNodeFields);
+
+    size_t nTree = nTreeNodes;
+    size_t nNext = 0;
+    for (size_t iNode = 0; iNode < nLevel; ++iNode)
+    {
+        const double * node = levelNodes + iNode * nLevelNodeFields;
+        double * split      = splits.get() + iNode * nSplitFields;
+        split[splitFeature] = -1;
+        split[splitBin]     = 0;
+        split[splitIncLeft] = split[splitIncRight] = 0;
+        split[splitNextLeft] = split[splitNextRight] = -1;
+        if (node[levelIsLeaf] != 0) continue; //the leaf is already created, the observations are already updated
+
+        double * treeNode = newTree + size_t(node[levelTreeNode]) * nTreeNodeFields;
+        if (bestFeature[iNode] < 0)
+        {
+            split[splitIncLeft] = split[splitIncRight] = makeLeaf(treeNode, node[levelG], node[levelH], node[levelN], iTree);
+            continue;
+        }
+
+        const int iFeature        = bestFeature[iNode];
+        const FeatureSplit & best = featureSplits[iNode * nFeatures + iFeature];
+        const size_t iLeftKid     = nTree;
+        treeNode[treeFeature]     = iFeature;
+        treeNode[treeLeftKid]     = double(iLeftKid);
+        treeNode[treeValue]       = borders[iFeature][best.iBin];
+        treeNode[treeImpurity]    = impurity(node[levelG], node[levelH]);
+        treeNode[treeCount]       = node[levelN];
+        nTree += 2;
+        split[splitFeature] = iFeature;
+        split[splitBin]     = best.iBin;
+
+        const double kidG[2] = { best.g, node[levelG] - best.g };
+        const double kidH[2] = { best.h, node[levelH] - best.h };
+        const double kidN[2] = { best.n, node[levelN] - best.n };
+        const bool isLeaf[2] = { terminateCriteria(kidN[0], level + 1), terminateCriteria(kidN[1], level + 1) };
+        for (size_t iKid = 0; iKid < 2; ++iKid)
+        {
+            if (isLeaf[iKid])
+            {
+                split[splitIncLeft + iKid] = makeLeaf(newTree + (iLeftKid + iKid) * nTreeNodeFields, kidG[iKid], kidH[iKid], kidN[iKid], iTree);
+                //the leaf goes to the next level only if its histograms are cheaper to compute than the ones of the sibling
+                if (isLeaf[1 - iKid] || (kidN[iKid] >= kidN[1 - iKid])) continue;
+            }
+            double * kid                = nextNodes.get() + nNext * nLevelNodeFields;
+            kid[levelTreeNode]          = double(iLeftKid + iKid);
+            kid[levelParent]            = double(iNode);
+            kid[levelSibling]           = -1;
+            kid[levelIsLeaf]            = isLeaf[iKid];
+            kid[levelG]                 = kidG[iKid];
+            kid[levelH]                 = kidH[iKid];
+            kid[levelN]                 = kidN[iKid];
+            split[splitNextLeft + iKid] = double(nNext++);
+        }
+        if ((split[splitNextLeft] >= 0) && (split[splitNextRight] >= 0))
+        {
+            //the histograms of the bigger kid are derived from the ones of the parent and the smaller kid
+            const size_t iSmaller    = (kidN[1] < kidN[0]) ? 1 : 0;
+            const size_t iBigger     = size_t(split[splitNextLeft + 1 - iSmaller]);
+            double * biggerNode      = nextNodes.get() + iBigger * nLevelNodeFields;
+            biggerNode[levelSibling] = split[splitNextLeft + iSmaller];
+        }
+    }
+
+    bool isNewTree = false;
+    if (!nNext)
+    {
+        //the tree is built, a tree of one leaf ends the training as in the batch processing mode
+        if (nTree < 2)
+        {
+            finishTraining();
+            return s;
+        }
+        trees->push_back(_data[masterCurrentTree]);
+        _state[stateITree] = double(iTree + 1);
+        if (iTree + 1 >= _par.maxIterations)
+        {
+            finishTraining();
+            return s;
+        }
+        DAAL_CHECK_STATUS(s, startTree(false));
+        isNewTree = true;
+        nNext     = 1;
+    }
+    else
+    {
+        double * next = createInternalTable<double, cpu>(_data, masterLevelNodes, nLevelNodeFields, nNext, s);
+        DAAL_CHECK_STATUS_VAR(s);
+        services::internal::tmemcpy<double, cpu>(next, nextNodes.get(), nNext * nLevelNodeFields);
+        _data[masterParentHist] = levelHistTbl;
+        _state[stateLevel]      = double(level + 1);
+    }
+
+    size_t nNextRows    = 0;
+    const double * next = getInternalArray<double, cpu>(_data, masterLevelNodes, nNextRows);
+    double * msg        = createMessage<cpu>(levelSplitsMsg, 3 + nLevel * nSplitFields + nNext, s);
+    DAAL_CHECK_STATUS_VAR(s);
+    msg[0] = isNewTree ? 1 : 0;
+    msg[1] = double(nLevel);
+    services::internal::tmemcpy<double, cpu>(msg + 2, splits.get(), nLevel * nSplitFields);
+    double * isRequired = msg + 2 + nLevel * nSplitFields;
+    isRequired[0]       = double(nNext);
+    for (size_t i = 0; i < nNext; ++i) isRequired[1 + i] = (next[i * nLevelNodeFields + levelSibling] < 0) ? 1 : 0;
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status DistributedMasterStep<algorithmFPType, cpu>::finalizeCompute(gbt::internal::ModelImpl & md)
+{
+    size_t nRows           = 0;
+    _state                 = getInternalArray<double, cpu>(_data, masterState, nRows);
+    DataCollection * trees = (masterTrees < _data.size()) ? dynamic_cast<DataCollection *>(_data[masterTrees].get()) : nullptr;
+    DAAL_CHECK(_state && trees, services::ErrorIncorrectValueInTheNumericTable);
+
+    typedef gbt::internal::TreeImpRegression<> TreeType;
+    typedef typename TreeType::NodeType NodeType;
+
+    const size_t nFeatures = size_t(_state[stateNFeatures]);
+    const size_t nTrees    = trees->size();
+    DAAL_CHECK_MALLOC(md.reserve(nTrees));
+
+    services::Status s;
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        HomogenNumericTable<double> * pTbl = dynamic_cast<HomogenNumericTable<double> *>((*trees)[iTree].get());
+        DAAL_CHECK(pTbl, services::ErrorIncorrectValueInTheNumericTable);
+        const size_t nNodes  = pTbl->getNumberOfRows();
+        const double * nodes = pTbl->getArray();
+
+        //the kids follow their parents, so the tree is built from the end
+        TreeType tree;
+        TArray<typename NodeType::Base *, cpu> aNode(nNodes);
+        DAAL_CHECK_MALLOC(aNode.get());
+        for (size_t i = nNodes; i-- > 0;)
+        {
+            const double * node = nodes + i * nTreeNodeFields;
+            if (node[treeFeature] < 0)
+            {
+                typename NodeType::Leaf * pLeaf = tree.allocator().allocLeaf();
+                pLeaf->response                 = node[treeValue];
+                pLeaf->count                    = size_t(node[treeCount]);
+                pLeaf->impurity                 = node[treeImpurity];
+                aNode[i]                        = pLeaf;
+                continue;
+            }
+            const size_t iLeftKid = size_t(node[treeLeftKid]);
+            DAAL_CHECK(iLeftKid + 1 < nNodes && iLeftKid > i, services::ErrorIncorrectValueInTheNumericTable);
+            typename NodeType::Split * pSplit = tree.allocator().allocSplit();
+            pSplit->set(int(node[treeFeature]), node[treeValue], false);
+            pSplit->kid[0]   = aNode[iLeftKid];
+            pSplit->kid[1]   = aNode[iLeftKid + 1];
+            pSplit->count    = size_t(node[treeCount]);
+            pSplit->impurity = node[treeImpurity];
+            aNode[i]         = pSplit;
+        }
+        tree.reset(aNode[0], false);
+
+        gbt::internal::GbtDecisionTree * pGbtTree = nullptr;
+        HomogenNumericTable<double> * pTblImp     = nullptr;
+        HomogenNumericTable<int> * pTblSmplCnt    = nullptr;
+
+        s = gbt::internal::ModelImpl::treeToTable(tree, &pGbtTree, &pTblImp, &pTblSmplCnt, nFeatures);
+        if (!s)
+        {
+            deleteTables<cpu>(&pGbtTree, &pTblImp, &pTblSmplCnt, 1);
+            break;
+        }
+        md.add(pGbtTree, pTblImp, pTblSmplCnt);
+    }
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -0,0 +1,200 @@
+/* file: gbt_train_external_memory.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the external memory mode of gradient boosted trees training
+//  (defaultDense) method.
+//
+//  The bin borders of the features are computed on a sample of the rows, then
+//  the data is read by blocks of rows once and the bin indices are stored in
+//  a temporary file in pages of rows. The trees are built level by level, every
+//  level reads the pages once.
+//--
+*/
+
+#ifndef __GBT_TRAIN_EXTERNAL_MEMORY_I__
+#define __GBT_TRAIN_EXTERNAL_MEMORY_I__
+
+#include "dtrees_feature_type_helper.h"
+#include "gbt_train_aux.i"
+#include "service_external_storage.h"
+#include "service_numeric_table.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::algorithms::dtrees::internal;
+
+//returns true if the binned features are stored in the external memory
+inline bool isExternalMemoryMode(const gbt::training::Parameter & par, size_t externalMemoryPageSize)
+{
+    return !par.memorySavingMode && (par.splitMethod == gbt::training::inexact) && (externalMemoryPageSize > 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Computes the bin borders of the features on the sample of the rows of the data.
+// The sample consists of evenly spaced blocks of rows, its size is not less than
+// the page size and is enough to fill the bins of the maximal size
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+services::Status initBinsOnSample(const NumericTable & x, const FeatureTypes & featTypes, const gbt::training::Parameter & par,
+                                  size_t externalMemoryPageSize, IndexedFeatures & indexedFeatures)
+{
+    const size_t sampleSizeFactor = 4;
+    const size_t maxSampleBlocks  = 64;
+
+    const size_t nRows         = x.getNumberOfRows();
+    const size_t nCols         = x.getNumberOfColumns();
+    const size_t minSampleSize = sampleSizeFactor * par.maxBins * par.minBinSize;
+    const size_t sampleSize    = (externalMemoryPageSize > minSampleSize) ? externalMemoryPageSize : minSampleSize;
+    const BinParams prm(par.maxBins, par.minBinSize);
+    if (sampleSize >= nRows) return indexedFeatures.initBins<algorithmFPType, cpu>(x, nRows, featTypes, prm);
+
+    const size_t nBlocks     = (sampleSize < maxSampleBlocks) ? sampleSize : maxSampleBlocks;
+    const size_t sizeOfBlock = sampleSize / nBlocks;
+    const size_t nSampleRows = sizeOfBlock * nBlocks;
+
+    services::Status s;
+    services::SharedPtr<HomogenNumericTable<algorithmFPType> > sample =
+        HomogenNumericTable<algorithmFPType>::create(nCols, nSampleRows, NumericTable::doAllocate, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    algorithmFPType * pSample = sample->getArray();
+
+    daal::SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        ReadRows<algorithmFPType, cpu> xRows(const_cast<NumericTable *>(&x), (nRows / nBlocks) * iBlock, sizeOfBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        services::internal::tmemcpy<algorithmFPType, cpu>(pSample + iBlock * sizeOfBlock * nCols, xRows.get(), sizeOfBlock * nCols);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    return indexedFeatures.initBins<algorithmFPType, cpu>(*sample, nRows, featTypes, prm);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Bin indices of the features stored in a temporary file by pages of rows,
+// the bin indices of a page are stored row by row
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename BinIndexType, CpuType cpu>
+class BinPages
+{
+public:
+    BinPages() : _nRows(0), _nCols(0), _pageSize(0) {}
+
+    //reads the data by pages, maps the values to the bins and writes the pages to the file
+    template <typename algorithmFPType>
+    services::Status init(const NumericTable & x, const IndexedFeatures & indexedFeatures, const FeatureTypes & featTypes, size_t pageSize);
+
+    size_t nRows() const { return _nRows; }
+    size_t nCols() const { return _nCols; }
+    size_t nPages() const { return _nRows / _pageSize + !!(_nRows % _pageSize); }
+    size_t nRowsInPage(size_t iPage) const
+    {
+        const size_t iStart = iPage * _pageSize;
+        return (_nRows - iStart < _pageSize) ? _nRows - iStart : _pageSize;
+    }
+
+    //reads the pages in order and calls func(iStartRow, nRowsInPage, binIndices) for each of them
+    template <typename Func>
+    services::Status forEachPage(const Func & func)
+    {
+        services::Status s  = _storage.rewind();
+        BinIndexType * page = _page.get();
+        for (size_t iPage = 0; s && (iPage < nPages()); ++iPage)
+        {
+            const size_t n = nRowsInPage(iPage);
+            s |= _storage.read(page, n * _nCols * sizeof(BinIndexType));
+            if (s) func(iPage * _pageSize, n, (const BinIndexType *)page);
+        }
+        return s;
+    }
+
+protected:
+    size_t _nRows;
+    size_t _nCols;
+    size_t _pageSize;
+    TVector<BinIndexType, cpu, ScalableAllocator<cpu> > _page;
+    services::internal::TemporaryFileStorage _storage;
+};
+
+template <typename BinIndexType, CpuType cpu>
+template <typename algorithmFPType>
+services::Status BinPages<BinIndexType, cpu>::init(const NumericTable & x, const IndexedFeatures & indexedFeatures, const FeatureTypes & featTypes,
+                                                   size_t pageSize)
+{
+    const size_t sizeOfBlock = 1024;
+
+    _nRows    = x.getNumberOfRows();
+    _nCols    = x.getNumberOfColumns();
+    _pageSize = (pageSize < _nRows) ? pageSize : _nRows;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _pageSize, _nCols);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _pageSize * _nCols, sizeof(BinIndexType));
+    _page.reset(_pageSize * _nCols);
+    DAAL_CHECK_MALLOC(_page.get());
+
+    TVector<bool, cpu> aUnordered(_nCols);
+    DAAL_CHECK_MALLOC(aUnordered.get());
+    for (size_t j = 0; j < _nCols; ++j) aUnordered[j] = featTypes.isUnordered(j);
+
+    services::Status s = _storage.open();
+    DAAL_CHECK_STATUS_VAR(s);
+
+    BinIndexType * page = _page.get();
+    for (size_t iPage = 0; iPage < nPages(); ++iPage)
+    {
+        const size_t iStart  = iPage * _pageSize;
+        const size_t n       = nRowsInPage(iPage);
+        const size_t nBlocks = n / sizeOfBlock + !!(n % sizeOfBlock);
+
+        daal::SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t iBlockStart = iBlock * sizeOfBlock;
+            const size_t nInBlock    = (n - iBlockStart < sizeOfBlock) ? n - iBlockStart : sizeOfBlock;
+
+            ReadRows<algorithmFPType, cpu> xRows(const_cast<NumericTable *>(&x), iStart + iBlockStart, nInBlock);
+            DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+            const algorithmFPType * px = xRows.get();
+            BinIndexType * pBins       = page + iBlockStart * _nCols;
+
+            for (size_t i = 0; i < nInBlock * _nCols; i += _nCols)
+            {
+                for (size_t j = 0; j < _nCols; ++j) pBins[i + j] = (BinIndexType)indexedFeatures.binIndex(j, px[i + j], aUnordered[j]);
+            }
+        });
+        DAAL_CHECK_SAFE_STATUS();
+        DAAL_CHECK_STATUS(s, _storage.write(page, n * _nCols * sizeof(BinIndexType)));
+    }
+    return s;
+}
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
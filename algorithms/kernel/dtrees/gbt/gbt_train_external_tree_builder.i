@@ -0,0 +1,530 @@
+/* file: gbt_train_external_tree_builder.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the tree builder for the external memory mode of gradient
+//  boosted trees training (defaultDense) method.
+//
+//  The tree is built level by level. Every row keeps the index of its node at
+//  the current level. One pass over the pages of the bin indices moves the rows
+//  to the kids of the split nodes and computes the histograms of the nodes of
+//  the next level. The histograms of the bigger kid are derived from the ones
+//  of the parent and its sibling.
+//--
+*/
+
+#ifndef __GBT_TRAIN_EXTERNAL_TREE_BUILDER_I__
+#define __GBT_TRAIN_EXTERNAL_TREE_BUILDER_I__
+
+#include "gbt_train_tree_builder.i"
+#include "gbt_train_external_memory.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+class ExternalMemoryTreeBuilder : public TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>
+{
+public:
+    typedef TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu> super;
+    typedef typename super::CommonCtx CommonCtx;
+    typedef typename super::ghType ghType;
+    typedef typename super::ghSumType ghSumType;
+    typedef typename super::NodeType NodeType;
+    typedef typename super::ImpurityType ImpurityType;
+    typedef BinPages<BinIndexType, cpu> PagesType;
+    typedef GlobalStorages<algorithmFPType, BinIndexType, cpu> GlobalStoragesType;
+
+    //node of the level of the tree being built
+    struct LevelNode
+    {
+        ImpurityType imp;                  //sums of the gradients and hessians of the sampled observations
+        size_t n;                          //number of the sampled observations
+        typename NodeType::Split * parent; //null for the root
+        size_t iKid;                       //index of the node in the kids of the parent
+        ghSumType * hist;                  //histograms of all the features
+        const ghSumType * parentHist;      //histograms of the parent
+        int iSibling;                      //index of the sibling if the histograms are derived from the ones of the parent and the sibling
+        bool isLeaf;                       //leaf which histograms are required to derive the ones of the sibling only
+        int iFeature;                      //split feature, -1 if the node is not split
+        BinIndexType iBin;                 //last bin of the left kid or the bin of the left kid for an unordered feature
+        bool featureUnordered;
+        ImpurityType left;                 //sums of the gradients and hessians of the sampled observations of the left kid
+        size_t nLeft;                      //number of the sampled observations of the left kid
+        int next[2];                       //indices of the kids in the next level, -1 if the kid is not there
+        algorithmFPType inc[2];            //increments of f of the observations moving to the kids
+    };
+
+    //best split of a node on a feature
+    struct FeatureSplit
+    {
+        algorithmFPType impurityDecrease;
+        ImpurityType left;
+        size_t nLeft;
+        int iBin;
+    };
+
+    ExternalMemoryTreeBuilder(CommonCtx & ctx) : super(ctx) {}
+
+    virtual services::Status init() DAAL_C11_OVERRIDE
+    {
+        const size_t nRows = this->_ctx.dataHelper().data()->getNumberOfRows();
+        _rowNode.reset(nRows);
+        DAAL_CHECK_MALLOC(_rowNode.get());
+        if (this->_ctx.isBagging())
+        {
+            _isInSample.reset(nRows);
+            DAAL_CHECK_MALLOC(_isInSample.get());
+        }
+        const size_t nFeat = this->_ctx.nFeatures();
+        const size_t nFPN  = this->_ctx.nFeaturesPerNode();
+        if (nFeat != nFPN)
+        {
+            _featureSample.reset((nFPN * nFPN < 2 * nFeat) ? 2 * nFPN : nFeat);
+            DAAL_CHECK_MALLOC(_featureSample.get());
+        }
+        return services::Status();
+    }
+
+    virtual services::Status run(gbt::internal::GbtDecisionTree *& pRes, HomogenNumericTable<double> *& pTblImp,
+                                 HomogenNumericTable<int> *& pTblSmplCnt, size_t iTree, GlobalStoragesType & GH_SUMS_BUF) DAAL_C11_OVERRIDE
+    {
+        DAAL_ASSERT(GH_SUMS_BUF.pages);
+        this->_tree.destroy();
+        this->_iTree = iTree;
+
+        typename NodeType::Base * nd = nullptr;
+        services::Status s           = buildTree(*GH_SUMS_BUF.pages, GH_SUMS_BUF.nUniquesArr.get(), GH_SUMS_BUF.nDiffFeatMax, nd);
+        if (nd) this->_tree.reset(nd, false);
+        DAAL_CHECK_STATUS_VAR(s);
+        DAAL_CHECK_MALLOC(nd);
+
+        //f of the out-of-bag observations is updated while the tree is built
+        return gbt::internal::ModelImpl::treeToTable(this->_tree, &pRes, &pTblImp, &pTblSmplCnt, this->_ctx.nFeatures());
+    }
+
+    static super * create(CommonCtx & ctx) { return new ExternalMemoryTreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>(ctx); }
+
+protected:
+    services::Status buildTree(PagesType & pages, const size_t * binOffsets, size_t nBinsTotal, typename NodeType::Base *& root);
+    services::Status allocHistograms(LevelNode * nodes, size_t nNodes, size_t nBinsTotal, size_t iLevel);
+    void deriveHistograms(LevelNode * nodes, size_t nNodes, size_t nBinsTotal);
+    services::Status findSplits(LevelNode * nodes, size_t nNodes, const size_t * binOffsets);
+    void findFeatureSplit(const LevelNode & node, size_t iFeature, const size_t * binOffsets, FeatureSplit & split) const;
+    size_t createNodes(LevelNode * nodes, size_t nNodes, LevelNode * next, size_t level, bool & bSplit, typename NodeType::Base *& root);
+    services::Status processPages(PagesType & pages, const LevelNode * nodes, LevelNode * next, const size_t * binOffsets);
+    void moveRows(const LevelNode * nodes, size_t iStart, size_t nRows, const BinIndexType * page, size_t nCols);
+
+    typename NodeType::Leaf * makeLeafNode(size_t n, const ImpurityType & imp, algorithmFPType & inc)
+    {
+        typename NodeType::Leaf * pNode = this->_tree.allocator().allocLeaf();
+        pNode->response                 = this->_ctx.computeLeafWeight(imp, inc);
+        pNode->count                    = n;
+        pNode->impurity                 = imp.value(this->_ctx.par().lambda);
+        return pNode;
+    }
+
+    static void attach(const LevelNode & node, typename NodeType::Base * pNode, typename NodeType::Base *& root)
+    {
+        if (node.parent)
+            node.parent->kid[node.iKid] = pNode;
+        else
+            root = pNode;
+    }
+
+protected:
+    TVector<RowIndexType, cpu> _rowNode; //index of the node of the row at the current level, -1 if the row is in a leaf
+    TVector<bool, cpu> _isInSample;      //true for the rows sampled for the tree, used with bagging only
+    TVector<RowIndexType, cpu> _featureSample;
+    TVector<RowIndexType, cpu> _nodeFeatures;
+    TVector<FeatureSplit, cpu> _featureSplits;
+    TVector<LevelNode, cpu> _levelNodes[2];
+    TVector<ghSumType, cpu, ScalableAllocator<cpu> > _levelHist[2];
+};
+
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+services::Status ExternalMemoryTreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildTree(PagesType & pages, const size_t * binOffsets,
+                                                                                                       size_t nBinsTotal,
+                                                                                                       typename NodeType::Base *& root)
+{
+    const size_t nRows     = pages.nRows();
+    RowIndexType * rowNode = _rowNode.get();
+    for (size_t i = 0; i < nRows; ++i) rowNode[i] = 0;
+    if (this->_ctx.isBagging())
+    {
+        bool * isInSample                     = _isInSample.get();
+        const RowIndexType * const aSampleToF = this->_ctx.aSampleToF();
+        for (size_t i = 0; i < nRows; ++i) isInSample[i] = false;
+        for (size_t i = 0; i < this->_ctx.nSamples(); ++i) isInSample[aSampleToF[i]] = true;
+    }
+
+    _levelNodes[0].reset(1);
+    DAAL_CHECK_MALLOC(_levelNodes[0].get());
+    LevelNode & rootNode = _levelNodes[0][0];
+    this->getInitialImpurity(rootNode.imp);
+    rootNode.n          = this->_ctx.nSamples();
+    rootNode.parent     = nullptr;
+    rootNode.iKid       = 0;
+    rootNode.parentHist = nullptr;
+    rootNode.iSibling   = -1;
+    rootNode.isLeaf     = false;
+    rootNode.iFeature   = -1;
+
+    if (this->_ctx.terminateCriteria(rootNode.n, 0, rootNode.imp))
+    {
+        algorithmFPType inc;
+        root            = makeLeafNode(rootNode.n, rootNode.imp, inc);
+        rootNode.inc[0] = rootNode.inc[1] = inc;
+        rootNode.next[0] = rootNode.next[1] = -1;
+        moveRows(_levelNodes[0].get(), 0, nRows, nullptr, 0);
+        return services::Status();
+    }
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, allocHistograms(_levelNodes[0].get(), 1, nBinsTotal, 0));
+    DAAL_CHECK_STATUS(s, processPages(pages, nullptr, _levelNodes[0].get(), binOffsets));
+
+    size_t nNodes = 1;
+    for (size_t level = 0; nNodes; ++level)
+    {
+        LevelNode * nodes = _levelNodes[level % 2].get();
+        deriveHistograms(nodes, nNodes, nBinsTotal);
+        DAAL_CHECK_STATUS(s, findSplits(nodes, nNodes, binOffsets));
+
+        TVector<LevelNode, cpu> & nextNodes = _levelNodes[(level + 1) % 2];
+        nextNodes.reset(2 * nNodes);
+        DAAL_CHECK_MALLOC(nextNodes.get());
+
+        bool bSplit        = false;
+        const size_t nNext = createNodes(nodes, nNodes, nextNodes.get(), level, bSplit, root);
+        if (nNext) DAAL_CHECK_STATUS(s, allocHistograms(nextNodes.get(), nNext, nBinsTotal, level + 1));
+
+        if (bSplit)
+            s = processPages(pages, nodes, nNext ? nextNodes.get() : nullptr, binOffsets);
+        else
+            moveRows(nodes, 0, nRows, nullptr, 0);
+        DAAL_CHECK_STATUS_VAR(s);
+        nNodes = nNext;
+    }
+    return s;
+}
+
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+services::Status ExternalMemoryTreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::allocHistograms(LevelNode * nodes, size_t nNodes,
+                                                                                                             size_t nBinsTotal, size_t iLevel)
+{
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nNodes, nBinsTotal);
+    TVector<ghSumType, cpu, ScalableAllocator<cpu> > & hist = _levelHist[iLevel % 2];
+    hist.reset(nNodes * nBinsTotal);
+    DAAL_CHECK_MALLOC(hist.get());
+
+    LoopHelper<cpu>::run(this->_ctx.isThreaded(), nNodes, [&](size_t iNode) {
+        nodes[iNode].hist = hist.get() + iNode * nBinsTotal;
+        //the histograms computed by the pass over the pages are accumulated
+        if (nodes[iNode].iSibling < 0)
+            services::internal::service_memset_seq<algorithmFPType, cpu>((algorithmFPType *)nodes[iNode].hist, algorithmFPType(0),
+                                                                         nBinsTotal * sizeof(ghSumType) / sizeof(algorithmFPType));
+    });
+    return services::Status();
+}
+
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+void ExternalMemoryTreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::deriveHistograms(LevelNode * nodes, size_t nNodes,
+                                                                                                  size_t nBinsTotal)
+{
+    const size_t n = nBinsTotal * sizeof(ghSumType) / sizeof(algorithmFPType);
+    LoopHelper<cpu>::run(this->_ctx.isThreaded(), nNodes, [&](size_t iNode) {
+        const LevelNode & node = nodes[iNode];
+        if (node.iSibling < 0) return;
+        algorithmFPType * pHist              = (algorithmFPType *)node.hist;
+        const algorithmFPType * pParentHist  = (const algorithmFPType *)node.parentHist;
+        const algorithmFPType * pSiblingHist = (const algorithmFPType *)nodes[node.iSibling].hist;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i) pHist[i] = pParentHist[i] - pSiblingHist[i];
+    });
+}
+
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+services::Status ExternalMemoryTreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::findSplits(LevelNode * nodes, size_t nNodes,
+                                                                                                        const size_t * binOffsets)
+{
+    const size_t nFPN            = this->_ctx.nFeaturesPerNode();
+    const bool bSampled          = (nFPN != this->_ctx.nFeatures());
+    const algorithmFPType lambda = this->_ctx.par().lambda;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nNodes, nFPN);
+    _featureSplits.reset(nNodes * nFPN);
+    DAAL_CHECK_MALLOC(_featureSplits.get());
+    if (bSampled)
+    {
+        _nodeFeatures.reset(nNodes * nFPN);
+        DAAL_CHECK_MALLOC(_nodeFeatures.get());
+        for (size_t iNode = 0; iNode < nNodes; ++iNode)
+        {
+            if (nodes[iNode].isLeaf) continue;
+            this->_ctx.chooseFeatures(_featureSample.get());
+            services::internal::tmemcpy<RowIndexType, cpu>(_nodeFeatures.get() + iNode * nFPN, _featureSample.get(), nFPN);
+        }
+    }
+
+    FeatureSplit * aSplit = _featureSplits.get();
+    LoopHelper<cpu>::run(this->_ctx.isThreaded(), nNodes * nFPN, [&](size_t i) {
+        const LevelNode & node = nodes[i / nFPN];
+        if (node.isLeaf) return;
+        findFeatureSplit(node, bSampled ? _nodeFeatures[i] : i % nFPN, binOffsets, aSplit[i]);
+    });
+
+    for (size_t iNode = 0; iNode < nNodes; ++iNode)
+    {
+        LevelNode & node = nodes[iNode];
+        node.iFeature    = -1;
+        if (node.isLeaf) continue;
+
+        const FeatureSplit * best = nullptr;
+        for (size_t i = 0; i < nFPN; ++i)
+        {
+            const FeatureSplit & split = aSplit[iNode * nFPN + i];
+            if (split.iBin < 0) continue;
+            const int iFeature = bSampled ? _nodeFeatures[iNode * nFPN + i] : i;
+            //the same feature is chosen on the same impurity decrease as in the in-memory case
+            if (!best || (split.impurityDecrease > best->impurityDecrease)
+                || ((split.impurityDecrease == best->impurityDecrease) && (iFeature < node.iFeature)))
+            {
+                best          = &split;
+                node.iFeature = iFeature;
+            }
+        }
+        if (!best || (best->impurityDecrease - node.imp.value(lambda) < this->_ctx.par().minSplitLoss))
+        {
+            node.iFeature = -1;
+            continue;
+        }
+        node.iBin             = (BinIndexType)best->iBin;
+        node.featureUnordered = this->_ctx.featTypes().isUnordered(node.iFeature);
+        node.left             = best->left;
+        node.nLeft            = best->nLeft;
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+void ExternalMemoryTreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::findFeatureSplit(const LevelNode & node, size_t iFeature,
+                                                                                                  const size_t * binOffsets,
+                                                                                                  FeatureSplit & split) const
+{
+    const size_t minObservationsInLeafNode = this->_ctx.par().minObservationsInLeafNode;
+    const algorithmFPType lambda           = this->_ctx.par().lambda;
+    const ghSumType * aGHSum               = node.hist + binOffsets[iFeature];
+    const size_t nBins                     = this->_ctx.dataHelper().indexedFeatures().numIndices(iFeature);
+
+    split.iBin             = -1;
+    split.impurityDecrease = -services::internal::MaxVal<algorithmFPType>::get();
+
+    if (this->_ctx.featTypes().isUnordered(iFeature))
+    {
+        //the last bin keeps the values absent in the sample of the data, it does not make a split
+        for (size_t i = 0; i + 1 < nBins; ++i)
+        {
+            if ((aGHSum[i].n < minObservationsInLeafNode) || ((node.n - aGHSum[i].n) < minObservationsInLeafNode)) continue;
+            const ImpurityType & left = aGHSum[i];
+            ImpurityType right(node.imp, left);
+            const algorithmFPType impDecrease = left.value(lambda) + right.value(lambda);
+            if (impDecrease > split.impurityDecrease)
+            {
+                split.impurityDecrease = impDecrease;
+                split.left             = left;
+                split.nLeft            = aGHSum[i].n;
+                split.iBin             = i;
+            }
+        }
+        return;
+    }
+
+    ImpurityType left;
+    size_t nLeft = 0;
+    for (size_t i = 0; i < nBins; ++i)
+    {
+        if (!aGHSum[i].n) continue;
+        nLeft += aGHSum[i].n;
+        if ((node.n - nLeft) < minObservationsInLeafNode) break;
+        left.add(aGHSum[i]);
+        if (nLeft < minObservationsInLeafNode) continue;
+
+        ImpurityType right(node.imp, left);
+        const algorithmFPType impDecrease = left.value(lambda) + right.value(lambda);
+        if (impDecrease > split.impurityDecrease)
+        {
+            split.impurityDecrease = impDecrease;
+            split.left             = left;
+            split.nLeft            = nLeft;
+            split.iBin             = i;
+        }
+    }
+}
+
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+size_t ExternalMemoryTreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::createNodes(LevelNode * nodes, size_t nNodes, LevelNode * next,
+                                                                                               size_t level, bool & bSplit,
+                                                                                               typename NodeType::Base *& root)
+{
+    const IndexedFeatures & indexedFeatures = this->_ctx.dataHelper().indexedFeatures();
+    size_t nNext                            = 0;
+    for (size_t iNode = 0; iNode < nNodes; ++iNode)
+    {
+        LevelNode & node = nodes[iNode];
+        node.next[0] = node.next[1] = -1;
+        node.inc[0] = node.inc[1] = algorithmFPType(0);
+        if (node.isLeaf) continue; //the leaf is already created, the observations are already updated
+
+        if (node.iFeature < 0)
+        {
+            algorithmFPType inc;
+            attach(node, makeLeafNode(node.n, node.imp, inc), root);
+            node.inc[0] = node.inc[1] = inc;
+            continue;
+        }
+
+        typename NodeType::Split * pSplit = this->_tree.allocator().allocSplit();
+        pSplit->set(node.iFeature, indexedFeatures.binRightBorder(node.iFeature, node.iBin), node.featureUnordered);
+        pSplit->count    = node.n;
+        pSplit->impurity = node.imp.value(this->_ctx.par().lambda);
+        attach(node, pSplit, root);
+        bSplit = true;
+
+        const ImpurityType kidImp[2] = { node.left, ImpurityType(node.imp, node.left) };
+        const size_t kidN[2]         = { node.nLeft, node.n - node.nLeft };
+        const bool isLeaf[2]         = { this->_ctx.terminateCriteria(kidN[0], level + 1, kidImp[0]),
+                                         this->_ctx.terminateCriteria(kidN[1], level + 1, kidImp[1]) };
+        for (size_t iKid = 0; iKid < 2; ++iKid)
+        {
+            if (isLeaf[iKid])
+            {
+                pSplit->kid[iKid] = makeLeafNode(kidN[iKid], kidImp[iKid], node.inc[iKid]);
+                //the leaf goes to the next level only if its histograms are cheaper to compute than the ones of the sibling
+                if (isLeaf[1 - iKid] || (kidN[iKid] >= kidN[1 - iKid])) continue;
+            }
+            LevelNode & kid = next[nNext];
+            kid.imp         = kidImp[iKid];
+            kid.n           = kidN[iKid];
+            kid.parent      = pSplit;
+            kid.iKid        = iKid;
+            kid.hist        = nullptr;
+            kid.parentHist  = node.hist;
+            kid.iSibling    = -1;
+            kid.isLeaf      = isLeaf[iKid];
+            kid.iFeature    = -1;
+            node.next[iKid] = nNext++;
+        }
+        if ((node.next[0] >= 0) && (node.next[1] >= 0))
+        {
+            //the histograms of the bigger kid are derived from the ones of the parent and the smaller kid
+            const size_t iSmaller                  = (kidN[1] < kidN[0]) ? 1 : 0;
+            next[node.next[1 - iSmaller]].iSibling = node.next[iSmaller];
+        }
+    }
+    return nNext;
+}
+
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+services::Status ExternalMemoryTreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::processPages(PagesType & pages, const LevelNode * nodes,
+                                                                                                          LevelNode * next, const size_t * binOffsets)
+{
+    const size_t maxFeatureBlockSize = 16;
+
+    const size_t nCols      = pages.nCols();
+    const size_t nThreads   = threader_get_threads_number();
+    size_t featureBlockSize = nCols / (2 * nThreads);
+    featureBlockSize        = (featureBlockSize < 1) ? 1 : ((featureBlockSize > maxFeatureBlockSize) ? maxFeatureBlockSize : featureBlockSize);
+
+    const size_t nFeatureBlocks  = nCols / featureBlockSize + !!(nCols % featureBlockSize);
+    const ghType * pgh           = this->_ctx.grad(this->_iTree);
+    const RowIndexType * rowNode = _rowNode.get();
+    const bool * isInSample      = _isInSample.get();
+
+    return pages.forEachPage([&](size_t iStart, size_t nRows, const BinIndexType * page) {
+        if (nodes) moveRows(nodes, iStart, nRows, page, nCols);
+        if (!next) return;
+
+        //every thread updates the histograms of its own features of the nodes
+        LoopHelper<cpu>::run(this->_ctx.isThreaded(), nFeatureBlocks, [&](size_t iBlock) {
+            const size_t jStart = iBlock * featureBlockSize;
+            const size_t jEnd   = (jStart + featureBlockSize < nCols) ? jStart + featureBlockSize : nCols;
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                const RowIndexType iNode = rowNode[iStart + i];
+                if ((iNode < 0) || (next[iNode].iSibling >= 0)) continue;
+                if (isInSample && !isInSample[iStart + i]) continue;
+
+                const ghType & rowGH     = pgh[iStart + i];
+                ghSumType * hist         = next[iNode].hist;
+                const BinIndexType * row = page + i * nCols;
+                for (size_t j = jStart; j < jEnd; ++j)
+                {
+                    ghSumType & sum = hist[binOffsets[j] + row[j]];
+                    sum.g += rowGH.g;
+                    sum.h += rowGH.h;
+                    sum.n += 1;
+                }
+            }
+        });
+    });
+}
+
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+void ExternalMemoryTreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::moveRows(const LevelNode * nodes, size_t iStart, size_t nRows,
+                                                                                          const BinIndexType * page, size_t nCols)
+{
+    const size_t sizeOfBlock = 1024;
+    const size_t nBlocks     = nRows / sizeOfBlock + !!(nRows % sizeOfBlock);
+    RowIndexType * rowNode   = _rowNode.get();
+
+    LoopHelper<cpu>::run(this->_ctx.isThreaded(), nBlocks, [&](size_t iBlock) {
+        const size_t iEnd = ((iBlock + 1) * sizeOfBlock < nRows) ? (iBlock + 1) * sizeOfBlock : nRows;
+        for (size_t i = iBlock * sizeOfBlock; i < iEnd; ++i)
+        {
+            const RowIndexType iNode = rowNode[iStart + i];
+            if (iNode < 0) continue;
+            const LevelNode & node = nodes[iNode];
+            size_t iKid            = 0;
+            if (node.iFeature >= 0)
+            {
+                const BinIndexType bin = page[i * nCols + node.iFeature];
+                iKid                   = node.featureUnordered ? (bin != node.iBin) : (bin > node.iBin);
+            }
+            //the observations are moved through the tree as on the prediction, so the same is done for the out-of-bag ones
+            if (node.inc[iKid] != 0) this->_ctx.updateF(iStart + i, this->_iTree, node.inc[iKid]);
+            rowNode[iStart + i] = node.next[iKid];
+        }
+    });
+}
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
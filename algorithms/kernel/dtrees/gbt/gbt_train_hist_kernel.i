@@ -238,6 +238,9 @@ struct ComputeGHSumByRows
         const size_t iEndWithPrefetch            = services::internal::min<cpu, size_t>(nRows - noPrefetchSize, iEnd);
         const size_t nCacheLinesToPrefetchOneRow = nFeatures / elementsInCacheLine + !!(nFeatures % elementsInCacheLine);
 
+        /* g, h, n and padding of the histogram bin are updated as one vector of 4 elements */
+        algorithmFPType adds[4] = { 0, 0, 1, 0 };
+
         RowIndexType i = iStart;
         PRAGMA_IVDEP
         for (; i < iEndWithPrefetch; ++i)
@@ -247,14 +250,14 @@ struct ComputeGHSumByRows
             for (RowIndexType j = 0; j < nCacheLinesToPrefetchOneRow; j++) DAAL_PREFETCH_READ_T0(ptr + elementsInCacheLine * j);
 
             const BinIndexType * featIdx = indexedFeature + aIdx[i] * nFeatures;
+            adds[0]                      = pgh[2 * aIdx[i]];
+            adds[1]                      = pgh[2 * aIdx[i] + 1];
 
             PRAGMA_IVDEP
             for (RowIndexType j = 0; j < nFeatures; j++)
             {
-                const size_t idx = 4 * (UniquesArr[j] + (size_t)featIdx[j]);
-                aGHSumFP[idx + 0] += pgh[2 * aIdx[i]];
-                aGHSumFP[idx + 1] += pgh[2 * aIdx[i] + 1];
-                aGHSumFP[idx + 2] += algorithmFPType(1);
+                algorithmFPType * hist = aGHSumFP + 4 * (UniquesArr[j] + (size_t)featIdx[j]);
+                addToHist(hist, adds);
             }
         }
 
@@ -262,16 +265,75 @@ struct ComputeGHSumByRows
         for (; i < iEnd; ++i)
         {
             const BinIndexType * featIdx = indexedFeature + aIdx[i] * nFeatures;
+            adds[0]                      = pgh[2 * aIdx[i]];
+            adds[1]                      = pgh[2 * aIdx[i] + 1];
 
             PRAGMA_IVDEP
             for (RowIndexType j = 0; j < nFeatures; j++)
             {
-                const size_t idx = 4 * (UniquesArr[j] + (size_t)featIdx[j]);
-                aGHSumFP[idx + 0] += pgh[2 * aIdx[i]];
-                aGHSumFP[idx + 1] += pgh[2 * aIdx[i] + 1];
-                aGHSumFP[idx + 2] += algorithmFPType(1);
+                algorithmFPType * hist = aGHSumFP + 4 * (UniquesArr[j] + (size_t)featIdx[j]);
+                addToHist(hist, adds);
+            }
+        }
+    }
+
+private:
+    static void addToHist(algorithmFPType * hist, const algorithmFPType * adds)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < 4; k++) hist[k] += adds[k];
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Computes the histograms of the rows which bin indices are stored sparse.
+// A stored bin index moves the gradients of the row from the bin of zero of the feature
+// to the stored bin, the sums of the gradients of the block of rows are added to the bins
+// of zero of all the features then
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename RowIndexType, typename BinIndexType, typename FeatureIndexType, typename algorithmFPType, CpuType cpu>
+struct ComputeGHSumBySparseRows
+{
+    static void run(algorithmFPType * aGHSumFP, const size_t * rowOffsets, const FeatureIndexType * features, const BinIndexType * bins,
+                    const BinIndexType * zeroBins, const RowIndexType * aIdx, const algorithmFPType * pgh, size_t nFeatures, size_t iStart,
+                    size_t iEnd, const size_t * UniquesArr)
+    {
+        /* g, h, n and padding of the histogram bin are updated as one vector of 4 elements */
+        algorithmFPType adds[4]  = { 0, 0, 1, 0 };
+        algorithmFPType total[4] = { 0, 0, 0, 0 };
+
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const RowIndexType iRow = aIdx[i];
+            adds[0]                 = pgh[2 * iRow];
+            adds[1]                 = pgh[2 * iRow + 1];
+            addToHist(total, adds);
+
+            for (size_t k = rowOffsets[iRow]; k < rowOffsets[iRow + 1]; ++k)
+            {
+                const size_t j = features[k];
+                addToHist(aGHSumFP + 4 * (UniquesArr[j] + (size_t)bins[k]), adds);
+                subFromHist(aGHSumFP + 4 * (UniquesArr[j] + (size_t)zeroBins[j]), adds);
             }
         }
+
+        for (size_t j = 0; j < nFeatures; ++j) addToHist(aGHSumFP + 4 * (UniquesArr[j] + (size_t)zeroBins[j]), total);
+    }
+
+private:
+    static void addToHist(algorithmFPType * hist, const algorithmFPType * adds)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < 4; k++) hist[k] += adds[k];
+    }
+
+    static void subFromHist(algorithmFPType * hist, const algorithmFPType * adds)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < 4; k++) hist[k] -= adds[k];
     }
 };
 
@@ -336,7 +398,7 @@ struct ComputeGHSumByRows<RowIndexType, BinIndexType, float, SSE42_ALL>
     {
         const size_t cacheLineSize       = 64; // bytes
         const size_t prefetchOffset      = 10; // heuristic, prefetch on 10 rows ahead
-        const size_t elementsInCacheLine = cacheLineSize / sizeof(IndexType);
+        const size_t elementsInCacheLine = cacheLineSize / sizeof(BinIndexType);
 
         const size_t noPrefetchSize              = services::internal::min<SSE42_ALL, size_t>(prefetchOffset + elementsInCacheLine, nRows);
         const size_t iEndWithPrefetch            = services::internal::min<SSE42_ALL, size_t>(nRows - noPrefetchSize, iEnd);
@@ -397,7 +459,7 @@ struct ComputeGHSumByRows<RowIndexType, BinIndexType, double, AVX_ALL>
     {
         const size_t cacheLineSize       = 64; // bytes
         const size_t prefetchOffset      = 10; // heuristic, prefetch on 10 rows ahead
-        const size_t elementsInCacheLine = cacheLineSize / sizeof(IndexType);
+        const size_t elementsInCacheLine = cacheLineSize / sizeof(BinIndexType);
 
         const size_t noPrefetchSize              = services::internal::min<AVX_ALL, size_t>(prefetchOffset + elementsInCacheLine, nRows);
         const size_t iEndWithPrefetch            = services::internal::min<AVX_ALL, size_t>(nRows - noPrefetchSize, iEnd);
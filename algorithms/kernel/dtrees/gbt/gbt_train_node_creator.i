@@ -115,7 +115,7 @@ protected:
         buildRightnode(newTasks, nTask, res, impRight);
     }
 
-    void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res)
+    virtual void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res)
     {
         NodeInfoType node(_node.iStart, _split.nLeft, _node.level + 1, _split.left, res->kid[0]);
         newTasks[nTask++] = new (services::internal::service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(_data, node);
@@ -126,7 +126,7 @@ protected:
         }
     }
 
-    void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res, ImpurityType & impRight)
+    virtual void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename NodeType::Split * res, ImpurityType & impRight)
     {
         NodeInfoType node(_node.iStart + _split.nLeft, _node.n - _split.nLeft, _node.level + 1, impRight, res->kid[1]);
         newTasks[nTask++] = new (services::internal::service_scalable_calloc<UpdaterType, cpu>(1)) UpdaterType(_data, node);
@@ -202,6 +202,42 @@ protected:
             MergedUpdaterType(super::_data, node1, node2, super::_prevRes);
     }
 
+    // the right kid is a leaf: if it is smaller, GHSums of the left kid are obtained by subtraction of its GHSums from the parent ones
+    virtual void buildLeftnode(GbtTask ** newTasks, size_t & nTask, typename super::NodeType::Split * res)
+    {
+        const size_t nRight = super::_node.n - super::_split.nLeft;
+        if (nRight >= super::_split.nLeft)
+        {
+            super::buildLeftnode(newTasks, nTask, res);
+            return;
+        }
+
+        typename super::ImpurityType impRight;
+        impRight.g = super::_node.imp.g - super::_split.left.g;
+        impRight.h = super::_node.imp.h - super::_split.left.h;
+
+        typename super::NodeInfoType node(super::_node.iStart, super::_split.nLeft, super::_node.level + 1, super::_split.left, res->kid[0]);
+        typename super::NodeInfoType leaf(super::_node.iStart + super::_split.nLeft, nRight, super::_node.level + 1, impRight, res->kid[1]);
+        newTasks[nTask++] = new (services::internal::service_scalable_calloc<MergedUpdaterType, cpu>(1))
+            MergedUpdaterType(super::_data, node, leaf, super::_prevRes, true);
+    }
+
+    // the left kid is a leaf: if it is smaller, GHSums of the right kid are obtained by subtraction of its GHSums from the parent ones
+    virtual void buildRightnode(GbtTask ** newTasks, size_t & nTask, typename super::NodeType::Split * res, typename super::ImpurityType & impRight)
+    {
+        const size_t nRight = super::_node.n - super::_split.nLeft;
+        if (super::_split.nLeft >= nRight)
+        {
+            super::buildRightnode(newTasks, nTask, res, impRight);
+            return;
+        }
+
+        typename super::NodeInfoType node(super::_node.iStart + super::_split.nLeft, nRight, super::_node.level + 1, impRight, res->kid[1]);
+        typename super::NodeInfoType leaf(super::_node.iStart, super::_split.nLeft, super::_node.level + 1, super::_split.left, res->kid[0]);
+        newTasks[nTask++] = new (services::internal::service_scalable_calloc<MergedUpdaterType, cpu>(1))
+            MergedUpdaterType(super::_data, node, leaf, super::_prevRes, true);
+    }
+
     using super::_data;
     using super::_split;
     using super::_node;
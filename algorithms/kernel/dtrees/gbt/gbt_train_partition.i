@@ -151,12 +151,34 @@ protected:
 
     DAAL_INT doPartition(size_t n, size_t iStart, SplitDataType & split, DAAL_INT iFeature, size_t idxFeatureValueBestSplit)
     {
-        return doPartitionIdx(n, _sharedData.aIdx + iStart, _sharedData.ctx.dataHelper().indexedFeatures().data(iFeature), split.featureUnordered,
-                              idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
+        // histogram method keeps the compact row-major bin indices only
+        const BinIndexType * binnedFeatures = _sharedData.GH_SUMS_BUF->newFI;
+        if (binnedFeatures)
+        {
+            const BinIndexType * const binnedFeature = binnedFeatures + iFeature;
+            const size_t stride                      = _sharedData.ctx.nFeatures();
+            return doPartitionIdx(
+                n, _sharedData.aIdx + iStart, [=](RowIndexType iRow) -> BinIndexType { return binnedFeature[iRow * stride]; }, split.featureUnordered,
+                idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
+        }
+
+        // histogram method on the CSR data keeps the bin indices that differ from the bins of zero only
+        const SparseBins<BinIndexType, cpu> * sparseBins = _sharedData.GH_SUMS_BUF->sparseBins;
+        if (sparseBins)
+            return doPartitionIdx(
+                n, _sharedData.aIdx + iStart, [=](RowIndexType iRow) -> BinIndexType { return sparseBins->get(iRow, iFeature); },
+                split.featureUnordered, idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
+
+        const IndexedFeatures::IndexType * const indexedFeature = _sharedData.ctx.dataHelper().indexedFeatures().data(iFeature);
+        return doPartitionIdx(
+            n, _sharedData.aIdx + iStart, [=](RowIndexType iRow) -> IndexedFeatures::IndexType { return indexedFeature[iRow]; },
+            split.featureUnordered, idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
     }
 
-    DAAL_INT doPartitionIdx(IndexType n, RowIndexType * aIdx, const RowIndexType * indexedFeature, bool featureUnordered,
-                            RowIndexType idxFeatureValueBestSplit, RowIndexType * buffer, RowIndexType nLeft)
+    //binOf(iRow) returns the index of the feature value of the row
+    template <typename BinAccessor>
+    DAAL_INT doPartitionIdx(IndexType n, RowIndexType * aIdx, const BinAccessor & binOf, bool featureUnordered, RowIndexType idxFeatureValueBestSplit,
+                            RowIndexType * buffer, RowIndexType nLeft)
     {
         DAAL_INT iRowSplitVal = -1;
 
@@ -191,7 +213,7 @@ protected:
                 PRAGMA_VECTOR_ALWAYS
                 for (IndexType i = iStart; i < iEnd; ++i)
                 {
-                    if (indexedFeature[aIdx[i]] != idxFeatureValueBestSplit)
+                    if (binOf(aIdx[i]) != idxFeatureValueBestSplit)
                         bestSplitIdxRight[iRight++] = aIdx[i];
                     else
                         bestSplitIdx[iLeft++] = aIdx[i];
@@ -203,7 +225,7 @@ protected:
                 PRAGMA_VECTOR_ALWAYS
                 for (IndexType i = iStart; i < iEnd; ++i)
                 {
-                    if (indexedFeature[aIdx[i]] > idxFeatureValueBestSplit)
+                    if (binOf(aIdx[i]) > idxFeatureValueBestSplit)
                         bestSplitIdxRight[iRight++] = aIdx[i];
                     else
                         bestSplitIdx[iLeft++] = aIdx[i];
@@ -238,7 +260,7 @@ protected:
         });
 
         RowIndexType i = 0;
-        while (indexedFeature[aIdx[i]] != idxFeatureValueBestSplit) i++;
+        while (binOf(aIdx[i]) != idxFeatureValueBestSplit) i++;
         iRowSplitVal = aIdx[i];
 
         return iRowSplitVal;
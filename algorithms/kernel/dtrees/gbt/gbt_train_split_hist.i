@@ -153,7 +153,7 @@ public:
     FindMaxImpurityDecreaseWithGHSumsReduceTaskMerged(size_t iFeature, size_t nBlocks, SharedDataType & sharedData, const NodeInfoType & node1,
                                                       const NodeInfoType & node2, BestSplitType & bestSplit1, BestSplitType & bestSplit2,
                                                       const ResultType & prevRes, ResultType & res1, ResultType & res2, algorithmFPType ** results,
-                                                      size_t size)
+                                                      size_t size, bool isLeaf1 = false)
         : _iFeature(iFeature),
           _nBlocks(nBlocks),
           _data(sharedData),
@@ -165,7 +165,8 @@ public:
           _res2(res2),
           _prevRes(prevRes),
           _results(results),
-          _size(size)
+          _size(size),
+          _isLeaf1(isLeaf1)
     {}
 
     virtual GbtTask * execute()
@@ -187,6 +188,8 @@ public:
         daal::threader_for(2, 2, [&](size_t iBlock) {
             if (iBlock == 0)
             {
+                if (_isLeaf1) return; // GHSums of the leaf are needed for the sibling only
+
                 // TODO: check for hasDiffFeatureValues()
 
                 const bool featureUnordered = _data.ctx.featTypes().isUnordered(_iFeature);
@@ -259,6 +262,7 @@ protected:
     const ResultType & _prevRes;
     algorithmFPType ** _results;
     const size_t _size;
+    const bool _isLeaf1;
 };
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename MergedRType, CpuType cpu>
@@ -371,7 +375,15 @@ public:
             local->isInitilized = true;
         }
 
-        algorithmFPType * pgh = (algorithmFPType *)_data.ctx.grad(_data.iTree);
+        algorithmFPType * pgh                            = (algorithmFPType *)_data.ctx.grad(_data.iTree);
+        const SparseBins<BinIndexType, cpu> * sparseBins = _data.GH_SUMS_BUF->sparseBins;
+        if (sparseBins)
+        {
+            ComputeGHSumBySparseRows<RowIndexType, BinIndexType, typename SparseBins<BinIndexType, cpu>::FeatureIndexType, algorithmFPType, cpu>::run(
+                aGHSumFP, sparseBins->rowOffsets(), sparseBins->features(), sparseBins->bins(), sparseBins->zeroBins(), aIdx, pgh, nFeatures, iStart,
+                iEnd, _data.GH_SUMS_BUF->nUniquesArr.get());
+            return nullptr;
+        }
         ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeature, aIdx, pgh, nFeatures, iStart, iEnd,
                                                                                   _node.iStart + _node.n, _data.GH_SUMS_BUF->nUniquesArr.get());
         return nullptr;
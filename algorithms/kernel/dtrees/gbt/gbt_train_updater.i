@@ -251,8 +251,10 @@ public:
 
     using GHSumType = ghSum<algorithmFPType, cpu>;
 
-    MergedUpdaterByRows(DataType & data, NodeInfoType & node1, NodeInfoType & node2, MergedResult<ResultType, cpu> * _prevResult)
-        : super(data, node1), _node2(node2), _prevRes(_prevResult)
+    // isLeaf2 means that node2 is a leaf already, its GHSums are computed only to get GHSums of node1 by subtraction
+    MergedUpdaterByRows(DataType & data, NodeInfoType & node1, NodeInfoType & node2, MergedResult<ResultType, cpu> * _prevResult,
+                        bool isLeaf2 = false)
+        : super(data, node1), _node2(node2), _prevRes(_prevResult), _isLeaf2(isLeaf2)
     {}
 
     virtual void findSplit(const RowIndexType * featureSample, BestSplitType & bestSplit) DAAL_C11_OVERRIDE {}
@@ -267,7 +269,10 @@ public:
         DAAL_INT idxFeatureValueBestSplit1;
         DAAL_INT idxFeatureValueBestSplit2;
 
-        if (_node1.n < _node2.n) // full GHSums will be computed for 1 node
+        if (_isLeaf2) // full GHSums will be computed for the leaf, split is found for 1 node only
+            findBestSplit(_node2, _node1, _bestSplit2, _bestSplit1, _iFeature2, _iFeature1, idxFeatureValueBestSplit2, idxFeatureValueBestSplit1,
+                          _result2, _result1, true);
+        else if (_node1.n < _node2.n) // full GHSums will be computed for 1 node
             findBestSplit(_node1, _node2, _bestSplit1, _bestSplit2, _iFeature1, _iFeature2, idxFeatureValueBestSplit1, idxFeatureValueBestSplit2,
                           _result1, _result2);
         else // full GHSums will be computed for 2 node
@@ -295,8 +300,16 @@ public:
         NodesCreatorType kidsCreatorLeft(_data, _bestSplit1, _node1, _result1); // spawns 0 or 1 tasks
         kidsCreatorLeft.create(_iFeature1, newTasks, nTasks);
 
-        NodesCreatorType kidsCreatorRight(_data, _bestSplit2, _node2, _result2); // spawns 0 or 1 tasks
-        kidsCreatorRight.create(_iFeature2, newTasks, nTasks);
+        if (_isLeaf2)
+        {
+            _result2->release(_data);
+            _result2 = nullptr;
+        }
+        else
+        {
+            NodesCreatorType kidsCreatorRight(_data, _bestSplit2, _node2, _result2); // spawns 0 or 1 tasks
+            kidsCreatorRight.create(_iFeature2, newTasks, nTasks);
+        }
 
         if (_prevRes)
         {
@@ -308,7 +321,7 @@ public:
 protected:
     virtual void findBestSplit(NodeInfoType & node1, NodeInfoType & node2, SplitDataType & split1, SplitDataType & split2, DAAL_INT & iFeature1,
                                DAAL_INT & iFeature2, DAAL_INT & idxFeatureValueBestSplit1, DAAL_INT & idxFeatureValueBestSplit2,
-                               MergedResult<ResultType, cpu> * result1, MergedResult<ResultType, cpu> * result2)
+                               MergedResult<ResultType, cpu> * result1, MergedResult<ResultType, cpu> * result2, bool isLeaf1 = false)
     {
         const RowIndexType * featureSample = super::chooseFeatures();
 
@@ -319,7 +332,7 @@ protected:
         daal::Mutex mtBestSplit2;
         BestSplitType bestSplit1(split1, _data.ctx.isParallelFeatures() ? &mtBestSplit1 : nullptr);
         BestSplitType bestSplit2(split2, _data.ctx.isParallelFeatures() ? &mtBestSplit2 : nullptr);
-        findSplitbyRows(featureSample, bestSplit1, bestSplit2, node1, node2, result1, result2);
+        findSplitbyRows(featureSample, bestSplit1, bestSplit2, node1, node2, result1, result2, isLeaf1);
 
         bestSplit1.getResult(iFeature1, idxFeatureValueBestSplit1);
         bestSplit2.getResult(iFeature2, idxFeatureValueBestSplit2);
@@ -331,7 +344,7 @@ protected:
     }
 
     void findSplitbyRows(const RowIndexType * featureSample, BestSplitType & bestSplit1, BestSplitType & bestSplit2, NodeInfoType & node1,
-                         NodeInfoType & node2, MergedResult<ResultType, cpu> * result1, MergedResult<ResultType, cpu> * result2)
+                         NodeInfoType & node2, MergedResult<ResultType, cpu> * result1, MergedResult<ResultType, cpu> * result2, bool isLeaf1)
     {
         const size_t nRows       = node1.n;
         const size_t sizeOfBlock = 512;
@@ -352,7 +365,7 @@ protected:
         LoopHelper<cpu>::run(true, _data.ctx.nFeaturesPerNode(), [&](size_t i) {
             const DAAL_INT iFeature = featureSample ? featureSample[i] : i;
             DAAL_TYPENAME SplitMode::FindBestSplitMergedTask task(iFeature, nBlocks, _data, node1, node2, bestSplit1, bestSplit2, _prevRes->res[i],
-                                                                  result1->res[i], result2->res[i], ptrs, size);
+                                                                  result1->res[i], result2->res[i], ptrs, size, isLeaf1);
             task.execute();
         });
 
@@ -378,6 +391,7 @@ protected:
     MergedResult<ResultType, cpu> * _prevRes;
     MergedResult<ResultType, cpu> * _result1;
     MergedResult<ResultType, cpu> * _result2;
+    const bool _isLeaf2;
 };
 
 } /* namespace internal */
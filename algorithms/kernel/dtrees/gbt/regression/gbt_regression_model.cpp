@@ -89,14 +89,19 @@ services::Status ModelImpl::serializeImpl(data_management::InputDataArchive * ar
 {
     auto s = algorithms::regression::Model::serialImpl<data_management::InputDataArchive, false>(arch);
     s.add(algorithms::regression::internal::ModelInternal::serialImpl<data_management::InputDataArchive, false>(arch));
-    return s.add(ImplType::serialImpl<data_management::InputDataArchive, false>(arch));
+    s.add(ImplType::serialImpl<data_management::InputDataArchive, false>(arch));
+    arch->set(_logLink);
+    return s;
 }
 
 services::Status ModelImpl::deserializeImpl(const data_management::OutputDataArchive * arch)
 {
     auto s = algorithms::regression::Model::serialImpl<const data_management::OutputDataArchive, true>(arch);
     s.add(algorithms::regression::internal::ModelInternal::serialImpl<const data_management::OutputDataArchive, true>(arch));
-    return s.add(ImplType::serialImpl<const data_management::OutputDataArchive, true>(arch));
+    s.add(ImplType::serialImpl<const data_management::OutputDataArchive, true>(arch));
+    const int daalVersion = COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion());
+    if (daalVersion >= COMPUTE_DAAL_VERSION(2021, 1, 3)) arch->set(_logLink);
+    return s;
 }
 
 } // namespace internal
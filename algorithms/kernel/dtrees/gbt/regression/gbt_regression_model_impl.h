@@ -48,7 +48,7 @@ public:
     typedef gbt::internal::ModelImpl ImplType;
     typedef algorithms::regression::internal::ModelInternal RegressionImplType;
 
-    ModelImpl(size_t nFeatures = 0) : RegressionImplType(nFeatures) {}
+    ModelImpl(size_t nFeatures = 0) : RegressionImplType(nFeatures), _logLink(0) {}
     ~ModelImpl() {}
 
     virtual size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE { return RegressionImplType::getNumberOfFeatures(); }
@@ -65,6 +65,13 @@ public:
     virtual services::Status deserializeImpl(const data_management::OutputDataArchive * arch) DAAL_C11_OVERRIDE;
 
     virtual size_t getNumberOfTrees() const DAAL_C11_OVERRIDE;
+
+    //returns true if the sum of the responses of the trees is the logarithm of the prediction
+    bool isLogLink() const { return _logLink != 0; }
+    void setLogLink(bool bLogLink) { _logLink = (bLogLink ? 1 : 0); }
+
+protected:
+    int _logLink;
 };
 
 } // namespace internal
@@ -33,6 +33,7 @@
 #include "service_numeric_table.h"
 #include "service_error_handling.h"
 #include "service_memory.h"
+#include "service_math.h"
 #include "dtrees_regression_predict_dense_default_impl.i"
 #include "gbt_predict_dense_default_impl.i"
 
@@ -99,7 +100,25 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const gbt::reg
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
-    return runInternal(pHostApp, this->_res);
+    services::Status s = runInternal(pHostApp, this->_res);
+    if (!s || !m->isLogLink()) return s;
+
+    //the trees are trained on the log link scale, the prediction is the exponent of their responses
+    const size_t nRows = this->_data->getNumberOfRows();
+    WriteRows<algorithmFPType, cpu> resBD(this->_res, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(resBD);
+    algorithmFPType * res = resBD.get();
+
+    auto nBlocks           = daal::threader_get_threads_number();
+    const size_t blockSize = nRows / nBlocks;
+    nBlocks += (nBlocks * blockSize != nRows);
+
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        const size_t startRow  = iBlock * blockSize;
+        const size_t finishRow = (((iBlock + 1) == nBlocks) ? nRows : (iBlock + 1) * blockSize);
+        daal::internal::Math<algorithmFPType, cpu>::vExp(finishRow - startRow, res + startRow, res + startRow);
+    });
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -112,6 +131,7 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(servic
     DAAL_CHECK_BLOCK_STATUS(resBD);
     services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
     const size_t nThreads = daal::threader_get_threads_number();
+    dtrees::prediction::internal::SparseRows<algorithmFPType, cpu> sparseRows(*this->_data);
     SafeStatus safeStat;
     services::Status s;
     HostAppHelper host(pHostApp, 100);
@@ -123,9 +143,16 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::runInternal(servic
         daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iBlock * dim.nRowsInBlock : dim.nRowsInBlock;
+            algorithmFPType * res       = resBD.get() + iStartRow;
+            if (sparseRows.isSparse())
+            {
+                safeStat |= sparseRows.forEach(iStartRow, nRowsToProcess, [&](size_t iRow, const algorithmFPType * x) {
+                    res[iRow] += predictByTrees(iTree, nTreesToUse, x);
+                });
+                return;
+            }
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(this->_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() + iStartRow;
 
             size_t iRow;
             for (iRow = 0; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
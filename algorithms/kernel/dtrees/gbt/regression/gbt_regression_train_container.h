@@ -27,6 +27,7 @@
 #include "kernel.h"
 #include "gbt_regression_training_types.h"
 #include "gbt_regression_training_batch.h"
+#include "gbt_regression_training_distributed.h"
 #include "gbt_regression_train_kernel.h"
 #include "gbt_regression_model_impl.h"
 #include "service_algo_utils.h"
@@ -76,8 +77,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     gbt::regression::Model * m = result->get(model).get();
 
-    const Parameter * par                  = static_cast<gbt::regression::training::Parameter *>(_par);
-    daal::services::Environment::env & env = *_env;
+    const gbt::regression::training::Parameter * par = static_cast<gbt::regression::training::Parameter *>(_par);
+    daal::services::Environment::env & env           = *_env;
     daal::algorithms::engines::internal::BatchBaseImpl * engine =
         dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(par->engine.get());
 
@@ -96,6 +97,99 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::setupCompute()
     return services::Status();
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::RegressionTrainDistrStep1Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+/**
+ *  \brief Choose appropriate kernel to compute the histograms of the gradients on the local node
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    DistributedStep1LocalInput * input        = static_cast<DistributedStep1LocalInput *>(_in);
+    DistributedStep1LocalPartialResult * pres = static_cast<DistributedStep1LocalPartialResult *>(_pres);
+
+    const NumericTable * x              = input->get(data).get();
+    const NumericTable * y              = input->get(dependentVariable).get();
+    const NumericTable * binBordersMsg  = input->get(binBordersFromStep2).get();
+    const NumericTable * levelSplitsMsg = input->get(levelSplitsFromStep2).get();
+
+    const gbt::regression::training::Parameter * par = static_cast<gbt::regression::training::Parameter *>(_par);
+    daal::services::Environment::env & env           = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::RegressionTrainDistrStep1Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, binBordersMsg,
+                       levelSplitsMsg, *pres, *par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    return services::Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::RegressionTrainDistrStep2Kernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+/**
+ *  \brief Choose appropriate kernel to merge the histograms of the gradients and to find the splits on the master node
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedStep2MasterInput * input        = static_cast<DistributedStep2MasterInput *>(_in);
+    DistributedStep2MasterPartialResult * pres = static_cast<DistributedStep2MasterPartialResult *>(_pres);
+    DataCollection * binSketchesMsgs           = input->get(binSketchesFromStep1).get();
+    DataCollection * histogramsMsgs            = input->get(histogramsFromStep1).get();
+
+    const gbt::regression::training::Parameter * par = static_cast<gbt::regression::training::Parameter *>(_par);
+    daal::services::Environment::env & env           = *_env;
+
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::RegressionTrainDistrStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
+                                                   compute, binSketchesMsgs, histogramsMsgs, *pres, *par);
+    binSketchesMsgs->clear();
+    histogramsMsgs->clear();
+    return s;
+}
+
+/**
+ *  \brief Choose appropriate kernel to build the model from the trees kept on the master node
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    DistributedStep2MasterPartialResult * pres = static_cast<DistributedStep2MasterPartialResult *>(_pres);
+    Result * result                            = static_cast<Result *>(_res);
+
+    gbt::regression::Model * m                   = result->get(model).get();
+    gbt::regression::internal::ModelImpl * pImpl = dynamic_cast<gbt::regression::internal::ModelImpl *>(m);
+    DAAL_ASSERT(pImpl);
+    pImpl->clear();
+
+    const gbt::regression::training::Parameter * par = static_cast<gbt::regression::training::Parameter *>(_par);
+    daal::services::Environment::env & env           = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::RegressionTrainDistrStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute, *pres, *m,
+                       *par);
+}
+
 } // namespace training
 } // namespace regression
 } // namespace gbt
@@ -0,0 +1,120 @@
+/* file: gbt_regression_train_dense_default_distr_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees regression training
+//  (defaultDense) method in the distributed processing mode.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAIN_DENSE_DEFAULT_DISTR_IMPL_I__
+#define __GBT_REGRESSION_TRAIN_DENSE_DEFAULT_DISTR_IMPL_I__
+
+#include "gbt_regression_train_dense_default_impl.i"
+#include "gbt_train_distributed.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// RegressionTrainDistrStep1Kernel
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status computeLocalStep(const NumericTable * x, const NumericTable * y, const NumericTable * binBordersMsg,
+                                  const NumericTable * levelSplitsMsg, DistributedStep1LocalPartialResult & partialResult, const Parameter & par)
+{
+    SquaredLoss<algorithmFPType, cpu> loss;
+
+    DataCollectionPtr internalData = partialResult.get(internalResult);
+    NumericTablePtr binSketchesMsg;
+    NumericTablePtr histogramsMsg;
+    DistributedLocalStep<algorithmFPType, BinIndexType, cpu> step(*x, *y, *internalData, par);
+    services::Status s = step.compute(binBordersMsg, levelSplitsMsg, loss, binSketchesMsg, histogramsMsg);
+    if (s)
+    {
+        partialResult.set(binSketches, binSketchesMsg);
+        partialResult.set(histograms, histogramsMsg);
+    }
+    return s;
+}
+
+template <typename algorithmFPType, gbt::regression::training::Method method, CpuType cpu>
+services::Status RegressionTrainDistrStep1Kernel<algorithmFPType, method, cpu>::compute(const NumericTable * x, const NumericTable * y,
+                                                                                        const NumericTable * binBordersMsg,
+                                                                                        const NumericTable * levelSplitsMsg,
+                                                                                        DistributedStep1LocalPartialResult & partialResult,
+                                                                                        const Parameter & par)
+{
+    DAAL_CHECK(par.loss == squared, services::ErrorMethodNotSupported);
+
+    //the number of the bins merged on the master node does not exceed maxBins
+    if (par.maxBins <= 256)
+        return computeLocalStep<algorithmFPType, uint8_t, cpu>(x, y, binBordersMsg, levelSplitsMsg, partialResult, par);
+    else if (par.maxBins <= 65536)
+        return computeLocalStep<algorithmFPType, uint16_t, cpu>(x, y, binBordersMsg, levelSplitsMsg, partialResult, par);
+    return computeLocalStep<algorithmFPType, uint32_t, cpu>(x, y, binBordersMsg, levelSplitsMsg, partialResult, par);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// RegressionTrainDistrStep2Kernel
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, gbt::regression::training::Method method, CpuType cpu>
+services::Status RegressionTrainDistrStep2Kernel<algorithmFPType, method, cpu>::compute(const DataCollection * binSketchesMsgs,
+                                                                                        const DataCollection * histogramsMsgs,
+                                                                                        DistributedStep2MasterPartialResult & partialResult,
+                                                                                        const Parameter & par)
+{
+    DataCollectionPtr internalData = partialResult.get(internalResult);
+    NumericTablePtr binBordersMsg;
+    NumericTablePtr levelSplitsMsg;
+    DistributedMasterStep<algorithmFPType, cpu> step(*internalData, par);
+    services::Status s = step.compute(*binSketchesMsgs, *histogramsMsgs, binBordersMsg, levelSplitsMsg);
+    if (s)
+    {
+        partialResult.set(binBorders, binBordersMsg);
+        partialResult.set(levelSplits, levelSplitsMsg);
+    }
+    return s;
+}
+
+template <typename algorithmFPType, gbt::regression::training::Method method, CpuType cpu>
+services::Status RegressionTrainDistrStep2Kernel<algorithmFPType, method, cpu>::finalizeCompute(
+    const DistributedStep2MasterPartialResult & partialResult, gbt::regression::Model & m, const Parameter & par)
+{
+    DataCollectionPtr internalData = partialResult.get(internalResult);
+    DistributedMasterStep<algorithmFPType, cpu> step(*internalData, par);
+    return step.finalizeCompute(*static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m));
+}
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace regression */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -29,6 +29,8 @@
 #include "gbt_regression_model_impl.h"
 #include "gbt_train_dense_default_impl.i"
 #include "gbt_train_tree_builder.i"
+#include "gbt_train_external_tree_builder.i"
+#include "service_math.h"
 
 using namespace daal::algorithms::dtrees::training::internal;
 using namespace daal::algorithms::gbt::training::internal;
@@ -46,36 +48,296 @@ namespace training
 namespace internal
 {
 //////////////////////////////////////////////////////////////////////////////////////////
-// Squared loss function, L(y,f)=1/2([y-f(x)]^2)
+// Base class for the regression loss functions. The gradients and the hessians are computed
+// in parallel for the blocks of observations gathered into contiguous arrays
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu>
-class SquaredLoss : public LossFunction<algorithmFPType, cpu>
+class RegressionLoss : public LossFunction<algorithmFPType, cpu>
 {
 public:
-    virtual void getGradients(size_t n, size_t nRows, const algorithmFPType * y, const algorithmFPType * f, const IndexType * sampleInd,
-                              algorithmFPType * gh) DAAL_C11_OVERRIDE
+    virtual services::Status getGradients(size_t n, size_t nRows, const algorithmFPType * y, const algorithmFPType * f, const IndexType * sampleInd,
+                                          algorithmFPType * gh) DAAL_C11_OVERRIDE
     {
-        if (sampleInd)
-        {
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for (size_t i = 0; i < n; ++i)
+        SafeStatus safeStat;
+        const size_t blockSize = 256;
+        const size_t nBlocks   = n / blockSize + !!(n % blockSize);
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t iStart   = iBlock * blockSize;
+            const size_t nInBlock = (iStart + blockSize < n) ? blockSize : n - iStart;
+            algorithmFPType yBuf[blockSize], fBuf[blockSize], g[blockSize], h[blockSize];
+            const algorithmFPType * yBlock = y + iStart;
+            const algorithmFPType * fBlock = f + iStart;
+            if (sampleInd)
             {
-                gh[2 * sampleInd[i]]     = f[sampleInd[i]] - y[sampleInd[i]]; //gradient
-                gh[2 * sampleInd[i] + 1] = 1;                                 //hessian
+                const IndexType * ind = sampleInd + iStart;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nInBlock; ++i)
+                {
+                    yBuf[i] = y[ind[i]];
+                    fBuf[i] = f[ind[i]];
+                }
+                yBlock = yBuf;
+                fBlock = fBuf;
             }
-        }
-        else
-        {
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for (size_t i = 0; i < n; ++i)
+            DAAL_CHECK_STATUS_THR(getBlockGradients(nInBlock, yBlock, fBlock, g, h));
+            if (sampleInd)
+            {
+                const IndexType * ind = sampleInd + iStart;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nInBlock; ++i)
+                {
+                    gh[2 * ind[i]]     = g[i]; //gradient
+                    gh[2 * ind[i] + 1] = h[i]; //hessian
+                }
+            }
+            else
             {
-                gh[2 * i]     = f[i] - y[i]; //gradient
-                gh[2 * i + 1] = 1;           //hessian
+                algorithmFPType * ghBlock = gh + 2 * iStart;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nInBlock; ++i)
+                {
+                    ghBlock[2 * i]     = g[i]; //gradient
+                    ghBlock[2 * i + 1] = h[i]; //hessian
+                }
             }
+        });
+        return safeStat.detach();
+    }
+
+    //initial approximation of the response, the mean of its values by default
+    virtual services::Status getInitialF(size_t n, const algorithmFPType * y, algorithmFPType & val) const
+    {
+        const algorithmFPType div = algorithmFPType(1.) / algorithmFPType(n);
+        val                       = algorithmFPType(0);
+        for (size_t i = 0; i < n; ++i) val += div * y[i];
+        return services::Status();
+    }
+
+protected:
+    virtual services::Status getBlockGradients(size_t n, const algorithmFPType * y, const algorithmFPType * f, algorithmFPType * g,
+                                               algorithmFPType * h) const = 0;
+
+    //alpha-quantile of the response values, linearly interpolated between the order statistics
+    static services::Status getQuantile(size_t n, const algorithmFPType * y, double alpha, algorithmFPType & val)
+    {
+        TArray<algorithmFPType, cpu> sorted(n);
+        DAAL_CHECK_MALLOC(sorted.get());
+        services::internal::tmemcpy<algorithmFPType, cpu>(sorted.get(), y, n);
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(n, sorted.get());
+        const double pos = alpha * double(n - 1);
+        const size_t i   = size_t(pos);
+        val              = sorted[i];
+        if (i + 1 < n) val += algorithmFPType(pos - double(i)) * (sorted[i + 1] - sorted[i]);
+        return services::Status();
+    }
+
+    //logarithm of the mean of the response values that must be non-negative, for the losses with the log link
+    static services::Status getLogMean(size_t n, const algorithmFPType * y, algorithmFPType & val)
+    {
+        algorithmFPType mean = algorithmFPType(0);
+        bool bNegative       = false;
+        for (size_t i = 0; i < n; ++i)
+        {
+            mean += y[i];
+            bNegative |= (y[i] < 0);
+        }
+        mean /= algorithmFPType(n);
+        DAAL_CHECK(!bNegative && (mean > 0), services::ErrorIncorrectValueInTheNumericTable);
+        val = daal::internal::Math<algorithmFPType, cpu>::sLog(mean);
+        return services::Status();
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Squared loss function, L(y,f)=1/2([y-f(x)]^2)
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class SquaredLoss : public RegressionLoss<algorithmFPType, cpu>
+{
+protected:
+    virtual services::Status getBlockGradients(size_t n, const algorithmFPType * y, const algorithmFPType * f, algorithmFPType * g,
+                                               algorithmFPType * h) const DAAL_C11_OVERRIDE
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i)
+        {
+            g[i] = f[i] - y[i];
+            h[i] = 1;
+        }
+        return services::Status();
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Pseudo-Huber loss function, L(y,f)=delta^2*(sqrt(1+([y-f(x)]/delta)^2)-1)
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class PseudoHuberLoss : public RegressionLoss<algorithmFPType, cpu>
+{
+public:
+    PseudoHuberLoss(double delta) : _invDelta(algorithmFPType(1.) / algorithmFPType(delta)) {}
+
+    virtual services::Status getInitialF(size_t n, const algorithmFPType * y, algorithmFPType & val) const DAAL_C11_OVERRIDE
+    {
+        return this->getQuantile(n, y, 0.5, val);
+    }
+
+protected:
+    virtual services::Status getBlockGradients(size_t n, const algorithmFPType * y, const algorithmFPType * f, algorithmFPType * g,
+                                               algorithmFPType * h) const DAAL_C11_OVERRIDE
+    {
+        //h keeps 1+(r/delta)^2 and g keeps its square root until the derivatives are computed
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i)
+        {
+            const algorithmFPType r = (f[i] - y[i]) * _invDelta;
+            h[i]                    = algorithmFPType(1.) + r * r;
+        }
+        daal::internal::Math<algorithmFPType, cpu>::vSqrt(n, h, g);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i)
+        {
+            const algorithmFPType invSqrt = algorithmFPType(1.) / g[i];
+            h[i]                          = invSqrt / h[i];
+            g[i]                          = (f[i] - y[i]) * invSqrt;
+        }
+        return services::Status();
+    }
+
+    const algorithmFPType _invDelta;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Quantile loss function, L(y,f)=max(alpha*[y-f(x)], (alpha-1)*[y-f(x)]).
+// The hessian is replaced with 1, so that the leaf weights are the Newton steps of the squared loss
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class QuantileLoss : public RegressionLoss<algorithmFPType, cpu>
+{
+public:
+    QuantileLoss(double alpha) : _alpha(alpha) {}
+
+    virtual services::Status getInitialF(size_t n, const algorithmFPType * y, algorithmFPType & val) const DAAL_C11_OVERRIDE
+    {
+        return this->getQuantile(n, y, _alpha, val);
+    }
+
+protected:
+    virtual services::Status getBlockGradients(size_t n, const algorithmFPType * y, const algorithmFPType * f, algorithmFPType * g,
+                                               algorithmFPType * h) const DAAL_C11_OVERRIDE
+    {
+        const algorithmFPType gAbove = algorithmFPType(1.) - algorithmFPType(_alpha);
+        const algorithmFPType gBelow = -algorithmFPType(_alpha);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i)
+        {
+            g[i] = (f[i] >= y[i]) ? gAbove : gBelow;
+            h[i] = 1;
+        }
+        return services::Status();
+    }
+
+    const double _alpha;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Poisson loss function with the log link, L(y,f)=exp(f(x))-y*f(x)
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class PoissonLoss : public RegressionLoss<algorithmFPType, cpu>
+{
+public:
+    virtual services::Status getInitialF(size_t n, const algorithmFPType * y, algorithmFPType & val) const DAAL_C11_OVERRIDE
+    {
+        return this->getLogMean(n, y, val);
+    }
+
+protected:
+    virtual services::Status getBlockGradients(size_t n, const algorithmFPType * y, const algorithmFPType * f, algorithmFPType * g,
+                                               algorithmFPType * h) const DAAL_C11_OVERRIDE
+    {
+        daal::internal::Math<algorithmFPType, cpu>::vExp(n, f, h);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i) g[i] = h[i] - y[i];
+        return services::Status();
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Tweedie loss function with the log link, L(y,f)=-y*exp((1-p)f(x))/(1-p)+exp((2-p)f(x))/(2-p)
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class TweedieLoss : public RegressionLoss<algorithmFPType, cpu>
+{
+public:
+    TweedieLoss(double power) : _power(power) {}
+
+    virtual services::Status getInitialF(size_t n, const algorithmFPType * y, algorithmFPType & val) const DAAL_C11_OVERRIDE
+    {
+        return this->getLogMean(n, y, val);
+    }
+
+protected:
+    virtual services::Status getBlockGradients(size_t n, const algorithmFPType * y, const algorithmFPType * f, algorithmFPType * g,
+                                               algorithmFPType * h) const DAAL_C11_OVERRIDE
+    {
+        //g keeps exp((1-p)f) and h keeps exp((2-p)f) until the derivatives are computed
+        const algorithmFPType a = algorithmFPType(1.) - algorithmFPType(_power);
+        const algorithmFPType b = algorithmFPType(2.) - algorithmFPType(_power);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i)
+        {
+            g[i] = a * f[i];
+            h[i] = b * f[i];
+        }
+        daal::internal::Math<algorithmFPType, cpu>::vExp(n, g, g);
+        daal::internal::Math<algorithmFPType, cpu>::vExp(n, h, h);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i)
+        {
+            const algorithmFPType expA = g[i];
+            const algorithmFPType expB = h[i];
+            g[i]                       = expB - y[i] * expA;
+            h[i]                       = b * expB - a * y[i] * expA;
         }
+        return services::Status();
     }
+
+    const double _power;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// User-defined loss function
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class CustomLoss : public RegressionLoss<algorithmFPType, cpu>
+{
+public:
+    CustomLoss(const LossFunctionIface & loss) : _loss(loss) {}
+
+    virtual services::Status getInitialF(size_t n, const algorithmFPType * y, algorithmFPType & val) const DAAL_C11_OVERRIDE
+    {
+        return _loss.getInitialApproximation(n, y, val);
+    }
+
+protected:
+    virtual services::Status getBlockGradients(size_t n, const algorithmFPType * y, const algorithmFPType * f, algorithmFPType * g,
+                                               algorithmFPType * h) const DAAL_C11_OVERRIDE
+    {
+        return _loss.getGradients(n, y, f, g, h);
+    }
+
+    const LossFunctionIface & _loss;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -90,36 +352,43 @@ public:
     TrainBatchTask(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, const gbt::training::Parameter & par,
                    const dtrees::internal::FeatureTypes & featTypes, const dtrees::internal::IndexedFeatures * indexedFeatures,
                    engines::internal::BatchBaseImpl & engine, size_t dummy)
-        : super(pHostApp, x, y, par, featTypes, indexedFeatures, engine, 1), _builder(nullptr)
+        : super(pHostApp, x, y, par, static_cast<const gbt::regression::training::Parameter &>(par).externalMemoryPageSize, featTypes,
+                indexedFeatures, engine, 1),
+          _builder(nullptr)
     {
-        _builder = TreeBuilder<algorithmFPType, int, BinIndexType, cpu>::create(*this); // TODO: replace int
+        _builder = this->isExternalMemoryMode() ? ExternalMemoryTreeBuilder<algorithmFPType, int, BinIndexType, cpu>::create(*this)
+                                                : TreeBuilder<algorithmFPType, int, BinIndexType, cpu>::create(*this); // TODO: replace int
     }
     ~TrainBatchTask() { delete _builder; }
     bool done() { return false; }
     virtual services::Status init() DAAL_C11_OVERRIDE
     {
-        auto s = super::init();
-        if (s) s = _builder->init();
-        return s;
+        services::Status s;
+        DAAL_CHECK_STATUS(s, super::init());
+        const RegressionLoss<algorithmFPType, cpu> * loss = static_cast<const RegressionLoss<algorithmFPType, cpu> *>(this->lossFunc());
+        DAAL_CHECK_STATUS(s, loss->getInitialF(this->_dataHelper.data()->getNumberOfRows(), this->_dataHelper.y(), _initialResponse));
+        return _builder->init();
     }
 
 protected:
     virtual void initLossFunc() DAAL_C11_OVERRIDE
     {
-        switch (static_cast<const gbt::regression::training::Parameter &>(this->_par).loss)
+        const gbt::regression::training::Parameter & par = static_cast<const gbt::regression::training::Parameter &>(this->_par);
+        switch (par.loss)
         {
         case squared: this->_loss = new SquaredLoss<algorithmFPType, cpu>(); break;
+        case pseudoHuber: this->_loss = new PseudoHuberLoss<algorithmFPType, cpu>(par.huberDelta); break;
+        case quantile: this->_loss = new QuantileLoss<algorithmFPType, cpu>(par.quantileAlpha); break;
+        case poisson: this->_loss = new PoissonLoss<algorithmFPType, cpu>(); break;
+        case tweedie: this->_loss = new TweedieLoss<algorithmFPType, cpu>(par.tweediePower); break;
+        case custom: this->_loss = new CustomLoss<algorithmFPType, cpu>(*par.customLoss); break;
         default: DAAL_ASSERT(false);
         }
     }
 
     virtual bool getInitialF(algorithmFPType & val) DAAL_C11_OVERRIDE
     {
-        const auto py             = this->_dataHelper.y();
-        const size_t n            = this->_dataHelper.data()->getNumberOfRows();
-        const algorithmFPType div = algorithmFPType(1.) / algorithmFPType(n);
-        val                       = algorithmFPType(0);
-        for (size_t i = 0; i < n; ++i) val += div * py[i];
+        val = _initialResponse;
         return true;
     }
 
@@ -133,6 +402,7 @@ protected:
 
 protected:
     TreeBuilder<algorithmFPType, int, BinIndexType, cpu> * _builder; // TODO: replace int
+    algorithmFPType _initialResponse = 0.0;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -146,13 +416,24 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
     const bool inexactWithHistMethod =
         !par.memorySavingMode && par.splitMethod == gbt::training::inexact && x->getNumberOfColumns() == nFeaturesPerNode;
+    const bool externalMemoryMode = isExternalMemoryMode(par, par.externalMemoryPageSize);
 
     services::Status s;
     dtrees::internal::IndexedFeatures indexedFeatures;
     dtrees::internal::FeatureTypes featTypes;
     DAAL_CHECK_MALLOC(featTypes.init(*x));
 
-    if (!par.memorySavingMode)
+    if (externalMemoryMode)
+    {
+        DAAL_CHECK_STATUS(s, (initBinsOnSample<algorithmFPType, cpu>(*x, featTypes, par, par.externalMemoryPageSize, indexedFeatures)));
+    }
+    else if (inexactWithHistMethod && (x->getDataLayout() == NumericTableIface::csrArray))
+    {
+        //the bins of the CSR data are computed on its non-zero values, the indices of the features are not created
+        BinParams prm(par.maxBins, par.minBinSize);
+        DAAL_CHECK_STATUS(s, (indexedFeatures.initBins<algorithmFPType, cpu>(*x, x->getNumberOfRows(), featTypes, prm)));
+    }
+    else if (!par.memorySavingMode)
     {
         BinParams prm(par.maxBins, par.minBinSize);
         DAAL_CHECK_STATUS(s,
@@ -188,26 +469,28 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     algorithmFPType * ptrTotalGain  = totalGainRows.get();
     algorithmFPType * ptrGain       = gainRows.get();
 
-    if (inexactWithHistMethod)
+    gbt::regression::internal::ModelImpl & modelImpl = *static_cast<gbt::regression::internal::ModelImpl *>(&m);
+    modelImpl.setLogLink((par.loss == poisson) || (par.loss == tweedie));
+
+    if (inexactWithHistMethod || externalMemoryMode)
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
-                featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHostApp, x, y, modelImpl, par, engine, 1, indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain,
+                ptrTotalGain);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
-                featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHostApp, x, y, modelImpl, par, engine, 1, indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain,
+                ptrTotalGain);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
-                featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHostApp, x, y, modelImpl, par, engine, 1, indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain,
+                ptrTotalGain);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-            pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures, featTypes,
-            &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+            pHostApp, x, y, modelImpl, par, engine, 1, indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
 }
 
@@ -53,6 +53,23 @@ public:
                              const Parameter & par, engines::internal::BatchBaseImpl & engine);
 };
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+class RegressionTrainDistrStep1Kernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable * x, const NumericTable * y, const NumericTable * binBordersMsg, const NumericTable * levelSplitsMsg,
+                             DistributedStep1LocalPartialResult & partialResult, const Parameter & par);
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class RegressionTrainDistrStep2Kernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const DataCollection * binSketchesMsgs, const DataCollection * histogramsMsgs,
+                             DistributedStep2MasterPartialResult & partialResult, const Parameter & par);
+    services::Status finalizeCompute(const DistributedStep2MasterPartialResult & partialResult, gbt::regression::Model & m, const Parameter & par);
+};
+
 } // namespace internal
 } // namespace training
 } // namespace regression
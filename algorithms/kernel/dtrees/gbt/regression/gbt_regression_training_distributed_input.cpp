@@ -0,0 +1,194 @@
+/* file: gbt_regression_training_distributed_input.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees algorithm classes
+//  in the distributed processing mode.
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+#include "daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace interface1
+{
+/* The distributed processing mode bins the data with the global borders and builds every tree on all the observations
+   and all the features with the squared loss, the other options of the parameter are not supported */
+static Status checkDistributedParameter(const daal::algorithms::Parameter * par)
+{
+    const gbt::regression::training::Parameter * prm = static_cast<const gbt::regression::training::Parameter *>(par);
+    DAAL_CHECK_EX(prm->loss == squared, ErrorMethodNotSupported, ParameterName, lossStr());
+    DAAL_CHECK_EX(prm->splitMethod == gbt::training::inexact, ErrorMethodNotSupported, ParameterName, splitMethodStr());
+    DAAL_CHECK_EX(prm->observationsPerTreeFraction == 1, ErrorMethodNotSupported, ParameterName, observationsPerTreeFractionStr());
+    DAAL_CHECK_EX(!prm->memorySavingMode, ErrorMethodNotSupported, ParameterName, memorySavingModeStr());
+    DAAL_CHECK_EX(!prm->externalMemoryPageSize, ErrorMethodNotSupported, ParameterName, externalMemoryPageSizeStr());
+    DAAL_CHECK_EX(!prm->varImportance, ErrorMethodNotSupported, ParameterName, varImportanceStr());
+    return Status();
+}
+
+static Status checkMessages(const DataCollectionPtr & collection, const char * name)
+{
+    const int unexpectedLayouts = (int)packed_mask;
+    Status s;
+    for (size_t i = 0; i < collection->size(); i++)
+    {
+        NumericTable * step1Output = dynamic_cast<NumericTable *>((*collection)[i].get());
+        DAAL_CHECK_EX(step1Output, ErrorIncorrectElementInNumericTableCollection, ArgumentName, name);
+        DAAL_CHECK_STATUS(s, checkNumericTable(step1Output, name, unexpectedLayouts, 0, 0, 1));
+    }
+    return s;
+}
+
+DistributedStep1LocalInput::DistributedStep1LocalInput() : Input(lastDistributedStep1LocalInputId + 1) {}
+
+/**
+ * Returns an input object for model-based training in the first step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr DistributedStep1LocalInput::get(DistributedStep1LocalInputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input object for model-based training in the first step of the distributed processing mode
+ * \param[in] id      Identifier of the input object
+ * \param[in] value   Pointer to the object
+ */
+void DistributedStep1LocalInput::set(DistributedStep1LocalInputId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
+/**
+* Checks an input object for the gradient boosted trees algorithm in the first step of the distributed processing mode
+* \param[in] par     Algorithm parameter
+* \param[in] method  Computation method
+*/
+Status DistributedStep1LocalInput::check(const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, Input::check(par, method));
+    DAAL_CHECK_STATUS(s, checkDistributedParameter(par));
+
+    NumericTablePtr dataTable = get(data);
+    const size_t nFeatures    = dataTable->getNumberOfColumns();
+    const Parameter * prm     = static_cast<const Parameter *>(par);
+    DAAL_CHECK_EX(!prm->featuresPerNode || (prm->featuresPerNode == nFeatures), ErrorMethodNotSupported, ParameterName, featuresPerNodeStr());
+    for (size_t i = 0; i < nFeatures; i++)
+        DAAL_CHECK_EX(dataTable->getFeatureType(i) != features::DAAL_CATEGORICAL, ErrorMethodNotSupported, ArgumentName, dataStr());
+
+    NumericTablePtr binBordersTable  = get(binBordersFromStep2);
+    NumericTablePtr levelSplitsTable = get(levelSplitsFromStep2);
+    DAAL_CHECK(!binBordersTable || !levelSplitsTable, ErrorIncorrectNumberOfInputNumericTables);
+    const int unexpectedLayouts = (int)packed_mask;
+    if (binBordersTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(binBordersTable.get(), binBordersFromStep2Str(), unexpectedLayouts, 0, 0, 1));
+    }
+    if (levelSplitsTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(levelSplitsTable.get(), levelSplitsFromStep2Str(), unexpectedLayouts, 0, 0, 1));
+    }
+    return s;
+}
+
+DistributedStep2MasterInput::DistributedStep2MasterInput() : daal::algorithms::Input(lastDistributedStep2MasterInputId + 1)
+{
+    Argument::set(binSketchesFromStep1, DataCollectionPtr(new DataCollection()));
+    Argument::set(histogramsFromStep1, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Returns an input object for model-based training in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+DataCollectionPtr DistributedStep2MasterInput::get(DistributedStep2MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input object for model-based training in the second step of the distributed processing mode
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the object
+ */
+void DistributedStep2MasterInput::set(DistributedStep2MasterInputId id, const DataCollectionPtr & ptr)
+{
+    Argument::set(id, staticPointerCast<SerializationIface, DataCollection>(ptr));
+}
+
+/**
+ * Adds the output of the first step computed on a local node to the input of the second step
+ * \param[in] id    Identifier of the input object
+ * \param[in] value Pointer to the object
+ */
+void DistributedStep2MasterInput::add(DistributedStep2MasterInputId id, const NumericTablePtr & value)
+{
+    DataCollectionPtr collection = get(id);
+    if (!collection)
+    {
+        collection.reset(new DataCollection());
+        set(id, collection);
+    }
+    collection->push_back(value);
+}
+
+/**
+* Checks an input object for the gradient boosted trees algorithm in the second step of the distributed processing mode
+* \param[in] par     Algorithm parameter
+* \param[in] method  Computation method
+*/
+Status DistributedStep2MasterInput::check(const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, checkDistributedParameter(par));
+
+    DataCollectionPtr sketches = get(binSketchesFromStep1);
+    DataCollectionPtr hists    = get(histogramsFromStep1);
+    DAAL_CHECK_EX(sketches, ErrorNullInputDataCollection, ArgumentName, binSketchesFromStep1Str());
+    DAAL_CHECK_EX(hists, ErrorNullInputDataCollection, ArgumentName, histogramsFromStep1Str());
+
+    /* the summaries are sent on the first iteration only, and the histograms on the next ones */
+    DAAL_CHECK((sketches->size() > 0) != (hists->size() > 0), ErrorIncorrectNumberOfInputNumericTables);
+    DAAL_CHECK_STATUS(s, checkMessages(sketches, binSketchesFromStep1Str()));
+    DAAL_CHECK_STATUS(s, checkMessages(hists, histogramsFromStep1Str()));
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
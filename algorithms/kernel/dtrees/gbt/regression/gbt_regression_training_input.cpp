@@ -44,6 +44,36 @@ namespace training
 {
 namespace interface1
 {
+template <typename T>
+static Status getMean(size_t n, const T * y, T & f0)
+{
+    DAAL_CHECK(n > 0 && y, ErrorIncorrectNumberOfObservations);
+    const T div = T(1) / T(n);
+    f0          = T(0);
+    for (size_t i = 0; i < n; ++i) f0 += div * y[i];
+    return Status();
+}
+
+Status LossFunctionIface::getGradients(size_t n, const float * y, const float * f, float * gradients, float * hessians) const
+{
+    return Status(ErrorMethodNotSupported);
+}
+
+Status LossFunctionIface::getGradients(size_t n, const double * y, const double * f, double * gradients, double * hessians) const
+{
+    return Status(ErrorMethodNotSupported);
+}
+
+Status LossFunctionIface::getInitialApproximation(size_t n, const float * y, float & f0) const
+{
+    return getMean(n, y, f0);
+}
+
+Status LossFunctionIface::getInitialApproximation(size_t n, const double * y, double & f0) const
+{
+    return getMean(n, y, f0);
+}
+
 Parameter::Parameter() : loss(squared), varImportance(0) {}
 Status Parameter::check() const
 {
@@ -98,6 +128,27 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+Parameter::Parameter() : huberDelta(1.0), quantileAlpha(0.5), tweediePower(1.5), externalMemoryPageSize(0) {}
+Status Parameter::check() const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, gbt::training::checkImpl(*this));
+    switch (loss)
+    {
+    case squared:
+    case poisson: break;
+    case custom: DAAL_CHECK_EX(customLoss.get(), ErrorNullParameterNotSupported, ParameterName, customLossStr()); break;
+    case pseudoHuber: DAAL_CHECK_EX(huberDelta > 0, ErrorIncorrectParameter, ParameterName, huberDeltaStr()); break;
+    case quantile: DAAL_CHECK_EX((quantileAlpha > 0) && (quantileAlpha < 1), ErrorIncorrectParameter, ParameterName, quantileAlphaStr()); break;
+    case tweedie: DAAL_CHECK_EX((tweediePower > 1) && (tweediePower < 2), ErrorIncorrectParameter, ParameterName, tweediePowerStr()); break;
+    default: DAAL_CHECK_EX(false, ErrorIncorrectParameter, ParameterName, lossStr());
+    }
+    return s;
+}
+} // namespace interface2
 } // namespace training
 } // namespace regression
 } // namespace gbt
@@ -0,0 +1,166 @@
+/* file: gbt_regression_training_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees algorithm classes
+//  in the distributed processing mode.
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+#include "serialization_utils.h"
+#include "daal_strings.h"
+#include "gbt_train_distributed.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace interface1
+{
+using namespace gbt::training::internal;
+
+static Status checkInternalResult(const DataCollectionPtr & internal)
+{
+    DAAL_CHECK_EX(internal, ErrorNullPartialResult, ArgumentName, internalResultStr());
+    return Status();
+}
+
+/* one of the messages is set on every call of the step, none of them after the training is finished */
+static Status checkMessage(const NumericTablePtr & msg, const char * name)
+{
+    const int unexpectedLayouts = (int)packed_mask;
+    return msg ? checkNumericTable(msg.get(), name, unexpectedLayouts, 0, 0, 1) : Status();
+}
+
+static double getMasterStateValue(const DataCollectionPtr & internal, DistributedMasterStateField field)
+{
+    if (!internal || internal->size() < nMasterData) return 0;
+    NumericTable * state = dynamic_cast<NumericTable *>((*internal)[masterState].get());
+    if (!state || state->getNumberOfColumns() < nStateFields) return 0;
+
+    BlockDescriptor<double> block;
+    state->getBlockOfRows(0, 1, readOnly, block);
+    const double * values = block.getBlockPtr();
+    const double res      = values ? values[field] : 0;
+    state->releaseBlockOfRows(block);
+    return res;
+}
+
+__DAAL_REGISTER_SERIALIZATION_CLASS(DistributedStep1LocalPartialResult, SERIALIZATION_GBT_REGRESSION_STEP1_PARTIAL_RESULT_ID);
+DistributedStep1LocalPartialResult::DistributedStep1LocalPartialResult() : daal::algorithms::PartialResult(lastDistributedPartialResultDataId + 1) {}
+
+NumericTablePtr DistributedStep1LocalPartialResult::get(DistributedStep1LocalPartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep1LocalPartialResult::set(DistributedStep1LocalPartialResultId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
+DataCollectionPtr DistributedStep1LocalPartialResult::get(DistributedPartialResultDataId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep1LocalPartialResult::set(DistributedPartialResultDataId id, const DataCollectionPtr & value)
+{
+    Argument::set(id, staticPointerCast<SerializationIface, DataCollection>(value));
+}
+
+Status DistributedStep1LocalPartialResult::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    return check(par, method);
+}
+
+Status DistributedStep1LocalPartialResult::check(const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, checkMessage(get(binSketches), binSketchesStr()));
+    DAAL_CHECK_STATUS(s, checkMessage(get(histograms), histogramsStr()));
+    return checkInternalResult(get(internalResult));
+}
+
+__DAAL_REGISTER_SERIALIZATION_CLASS(DistributedStep2MasterPartialResult, SERIALIZATION_GBT_REGRESSION_STEP2_PARTIAL_RESULT_ID);
+DistributedStep2MasterPartialResult::DistributedStep2MasterPartialResult() : daal::algorithms::PartialResult(lastDistributedPartialResultDataId + 1)
+{}
+
+NumericTablePtr DistributedStep2MasterPartialResult::get(DistributedStep2MasterPartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep2MasterPartialResult::set(DistributedStep2MasterPartialResultId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
+DataCollectionPtr DistributedStep2MasterPartialResult::get(DistributedPartialResultDataId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+void DistributedStep2MasterPartialResult::set(DistributedPartialResultDataId id, const DataCollectionPtr & value)
+{
+    Argument::set(id, staticPointerCast<SerializationIface, DataCollection>(value));
+}
+
+bool DistributedStep2MasterPartialResult::isTrainingFinished() const
+{
+    return getMasterStateValue(get(internalResult), stateIsFinished) != 0;
+}
+
+size_t DistributedStep2MasterPartialResult::getNumberOfFeatures() const
+{
+    return size_t(getMasterStateValue(get(internalResult), stateNFeatures));
+}
+
+Status DistributedStep2MasterPartialResult::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, checkMessage(get(binBorders), binBordersStr()));
+    DAAL_CHECK_STATUS(s, checkMessage(get(levelSplits), levelSplitsStr()));
+    return checkInternalResult(get(internalResult));
+}
+
+Status DistributedStep2MasterPartialResult::check(const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, checkInternalResult(get(internalResult)));
+    DAAL_CHECK_EX(isTrainingFinished(), ErrorIncorrectParameter, ArgumentName, internalResultStr());
+    DAAL_CHECK_EX(getNumberOfFeatures() > 0, ErrorIncorrectNumberOfFeatures, ArgumentName, internalResultStr());
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
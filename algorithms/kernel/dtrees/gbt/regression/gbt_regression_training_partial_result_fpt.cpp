@@ -0,0 +1,68 @@
+/* file: gbt_regression_training_partial_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees algorithm interface
+//  in the distributed processing mode
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+using namespace daal::data_management;
+
+/* The kinds and the sizes of the messages change from call to call, so the kernels set the output tables,
+   and fill the collection of the internal data on the first call */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status DistributedStep1LocalPartialResult::allocate(const daal::algorithms::Input * input,
+                                                                         const daal::algorithms::Parameter * parameter, const int method)
+{
+    set(internalResult, DataCollectionPtr(new DataCollection()));
+    return services::Status();
+}
+
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status DistributedStep2MasterPartialResult::allocate(const daal::algorithms::Input * input,
+                                                                          const daal::algorithms::Parameter * parameter, const int method)
+{
+    set(internalResult, DataCollectionPtr(new DataCollection()));
+    return services::Status();
+}
+
+template DAAL_EXPORT services::Status DistributedStep1LocalPartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                                                const daal::algorithms::Parameter * parameter,
+                                                                                                const int method);
+template DAAL_EXPORT services::Status DistributedStep2MasterPartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                                                 const daal::algorithms::Parameter * parameter,
+                                                                                                 const int method);
+
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
@@ -74,8 +74,19 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     return s;
 }
 
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialResult * partialResult, const Parameter * parameter, const int method)
+{
+    services::Status s;
+    const DistributedStep2MasterPartialResult * pres = static_cast<const DistributedStep2MasterPartialResult *>(partialResult);
+    set(model, daal::algorithms::gbt::regression::Model::create(pres->getNumberOfFeatures(), &s));
+    return s;
+}
+
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const Parameter * parameter,
                                                                     const int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult * partialResult,
+                                                                    const Parameter * parameter, const int method);
 
 } // namespace training
 } // namespace regression
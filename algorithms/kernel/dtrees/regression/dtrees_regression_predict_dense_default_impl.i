@@ -56,17 +56,15 @@ class PredictRegressionTaskBase
 {
 public:
     typedef dtrees::internal::TreeImpRegression<> TreeType;
+    typedef dtrees::prediction::internal::FlatForest<algorithmFPType, cpu> FlatForestType;
+    typedef typename FlatForestType::TreeType FlatTreeType;
+    typedef typename FlatForestType::NodeIndexType NodeIndexType;
     PredictRegressionTaskBase(const NumericTable * x, NumericTable * y) : _data(x), _res(y) {}
 
 protected:
-    static algorithmFPType predict(const dtrees::internal::DecisionTreeTable & t, const dtrees::internal::FeatureTypes & featTypes,
-                                   const algorithmFPType * x)
+    static algorithmFPType predict(const FlatTreeType & t, const dtrees::internal::FeatureTypes & featTypes, const algorithmFPType * x)
     {
-        const typename dtrees::internal::DecisionTreeNode * pNode =
-            dtrees::prediction::internal::findNode<algorithmFPType, TreeType, cpu>(t, featTypes, x);
-        DAAL_ASSERT(pNode);
-
-        return pNode ? pNode->featureValueOrResponse : 0.;
+        return t.featureValueOrResponse[dtrees::prediction::internal::findNode<algorithmFPType, cpu>(t, featTypes, x)];
     }
 
     algorithmFPType predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x)
@@ -74,31 +72,53 @@ protected:
         algorithmFPType val    = 0;
         const size_t iLastTree = iFirstTree + nTrees;
 
-        for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree) val += predict(*_aTree[iTree], _featHelper, x);
+        for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree) val += predict((*_flatForest)[iTree], _featHelper, x);
         return val;
     }
+
+    //prediction for the block of observations, all features are ordered
+    void predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, size_t nRows, size_t nCols, algorithmFPType * res,
+                        algorithmFPType factor)
+    {
+        DAAL_ASSERT(nRows <= s_cRowsInSubBlock);
+        NodeIndexType aNode[s_cRowsInSubBlock];
+        algorithmFPType aVal[s_cRowsInSubBlock];
+        for (size_t i = 0; i < nRows; ++i) aVal[i] = 0;
+
+        const size_t iLastTree = iFirstTree + nTrees;
+        for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+        {
+            const FlatTreeType & t = (*_flatForest)[iTree];
+            dtrees::prediction::internal::findNodes<algorithmFPType, cpu>(t, x, nRows, nCols, aNode);
+            for (size_t i = 0; i < nRows; ++i) aVal[i] += t.featureValueOrResponse[aNode[i]];
+        }
+        for (size_t i = 0; i < nRows; ++i) res[i] += factor * aVal[i];
+    }
     services::Status run(services::HostAppIface * pHostApp, algorithmFPType factor);
 
 protected:
     dtrees::internal::FeatureTypes _featHelper;
-    TArray<const dtrees::internal::DecisionTreeTable *, cpu> _aTree;
+    services::SharedPtr<const FlatForestType> _flatForest;
     const NumericTable * _data;
     NumericTable * _res;
+    static const size_t s_cRowsInSubBlock = 32;
 };
 
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::HostAppIface * pHostApp, algorithmFPType factor)
 {
-    const auto nTreesTotal = _aTree.size();
-    const auto treeSize    = _aTree[0]->getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
+    services::Status s;
+    const auto nTreesTotal = _flatForest->size();
+    const auto treeSize    = (*_flatForest)[0].nNodes * FlatForestType::nodeSize();
 
     dtrees::prediction::internal::TileDimensions<algorithmFPType> dim(*_data, nTreesTotal, treeSize);
     WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(resBD);
     services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
-    const size_t nThreads = daal::threader_get_threads_number();
+    const size_t nThreads   = daal::threader_get_threads_number();
+    const bool bBlockOfRows = !_featHelper.hasUnorderedFeatures();
+    dtrees::prediction::internal::SparseRows<algorithmFPType, cpu> sparseRows(*_data);
     SafeStatus safeStat;
-    services::Status s;
     HostAppHelper host(pHostApp, 100);
     for (size_t iTree = 0; iTree < nTreesTotal; iTree += dim.nTreesInBlock)
     {
@@ -107,10 +127,34 @@ services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::
         daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
             const size_t iStartRow      = iBlock * dim.nRowsInBlock;
             const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iBlock * dim.nRowsInBlock : dim.nRowsInBlock;
+            algorithmFPType * res       = resBD.get() + iStartRow;
+            if (sparseRows.isSparse())
+            {
+                safeStat |= sparseRows.forEach(iStartRow, nRowsToProcess, [&](size_t iRow, const algorithmFPType * x) {
+                    res[iRow] += factor * predictByTrees(iTree, nTreesToUse, x);
+                });
+                return;
+            }
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-            algorithmFPType * res = resBD.get() + iStartRow;
-            if (nRowsToProcess < 2 * nThreads || cpu == __avx512_mic__)
+            if (bBlockOfRows)
+            {
+                const size_t nSubBlocks = nRowsToProcess / s_cRowsInSubBlock + !!(nRowsToProcess % s_cRowsInSubBlock);
+                auto predictSubBlock    = [&](size_t iSubBlock) {
+                    const size_t iRow  = iSubBlock * s_cRowsInSubBlock;
+                    const size_t nRows = (iSubBlock == nSubBlocks - 1) ? nRowsToProcess - iRow : s_cRowsInSubBlock;
+                    predictByTrees(iTree, nTreesToUse, xBD.get() + iRow * dim.nCols, nRows, dim.nCols, res + iRow, factor);
+                };
+                if (nSubBlocks < 2 * nThreads || cpu == __avx512_mic__)
+                {
+                    for (size_t iSubBlock = 0; iSubBlock < nSubBlocks; ++iSubBlock) predictSubBlock(iSubBlock);
+                }
+                else
+                {
+                    daal::threader_for(nSubBlocks, nSubBlocks, predictSubBlock);
+                }
+            }
+            else if (nRowsToProcess < 2 * nThreads || cpu == __avx512_mic__)
             {
                 for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
                     res[iRow] += factor * predictByTrees(iTree, nTreesToUse, xBD.get() + iRow * dim.nCols);
@@ -54,7 +54,8 @@ services::Status Model::serializeImpl(data_management::InputDataArchive  * arch)
 services::Status Model::deserializeImpl(const data_management::OutputDataArchive * arch)
 {
     daal::algorithms::classifier::Model::serialImpl<const data_management::OutputDataArchive, true>(arch);
-    return _impl->serialImpl<const data_management::OutputDataArchive, true>(arch);
+    return _impl->serialImpl<const data_management::OutputDataArchive, true>(
+        arch, COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion()));
 }
 
 size_t Model::getNumberOfFeatures() const
@@ -69,6 +70,17 @@ services::Status Parameter::check() const
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(nProbes > 0, services::ErrorIncorrectParameter, services::ParameterName, nProbesStr());
+    DAAL_CHECK_EX(maxIterations > 0, services::ErrorIncorrectParameter, services::ParameterName, maxIterationsStr());
+    return interface1::Parameter::check();
+}
+
+} // namespace interface2
 } // namespace bf_knn_classification
 } // namespace algorithms
 } // namespace daal
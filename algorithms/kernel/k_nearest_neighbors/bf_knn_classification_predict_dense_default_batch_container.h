@@ -16,7 +16,9 @@
 *******************************************************************************/
 
 #include "bf_knn_classification_predict.h"
+#include "bf_knn_classification_predict_kernel.h"
 #include "oneapi/bf_knn_classification_predict_kernel_ucapi.h"
+#include "execution_context.h"
 
 namespace daal
 {
@@ -30,7 +32,17 @@ namespace prediction
 template <typename algorithmFpType, Method method, CpuType cpu>
 BatchContainer<algorithmFpType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv) : PredictionContainerIface()
 {
-    __DAAL_INITIALIZE_KERNELS_SYCL(internal::KNNClassificationPredictKernelUCAPI, DAAL_FPTYPE);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::KNNClassificationPredictKernel, algorithmFpType);
+    }
+    else
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::KNNClassificationPredictKernelUCAPI, DAAL_FPTYPE);
+    }
 }
 
 template <typename algorithmFpType, Method method, CpuType cpu>
@@ -50,9 +62,21 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
     const data_management::NumericTablePtr r = result->get(classifier::prediction::prediction);
 
     const daal::algorithms::Parameter * const par = _par;
-    __DAAL_CALL_KERNEL_SYCL(env, internal::KNNClassificationPredictKernelUCAPI, \
-                            __DAAL_KERNEL_ARGUMENTS(algorithmFpType),           \
-                            compute, a.get(), m.get(), r.get(), par);
+
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType), compute, a.get(), m.get(),
+                           r.get(), par);
+    }
+    else
+    {
+        __DAAL_CALL_KERNEL_SYCL(env, internal::KNNClassificationPredictKernelUCAPI, \
+                                __DAAL_KERNEL_ARGUMENTS(algorithmFpType),           \
+                                compute, a.get(), m.get(), r.get(), par);
+    }
 }
 
 } // namespace prediction
@@ -0,0 +1,506 @@
+/* file: bf_knn_classification_predict_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of brute force K-Nearest Neighbors prediction on CPU.
+//  Distances between blocks of queries and blocks of training points are computed
+//  with GEMM for dense data and with sparse matrix multiplication for CSR data.
+//--
+*/
+
+#ifndef __BF_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __BF_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+
+#include "threading.h"
+#include "service_memory.h"
+#include "service_data_utils.h"
+#include "service_blas.h"
+#include "service_spblas.h"
+#include "service_heap.h"
+#include "service_sort.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "bf_knn_classification_predict_kernel.h"
+#include "oneapi/bf_knn_classification_model_ucapi_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+const size_t bfKnnQueryBlockSize = 128;
+const size_t bfKnnPointBlockSize = 512;
+
+template <typename algorithmFpType, CpuType cpu>
+struct BruteForceNeighbors
+{
+    algorithmFpType distance;
+    size_t index;
+};
+
+/* Thread local buffers used to process a block of queries */
+template <typename algorithmFpType, CpuType cpu>
+class BruteForceTask
+{
+public:
+    typedef BruteForceNeighbors<algorithmFpType, cpu> Neighbors;
+
+    static BruteForceTask * create(size_t nQueries, size_t nPoints, size_t k, size_t nProbes, size_t bufSize)
+    {
+        BruteForceTask * result = new BruteForceTask(nQueries, nPoints, k, nProbes, bufSize);
+        if (result && !result->isValid())
+        {
+            delete result;
+            result = nullptr;
+        }
+        return result;
+    }
+
+    algorithmFpType * distances() { return _distances.get(); }
+    algorithmFpType * buf() { return _buf.get(); }
+    Neighbors * heaps() { return _heaps.get(); }
+    size_t * heapSizes() { return _heapSizes.get(); }
+    Neighbors * probes() { return _probes.get(); }
+    size_t * probeSizes() { return _probeSizes.get(); }
+    size_t * candidates() { return _candidates.get(); }
+    int * classes() { return _classes.get(); }
+
+private:
+    BruteForceTask(size_t nQueries, size_t nPoints, size_t k, size_t nProbes, size_t bufSize)
+        : _distances(nQueries * nPoints),
+          _buf(bufSize),
+          _heaps(nQueries * k),
+          _heapSizes(nQueries),
+          _probes(nQueries * nProbes),
+          _probeSizes(nProbes ? nQueries : 0),
+          _candidates(nPoints),
+          _classes(k)
+    {}
+
+    bool isValid() const
+    {
+        return _distances.get() && (_buf.get() || !_buf.size()) && _heaps.get() && _heapSizes.get() && (_probes.get() || !_probes.size())
+               && (_probeSizes.get() || !_probeSizes.size()) && _candidates.get() && _classes.get();
+    }
+
+    TArrayScalable<algorithmFpType, cpu> _distances;
+    TArrayScalableCalloc<algorithmFpType, cpu> _buf; /* Zero-initialized as it holds the scattered sparse queries */
+    TArrayScalable<Neighbors, cpu> _heaps;
+    TArrayScalable<size_t, cpu> _heapSizes;
+    TArrayScalable<Neighbors, cpu> _probes; /* The lists of the inverted file index closest to the queries */
+    TArrayScalable<size_t, cpu> _probeSizes;
+    TArrayScalable<size_t, cpu> _candidates;
+    TArrayScalable<int, cpu> _classes;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status computeSquaredNorms(const NumericTable & points, size_t nPoints, size_t blockSize, algorithmFpType * pointsSq)
+{
+    const bool isSparse              = (points.getDataLayout() == NumericTableIface::csrArray);
+    const size_t nBlocks             = nPoints / blockSize + !!(nPoints % blockSize);
+    NumericTable * const nt          = const_cast<NumericTable *>(&points);
+    CSRNumericTableIface * const csr = isSparse ? dynamic_cast<CSRNumericTableIface *>(nt) : nullptr;
+    DAAL_CHECK(!isSparse || csr, services::ErrorIncorrectTypeOfInputNumericTable);
+    const size_t nFeatures = points.getNumberOfColumns();
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * blockSize;
+        const size_t n      = (iBlock + 1 == nBlocks) ? nPoints - iStart : blockSize;
+        if (isSparse)
+        {
+            ReadRowsCSR<algorithmFpType, cpu> rows(csr, iStart, n);
+            DAAL_CHECK_BLOCK_STATUS_THR(rows);
+            const algorithmFpType * const values = rows.values();
+            const size_t * const rowOffsets      = rows.rows();
+            for (size_t i = 0; i < n; ++i)
+            {
+                algorithmFpType sum = 0;
+                for (size_t j = rowOffsets[i] - rowOffsets[0]; j < rowOffsets[i + 1] - rowOffsets[0]; ++j) sum += values[j] * values[j];
+                pointsSq[iStart + i] = sum;
+            }
+        }
+        else
+        {
+            ReadRows<algorithmFpType, cpu> rows(nt, iStart, n);
+            DAAL_CHECK_BLOCK_STATUS_THR(rows);
+            const algorithmFpType * const x = rows.get();
+            for (size_t i = 0; i < n; ++i)
+            {
+                algorithmFpType sum = 0;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; ++j) sum += x[i * nFeatures + j] * x[i * nFeatures + j];
+                pointsSq[iStart + i] = sum;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationPredictKernel<algorithmFpType, cpu>::compute(const NumericTable * x, const classifier::Model * m, NumericTable * y,
+                                                                                 const daal::algorithms::Parameter * par)
+{
+    typedef BruteForceTask<algorithmFpType, cpu> Task;
+    typedef BruteForceNeighbors<algorithmFpType, cpu> Neighbors;
+
+    const Model * const model         = static_cast<const Model *>(m);
+    const NumericTable * const points = model->impl()->getData().get();
+    const NumericTable * const labels = model->impl()->getLabels().get();
+    const Parameter * const parameter = static_cast<const Parameter *>(par);
+    const size_t k                    = parameter->k;
+
+    const size_t nQueries  = x->getNumberOfRows();
+    const size_t nLabels   = labels->getNumberOfRows();
+    const size_t nPoints   = points->getNumberOfRows() < nLabels ? points->getNumberOfRows() : nLabels;
+    const size_t nFeatures = points->getNumberOfColumns();
+    if (!nQueries || !nPoints) return services::Status();
+
+    ReadColumns<int, cpu> labelsBlock(const_cast<NumericTable *>(labels), 0, 0, nPoints);
+    DAAL_CHECK_BLOCK_STATUS(labelsBlock);
+    const int * const pointLabels = labelsBlock.get();
+
+    /* Squared norms of the training points. The squared norms of the queries do not change the order of the neighbors.
+     * The model with the inverted file index stores the norms, otherwise they are computed */
+    const NumericTable * const centroids = model->impl()->getCentroids().get();
+    TArray<algorithmFpType, cpu> pointsSqArr(centroids ? 0 : nPoints);
+    ReadColumns<algorithmFpType, cpu> normsBlock;
+    const algorithmFpType * pointsSq = nullptr;
+    if (centroids)
+    {
+        normsBlock.set(const_cast<NumericTable *>(model->impl()->getSquaredNorms().get()), 0, 0, nPoints);
+        DAAL_CHECK_BLOCK_STATUS(normsBlock);
+        pointsSq = normsBlock.get();
+    }
+    else
+    {
+        DAAL_CHECK_MALLOC(pointsSqArr.get());
+        DAAL_CHECK_STATUS_VAR((computeSquaredNorms<algorithmFpType, cpu>(*points, nPoints, bfKnnPointBlockSize, pointsSqArr.get())));
+        pointsSq = pointsSqArr.get();
+    }
+
+    /* The lists of the inverted file index and the squared norms of their centroids */
+    const size_t nLists  = centroids ? centroids->getNumberOfRows() : 0;
+    const size_t nProbes = (parameter->nProbes < nLists) ? parameter->nProbes : nLists;
+    TArray<algorithmFpType, cpu> centroidsSqArr(nLists);
+    ReadColumns<int, cpu> offsetsBlock;
+    if (centroids)
+    {
+        DAAL_CHECK_MALLOC(centroidsSqArr.get());
+        DAAL_CHECK_STATUS_VAR((computeSquaredNorms<algorithmFpType, cpu>(*centroids, nLists, bfKnnPointBlockSize, centroidsSqArr.get())));
+        offsetsBlock.set(const_cast<NumericTable *>(model->impl()->getListOffsets().get()), 0, 0, nLists + 1);
+        DAAL_CHECK_BLOCK_STATUS(offsetsBlock);
+    }
+    const algorithmFpType * const centroidsSq = centroidsSqArr.get();
+    const int * const listOffsets             = offsetsBlock.get();
+
+    /* Size of the additional buffer: the scattered sparse query if both tables are sparse,
+     * the transposed block of distances if only the queries are sparse */
+    const bool sparseQueries = (x->getDataLayout() == NumericTableIface::csrArray);
+    const bool sparsePoints  = (points->getDataLayout() == NumericTableIface::csrArray);
+    const size_t bufSize     = sparseQueries ? (sparsePoints ? nFeatures : bfKnnQueryBlockSize * bfKnnPointBlockSize) : 0;
+
+    daal::tls<Task *> tls([=]() -> Task * { return Task::create(bfKnnQueryBlockSize, bfKnnPointBlockSize, k, nProbes, bufSize); });
+
+    const size_t nQueryBlocks = nQueries / bfKnnQueryBlockSize + !!(nQueries % bfKnnQueryBlockSize);
+    const size_t nPointBlocks = nPoints / bfKnnPointBlockSize + !!(nPoints % bfKnnPointBlockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nQueryBlocks, nQueryBlocks, [&](size_t iQueryBlock) {
+        Task * const task = tls.local();
+        DAAL_CHECK_THR(task, services::ErrorMemoryAllocationFailed);
+
+        const size_t iQueryStart   = iQueryBlock * bfKnnQueryBlockSize;
+        const size_t nBlockQueries = (iQueryBlock + 1 == nQueryBlocks) ? nQueries - iQueryStart : bfKnnQueryBlockSize;
+
+        Neighbors * const heaps  = task->heaps();
+        size_t * const heapSizes = task->heapSizes();
+        for (size_t i = 0; i < nBlockQueries; ++i) heapSizes[i] = 0;
+
+        if (centroids)
+        {
+            services::Status s =
+                searchIndex(*x, iQueryStart, nBlockQueries, *points, pointsSq, *centroids, centroidsSq, listOffsets, nProbes, k, *task);
+            DAAL_CHECK_STATUS_THR(s);
+        }
+
+        for (size_t iPointBlock = 0; !centroids && iPointBlock < nPointBlocks; ++iPointBlock)
+        {
+            const size_t iPointStart          = iPointBlock * bfKnnPointBlockSize;
+            const size_t nBlockPoints         = (iPointBlock + 1 == nPointBlocks) ? nPoints - iPointStart : bfKnnPointBlockSize;
+            algorithmFpType * const distances = task->distances();
+
+            services::Status s =
+                computeDistances(*x, iQueryStart, nBlockQueries, *points, iPointStart, nBlockPoints, pointsSq + iPointStart, distances, task->buf());
+            DAAL_CHECK_STATUS_THR(s);
+
+            for (size_t i = 0; i < nBlockQueries; ++i)
+            {
+                selectNearest(distances + i * nBlockPoints, nBlockPoints, iPointStart, k, heaps + i * k, heapSizes[i], task->candidates());
+            }
+        }
+
+        WriteOnlyRows<algorithmFpType, cpu> resBlock(y, iQueryStart, nBlockQueries);
+        DAAL_CHECK_BLOCK_STATUS_THR(resBlock);
+        algorithmFpType * const res = resBlock.get();
+        for (size_t i = 0; i < nBlockQueries; ++i)
+        {
+            res[i] = vote(heaps + i * k, heapSizes[i], pointLabels, task->classes());
+        }
+    });
+
+    tls.reduce([](Task * task) -> void { delete task; });
+    return safeStat.detach();
+}
+
+/* Searches the neighbors of the block of queries in nProbes lists of the inverted file index with the closest centroids */
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationPredictKernel<algorithmFpType, cpu>::searchIndex(
+    const NumericTable & x, size_t iQueryStart, size_t nQueries, const NumericTable & points, const algorithmFpType * pointsSq,
+    const NumericTable & centroids, const algorithmFpType * centroidsSq, const int * listOffsets, size_t nProbes, size_t k,
+    BruteForceTask<algorithmFpType, cpu> & task)
+{
+    const size_t nLists                                      = centroids.getNumberOfRows();
+    algorithmFpType * const distances                        = task.distances();
+    BruteForceNeighbors<algorithmFpType, cpu> * const probes = task.probes();
+    size_t * const probeSizes                                = task.probeSizes();
+    BruteForceNeighbors<algorithmFpType, cpu> * const heaps  = task.heaps();
+    size_t * const heapSizes                                 = task.heapSizes();
+
+    for (size_t i = 0; i < nQueries; ++i) probeSizes[i] = 0;
+    for (size_t iStart = 0; iStart < nLists; iStart += bfKnnPointBlockSize)
+    {
+        const size_t n = (iStart + bfKnnPointBlockSize > nLists) ? nLists - iStart : bfKnnPointBlockSize;
+        DAAL_CHECK_STATUS_VAR(computeDistances(x, iQueryStart, nQueries, centroids, iStart, n, centroidsSq + iStart, distances, task.buf()));
+        for (size_t i = 0; i < nQueries; ++i)
+        {
+            selectNearest(distances + i * n, n, iStart, nProbes, probes + i * nProbes, probeSizes[i], task.candidates());
+        }
+    }
+
+    for (size_t i = 0; i < nQueries; ++i)
+    {
+        for (size_t j = 0; j < probeSizes[i]; ++j)
+        {
+            const size_t iList = probes[i * nProbes + j].index;
+            const size_t iEnd  = listOffsets[iList + 1];
+            for (size_t iStart = listOffsets[iList]; iStart < iEnd; iStart += bfKnnPointBlockSize)
+            {
+                const size_t n = (iStart + bfKnnPointBlockSize > iEnd) ? iEnd - iStart : bfKnnPointBlockSize;
+                DAAL_CHECK_STATUS_VAR(computeDistances(x, iQueryStart + i, 1, points, iStart, n, pointsSq + iStart, distances, task.buf()));
+                selectNearest(distances, n, iStart, k, heaps + i * k, heapSizes[i], task.candidates());
+            }
+        }
+    }
+    return services::Status();
+}
+
+/* Computes the block of distances without the squared norms of the queries.
+ * The distances of the i-th query are stored contiguously at distances + i * nPoints */
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationPredictKernel<algorithmFpType, cpu>::computeDistances(const NumericTable & x, size_t iQueryStart, size_t nQueries,
+                                                                                          const NumericTable & points, size_t iPointStart,
+                                                                                          size_t nPoints, const algorithmFpType * pointsSq,
+                                                                                          algorithmFpType * distances, algorithmFpType * buf)
+{
+    NumericTable * const xt = const_cast<NumericTable *>(&x);
+    NumericTable * const pt = const_cast<NumericTable *>(&points);
+    const DAAL_INT p        = (DAAL_INT)points.getNumberOfColumns();
+    const DAAL_INT nq       = (DAAL_INT)nQueries;
+    const DAAL_INT np       = (DAAL_INT)nPoints;
+
+    const algorithmFpType alpha = -2.0;
+    const algorithmFpType beta  = 0.0;
+    const char matdescra[6]     = { 'G', 0, 0, 'F', 0, 0 };
+
+    if (x.getDataLayout() != NumericTableIface::csrArray)
+    {
+        ReadRows<algorithmFpType, cpu> queryRows(xt, iQueryStart, nQueries);
+        DAAL_CHECK_BLOCK_STATUS(queryRows);
+        const algorithmFpType * const queries = queryRows.get();
+
+        if (points.getDataLayout() != NumericTableIface::csrArray)
+        {
+            ReadRows<algorithmFpType, cpu> pointRows(pt, iPointStart, nPoints);
+            DAAL_CHECK_BLOCK_STATUS(pointRows);
+
+            const char transa = 't';
+            const char transb = 'n';
+            Blas<algorithmFpType, cpu>::xxgemm(&transa, &transb, &np, &nq, &p, &alpha, pointRows.get(), &p, queries, &p, &beta, distances, &np);
+        }
+        else
+        {
+            CSRNumericTableIface * const csr = dynamic_cast<CSRNumericTableIface *>(pt);
+            DAAL_CHECK(csr, services::ErrorIncorrectTypeOfInputNumericTable);
+            ReadRowsCSR<algorithmFpType, cpu> pointRows(csr, iPointStart, nPoints);
+            DAAL_CHECK_BLOCK_STATUS(pointRows);
+
+            const char transa = 'n';
+            SpBlas<algorithmFpType, cpu>::xxcsrmm(&transa, &np, &nq, &p, &alpha, matdescra, pointRows.values(), (const DAAL_INT *)pointRows.cols(),
+                                                  (const DAAL_INT *)pointRows.rows(), queries, &p, &beta, distances, &np);
+        }
+        for (size_t i = 0; i < nQueries; ++i)
+        {
+            algorithmFpType * const d = distances + i * nPoints;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nPoints; ++j) d[j] += pointsSq[j];
+        }
+        return services::Status();
+    }
+
+    CSRNumericTableIface * const xCsr = dynamic_cast<CSRNumericTableIface *>(xt);
+    DAAL_CHECK(xCsr, services::ErrorIncorrectTypeOfInputNumericTable);
+    ReadRowsCSR<algorithmFpType, cpu> queryRows(xCsr, iQueryStart, nQueries);
+    DAAL_CHECK_BLOCK_STATUS(queryRows);
+    const algorithmFpType * const qValues = queryRows.values();
+    const size_t * const qCols            = queryRows.cols();
+    const size_t * const qRows            = queryRows.rows();
+
+    if (points.getDataLayout() != NumericTableIface::csrArray)
+    {
+        ReadRows<algorithmFpType, cpu> pointRows(pt, iPointStart, nPoints);
+        DAAL_CHECK_BLOCK_STATUS(pointRows);
+
+        const char transa = 'n';
+        SpBlas<algorithmFpType, cpu>::xxcsrmm(&transa, &nq, &np, &p, &alpha, matdescra, qValues, (const DAAL_INT *)qCols, (const DAAL_INT *)qRows,
+                                              pointRows.get(), &p, &beta, buf, &nq);
+
+        /* The product is stored by the points, transpose it to store the distances by the queries */
+        for (size_t i = 0; i < nQueries; ++i)
+        {
+            algorithmFpType * const d = distances + i * nPoints;
+            for (size_t j = 0; j < nPoints; ++j) d[j] = pointsSq[j] + buf[i + j * nQueries];
+        }
+        return services::Status();
+    }
+
+    CSRNumericTableIface * const pCsr = dynamic_cast<CSRNumericTableIface *>(pt);
+    DAAL_CHECK(pCsr, services::ErrorIncorrectTypeOfInputNumericTable);
+    ReadRowsCSR<algorithmFpType, cpu> pointRows(pCsr, iPointStart, nPoints);
+    DAAL_CHECK_BLOCK_STATUS(pointRows);
+    const algorithmFpType * const pValues = pointRows.values();
+    const size_t * const pCols            = pointRows.cols();
+    const size_t * const pRows            = pointRows.rows();
+
+    /* Both tables are sparse: every query is scattered into the zero buffer and multiplied by the sparse block of points */
+    for (size_t i = 0; i < nQueries; ++i)
+    {
+        const size_t qStart = qRows[i] - qRows[0];
+        const size_t qEnd   = qRows[i + 1] - qRows[0];
+        for (size_t j = qStart; j < qEnd; ++j) buf[qCols[j] - 1] = qValues[j];
+
+        algorithmFpType * const d = distances + i * nPoints;
+        for (size_t j = 0; j < nPoints; ++j)
+        {
+            algorithmFpType dot = 0;
+            for (size_t l = pRows[j] - pRows[0]; l < pRows[j + 1] - pRows[0]; ++l) dot += pValues[l] * buf[pCols[l] - 1];
+            d[j] = pointsSq[j] + alpha * dot;
+        }
+
+        for (size_t j = qStart; j < qEnd; ++j) buf[qCols[j] - 1] = 0;
+    }
+    return services::Status();
+}
+
+/* Updates the max-heap of k nearest neighbors of the query with the block of its distances */
+template <typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, cpu>::selectNearest(const algorithmFpType * distances, size_t nPoints, size_t iPointStart,
+                                                                         size_t k, BruteForceNeighbors<algorithmFpType, cpu> * heap,
+                                                                         size_t & heapSize, size_t * candidates)
+{
+    /* Only the points closer than the farthest of the found neighbors can get into the heap.
+     * The candidates are collected without branches so that the loop can be vectorized */
+    typedef BruteForceNeighbors<algorithmFpType, cpu> Neighbors;
+    auto compare = [](const Neighbors & a, const Neighbors & b) -> bool { return a.distance < b.distance; };
+
+    const algorithmFpType threshold = (heapSize == k) ? heap[0].distance : daal::services::internal::MaxVal<algorithmFpType>::get();
+    size_t nCandidates              = 0;
+    for (size_t j = 0; j < nPoints; ++j)
+    {
+        candidates[nCandidates] = j;
+        nCandidates += size_t(distances[j] < threshold);
+    }
+
+    for (size_t i = 0; i < nCandidates; ++i)
+    {
+        const size_t j           = candidates[i];
+        const Neighbors neighbor = { distances[j], iPointStart + j };
+        if (heapSize < k)
+        {
+            heap[heapSize++] = neighbor;
+            if (heapSize == k) daal::algorithms::internal::makeMaxHeap<cpu>(heap, heap + k, compare);
+        }
+        else if (neighbor.distance < heap[0].distance)
+        {
+            /* Replace the farthest neighbor and restore the heap */
+            heap[0] = neighbor;
+            daal::algorithms::internal::internalAdjustMaxHeap<cpu>(heap, heap + k, k, size_t(0), compare);
+        }
+    }
+}
+
+/* Returns the most frequent class among the neighbors, the smallest class wins a tie */
+template <typename algorithmFpType, CpuType cpu>
+algorithmFpType KNNClassificationPredictKernel<algorithmFpType, cpu>::vote(BruteForceNeighbors<algorithmFpType, cpu> * heap, size_t heapSize,
+                                                                           const int * labels, int * classes)
+{
+    if (!heapSize) return algorithmFpType(0);
+
+    for (size_t i = 0; i < heapSize; ++i) classes[i] = labels[heap[i].index];
+    daal::algorithms::internal::qSort<int, cpu>(heapSize, classes);
+
+    int currentClass     = classes[0];
+    int winnerClass      = currentClass;
+    size_t currentWeight = 1;
+    size_t winnerWeight  = currentWeight;
+    for (size_t i = 1; i < heapSize; ++i)
+    {
+        if (classes[i] == currentClass)
+        {
+            if ((++currentWeight) > winnerWeight)
+            {
+                winnerWeight = currentWeight;
+                winnerClass  = currentClass;
+            }
+        }
+        else
+        {
+            currentWeight = 1;
+            currentClass  = classes[i];
+        }
+    }
+    return algorithmFpType(winnerClass);
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,74 @@
+/* file: bf_knn_classification_predict_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes brute force K-Nearest Neighbors prediction results on CPU.
+//--
+*/
+
+#ifndef __BF_KNN_CLASSIFICATION_PREDICT_KERNEL_H__
+#define __BF_KNN_CLASSIFICATION_PREDICT_KERNEL_H__
+
+#include "kernel.h"
+#include "numeric_table.h"
+#include "bf_knn_classification_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+template <typename algorithmFpType, CpuType cpu>
+struct BruteForceNeighbors;
+template <typename algorithmFpType, CpuType cpu>
+class BruteForceTask;
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationPredictKernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par);
+
+protected:
+    services::Status computeDistances(const NumericTable & x, size_t iQueryStart, size_t nQueries, const NumericTable & points, size_t iPointStart,
+                                      size_t nPoints, const algorithmFpType * pointsSq, algorithmFpType * distances, algorithmFpType * buf);
+
+    services::Status searchIndex(const NumericTable & x, size_t iQueryStart, size_t nQueries, const NumericTable & points,
+                                 const algorithmFpType * pointsSq, const NumericTable & centroids, const algorithmFpType * centroidsSq,
+                                 const int * listOffsets, size_t nProbes, size_t k, BruteForceTask<algorithmFpType, cpu> & task);
+
+    void selectNearest(const algorithmFpType * distances, size_t nPoints, size_t iPointStart, size_t k,
+                       BruteForceNeighbors<algorithmFpType, cpu> * heap, size_t & heapSize, size_t * candidates);
+
+    algorithmFpType vote(BruteForceNeighbors<algorithmFpType, cpu> * heap, size_t heapSize, const int * labels, int * classes);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -22,6 +22,7 @@
 #include "data_management/data/numeric_table.h"
 #include "services/daal_shared_ptr.h"
 #include "bf_knn_classification_training_batch.h"
+#include "bf_knn_classification_train_kernel.h"
 #include "oneapi/bf_knn_classification_train_kernel_ucapi.h"
 #include "oneapi/bf_knn_classification_model_ucapi_impl.h"
 
@@ -39,7 +40,14 @@ using namespace daal::data_management;
 template <typename algorithmFpType, training::Method method, CpuType cpu>
 BatchContainer<algorithmFpType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS_SYCL(internal::KNNClassificationTrainKernelUCAPI, DAAL_FPTYPE);
+    if (method == ivfDense)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::KNNClassificationTrainKernel, algorithmFpType);
+    }
+    else
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::KNNClassificationTrainKernelUCAPI, DAAL_FPTYPE);
+    }
 }
 
 template <typename algorithmFpType, training::Method method, CpuType cpu>
@@ -64,6 +72,13 @@ services::Status BatchContainer<algorithmFpType, method, cpu>::compute()
 
     daal::services::Environment::env & env = *_env;
 
+    if (method == ivfDense)
+    {
+        /* The index stores the copy of the training data reordered by the lists */
+        __DAAL_CALL_KERNEL(env, internal::KNNClassificationTrainKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType), compute, x.get(), y.get(), r.get(),
+                           *par, *par->engine);
+    }
+
     const bool copy = (par->dataUseInModel == doNotUse);
     status |= r->impl()->setData<algorithmFpType>(x, copy);
     status |= r->impl()->setLabels<algorithmFpType>(y, copy);
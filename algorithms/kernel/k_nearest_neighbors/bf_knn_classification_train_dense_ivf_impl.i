@@ -0,0 +1,330 @@
+/* file: bf_knn_classification_train_dense_ivf_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the inverted file index construction for BF kNN model.
+//  The centroids of the lists are computed by k-means on a random sample of the training data,
+//  then the training data is reordered by the lists of the closest centroids.
+//--
+*/
+
+#ifndef __BF_KNN_CLASSIFICATION_TRAIN_DENSE_IVF_IMPL_I__
+#define __BF_KNN_CLASSIFICATION_TRAIN_DENSE_IVF_IMPL_I__
+
+#include "threading.h"
+#include "service_memory.h"
+#include "service_data_utils.h"
+#include "service_math.h"
+#include "service_blas.h"
+#include "service_rng.h"
+#include "service_threading.h"
+#include "service_numeric_table.h"
+#include "service_error_handling.h"
+#include "engine_batch_impl.h"
+#include "bf_knn_classification_train_kernel.h"
+#include "oneapi/bf_knn_classification_model_ucapi_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace bf_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+/* Maximal number of the training observations per list used to compute the centroids */
+const size_t ivfSamplesPerList = 256;
+const size_t ivfRowBlockSize   = 256;
+const size_t ivfListBlockSize  = 256;
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status gatherRows(NumericTable & x, const int * indices, size_t n, algorithmFpType * dst)
+{
+    const size_t p       = x.getNumberOfColumns();
+    const size_t nBlocks = n / ivfRowBlockSize + !!(n % ivfRowBlockSize);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iEnd = (iBlock + 1 == nBlocks) ? n : (iBlock + 1) * ivfRowBlockSize;
+        ReadRows<algorithmFpType, cpu> row(x);
+        for (size_t i = iBlock * ivfRowBlockSize; i < iEnd; ++i)
+        {
+            const algorithmFpType * const src = row.next(indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(row);
+            for (size_t j = 0; j < p; ++j) dst[i * p + j] = src[j];
+        }
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationTrainKernel<algorithmFpType, cpu>::compute(NumericTable * x, NumericTable * y, Model * r, const Parameter & par,
+                                                                               engines::BatchBase & engine)
+{
+    typedef HomogenNumericTable<algorithmFpType> HomogenTable;
+    typedef services::SharedPtr<HomogenTable> HomogenTablePtr;
+
+    DAAL_CHECK(x->getDataLayout() != NumericTableIface::csrArray, services::ErrorIncorrectTypeOfInputNumericTable);
+
+    const size_t nRows = x->getNumberOfRows();
+    const size_t p     = x->getNumberOfColumns();
+    DAAL_CHECK(nRows > 0 && nRows <= size_t(MaxVal<int>::get()), services::ErrorIncorrectNumberOfObservations);
+
+    size_t nLists = par.nLists ? par.nLists : size_t(Math<algorithmFpType, cpu>::sSqrt(algorithmFpType(nRows)));
+    if (nLists < 1) nLists = 1;
+    if (nLists > nRows) nLists = nRows;
+
+    engines::internal::BatchBaseImpl * const engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(&engine);
+    DAAL_CHECK(engineImpl, services::ErrorIncorrectEngineParameter);
+    RNGs<int, cpu> rng;
+
+    /* The centroids are computed on a random sample of the training data */
+    services::Status st;
+    const size_t nSample = (nRows > nLists * ivfSamplesPerList) ? nLists * ivfSamplesPerList : nRows;
+    NumericTablePtr sampleTable;
+    if (nSample < nRows)
+    {
+        TArray<int, cpu> sampleIndices(nSample);
+        DAAL_CHECK_MALLOC(sampleIndices.get());
+        DAAL_CHECK(!rng.uniformWithoutReplacement((int)nSample, sampleIndices.get(), engineImpl->getState(), 0, (int)nRows),
+                   services::ErrorIncorrectErrorcodeFromGenerator);
+
+        HomogenTablePtr sample = HomogenTable::create(p, nSample, NumericTable::doAllocate, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        DAAL_CHECK_STATUS_VAR((gatherRows<algorithmFpType, cpu>(*x, sampleIndices.get(), nSample, sample->getArray())));
+        sampleTable = sample;
+    }
+    NumericTable & trainTable = sampleTable ? *sampleTable : *x;
+
+    TArray<algorithmFpType, cpu> centroidsArr(nLists * p);
+    TArray<int, cpu> initIndices(nLists);
+    TArray<int, cpu> assignmentsArr(nRows);
+    DAAL_CHECK_MALLOC(centroidsArr.get() && initIndices.get() && assignmentsArr.get());
+    algorithmFpType * const centroids = centroidsArr.get();
+    int * const assignments           = assignmentsArr.get();
+
+    DAAL_CHECK(!rng.uniformWithoutReplacement((int)nLists, initIndices.get(), engineImpl->getState(), 0, (int)nSample),
+               services::ErrorIncorrectErrorcodeFromGenerator);
+    DAAL_CHECK_STATUS_VAR((gatherRows<algorithmFpType, cpu>(trainTable, initIndices.get(), nLists, centroids)));
+
+    for (size_t iter = 0; iter < par.maxIterations; ++iter)
+    {
+        DAAL_CHECK_STATUS_VAR(assignLists(trainTable, nSample, centroids, nLists, assignments));
+        DAAL_CHECK_STATUS_VAR(updateCentroids(trainTable, nSample, assignments, nLists, centroids));
+    }
+    DAAL_CHECK_STATUS_VAR(assignLists(*x, nRows, centroids, nLists, assignments));
+
+    /* Offsets of the lists and the positions of the observations in the reordered data */
+    TArrayCalloc<int, cpu> offsetsArr(nLists + 1);
+    TArray<int, cpu> positionsArr(nRows);
+    DAAL_CHECK_MALLOC(offsetsArr.get() && positionsArr.get());
+    int * const offsets   = offsetsArr.get();
+    int * const positions = positionsArr.get();
+    for (size_t i = 0; i < nRows; ++i) ++offsets[assignments[i] + 1];
+    for (size_t i = 0; i < nLists; ++i) offsets[i + 1] += offsets[i];
+    {
+        TArray<int, cpu> cursorArr(nLists);
+        DAAL_CHECK_MALLOC(cursorArr.get());
+        int * const cursor = cursorArr.get();
+        for (size_t i = 0; i < nLists; ++i) cursor[i] = offsets[i];
+        for (size_t i = 0; i < nRows; ++i) positions[i] = cursor[assignments[i]]++;
+    }
+
+    HomogenTablePtr dataTable = HomogenTable::create(p, nRows, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    HomogenTablePtr labelsTable = HomogenTable::create(1, nRows, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    HomogenTablePtr normsTable = HomogenTable::create(1, nRows, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    HomogenTablePtr centroidsTable = HomogenTable::create(p, nLists, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    services::SharedPtr<HomogenNumericTable<int> > offsetsTable = HomogenNumericTable<int>::create(1, nLists + 1, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    algorithmFpType * const data   = dataTable->getArray();
+    algorithmFpType * const labels = labelsTable->getArray();
+    algorithmFpType * const norms  = normsTable->getArray();
+    int * const listOffsets        = offsetsTable->getArray();
+    algorithmFpType * const cents  = centroidsTable->getArray();
+    for (size_t i = 0; i < nLists * p; ++i) cents[i] = centroids[i];
+    for (size_t i = 0; i <= nLists; ++i) listOffsets[i] = offsets[i];
+
+    const size_t nBlocks = nRows / ivfRowBlockSize + !!(nRows % ivfRowBlockSize);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * ivfRowBlockSize;
+        const size_t n      = (iBlock + 1 == nBlocks) ? nRows - iStart : ivfRowBlockSize;
+
+        ReadRows<algorithmFpType, cpu> xRows(x, iStart, n);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        ReadColumns<algorithmFpType, cpu> yRows(y, 0, iStart, n);
+        DAAL_CHECK_BLOCK_STATUS_THR(yRows);
+        const algorithmFpType * const xBlock = xRows.get();
+        const algorithmFpType * const yBlock = yRows.get();
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const size_t pos                  = positions[iStart + i];
+            const algorithmFpType * const src = xBlock + i * p;
+            algorithmFpType * const dst       = data + pos * p;
+            algorithmFpType sum               = 0;
+            for (size_t j = 0; j < p; ++j)
+            {
+                dst[j] = src[j];
+                sum += src[j] * src[j];
+            }
+            norms[pos]  = sum;
+            labels[pos] = yBlock[i];
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    DAAL_CHECK_STATUS_VAR(r->impl()->setData<algorithmFpType>(dataTable, false));
+    DAAL_CHECK_STATUS_VAR(r->impl()->setLabels<algorithmFpType>(labelsTable, false));
+    r->impl()->setIndex(centroidsTable, offsetsTable, normsTable);
+    return services::Status();
+}
+
+/* Assigns every observation to the list with the closest centroid */
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationTrainKernel<algorithmFpType, cpu>::assignLists(NumericTable & x, size_t nRows, const algorithmFpType * centroids,
+                                                                                   size_t nLists, int * assignments)
+{
+    const size_t p = x.getNumberOfColumns();
+
+    TArray<algorithmFpType, cpu> centroidsSqArr(nLists);
+    DAAL_CHECK_MALLOC(centroidsSqArr.get());
+    algorithmFpType * const centroidsSq = centroidsSqArr.get();
+    for (size_t l = 0; l < nLists; ++l)
+    {
+        algorithmFpType sum = 0;
+        for (size_t j = 0; j < p; ++j) sum += centroids[l * p + j] * centroids[l * p + j];
+        centroidsSq[l] = sum;
+    }
+
+    daal::TlsMem<algorithmFpType, cpu> tlsBuf(ivfRowBlockSize * ivfListBlockSize + ivfRowBlockSize);
+
+    const size_t nBlocks = nRows / ivfRowBlockSize + !!(nRows % ivfRowBlockSize);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * ivfRowBlockSize;
+        const size_t n      = (iBlock + 1 == nBlocks) ? nRows - iStart : ivfRowBlockSize;
+
+        algorithmFpType * const buf = tlsBuf.local();
+        DAAL_CHECK_THR(buf, services::ErrorMemoryAllocationFailed);
+        algorithmFpType * const dots    = buf;
+        algorithmFpType * const minDist = buf + ivfRowBlockSize * ivfListBlockSize;
+
+        ReadRows<algorithmFpType, cpu> xRows(x, iStart, n);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+
+        for (size_t i = 0; i < n; ++i) minDist[i] = MaxVal<algorithmFpType>::get();
+
+        for (size_t lStart = 0; lStart < nLists; lStart += ivfListBlockSize)
+        {
+            const size_t nb = (lStart + ivfListBlockSize > nLists) ? nLists - lStart : ivfListBlockSize;
+
+            const char transa           = 't';
+            const char transb           = 'n';
+            const DAAL_INT m            = (DAAL_INT)nb;
+            const DAAL_INT nn           = (DAAL_INT)n;
+            const DAAL_INT k            = (DAAL_INT)p;
+            const algorithmFpType alpha = -2.0;
+            const algorithmFpType beta  = 0.0;
+            Blas<algorithmFpType, cpu>::xxgemm(&transa, &transb, &m, &nn, &k, &alpha, centroids + lStart * p, &k, xRows.get(), &k, &beta, dots, &m);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t l = 0; l < nb; ++l)
+                {
+                    const algorithmFpType d = centroidsSq[lStart + l] + dots[l + i * nb];
+                    if (d < minDist[i])
+                    {
+                        minDist[i]              = d;
+                        assignments[iStart + i] = int(lStart + l);
+                    }
+                }
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+/* Replaces the centroids with the means of their lists. The centroids of empty lists are kept */
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationTrainKernel<algorithmFpType, cpu>::updateCentroids(NumericTable & x, size_t nRows, const int * assignments,
+                                                                                       size_t nLists, algorithmFpType * centroids)
+{
+    const size_t p    = x.getNumberOfColumns();
+    const size_t size = nLists * (p + 1);
+
+    daal::TlsSum<algorithmFpType, cpu> tlsSums(size);
+
+    const size_t nBlocks = nRows / ivfRowBlockSize + !!(nRows % ivfRowBlockSize);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * ivfRowBlockSize;
+        const size_t n      = (iBlock + 1 == nBlocks) ? nRows - iStart : ivfRowBlockSize;
+
+        algorithmFpType * const sums = tlsSums.local();
+        DAAL_CHECK_THR(sums, services::ErrorMemoryAllocationFailed);
+
+        ReadRows<algorithmFpType, cpu> xRows(x, iStart, n);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        const algorithmFpType * const xBlock = xRows.get();
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            algorithmFpType * const sum = sums + assignments[iStart + i] * (p + 1);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; ++j) sum[j] += xBlock[i * p + j];
+            sum[p] += 1;
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    TArray<algorithmFpType, cpu> totalArr(size);
+    DAAL_CHECK_MALLOC(totalArr.get());
+    algorithmFpType * const total = totalArr.get();
+    tlsSums.reduceTo(total, size);
+
+    for (size_t l = 0; l < nLists; ++l)
+    {
+        const algorithmFpType count = total[l * (p + 1) + p];
+        if (count > 0)
+        {
+            const algorithmFpType inv = algorithmFpType(1) / count;
+            for (size_t j = 0; j < p; ++j) centroids[l * p + j] = total[l * (p + 1) + j] * inv;
+        }
+    }
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace training
+} // namespace bf_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -30,7 +30,8 @@ namespace training
 {
 
 template<typename algorithmFPType>
-DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * input, const Parameter * parameter, int method)
+DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * input, const bf_knn_classification::interface1::Parameter * parameter,
+                                              int method)
 {
     services::Status status;
     const classifier::training::Input *algInput = static_cast<const classifier::training::Input *>(input);
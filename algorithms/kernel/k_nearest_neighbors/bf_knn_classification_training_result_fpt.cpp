@@ -26,7 +26,8 @@ namespace bf_knn_classification
 namespace training
 {
 
-template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const Parameter * parameter, int method);
+template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input,
+                                                                   const bf_knn_classification::interface1::Parameter * parameter, int method);
 
 }// namespace training
 }// namespace bf_knn_classification
@@ -20,6 +20,7 @@
 
 #include "algorithms/k_nearest_neighbors/bf_knn_classification_model.h"
 #include "data_management/data/numeric_table_sycl_homogen.h"
+#include "service_numeric_table.h"
 
 #include "daal_defines.h"
 
@@ -42,11 +43,18 @@ public:
     data_management::NumericTablePtr getData() { return _data; }
 
     template<typename Archive, bool onDeserialize>
-    services::Status serialImpl(Archive * arch)
+    services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
         arch->setSharedPtrObj(_data);
         arch->setSharedPtrObj(_labels);
 
+        if (daalVersion >= COMPUTE_DAAL_VERSION(2021, 1, 3))
+        {
+            arch->setSharedPtrObj(_centroids);
+            arch->setSharedPtrObj(_listOffsets);
+            arch->setSharedPtrObj(_squaredNorms);
+        }
+
         return services::Status();
     }
 
@@ -67,6 +75,24 @@ public:
     }
 
     size_t getNumberOfFeatures() const { return _nFeatures; }
+
+    /* Inverted file index built by the ivfDense training method. The rows of the data and the labels are ordered by the lists:
+     * the list i holds the rows from listOffsets[i] to listOffsets[i + 1] closest to the i-th centroid.
+     * The centroids are null if the model has no index */
+    data_management::NumericTableConstPtr getCentroids() const { return _centroids; }
+
+    data_management::NumericTableConstPtr getListOffsets() const { return _listOffsets; }
+
+    data_management::NumericTableConstPtr getSquaredNorms() const { return _squaredNorms; }
+
+    void setIndex(const data_management::NumericTablePtr & centroids, const data_management::NumericTablePtr & listOffsets,
+                  const data_management::NumericTablePtr & squaredNorms)
+    {
+        _centroids    = centroids;
+        _listOffsets  = listOffsets;
+        _squaredNorms = squaredNorms;
+    }
+
 protected:
     template <typename algorithmFPType>
     DAAL_FORCEINLINE services::Status setTable(const data_management::NumericTablePtr & value,
@@ -76,6 +102,17 @@ protected:
         {
             dest = value;
         }
+        else if (value->getDataLayout() == data_management::NumericTableIface::csrArray)
+        {
+            data_management::CSRNumericTablePtr csrTable;
+            DAAL_CHECK_STATUS_VAR(daal::internal::createSparseTable<algorithmFPType>(value, csrTable));
+            dest = csrTable;
+        }
+        else if (services::Environment::getInstance()->getDefaultExecutionContext().getInfoDevice().isCpu)
+        {
+            dest = data_management::convertToHomogen<algorithmFPType>(*value);
+            DAAL_CHECK_MALLOC(dest.get());
+        }
         else
         {
             services::Status status;
@@ -100,6 +137,9 @@ private:
     size_t _nFeatures;
     data_management::NumericTablePtr _data;
     data_management::NumericTablePtr _labels;
+    data_management::NumericTablePtr _centroids;
+    data_management::NumericTablePtr _listOffsets;
+    data_management::NumericTablePtr _squaredNorms;
 };
 
 
@@ -28,6 +28,7 @@
 #include "kmeans_types.h"
 #include "kmeans_batch.h"
 #include "kmeans_distributed.h"
+#include "kmeans_online.h"
 #include "kmeans_lloyd_kernel.h"
 #include "oneapi/kmeans_dense_lloyd_batch_kernel_ucapi.h"
 #include "execution_context.h"
@@ -46,7 +47,7 @@ BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Env
     auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (deviceInfo.isCpu)
+    if (deviceInfo.isCpu || method != lloydDense)
     {
         __DAAL_INITIALIZE_KERNELS(internal::KMeansBatchKernel, method, algorithmFPType);
     }
@@ -230,6 +231,63 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
                        par);
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::KMeansOnlineKernel, method, algorithmFPType);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input * input        = static_cast<Input *>(_in);
+    PartialResult * pres = static_cast<PartialResult *>(_pres);
+
+    const size_t na = 1;
+    NumericTable * a[na];
+    a[0] = static_cast<NumericTable *>(input->get(data).get());
+
+    const size_t nr = 3;
+    NumericTable * r[nr];
+    r[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    r[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
+    r[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+
+    Parameter * par                        = static_cast<Parameter *>(_par);
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, na, a, nr, r, par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult * pres = static_cast<PartialResult *>(_pres);
+    Result * result      = static_cast<Result *>(_res);
+
+    const size_t na = 3;
+    NumericTable * a[na];
+    a[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    a[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
+    a[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+
+    const size_t nr = 2;
+    NumericTable * r[nr];
+    r[0] = static_cast<NumericTable *>(result->get(centroids).get());
+    r[1] = static_cast<NumericTable *>(result->get(objectiveFunction).get());
+
+    Parameter * par                        = static_cast<Parameter *>(_par);
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute, na, a, nr, r, par);
+}
+
 } // namespace kmeans
 } // namespace algorithms
 } // namespace daal
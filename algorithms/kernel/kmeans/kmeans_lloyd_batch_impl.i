@@ -102,8 +102,8 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
 
-    TArray<double, cpu> dS1(method == defaultDense ? p : 0);
-    if (method == defaultDense)
+    TArray<double, cpu> dS1(method != lloydCSR ? p : 0);
+    if (method != lloydCSR)
     {
         DAAL_CHECK(dS1.get(), services::ErrorMemoryAllocationFailed);
     }
@@ -115,6 +115,15 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
     TArray<size_t, cpu> cIndices(nClusters);
 
     Status s;
+
+    /* Bounds are not used with categorical features as the distances are weighted in that case */
+    const bool bUseBounds = (method == lloydHamerlyDense) && !catFlag;
+    HamerlyBounds<algorithmFPType, cpu> bounds;
+    if (bUseBounds)
+    {
+        DAAL_CHECK_STATUS(s, bounds.init(ntData->getNumberOfRows(), nClusters, p));
+    }
+
     algorithmFPType oldTargetFunc(0.0);
     size_t kIter;
     for (kIter = 0; kIter < nIter; kIter++)
@@ -125,7 +134,14 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
-            s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get());
+            if (bUseBounds)
+            {
+                s = bounds.update(inClusters);
+            }
+            if (s)
+            {
+                s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get(), nullptr, bUseBounds ? &bounds : nullptr);
+            }
         }
 
         if (!s)
@@ -208,7 +224,19 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
     NumericTable * assignments = par->assignFlag ? const_cast<NumericTable *>(r[1]) : nullptr;
     algorithmFPType targetFunc = algorithmFPType(0);
 
-    s = RecalculationObservations<method, algorithmFPType, cpu>(p, nClusters, inClusters, ntData, catCoef.get(), assignments, targetFunc);
+    if (bUseBounds)
+    {
+        /* Final assignments reuse the bounds computed on the last iteration */
+        DAAL_CHECK_STATUS(s, bounds.update(inClusters));
+        SharedPtr<task_t<algorithmFPType, cpu> > task = task_t<algorithmFPType, cpu>::create(p, nClusters, inClusters);
+        DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+        s = task->addNTToTaskThreadedHamerly(ntData, bounds, assignments);
+        task->kmeansClearClusters(&targetFunc);
+    }
+    else
+    {
+        s = RecalculationObservations<method, algorithmFPType, cpu>(p, nClusters, inClusters, ntData, catCoef.get(), assignments, targetFunc);
+    }
 
     WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[3]), 0, 1);
     DAAL_CHECK_BLOCK_STATUS(mtIterations);
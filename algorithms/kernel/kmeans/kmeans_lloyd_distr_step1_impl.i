@@ -134,8 +134,8 @@ Status KMeansDistributedStep1Kernel<method, algorithmFPType, cpu>::compute(size_
 
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
 
-        TArray<double, cpu> dS1(method == defaultDense ? p : 0);
-        if (method == defaultDense)
+        TArray<double, cpu> dS1(method != lloydCSR ? p : 0);
+        if (method != lloydCSR)
         {
             DAAL_CHECK(dS1.get(), services::ErrorMemoryAllocationFailed);
         }
@@ -31,6 +31,7 @@
 #include "service_blas.h"
 #include "service_spblas.h"
 #include "service_data_utils.h"
+#include "service_math.h"
 
 namespace daal
 {
@@ -120,6 +121,101 @@ struct Fp2IntSize<double>
     typedef __int64 IntT;
 };
 
+/* Bounds on the distances from observations to centroids used by lloydHamerlyDense method.
+   An observation keeps its cluster without computation of the distances to all centroids
+   if the distance to its centroid does not exceed the lower bound of the distance
+   to the second closest centroid or the half of the distance from its centroid to the closest one */
+template <typename algorithmFPType, CpuType cpu>
+struct HamerlyBounds
+{
+    Status init(size_t n, size_t nClusters, size_t p)
+    {
+        _nClusters = nClusters;
+        _p         = p;
+        assignments.reset(n);
+        lowerBounds.reset(n);
+        halfMinDist.reset(nClusters);
+        prevCentroids.reset(nClusters * p);
+        DAAL_CHECK_MALLOC(assignments.get() && lowerBounds.get() && halfMinDist.get() && prevCentroids.get());
+        bAssigned = false;
+        return Status();
+    }
+
+    /* Moves the bounds to the new centroids, called before each pass over the data */
+    Status update(const algorithmFPType * centroids)
+    {
+        maxShift       = 0;
+        secondMaxShift = 0;
+        iMaxShift      = 0;
+        if (bAssigned)
+        {
+            for (size_t j = 0; j < _nClusters; j++)
+            {
+                const algorithmFPType shift = Math<algorithmFPType, cpu>::sSqrt(sqDist(centroids + j * _p, prevCentroids.get() + j * _p, _p));
+                if (shift > maxShift)
+                {
+                    secondMaxShift = maxShift;
+                    maxShift       = shift;
+                    iMaxShift      = j;
+                }
+                else if (shift > secondMaxShift)
+                {
+                    secondMaxShift = shift;
+                }
+            }
+        }
+        const size_t nBytes = _nClusters * _p * sizeof(algorithmFPType);
+        DAAL_CHECK(!daal::services::internal::daal_memcpy_s(prevCentroids.get(), nBytes, centroids, nBytes), services::ErrorMemoryCopyFailedInternal);
+
+        const size_t nClusters               = _nClusters;
+        const size_t p                       = _p;
+        algorithmFPType * const aHalfMinDist = halfMinDist.get();
+        daal::threader_for(nClusters, nClusters, [=](size_t j) {
+            algorithmFPType minDist = MaxVal<algorithmFPType>::get();
+            for (size_t i = 0; i < nClusters; i++)
+            {
+                if (i == j) continue;
+                const algorithmFPType dist = sqDist(centroids + i * p, centroids + j * p, p);
+                if (dist < minDist) minDist = dist;
+            }
+            aHalfMinDist[j] = algorithmFPType(0.5) * Math<algorithmFPType, cpu>::sSqrt(minDist);
+        });
+        return Status();
+    }
+
+    /* Lower bound of the distance from the observation assigned to the cluster iCluster
+       to the second closest centroid after the last move of the centroids */
+    algorithmFPType shiftLowerBound(algorithmFPType lowerBound, size_t iCluster) const
+    {
+        return lowerBound - (iCluster == iMaxShift ? secondMaxShift : maxShift);
+    }
+
+    static algorithmFPType sqDist(const algorithmFPType * a, const algorithmFPType * b, size_t p)
+    {
+        algorithmFPType sum = algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_ICC_NO16(omp simd reduction(+ : sum))
+        for (size_t j = 0; j < p; j++)
+        {
+            sum += (a[j] - b[j]) * (a[j] - b[j]);
+        }
+        return sum;
+    }
+
+    TArray<int, cpu> assignments;                 /* cluster of the observation */
+    TArray<algorithmFPType, cpu> lowerBounds;     /* lower bound of the distance to the second closest centroid */
+    TArray<algorithmFPType, cpu> halfMinDist;     /* half of the distance from the centroid to the closest centroid */
+    TArray<algorithmFPType, cpu> prevCentroids;   /* centroids the bounds were computed for */
+    algorithmFPType maxShift       = 0;
+    algorithmFPType secondMaxShift = 0;
+    size_t iMaxShift               = 0;
+    bool bAssigned                 = false;        /* assignments and bounds are valid */
+
+private:
+    size_t _nClusters = 0;
+    size_t _p         = 0;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct task_t
 {
@@ -181,8 +277,12 @@ struct task_t
 
     Status addNTToTaskThreadedCSR(const NumericTable * const ntData, const algorithmFPType * const catCoef, NumericTable * ntAssign = nullptr);
 
+    Status addNTToTaskThreadedHamerly(const NumericTable * const ntData, HamerlyBounds<algorithmFPType, cpu> & bounds,
+                                      NumericTable * ntAssign = nullptr);
+
     template <Method method>
-    Status addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef, NumericTable * ntAssign = nullptr);
+    Status addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef, NumericTable * ntAssign = nullptr,
+                               HamerlyBounds<algorithmFPType, cpu> * bounds = nullptr);
 
     template <typename centroidsFPType>
     int kmeansUpdateCluster(int jidx, centroidsFPType * s1);
@@ -418,12 +518,215 @@ Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const NumericTable *
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedHamerly(const NumericTable * const ntData, HamerlyBounds<algorithmFPType, cpu> & bounds,
+                                                                NumericTable * ntAssign)
+{
+    const size_t n                = ntData->getNumberOfRows();
+    const size_t blockSizeDeafult = max_block_size;
+
+    size_t nBlocks = n / blockSizeDeafult;
+    nBlocks += (nBlocks * blockSizeDeafult != n);
+
+    const bool bAssigned = bounds.bAssigned;
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [=, &safeStat, &bounds](const int k) {
+        struct tls_task_t<algorithmFPType, cpu> * tt = tls_task->local();
+        DAAL_CHECK_MALLOC_THR(tt);
+        const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDeafult : blockSizeDeafult;
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), k * blockSizeDeafult, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        const algorithmFPType * const data = mtData.get();
+
+        const size_t p                           = dim;
+        const size_t nClusters                   = clNum;
+        const algorithmFPType * const inClusters = cCenters;
+        const algorithmFPType * const clustersSq = clSq;
+        const algorithmFPType * const halfMin    = bounds.halfMinDist.get();
+
+        int * const clAssign            = bounds.assignments.get() + k * blockSizeDeafult;
+        algorithmFPType * const clLower = bounds.lowerBounds.get() + k * blockSizeDeafult;
+
+        algorithmFPType * trg        = &(tt->goalFunc);
+        algorithmFPType * x_clusters = tt->mkl_buff;
+
+        int * cS0             = tt->cS0;
+        algorithmFPType * cS1 = tt->cS1;
+
+        int * assignments = nullptr;
+        WriteOnlyRows<int, cpu> assignBlock(ntAssign, k * blockSizeDeafult, blockSize);
+        if (ntAssign)
+        {
+            DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
+            assignments = assignBlock.get();
+        }
+
+        /* squared distances to the closest centroids and the observations for which the bounds do not hold */
+        TArrayScalable<algorithmFPType, cpu> goalValues(blockSize);
+        TArrayScalable<size_t, cpu> scanIdx(blockSize);
+        DAAL_CHECK_THR(goalValues.get() && scanIdx.get(), services::ErrorMemoryAllocationFailed);
+        algorithmFPType * const minGoalVals = goalValues.get();
+        size_t * const scan                 = scanIdx.get();
+
+        size_t nScan = 0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            if (bAssigned)
+            {
+                /* the distance is computed as ||x||^2 - 2 x c + ||c||^2 like for the scanned observations below,
+                   hence the goal function does not depend on whether the observation was bounded */
+                const size_t iCl                 = clAssign[i];
+                const algorithmFPType * const xi = data + i * p;
+                const algorithmFPType * const ci = inClusters + iCl * p;
+                algorithmFPType xc               = algorithmFPType(0);
+                algorithmFPType xSq              = algorithmFPType(0);
+                PRAGMA_IVDEP
+                for (size_t j = 0; j < p; j++)
+                {
+                    xc += xi[j] * ci[j];
+                    xSq += xi[j] * xi[j];
+                }
+                const algorithmFPType goalVal = (clustersSq[iCl] - xc) * 2.0 + xSq;
+                const algorithmFPType dist2   = (goalVal > algorithmFPType(0) ? goalVal : algorithmFPType(0));
+                const algorithmFPType upper   = Math<algorithmFPType, cpu>::sSqrt(dist2);
+                clLower[i]                    = bounds.shiftLowerBound(clLower[i], iCl);
+                if (upper <= halfMin[iCl] || upper <= clLower[i])
+                {
+                    minGoalVals[i] = dist2;
+                    continue;
+                }
+            }
+            scan[nScan++] = i;
+        }
+
+        if (nScan)
+        {
+            /* distances to all centroids are computed for the observations that are not bounded */
+            TArrayScalable<algorithmFPType, cpu> scanRows(nScan < blockSize ? nScan * p : 0);
+            const algorithmFPType * scanData = data;
+            if (nScan < blockSize)
+            {
+                DAAL_CHECK_THR(scanRows.get(), services::ErrorMemoryAllocationFailed);
+                for (size_t i = 0; i < nScan; i++)
+                {
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        scanRows[i * p + j] = data[scan[i] * p + j];
+                    }
+                }
+                scanData = scanRows.get();
+            }
+
+            const char transa           = 't';
+            const char transb           = 'n';
+            const DAAL_INT _m           = nScan;
+            const DAAL_INT _n           = nClusters;
+            const DAAL_INT _k           = p;
+            const algorithmFPType alpha = -1.0;
+            const DAAL_INT lda          = p;
+            const DAAL_INT ldy          = p;
+            const algorithmFPType beta  = 1.0;
+            const DAAL_INT ldaty        = nScan;
+
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nScan; i++)
+                {
+                    x_clusters[i + j * nScan] = clustersSq[j];
+                }
+            }
+
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, scanData, &lda, inClusters, &ldy, &beta, x_clusters,
+                                               &ldaty);
+
+            for (size_t i = 0; i < nScan; i++)
+            {
+                algorithmFPType minGoalVal    = x_clusters[i];
+                algorithmFPType secondGoalVal = MaxVal<algorithmFPType>::get();
+                size_t minIdx                 = 0;
+
+                for (size_t j = 1; j < nClusters; j++)
+                {
+                    const algorithmFPType localGoalVal = x_clusters[i + j * nScan];
+                    if (localGoalVal < minGoalVal)
+                    {
+                        secondGoalVal = minGoalVal;
+                        minGoalVal    = localGoalVal;
+                        minIdx        = j;
+                    }
+                    else if (localGoalVal < secondGoalVal)
+                    {
+                        secondGoalVal = localGoalVal;
+                    }
+                }
+
+                algorithmFPType xSq = algorithmFPType(0);
+                PRAGMA_IVDEP
+                for (size_t j = 0; j < p; j++)
+                {
+                    xSq += scanData[i * p + j] * scanData[i * p + j];
+                }
+                const size_t iRow = scan[i];
+                minGoalVal        = minGoalVal * 2.0 + xSq;
+                minGoalVals[iRow] = (minGoalVal > algorithmFPType(0) ? minGoalVal : algorithmFPType(0));
+                clAssign[iRow]    = (int)minIdx;
+                if (nClusters > 1)
+                {
+                    secondGoalVal = secondGoalVal * 2.0 + xSq;
+                    clLower[iRow] = Math<algorithmFPType, cpu>::sSqrt(secondGoalVal > algorithmFPType(0) ? secondGoalVal : algorithmFPType(0));
+                }
+                else
+                {
+                    clLower[iRow] = MaxVal<algorithmFPType>::get();
+                }
+            }
+        }
+
+        algorithmFPType goal = algorithmFPType(0);
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const size_t minIdx              = clAssign[i];
+            const algorithmFPType minGoalVal = minGoalVals[i];
+
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[minIdx * p + j] += data[i * p + j];
+            }
+
+            kmeansInsertCandidate(tt, minGoalVal, k * blockSizeDeafult + i);
+            cS0[minIdx]++;
+
+            goal += minGoalVal;
+
+            if (ntAssign)
+            {
+                assignments[i] = (int)minIdx;
+            }
+        }
+
+        *trg += goal;
+    });
+    DAAL_CHECK_SAFE_STATUS();
+    bounds.bAssigned = true;
+    return Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 Status task_t<algorithmFPType, cpu>::addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef,
-                                                         NumericTable * ntAssign)
+                                                         NumericTable * ntAssign, HamerlyBounds<algorithmFPType, cpu> * bounds)
 {
-    if (method == lloydDense)
+    if (method == lloydHamerlyDense && bounds)
+    {
+        return addNTToTaskThreadedHamerly(ntData, *bounds, ntAssign);
+    }
+    else if (method == lloydDense || method == lloydHamerlyDense)
     {
         return addNTToTaskThreadedDense(ntData, catCoef, ntAssign);
     }
@@ -460,7 +763,7 @@ template <typename algorithmFPType, CpuType cpu>
 template <Method method>
 void task_t<algorithmFPType, cpu>::kmeansComputeCentroids(int * clusterS0, algorithmFPType * clusterS1, double * auxData)
 {
-    if (method == defaultDense && auxData)
+    if (method != lloydCSR && auxData)
     {
         for (size_t i = 0; i < clNum; i++)
         {
@@ -745,7 +1048,7 @@ template <Method method, typename algorithmFPType, CpuType cpu>
 Status RecalculationObservations(const size_t p, const size_t nClusters, const algorithmFPType * const inClusters, const NumericTable * const ntData,
                                  const algorithmFPType * const catCoef, NumericTable * ntAssign, algorithmFPType & objectiveFunction)
 {
-    if (method == lloydDense)
+    if (method == lloydDense || method == lloydHamerlyDense)
     {
         return RecalculationObservationsDense<algorithmFPType, cpu>(p, nClusters, inClusters, ntData, catCoef, ntAssign, objectiveFunction);
     }
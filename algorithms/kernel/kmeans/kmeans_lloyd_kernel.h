@@ -62,6 +62,14 @@ public:
     services::Status finalizeCompute(size_t na, const NumericTable * const * a, size_t nr, const NumericTable * const * r, const Parameter * par);
 };
 
+template <Method method, typename algorithmFPType, CpuType cpu>
+class KMeansOnlineKernel : public Kernel
+{
+public:
+    services::Status compute(size_t na, const NumericTable * const * a, size_t nr, const NumericTable * const * r, const Parameter * par);
+    services::Status finalizeCompute(size_t na, const NumericTable * const * a, size_t nr, const NumericTable * const * r, const Parameter * par);
+};
+
 } // namespace internal
 } // namespace kmeans
 } // namespace algorithms
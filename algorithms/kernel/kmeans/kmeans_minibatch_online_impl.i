@@ -0,0 +1,180 @@
+/* file: kmeans_minibatch_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of mini-batch method for K-means algorithm in the online
+//  processing mode.
+//
+//  Each block of data is a mini-batch: its observations are assigned to the
+//  current centroids and then every centroid is moved towards the observations
+//  assigned to it with the per-cluster learning rate 1 / (number of observations
+//  assigned to the cluster so far). With such learning rates the centroid is the
+//  mean of all the observations ever assigned to it (the initial centroid counts
+//  as one observation). The partial result stores the centroids themselves
+//  rather than the sums of the observations, and the numbers of the observations
+//  in double precision, so that the centroids computed in single precision do
+//  not lose accuracy as the sums grow.
+//--
+*/
+
+#include "algorithm.h"
+#include "numeric_table.h"
+#include "threading.h"
+#include "daal_defines.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+
+#include "kmeans_lloyd_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::compute(size_t na, const NumericTable * const * a, size_t nr,
+                                                                 const NumericTable * const * r, const Parameter * par)
+{
+    NumericTable * ntData = const_cast<NumericTable *>(a[0]);
+
+    const size_t p         = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+
+    WriteRows<double, cpu> mtClusterS0(*const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusterS0);
+    double * clusterS0 = mtClusterS0.get();
+    WriteRows<algorithmFPType, cpu> mtClusters(*const_cast<NumericTable *>(r[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+    algorithmFPType * clusters = mtClusters.get();
+    WriteRows<double, cpu> mtTargetFunc(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTargetFunc);
+    double * goalFunc = mtTargetFunc.get();
+
+    /* Categorial variables check and support: begin */
+    int catFlag = 0;
+    for (size_t i = 0; i < p; i++)
+    {
+        if (ntData->getFeatureType(i) == features::DAAL_CATEGORICAL)
+        {
+            catFlag = 1;
+            break;
+        }
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(algorithmFPType));
+
+    TArray<algorithmFPType, cpu> catCoef(catFlag ? p : 0);
+    if (catFlag)
+    {
+        DAAL_CHECK(catCoef.get(), services::ErrorMemoryAllocationFailed);
+        for (size_t i = 0; i < p; i++)
+        {
+            if (ntData->getFeatureType(i) == features::DAAL_CATEGORICAL)
+            {
+                catCoef[i] = par->gamma;
+            }
+            else
+            {
+                catCoef[i] = (algorithmFPType)1.0;
+            }
+        }
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+
+    TArray<int, cpu> blockS0(nClusters);
+    TArray<algorithmFPType, cpu> blockS1(nClusters * p);
+    TArray<double, cpu> dS1(p);
+    DAAL_CHECK_MALLOC(blockS0.get() && blockS1.get() && dS1.get());
+
+    Status s;
+    algorithmFPType blockGoalFunc = (algorithmFPType)0.0;
+    {
+        SharedPtr<task_t<algorithmFPType, cpu> > task = task_t<algorithmFPType, cpu>::create(p, nClusters, clusters);
+        DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+
+        s = task->template addNTToTaskThreaded<lloydDense>(ntData, catCoef.get());
+        if (!s)
+        {
+            task->kmeansClearClusters(&blockGoalFunc);
+            return s;
+        }
+
+        task->template kmeansComputeCentroids<lloydDense>(blockS0.get(), blockS1.get(), dS1.get());
+        task->kmeansClearClusters(&blockGoalFunc);
+    }
+
+    /* Centroids are moved towards the observations of the block assigned to them: c += (blockSum - blockCount * c) / count */
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        if (blockS0[i] == 0) continue;
+        clusterS0[i] += blockS0[i];
+
+        const double blockCount          = (double)blockS0[i];
+        const double rate                = 1.0 / clusterS0[i];
+        algorithmFPType * c              = clusters + i * p;
+        const algorithmFPType * blockSum = blockS1.get() + i * p;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < p; j++)
+        {
+            c[j] += (algorithmFPType)((blockSum[j] - blockCount * c[j]) * rate);
+        }
+    }
+    *goalFunc += blockGoalFunc;
+
+    return s;
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(size_t na, const NumericTable * const * a, size_t nr,
+                                                                         const NumericTable * const * r, const Parameter * par)
+{
+    const size_t nClusters = par->nClusters;
+    const size_t p         = a[1]->getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> mtInClusters(*const_cast<NumericTable *>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtInClusters);
+    ReadRows<algorithmFPType, cpu> mtInTarget(*const_cast<NumericTable *>(a[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtInTarget);
+
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(*const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+    algorithmFPType * clusters = mtClusters.get();
+    WriteOnlyRows<algorithmFPType, cpu> mtTarget(*const_cast<NumericTable *>(r[1]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTarget);
+
+    /* The partial result already holds the centroids */
+    tmemcpy<algorithmFPType, cpu>(clusters, mtInClusters.get(), nClusters * p);
+    *mtTarget.get() = *mtInTarget.get();
+
+    return Status();
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
@@ -25,7 +25,9 @@
 #define __KMEANS_PARTIALRESULT_
 
 #include "algorithms/kmeans/kmeans_types.h"
+#include "service_numeric_table.h"
 
+using namespace daal::internal;
 using namespace daal::data_management;
 
 namespace daal
@@ -50,16 +52,31 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
     size_t nClusters = kmPar->nClusters;
 
     services::Status status;
-    set(nObservations, HomogenNumericTable<algorithmFPType>::create(1, nClusters, NumericTable::doAllocate, &status));
-    DAAL_CHECK_STATUS_VAR(status);
+    if (method == miniBatchDense)
+    {
+        /* The numbers of the observations and the objective function are accumulated over all the blocks of data */
+        set(nObservations, HomogenNumericTable<double>::create(1, nClusters, NumericTable::doAllocate, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+        set(partialObjectiveFunction, HomogenNumericTable<double>::create(1, 1, NumericTable::doAllocate, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+    else
+    {
+        set(nObservations, HomogenNumericTable<algorithmFPType>::create(1, nClusters, NumericTable::doAllocate, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+        set(partialObjectiveFunction, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+    }
     set(partialSums, HomogenNumericTable<algorithmFPType>::create(nFeatures, nClusters, NumericTable::doAllocate, &status));
     DAAL_CHECK_STATUS_VAR(status);
-    set(partialObjectiveFunction, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &status));
-    DAAL_CHECK_STATUS_VAR(status);
-    set(partialCandidatesDistances, HomogenNumericTable<algorithmFPType>::create(1, nClusters, NumericTable::doAllocate, &status));
-    DAAL_CHECK_STATUS_VAR(status);
-    set(partialCandidatesCentroids, HomogenNumericTable<algorithmFPType>::create(nFeatures, nClusters, NumericTable::doAllocate, &status));
-    DAAL_CHECK_STATUS_VAR(status);
+    if (method != miniBatchDense)
+    {
+        /* Candidates for the empty clusters are not used by the online mode */
+        set(partialCandidatesDistances, HomogenNumericTable<algorithmFPType>::create(1, nClusters, NumericTable::doAllocate, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+        set(partialCandidatesCentroids, HomogenNumericTable<algorithmFPType>::create(nFeatures, nClusters, NumericTable::doAllocate, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+    }
 
     const Input * step1Input = dynamic_cast<const Input *>(input);
     if (kmPar->assignFlag && step1Input)
@@ -71,6 +88,41 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
     return status;
 }
 
+/**
+ * Initializes partial results of the K-Means algorithm in the online processing mode
+ * \param[in] input        Pointer to the structure of the input objects
+ * \param[in] parameter    Pointer to the structure of the algorithm parameters
+ * \param[in] method       Computation method of the algorithm
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    const Parameter * kmPar = static_cast<const Parameter *>(parameter);
+    const Input * algInput  = static_cast<const Input *>(input);
+
+    const size_t nFeatures = algInput->getNumberOfFeatures();
+    const size_t nClusters = kmPar->nClusters;
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, get(nObservations)->assign(1.0));
+    DAAL_CHECK_STATUS(s, get(partialObjectiveFunction)->assign(0.0));
+
+    ReadRows<algorithmFPType, sse2> centroidsBlock(algInput->get(inputCentroids).get(), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(centroidsBlock);
+    const algorithmFPType * const initCentroids = centroidsBlock.get();
+
+    WriteOnlyRows<algorithmFPType, sse2> sumsBlock(get(partialSums).get(), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(sumsBlock);
+    algorithmFPType * const sums = sumsBlock.get();
+
+    for (size_t i = 0; i < nClusters * nFeatures; i++)
+    {
+        sums[i] = initCentroids[i];
+    }
+    return s;
+}
+
 } // namespace kmeans
 } // namespace algorithms
 } // namespace daal
@@ -87,10 +87,13 @@ services::Status PartialResult::check(const daal::algorithms::Input * input, con
     DAAL_CHECK_STATUS(s, checkNumericTable(get(nObservations).get(), nObservationsStr(), unexpectedLayouts, 0, 1, kmPar->nClusters));
     DAAL_CHECK_STATUS(s, checkNumericTable(get(partialSums).get(), partialSumsStr(), unexpectedLayouts, 0, inputFeatures, kmPar->nClusters));
     DAAL_CHECK_STATUS(s, checkNumericTable(get(partialGoalFunction).get(), partialGoalFunctionStr(), unexpectedLayouts, 0, 1, 1));
-    DAAL_CHECK_STATUS(
-        s, checkNumericTable(get(partialCandidatesDistances).get(), partialCandidatesDistancesStr(), unexpectedLayouts, 0, 1, kmPar->nClusters));
-    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialCandidatesCentroids).get(), partialCandidatesCentroidsStr(), unexpectedLayouts, 0,
-                                           inputFeatures, kmPar->nClusters));
+    if (method != miniBatchDense)
+    {
+        DAAL_CHECK_STATUS(
+            s, checkNumericTable(get(partialCandidatesDistances).get(), partialCandidatesDistancesStr(), unexpectedLayouts, 0, 1, kmPar->nClusters));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(partialCandidatesCentroids).get(), partialCandidatesCentroidsStr(), unexpectedLayouts, 0,
+                                               inputFeatures, kmPar->nClusters));
+    }
     if (kmPar->assignFlag)
     {
         Input * algInput = dynamic_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
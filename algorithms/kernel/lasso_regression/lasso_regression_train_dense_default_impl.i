@@ -72,7 +72,11 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
 
     NumericTablePtr xTrain = x;
     NumericTablePtr yTrain = y;
-    if (par.interceptFlag == true)
+
+    /* Centering destroys the sparsity of CSR data, so in this case the intercept is optimized as the first coefficient */
+    const bool isSparse   = (x->getDataLayout() == NumericTableIface::csrArray);
+    const bool centerData = par.interceptFlag && !isSparse;
+    if (centerData)
     {
         if (par.dataUseInComputation == doNotUse)
         {
@@ -213,13 +217,14 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
         cdAlgorithm->parameter().accuracyThreshold      = 0.00001;
         cdAlgorithm->parameter().selection              = optimization_solver::coordinate_descent::cyclic;
         cdAlgorithm->parameter().positive               = false;
-        cdAlgorithm->parameter().skipTheFirstComponents = true;
+        cdAlgorithm->parameter().skipTheFirstComponents = !(isSparse && par.interceptFlag);
+        cdAlgorithm->parameter().activeSetScreening     = true;
         pSolver                                         = cdAlgorithm;
     }
 
     objFunc->input.set(mse::data, xTrain);
     objFunc->input.set(mse::dependentVariables, yTrain);
-    objFunc->parameter().interceptFlag = false;
+    objFunc->parameter().interceptFlag = isSparse && par.interceptFlag;
 
     objFunc->parameter().penaltyL1 = par.lassoParameters;
 
@@ -255,7 +260,7 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
             pBeta[i * p + j] = a[j * nDependentVariables + i];
         }
     }
-    if (par.interceptFlag)
+    if (centerData)
     {
         daal::internal::TArray<algorithmFPType, cpu> dotPtr(nDependentVariables);
         algorithmFPType * dot = dotPtr.get();
@@ -270,6 +275,10 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
         }
         for (size_t j = 0; j < nDependentVariables; ++j) pBeta[p * j + 0] = yMeansPtr[j] - dot[j];
     }
+    else if (par.interceptFlag)
+    {
+        for (size_t j = 0; j < nDependentVariables; ++j) pBeta[p * j + 0] = a[j];
+    }
     else
     {
         for (size_t j = 0; j < nDependentVariables; ++j) pBeta[p * j + 0] = 0;
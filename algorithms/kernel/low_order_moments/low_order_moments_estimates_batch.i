@@ -234,6 +234,120 @@ struct tls_moments_data_t
     }
 };
 
+/* Final loop for std deviations and variations */
+template <typename algorithmFPType, CpuType cpu>
+void finalize_estimates(common_moments_data_t<algorithmFPType, cpu> & _cd)
+{
+#if (defined _STDEV_ENABLE_ || defined _VART_ENABLE_)
+    algorithmFPType * _varc  = _cd.resultArray[(int)variance];
+    algorithmFPType * _stdev = _cd.resultArray[(int)standardDeviation];
+    daal::internal::Math<algorithmFPType, cpu>::vSqrt(_cd.nFeatures, &_varc[0], &_stdev[0]);
+#endif /* #if (defined _STDEV_ENABLE_ || defined _VART_ENABLE_) */
+
+#if (defined _VART_ENABLE_ || defined _SORM_ENABLE_)
+    #ifdef _SORM_ENABLE_
+    algorithmFPType * _sum2     = _cd.resultArray[(int)sumSquares];
+    algorithmFPType * _sorm     = _cd.resultArray[(int)secondOrderRawMoment];
+    const algorithmFPType _invN = algorithmFPType(1.0) / algorithmFPType(_cd.nVectors);
+    #endif
+    #ifdef _VART_ENABLE_
+    algorithmFPType * _mean = _cd.resultArray[(int)mean];
+    algorithmFPType * _vart = _cd.resultArray[(int)variation];
+    #endif
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (int j = 0; j < _cd.nFeatures; j++)
+    {
+    #ifdef _SORM_ENABLE_
+        _sorm[j] = _sum2[j] * _invN;
+    #endif
+    #ifdef _VART_ENABLE_
+        _vart[j] = _stdev[j] / _mean[j];
+    #endif
+    }
+#endif /* #if (defined _VART_ENABLE_ || defined _SORM_ENABLE_) */
+}
+
+/* Computes the estimates feature by feature on the columns referenced in the data table without transposing them into blocks of rows */
+template <typename algorithmFPType, CpuType cpu>
+Status compute_estimates_by_columns(common_moments_data_t<algorithmFPType, cpu> & _cd)
+{
+    const size_t nVectors = _cd.nVectors;
+#if defined _MEAN_ENABLE_ || defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+    const algorithmFPType invN         = algorithmFPType(1.0) / algorithmFPType(nVectors);
+    const algorithmFPType varianceInvN = nVectors > 1 ? algorithmFPType(1.0) / algorithmFPType(nVectors - 1) : algorithmFPType(0);
+#endif
+#if defined _MIN_ENABLE_ || defined _MAX_ENABLE_
+    const algorithmFPType maxVal = daal::services::internal::MaxVal<algorithmFPType>::get();
+#endif
+
+    SafeStatus safeStat;
+    daal::threader_for(_cd.nFeatures, _cd.nFeatures, [&](size_t j) {
+        daal::internal::ReadColumns<algorithmFPType, cpu, NumericTable> columnBD(_cd.dataTable, j, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS_THR(columnBD);
+        const algorithmFPType * const column = columnBD.get();
+
+#ifdef _MIN_ENABLE_
+        algorithmFPType colMin = maxVal;
+#endif
+#ifdef _MAX_ENABLE_
+        algorithmFPType colMax = -maxVal;
+#endif
+        algorithmFPType colSum  = 0;
+        algorithmFPType colSum2 = 0;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            const algorithmFPType arg = column[i];
+#ifdef _MIN_ENABLE_
+            colMin = arg < colMin ? arg : colMin;
+#endif
+#ifdef _MAX_ENABLE_
+            colMax = arg > colMax ? arg : colMax;
+#endif
+            colSum += arg;
+            colSum2 += arg * arg;
+        }
+
+#ifdef _MIN_ENABLE_
+        _cd.resultArray[(int)minimum][j] = colMin;
+#endif
+#ifdef _MAX_ENABLE_
+        _cd.resultArray[(int)maximum][j] = colMax;
+#endif
+#ifdef _SUM_ENABLE_
+        _cd.resultArray[(int)sum][j] = colSum;
+#endif
+#if (defined _SUM2_ENABLE_ || defined _SORM_ENABLE_)
+        _cd.resultArray[(int)sumSquares][j] = colSum2;
+#endif
+
+#if defined _MEAN_ENABLE_ || defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+        /* The second pass over the column computes the centered sum of squares without cancellation */
+        const algorithmFPType colMean = colSum * invN;
+        algorithmFPType colSum2c      = 0;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            const algorithmFPType delta = column[i] - colMean;
+            colSum2c += delta * delta;
+        }
+    #ifdef _MEAN_ENABLE_
+        _cd.resultArray[(int)mean][j] = colMean;
+    #endif
+        _cd.resultArray[(int)sumSquaresCentered][j] = colSum2c;
+    #if defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+        _cd.resultArray[(int)variance][j] = colSum2c * varianceInvN;
+    #endif
+#endif
+    });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status compute_estimates(NumericTable * dataTable, Result * result)
 {
@@ -241,6 +355,16 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
     common_moments_data_t<algorithmFPType, cpu> _cd(dataTable, result);
     if (_cd.malloc_errors) return Status(daal::services::ErrorMemoryAllocationFailed);
 
+    /* Features stored contiguously are processed in place, one feature per task.
+       The tasks are not split by rows, so the path is taken only if there are enough features to load all the threads */
+    if (_cd.nFeatures >= daal::threader_get_threads_number() && daal::internal::hasColumnViews<algorithmFPType, cpu>(*dataTable))
+    {
+        Status s = compute_estimates_by_columns<algorithmFPType, cpu>(_cd);
+        DAAL_CHECK_STATUS_VAR(s);
+        finalize_estimates<algorithmFPType, cpu>(_cd);
+        return s;
+    }
+
     /* Rows and features splitting by blocks */
     const size_t blockSize          = getDefaultBatchModeBlockSize<cpu>(_cd.nVectors);
     const size_t numRowsInBlock     = (_cd.nVectors > blockSize) ? blockSize : _cd.nVectors;
@@ -325,10 +449,7 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
     algorithmFPType * _sum2  = _cd.resultArray[(int)sumSquares];
     algorithmFPType * _sum2c = _cd.resultArray[(int)sumSquaresCentered];
     algorithmFPType * _mean  = _cd.resultArray[(int)mean];
-    algorithmFPType * _sorm  = _cd.resultArray[(int)secondOrderRawMoment];
     algorithmFPType * _varc  = _cd.resultArray[(int)variance];
-    algorithmFPType * _stdev = _cd.resultArray[(int)standardDeviation];
-    algorithmFPType * _vart  = _cd.resultArray[(int)variation];
 
     /* Merge results by TLS buffers */
     tls_data.reduce([&](tls_moments_data_t<algorithmFPType, cpu> * _td) {
@@ -445,25 +566,6 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
 
     DAAL_CHECK_SAFE_STATUS();
 
-    /* Final loop for std deviations and variations */
-#if (defined _STDEV_ENABLE_ || defined _VART_ENABLE_)
-    daal::internal::Math<algorithmFPType, cpu>::vSqrt(_cd.nFeatures, &_varc[0], &_stdev[0]);
-#endif /* #if (defined _STDEV_ENABLE_ || defined _VART_ENABLE_) */
-
-#if (defined _VART_ENABLE_ || defined _SORM_ENABLE_)
-    const algorithmFPType _invN = algorithmFPType(1.0) / algorithmFPType(_cd.nVectors);
-    PRAGMA_IVDEP
-    PRAGMA_VECTOR_ALWAYS
-    for (int j = 0; j < _cd.nFeatures; j++)
-    {
-    #ifdef _SORM_ENABLE_
-        _sorm[j] = _sum2[j] * _invN;
-    #endif
-    #ifdef _VART_ENABLE_
-        _vart[j] = _stdev[j] / _mean[j];
-    #endif
-    }
-#endif /* #if (defined _VART_ENABLE_ || defined _SORM_ENABLE_) */
-
+    finalize_estimates<algorithmFPType, cpu>(_cd);
     return Status();
 } /* compute_estimates */
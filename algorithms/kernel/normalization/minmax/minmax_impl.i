@@ -72,6 +72,9 @@ Status MinMaxKernel<algorithmFPType, method, cpu>::compute(const NumericTable &
     size_t regularBlockSize = (nRows > BLOCK_SIZE_NORM) ? BLOCK_SIZE_NORM : nRows;
     size_t blocksNumber     = nRows / regularBlockSize;
 
+    /* Features stored contiguously are read in place instead of being transposed into blocks of rows */
+    const bool byColumns = hasColumnViews<algorithmFPType, cpu>(const_cast<NumericTable &>(inputTable));
+
     SafeStatus safeStat;
     daal::threader_for(blocksNumber, blocksNumber, [&](int iRowsBlock) {
         size_t blockSize     = regularBlockSize;
@@ -82,7 +85,14 @@ Status MinMaxKernel<algorithmFPType, method, cpu>::compute(const NumericTable &
             blockSize += nRows % regularBlockSize;
         }
 
-        safeStat |= processBlock(inputTable, resultTable, scaleFactors, shiftFactors, startRowIndex, blockSize);
+        if (byColumns)
+        {
+            safeStat |= processBlockByColumns(inputTable, resultTable, scaleFactors, shiftFactors, startRowIndex, blockSize);
+        }
+        else
+        {
+            safeStat |= processBlock(inputTable, resultTable, scaleFactors, shiftFactors, startRowIndex, blockSize);
+        }
     });
 
     resultTable.setNormalizationFlag(NumericTableIface::minMaxNormalized);
@@ -116,6 +126,36 @@ Status MinMaxKernel<algorithmFPType, method, cpu>::processBlock(const NumericTab
     return Status();
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status MinMaxKernel<algorithmFPType, method, cpu>::processBlockByColumns(const NumericTable & inputTable, NumericTable & resultTable,
+                                                                         const algorithmFPType * scale, const algorithmFPType * shift,
+                                                                         const size_t startRowIndex, const size_t blockSize)
+{
+    const size_t nColumns = inputTable.getNumberOfColumns();
+
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> resultTableRows(resultTable, startRowIndex, blockSize);
+    DAAL_CHECK_BLOCK_STATUS(resultTableRows);
+    algorithmFPType * result = resultTableRows.get();
+
+    ReadColumns<algorithmFPType, cpu, NumericTable> inputTableColumn;
+    for (size_t j = 0; j < nColumns; j++)
+    {
+        const algorithmFPType * input = inputTableColumn.set(const_cast<NumericTable *>(&inputTable), j, startRowIndex, blockSize);
+        DAAL_CHECK_BLOCK_STATUS(inputTableColumn);
+
+        const algorithmFPType scaleFactor = scale[j];
+        const algorithmFPType shiftFactor = shift[j];
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            result[i * nColumns + j] = input[i] * scaleFactor - shiftFactor;
+        }
+    }
+    return Status();
+}
+
 } // namespace internal
 } // namespace minmax
 } // namespace normalization
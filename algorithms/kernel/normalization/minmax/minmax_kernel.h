@@ -60,6 +60,9 @@ protected:
     Status processBlock(const NumericTable & inputTable, NumericTable & resultTable, const algorithmFPType * scale, const algorithmFPType * shift,
                         const size_t startRowIndex, const size_t blockSize);
 
+    Status processBlockByColumns(const NumericTable & inputTable, NumericTable & resultTable, const algorithmFPType * scale,
+                                 const algorithmFPType * shift, const size_t startRowIndex, const size_t blockSize);
+
     static const size_t BLOCK_SIZE_NORM = 256;
 };
 
@@ -69,7 +69,7 @@ services::Status Parameter::check() const
 }
 
 /** Default constructor */
-Input::Input() : sum_of_functions::interface1::Input(lastInputId + 1) {}
+Input::Input() : sum_of_functions::interface1::Input(dependentVariables + 1) {}
 
 Input::Input(const Input & other) : sum_of_functions::interface1::Input(other) {}
 
@@ -23,6 +23,9 @@
 #include "service_math.h"
 #include "service_utils.h"
 #include "service_ittnotify.h"
+#include "service_threading.h"
+#include "service_error_handling.h"
+#include "service_environment.h"
 
 DAAL_ITTNOTIFY_DOMAIN(logistic_loss.dense.default.batch);
 
@@ -123,11 +126,179 @@ void LogLossKernel<algorithmFPType, method, cpu>::sigmoid(const algorithmFPType
     for (size_t i = 0; i < n; ++i) s[i] = algorithmFPType(1.0) / (algorithmFPType(1.0) + s[i]);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+static size_t getRowBlockSize(size_t nCols, size_t nBufCols)
+{
+    const size_t nRowsInBlockDefault = 500;
+    const size_t nRowsInBlockMin     = 32;
+    const size_t nRowsInBlock        = services::internal::getNumElementsFitInMemory(services::internal::getL1CacheSize() * 0.8,
+                                                                              (nCols + nBufCols) * sizeof(algorithmFPType), nRowsInBlockDefault);
+    return nRowsInBlock < nRowsInBlockMin ? nRowsInBlockMin : nRowsInBlock;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Computes f = X*b + b0, the sigmoids, the loss, the gradient and Hessian sums
+// and the Hessian-vector product sums for the direction v if it is given
+// block by block, so that each block of rows is read from memory once
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::accumulateBlocks(const algorithmFPType * x, const algorithmFPType * y, size_t n,
+                                                                               size_t p, const algorithmFPType * b, const algorithmFPType * v,
+                                                                               bool bValue, bool bGradient, bool bHessian, bool bIntercept,
+                                                                               algorithmFPType * acc)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute_blocks);
+
+    const size_t nBeta      = p + 1;
+    const size_t gradOffset = 1;
+    const size_t hessOffset = gradOffset + (bGradient ? nBeta : 0);
+    const size_t hvOffset   = hessOffset + (bHessian ? nBeta * nBeta : 0);
+    const size_t accSize    = hvOffset + (v ? nBeta : 0);
+
+    /* Buffers of a block: f, sigmoids, logarithms of sigmoids, X*v and the rows of the Hessian factor */
+    const size_t nBufCols     = 6 + (bHessian ? nBeta : 0);
+    const size_t nRowsInBlock = getRowBlockSize<algorithmFPType, cpu>(p, nBufCols);
+    const size_t nDataBlocks  = n / nRowsInBlock + !!(n % nRowsInBlock);
+    const size_t bufSize      = nBufCols * nRowsInBlock;
+
+    DAAL_ASSERT(nBeta <= services::internal::MaxVal<DAAL_INT>::get());
+    DAAL_ASSERT(nRowsInBlock <= services::internal::MaxVal<DAAL_INT>::get());
+    DAAL_INT dim        = (DAAL_INT)p;
+    DAAL_INT dimBeta    = (DAAL_INT)nBeta;
+    DAAL_INT ione       = 1;
+    char notrans        = 'N';
+    char uplo           = 'L';
+    algorithmFPType one = 1.0;
+
+    TlsSum<algorithmFPType, cpu> tlsAcc(accSize);
+    TlsMem<algorithmFPType, cpu> tlsBuf(bufSize);
+    SafeStatus safeStat;
+    daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
+        algorithmFPType * const localAcc = tlsAcc.local();
+        algorithmFPType * const buf      = tlsBuf.local();
+        DAAL_CHECK_THR(localAcc && buf, services::ErrorMemoryAllocationFailed);
+
+        const size_t iStartRow      = iBlock * nRowsInBlock;
+        const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
+        const algorithmFPType * px  = x + iStartRow * p;
+        const algorithmFPType * py  = y ? y + iStartRow : nullptr;
+        DAAL_INT nN                 = (DAAL_INT)nRowsToProcess;
+
+        algorithmFPType * f  = buf;
+        algorithmFPType * sg = f + nRowsInBlock;
+        algorithmFPType * ls = sg + 2 * nRowsInBlock;
+        algorithmFPType * u  = ls + 2 * nRowsInBlock;
+        algorithmFPType * wx = u + nRowsInBlock;
+
+        //f = X*b + b0
+        applyBetaImpl<algorithmFPType, cpu>(px, b, f, nRowsToProcess, p, bIntercept, false);
+        //s = exp(-f)
+        vexp<algorithmFPType, cpu>(f, sg, nRowsToProcess);
+        //s = sigm(f), s1 = 1 - s
+        sigmoids<algorithmFPType, cpu>(sg, nRowsToProcess);
+        const algorithmFPType * s  = sg;
+        const algorithmFPType * s1 = sg + nRowsToProcess;
+
+        if (bValue)
+        {
+            daal::internal::Math<algorithmFPType, cpu>::vLog(2 * nRowsToProcess, sg, ls);
+            const algorithmFPType * ls1 = ls + nRowsToProcess;
+            algorithmFPType value       = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRowsToProcess; ++i) value += py[i] * ls[i] + (algorithmFPType(1) - py[i]) * ls1[i];
+            localAcc[0] += value;
+        }
+
+        if (v)
+        {
+            //u = s * (1 - s) * (X*v + v0)
+            applyBetaImpl<algorithmFPType, cpu>(px, v, u, nRowsToProcess, p, bIntercept, false);
+            algorithmFPType sum = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRowsToProcess; ++i)
+            {
+                u[i] *= s[i] * s1[i];
+                sum += u[i];
+            }
+            localAcc[hvOffset] += sum;
+            Blas<algorithmFPType, cpu>::xxgemv(&notrans, &dim, &nN, &one, px, &dim, u, &ione, &one, localAcc + hvOffset + 1, &ione);
+        }
+
+        if (bGradient)
+        {
+            //f = s - y, f is not needed anymore
+            algorithmFPType sum = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRowsToProcess; ++i)
+            {
+                f[i] = s[i] - py[i];
+                sum += f[i];
+            }
+            localAcc[gradOffset] += sum;
+            Blas<algorithmFPType, cpu>::xxgemv(&notrans, &dim, &nN, &one, px, &dim, f, &ione, &one, localAcc + gradOffset + 1, &ione);
+        }
+
+        if (bHessian)
+        {
+            //wx = sqrt(s * (1 - s)) * (1, x)
+            for (size_t i = 0; i < nRowsToProcess; ++i)
+            {
+                const algorithmFPType w    = daal::internal::Math<algorithmFPType, cpu>::sSqrt(s[i] * s1[i]);
+                const algorithmFPType * xi = px + i * p;
+                algorithmFPType * wxi      = wx + i * nBeta;
+                wxi[0]                     = w;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; ++j) wxi[j + 1] = w * xi[j];
+            }
+            Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &notrans, &dimBeta, &nN, &one, wx, &dimBeta, &one, localAcc + hessOffset, &dimBeta);
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    tlsAcc.reduceTo(acc, accSize);
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+static void scaleHessianVectorProduct(const algorithmFPType * accHv, const algorithmFPType * v, algorithmFPType * hv, size_t n, size_t nBeta,
+                                      bool bIntercept, algorithmFPType penaltyL2)
+{
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    hv[0]                     = bIntercept ? accHv[0] * div : algorithmFPType(0);
+    for (size_t j = 1; j < nBeta; ++j) hv[j] = accHv[j] * div + 2. * penaltyL2 * v[j];
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Hessian-vector product hv = H*v, computed without forming the Hessian
+// with one pass over the blocks of rows
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::hessianVectorProduct(const algorithmFPType * x, size_t n, size_t p,
+                                                                                   const algorithmFPType * beta, const algorithmFPType * v,
+                                                                                   algorithmFPType * hv, bool bIntercept, algorithmFPType penaltyL2)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(hessian_vector_product);
+
+    const size_t nBeta = p + 1;
+    TArray<algorithmFPType, cpu> accT(nBeta);
+    algorithmFPType * const acc = accT.get();
+    DAAL_CHECK_MALLOC(acc);
+
+    DAAL_CHECK_STATUS_VAR(accumulateBlocks(x, nullptr, n, p, beta, v, false, false, false, bIntercept, acc));
+    scaleHessianVectorProduct<algorithmFPType, cpu>(acc, v, hv, n, nBeta, bIntercept, penaltyL2);
+    return services::Status();
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p,
                                                                         NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
                                                                         NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
                                                                         NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                                                        NumericTable * directionNT, NumericTable * hessianVectorProductNT,
                                                                         Parameter * parameter)
 {
     const size_t nBeta = p + 1;
@@ -247,63 +418,57 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
         v = nonSmoothTerm;
     }
 
-    if (valueNT || gradientNT || hessianNT)
+    const algorithmFPType * v = nullptr;
+    algorithmFPType * hv      = nullptr;
+    ReadRows<algorithmFPType, cpu> vr;
+    WriteRows<algorithmFPType, cpu> hvr;
+    if (hessianVectorProductNT)
     {
-        TNArray<algorithmFPType, 16, cpu> f;
-        TNArray<algorithmFPType, 32, cpu> sg;
-
-        TArrayScalable<algorithmFPType, cpu> fScalable;
-        TArrayScalable<algorithmFPType, cpu> sgScalable;
-
-        algorithmFPType * fPtr;
-        algorithmFPType * sgPtr;
-        if (n < 16)
-        {
-            f.reset(n);
-            sg.reset(2 * n);
-            fPtr  = f.get();
-            sgPtr = sg.get();
-        }
-        else
-        {
-            fScalable.reset(n);
-            sgScalable.reset(2 * n);
-            fPtr  = fScalable.get();
-            sgPtr = sgScalable.get();
-        }
-        //f = X*b + b0
-        applyBetaThreaded(x, b, fPtr, n, p, parameter->interceptFlag);
+        DAAL_ASSERT(directionNT->getNumberOfRows() == nBeta);
+        DAAL_ASSERT(hessianVectorProductNT->getNumberOfRows() == nBeta);
+        vr.set(directionNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(vr);
+        v = vr.get();
+        hvr.set(hessianVectorProductNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hvr);
+        hv = hvr.get();
 
+        if (!(valueNT || gradientNT || hessianNT))
         {
-            DAAL_ITTNOTIFY_SCOPED_TASK(compute_sigmoids);
-            //s = exp(-f)
-            vexp<algorithmFPType, cpu>(fPtr, sgPtr, n);
-
-            //s = sigm(f), s1 = 1 - s
-            sigmoids<algorithmFPType, cpu>(sgPtr, n);
+            return hessianVectorProduct(x, n, p, b, v, hv, parameter->interceptFlag, parameter->penaltyL2);
         }
+    }
 
+    if (valueNT || gradientNT || hessianNT)
+    {
         const bool bL1 = (parameter->penaltyL1 > 0);
         const bool bL2 = (parameter->penaltyL2 > 0);
 
-        const size_t iFirstBeta   = parameter->interceptFlag ? 0 : 1;
         const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
 
-        if (valueNT)
-        {
-            TArrayScalable<algorithmFPType, cpu> logS(2 * n);
-            daal::internal::Math<algorithmFPType, cpu>::vLog(2 * n, sgPtr, logS.get());
+        /* Accumulated sums: loss value, gradient, lower triangle of the Hessian and Hessian-vector product */
+        const size_t gradOffset = 1;
+        const size_t hessOffset = gradOffset + (gradientNT ? nBeta : 0);
+        const size_t hvOffset   = hessOffset + (hessianNT ? nBeta * nBeta : 0);
+        const size_t accSize    = hvOffset + (hv ? nBeta : 0);
+        TArray<algorithmFPType, cpu> accT(accSize);
+        algorithmFPType * const acc = accT.get();
+        DAAL_CHECK_MALLOC(acc);
 
-            const algorithmFPType * ls  = logS.get();
-            const algorithmFPType * ls1 = ls + n;
+        DAAL_CHECK_STATUS_VAR(accumulateBlocks(x, y, n, p, b, v, valueNT != nullptr, gradientNT != nullptr, hessianNT != nullptr,
+                                               parameter->interceptFlag, acc));
 
+        if (hv)
+        {
+            scaleHessianVectorProduct<algorithmFPType, cpu>(acc + hvOffset, v, hv, n, nBeta, parameter->interceptFlag, parameter->penaltyL2);
+        }
+
+        if (valueNT)
+        {
             WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
             DAAL_CHECK_BLOCK_STATUS(vr);
             algorithmFPType & value = *vr.get();
-            value                   = 0.0;
-            for (size_t i = 0; i < n; ++i) value += y[i] * ls[i] + (algorithmFPType(1) - y[i]) * ls1[i];
-
-            value *= -div;
+            value                   = -div * acc[0];
             if (bL2)
             {
                 for (size_t i = 1; i < nBeta; ++i) value += b[i] * b[i] * parameter->penaltyL2;
@@ -324,10 +489,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
 
         if (gradientNT)
         {
-            DAAL_ITTNOTIFY_SCOPED_TASK(compute_gradient);
-
             DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
-            algorithmFPType * s = sgPtr;
 
             algorithmFPType * g;
             HomogenNumericTable<algorithmFPType> * hmgGrad = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(gradientNT);
@@ -343,65 +505,9 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
                 g = gr.get();
             }
 
-            char trans          = 'T';
-            char notrans        = 'N';
-            algorithmFPType one = 1.0;
-            DAAL_INT yDim       = 1;
-            DAAL_ASSERT(p <= services::internal::MaxVal<DAAL_INT>::get());
-            DAAL_INT dim = (DAAL_INT)p;
-
-            const size_t nRowsInBlock = 1024;
-            const size_t nDataBlocks  = n / nRowsInBlock + !!(n % nRowsInBlock);
-            const auto nThreads       = daal::threader_get_threads_number();
-            if ((nThreads > 1) && (nDataBlocks > 1))
-            {
-                TArray<algorithmFPType, cpu> grads(nDataBlocks * p);
-                algorithmFPType * const gradsPtr = grads.get();
-                daal::services::internal::service_memset<algorithmFPType, cpu>(gradsPtr, algorithmFPType(0), nDataBlocks * p);
-                daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
-                    const size_t iStartRow      = iBlock * nRowsInBlock;
-                    const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? n - iBlock * nRowsInBlock : nRowsInBlock;
-                    const auto px               = x + iStartRow * p;
-                    auto ps                     = s + iStartRow;
-                    const auto py               = y + iStartRow;
-                    DAAL_ASSERT(nRowsToProcess <= services::internal::MaxVal<DAAL_INT>::get());
-                    DAAL_INT nN = (DAAL_INT)nRowsToProcess;
-                    auto pg     = gradsPtr + iBlock * p;
-                    PRAGMA_IVDEP
-                    PRAGMA_VECTOR_ALWAYS
-                    for (size_t i = 0; i < nRowsToProcess; ++i)
-                    {
-                        ps[i] -= py[i];
-                    }
-                    daal::internal::Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &yDim, &dim, &nN, &one, ps, &yDim, px, &dim, &one, pg,
-                                                                       &yDim);
-                    PRAGMA_IVDEP
-                    PRAGMA_VECTOR_ALWAYS
-                    for (size_t i = 0; i < nRowsToProcess; ++i)
-                    {
-                        ps[i] += py[i];
-                    }
-                });
-                for (size_t i = 0; i < nDataBlocks; i++)
-                    for (size_t j = 0; j < p; j++) g[j + 1] += gradsPtr[i * p + j];
-            }
-            else
-            {
-                for (size_t i = 0; i < nBeta; ++i) g[i] = 0.0;
-                for (size_t i = 0; i < n; ++i)
-                {
-                    const algorithmFPType d = (s[i] - y[i]);
-                    PRAGMA_IVDEP
-                    PRAGMA_VECTOR_ALWAYS
-                    for (size_t j = 0; j < p; ++j) g[j + 1] += d * x[i * p + j];
-                }
-            }
-
-            if (parameter->interceptFlag)
-            {
-                for (size_t i = 0; i < n; ++i) g[0] += (s[i] - y[i]);
-            }
-            for (size_t i = iFirstBeta; i < nBeta; ++i) g[i] *= div;
+            const algorithmFPType * accGrad = acc + gradOffset;
+            g[0]                            = parameter->interceptFlag ? accGrad[0] * div : algorithmFPType(0);
+            for (size_t i = 1; i < nBeta; ++i) g[i] = accGrad[i] * div;
 
             if (bL2)
             {
@@ -416,48 +522,26 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
             DAAL_CHECK_BLOCK_STATUS(hr);
             algorithmFPType * h = hr.get();
 
-            algorithmFPType * s = sgPtr;
-            for (size_t i = 0; i < n; ++i)
-            {
-                s[i] *= s[i + n]; //sigmoid derivative at x[i]
-            }
-
-            h[0] = 0;
-            if (parameter->interceptFlag)
+            const algorithmFPType * accHess = acc + hessOffset;
+            for (size_t j = 0; j < nBeta; ++j)
             {
-                for (size_t i = 0; i < n; ++i) h[0] += s[i];
-                h[0] *= div; //average of sigmoid derivatives
-
-                //first row and column
-                for (size_t k = 1; k < nBeta; ++k)
+                for (size_t k = j; k < nBeta; ++k)
                 {
-                    algorithmFPType val = 0;
-                    for (size_t i = 0; i < n; ++i) val += s[i] * x[i * p + k - 1];
-                    h[k]         = val * div;
-                    h[k * nBeta] = val * div;
+                    const algorithmFPType val = accHess[j * nBeta + k] * div;
+                    h[j * nBeta + k]          = val;
+                    h[k * nBeta + j]          = val;
                 }
             }
-            else
+            if (!parameter->interceptFlag)
             {
                 //first row and column
-                for (size_t k = 1; k < nBeta; ++k)
+                for (size_t k = 0; k < nBeta; ++k)
                 {
                     h[k]         = 0;
                     h[k * nBeta] = 0;
                 }
             }
-            //rows 1,..
-            for (size_t j = 1; j < nBeta; ++j)
-            {
-                for (size_t k = j; k < nBeta; ++k)
-                {
-                    algorithmFPType val = 0;
-                    for (size_t i = 0; i < n; ++i) val += x[i * p + j - 1] * x[i * p + k - 1] * s[i];
-                    h[j * nBeta + k] = val * div;
-                    h[k * nBeta + j] = val * div;
-                }
-                h[j * nBeta + j] += 2. * parameter->penaltyL2;
-            }
+            for (size_t j = 1; j < nBeta; ++j) h[j * nBeta + j] += 2. * parameter->penaltyL2;
         }
     }
     return services::Status();
@@ -468,6 +552,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
                                                                       NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
                                                                       NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
                                                                       NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                                                      NumericTable * directionNT, NumericTable * hessianVectorProductNT,
                                                                       Parameter * parameter)
 {
     const size_t nRows                                = dataNT->getNumberOfRows();
@@ -487,8 +572,8 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
             int ind                    = ntInd->getValue<int>(0, 0);
             const algorithmFPType * aX = (*hmgData)[ind];
             const algorithmFPType * aY = (*hmgDependentVariables)[ind];
-            s |=
-                doCompute(aX, aY, n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant, parameter);
+            s |= doCompute(aX, aY, n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant,
+                           directionNT, hessianVectorProductNT, parameter);
             return s;
         }
         else
@@ -501,7 +586,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
             TArrayScalable<algorithmFPType, cpu> aY(n);
             s |= objective_function::internal::getXY<algorithmFPType, cpu>(dataNT, dependentVariablesNT, ntInd, aX.get(), aY.get(), nRows, n, p);
             s |= doCompute(aX.get(), aY.get(), n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection,
-                           lipschitzConstant, parameter);
+                           lipschitzConstant, directionNT, hessianVectorProductNT, parameter);
         }
         return s;
     }
@@ -512,7 +597,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
     DAAL_CHECK_BLOCK_STATUS(yr);
 
     s |= doCompute(xr.get(), yr.get(), nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection, lipschitzConstant,
-                   parameter);
+                   directionNT, hessianVectorProductNT, parameter);
     return s;
 }
 
@@ -48,16 +48,23 @@ class LogLossKernel : public Kernel
 public:
     services::Status compute(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value,
                              NumericTable * hessian, NumericTable * gradient, NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
-                             NumericTable * lipschitzConstant, Parameter * parameter);
+                             NumericTable * lipschitzConstant, NumericTable * directionNT, NumericTable * hessianVectorProductNT,
+                             Parameter * parameter);
     static void applyBeta(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * xb, size_t nRows, size_t nCols, bool bIntercept);
     static void applyBetaThreaded(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * xb, size_t nRows, size_t nCols,
                                   bool bIntercept);
     static void sigmoid(const algorithmFPType * f, algorithmFPType * s, size_t n);
+    services::Status hessianVectorProduct(const algorithmFPType * x, size_t n, size_t p, const algorithmFPType * beta, const algorithmFPType * v,
+                                          algorithmFPType * hv, bool bIntercept, algorithmFPType penaltyL2);
 
 protected:
     services::Status doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p, NumericTable * betaNT,
                                NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
-                               NumericTable * proximalProjection, NumericTable * lipschitzConstant, Parameter * parameter);
+                               NumericTable * proximalProjection, NumericTable * lipschitzConstant, NumericTable * directionNT,
+                               NumericTable * hessianVectorProductNT, Parameter * parameter);
+
+    services::Status accumulateBlocks(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p, const algorithmFPType * b,
+                                      const algorithmFPType * v, bool bValue, bool bGradient, bool bHessian, bool bIntercept, algorithmFPType * acc);
 };
 
 } // namespace internal
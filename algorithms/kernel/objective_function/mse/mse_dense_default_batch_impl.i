@@ -64,7 +64,17 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                 xNT                                               = dataNT;
                 SOANumericTable * soaDataPtr                      = dynamic_cast<SOANumericTable *>(dataNT);
                 HomogenNumericTable<algorithmFPType> * hmgDataPtr = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(dataNT);
-                if (hmgDataPtr)
+                CSRNumericTableIface * csrDataPtr =
+                    (dataNT->getDataLayout() == NumericTableIface::csrArray) ? dynamic_cast<CSRNumericTableIface *>(dataNT) : nullptr;
+                sparseData = (csrDataPtr != nullptr);
+                if (csrDataPtr)
+                {
+                    Status s = transposeCSR(csrDataPtr, nDataRows, nTheta);
+                    DAAL_CHECK_STATUS_VAR(s);
+                    X              = cscValues.get();
+                    transposedData = false;
+                }
+                else if (hmgDataPtr)
                 {
                     X              = hmgDataPtr->getArray();
                     transposedData = false;
@@ -151,7 +161,7 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                 b      = beta.get();
                 betaNT = argumentNT;
             }
-            if (nDataRows < nTheta || parameter->interceptFlag)
+            if (nDataRows < nTheta || parameter->interceptFlag || sparseData)
             {
                 if (dotPtr == nullptr)
                 {
@@ -171,6 +181,10 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                     previousFeatureId = -1;
                     residual.reset(nDataRows * yDim);
                     residualPtr = residual.get();
+                    DAAL_CHECK_MALLOC(residualPtr);
+                    partialDot.reset(nDataRows / residualBlockSize * yDim + yDim);
+                    partialDotPtr = partialDot.get();
+                    DAAL_CHECK_MALLOC(partialDotPtr);
 
                     result |= daal::services::internal::daal_memcpy_s(residualPtr, n * yDim * sizeof(algorithmFPType), Y,
                                                                       n * yDim * sizeof(algorithmFPType));
@@ -185,7 +199,34 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                     const size_t blockSize = 256;
                     size_t nBlocks         = nDataRows / blockSize;
                     nBlocks += (nBlocks * blockSize != nDataRows);
-                    if (compute_matrix)
+                    if (compute_matrix && sparseData)
+                    {
+                        const algorithmFPType * values = cscValues.get();
+                        const size_t * rowIndices      = cscRowIndices.get();
+                        const size_t * colOffsets      = cscColOffsets.get();
+                        for (size_t j = 0; j < nTheta; j++)
+                        {
+                            for (size_t ic = 0; ic < yDim; ic++)
+                            {
+                                const algorithmFPType beta = fB[(j + 1) * yDim + ic];
+                                if (beta == 0) continue;
+                                for (size_t k = colOffsets[j]; k < colOffsets[j + 1]; k++)
+                                {
+                                    residualPtr[rowIndices[k] * yDim + ic] -= values[k] * beta;
+                                }
+                            }
+                        }
+                        if (parameter->interceptFlag)
+                        {
+                            for (size_t i = 0; i < nDataRows; i++)
+                            {
+                                PRAGMA_IVDEP
+                                PRAGMA_VECTOR_ALWAYS
+                                for (size_t ic = 0; ic < yDim; ic++) residualPtr[i * yDim + ic] -= fB[ic];
+                            }
+                        }
+                    }
+                    else if (compute_matrix)
                     {
                         daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
                             const size_t startRow   = iBlock * blockSize;
@@ -228,7 +269,11 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                             hessianDiagonalPtr[j] = 0; /*USE DOTPRODUCT or parallel computation*/
                         }
 
-                        if (transposedData)
+                        if (sparseData)
+                        {
+                            computeSparseHessianDiagonal(nDataRows, nTheta);
+                        }
+                        else if (transposedData)
                         {
                             TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(nTheta);
                             daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
@@ -291,74 +336,7 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                     }
                 }
 
-                if (previousFeatureId >= 0)
-                {
-                    for (size_t ic = 0; ic < yDim; ic++) /*use ger or gemm for better performance*/
-                    {
-                        const algorithmFPType curentBetaValue = b[previousFeatureId * yDim + ic];
-                        const algorithmFPType diff            = previousFeatureValuesPtr[ic] - curentBetaValue;
-
-                        if (diff != 0)
-                        {
-                            if (previousFeatureId == 0 && parameter->interceptFlag)
-                            {
-                                PRAGMA_IVDEP
-                                PRAGMA_VECTOR_ALWAYS
-                                for (size_t i = 0; i < nDataRows; i++) /*threader for*/
-                                {
-                                    residualPtr[i * yDim + ic] += diff;
-                                }
-                            }
-                            if (previousFeatureId != 0)
-                            {
-                                if (transposedData)
-                                {
-                                    daal::internal::Blas<algorithmFPType, cpu>::xxaxpy(&n, &diff, X + (previousFeatureId - 1) * n, &ione,
-                                                                                       residualPtr + ic, &yDim);
-                                }
-                                else
-                                {
-                                    daal::internal::Blas<algorithmFPType, cpu>::xxaxpy(&n, &diff, X + (previousFeatureId - 1), &dim, residualPtr + ic,
-                                                                                       &yDim);
-                                }
-                            }
-                        }
-                    }
-                }
-                for (size_t ic = 0; ic < yDim; ic++)
-                {
-                    dotPtr[ic] = 0;
-                }
-
-                if (id == 0)
-                {
-                    if (parameter->interceptFlag)
-                    {
-                        for (size_t i = 0; i < nDataRows; i++) /*threader for*/
-                        {
-                            PRAGMA_IVDEP
-                            PRAGMA_VECTOR_ALWAYS
-                            for (size_t ic = 0; ic < yDim; ic++) dotPtr[ic] += residualPtr[i * yDim + ic];
-                        }
-                    }
-                }
-                else
-                {
-                    if (transposedData)
-                    {
-                        for (size_t ic = 0; ic < yDim; ic++)
-                        {
-                            dotPtr[ic] += daal::internal::Blas<algorithmFPType, cpu>::xxdot(&n, X + (id - 1) * n, &ione, residualPtr + ic, &yDim);
-                        }
-                    }
-                    else
-                    {
-                        for (size_t ic = 0; ic < yDim; ic++)
-                        {
-                            dotPtr[ic] += daal::internal::Blas<algorithmFPType, cpu>::xxdot(&n, X + (id - 1), &dim, residualPtr + ic, &yDim);
-                        }
-                    }
-                }
+                updateResidualAndDot(nDataRows, nTheta, yDim, id, parameter->interceptFlag);
 
                 /*store previous values for update*/
                 previousFeatureId = id;
@@ -550,13 +528,20 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                         {
                             hessianDiagonalPtr[j] = 0; /*USE DOTPRODUCT or parallel computation*/
                         }
-                        for (size_t i = 0; i < nDataRows; i++)
+                        if (sparseData)
+                        {
+                            computeSparseHessianDiagonal(nDataRows, nTheta);
+                        }
+                        else
                         {
-                            PRAGMA_IVDEP
-                            PRAGMA_VECTOR_ALWAYS
-                            for (size_t j = 0; j < nTheta; j++)
+                            for (size_t i = 0; i < nDataRows; i++)
                             {
-                                hessianDiagonalPtr[j] += X[i * dim + j] * X[i * dim + j]; /*USE DOTPRODUCT or parallel computation*/
+                                PRAGMA_IVDEP
+                                PRAGMA_VECTOR_ALWAYS
+                                for (size_t j = 0; j < nTheta; j++)
+                                {
+                                    hessianDiagonalPtr[j] += X[i * dim + j] * X[i * dim + j]; /*USE DOTPRODUCT or parallel computation*/
+                                }
                             }
                         }
                         PRAGMA_IVDEP
@@ -714,6 +699,221 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
     return (!result) ? run(task) : services::Status(services::ErrorMemoryCopyFailedInternal);
 }
 
+/**
+ *  \brief Builds the column-compressed copy of the CSR data for the per-feature computations
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status MSEKernel<algorithmFPType, method, cpu>::transposeCSR(CSRNumericTableIface * csrData, size_t nDataRows, size_t nTheta)
+{
+    ReadRowsCSR<algorithmFPType, cpu> dataBD(csrData, 0, nDataRows);
+    DAAL_CHECK_BLOCK_STATUS(dataBD);
+    const algorithmFPType * values = dataBD.values();
+    const size_t * colIndices      = dataBD.cols();
+    const size_t * rowOffsets      = dataBD.rows();
+    const size_t nNonZeros         = rowOffsets[nDataRows] - rowOffsets[0];
+
+    cscValues.reset(nNonZeros);
+    cscRowIndices.reset(nNonZeros);
+    cscColOffsets.reset(nTheta + 1);
+    DAAL_CHECK_MALLOC((cscValues.get() && cscRowIndices.get()) || !nNonZeros);
+    DAAL_CHECK_MALLOC(cscColOffsets.get());
+    size_t * colOffsets = cscColOffsets.get();
+
+    daal::services::internal::service_memset<size_t, cpu>(colOffsets, 0, nTheta + 1);
+    for (size_t k = 0; k < nNonZeros; k++)
+    {
+        colOffsets[colIndices[k]]++; /* column indices are one-based */
+    }
+    for (size_t j = 0; j < nTheta; j++)
+    {
+        colOffsets[j + 1] += colOffsets[j];
+    }
+
+    TArray<size_t, cpu> positionsT(nTheta);
+    size_t * positions = positionsT.get();
+    DAAL_CHECK_MALLOC(positions);
+    for (size_t j = 0; j < nTheta; j++)
+    {
+        positions[j] = colOffsets[j];
+    }
+    for (size_t i = 0; i < nDataRows; i++)
+    {
+        for (size_t k = rowOffsets[i] - rowOffsets[0]; k < rowOffsets[i + 1] - rowOffsets[0]; k++)
+        {
+            const size_t pos         = positions[colIndices[k] - 1]++;
+            cscValues.get()[pos]     = values[k];
+            cscRowIndices.get()[pos] = i;
+        }
+    }
+    return services::Status();
+}
+
+/**
+ *  \brief Computes the sums of squares of the CSR data columns
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void MSEKernel<algorithmFPType, method, cpu>::computeSparseHessianDiagonal(size_t nDataRows, size_t nTheta)
+{
+    const algorithmFPType * values = cscValues.get();
+    const size_t * colOffsets      = cscColOffsets.get();
+    daal::threader_for(nTheta, nTheta, [&](const size_t j) {
+        algorithmFPType sum = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = colOffsets[j]; k < colOffsets[j + 1]; k++)
+        {
+            sum += values[k] * values[k];
+        }
+        hessianDiagonalPtr[j] = sum;
+    });
+}
+
+/**
+ *  \brief Applies the change of the previous feature coefficients to the residual
+ *         and computes the dot products of the residual with the feature id in the same pass over the rows
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void MSEKernel<algorithmFPType, method, cpu>::updateResidualAndDot(size_t nDataRows, size_t nTheta, size_t yDim, size_t id, bool interceptFlag)
+{
+    const int prevId = previousFeatureId;
+    for (size_t ic = 0; ic < yDim; ic++)
+    {
+        dotPtr[ic] = 0;
+    }
+
+    size_t nBlocks = nDataRows / residualBlockSize;
+    nBlocks += (nBlocks * residualBlockSize != nDataRows);
+
+    if (sparseData)
+    {
+        const algorithmFPType * values = cscValues.get();
+        const size_t * rowIndices      = cscRowIndices.get();
+        const size_t * colOffsets      = cscColOffsets.get();
+        const size_t prevBegin         = (prevId > 0) ? colOffsets[prevId - 1] : 0;
+        const size_t prevEnd           = (prevId > 0) ? colOffsets[prevId] : 0;
+        const size_t begin             = (id > 0) ? colOffsets[id - 1] : 0;
+        const size_t end               = (id > 0) ? colOffsets[id] : 0;
+
+        /* Row indices are sorted within a column, so the non-zeros of a block of rows are found by the binary search */
+        auto lowerBound = [&](size_t first, size_t last, size_t row) -> size_t {
+            while (first < last)
+            {
+                const size_t middle = first + (last - first) / 2;
+                if (rowIndices[middle] < row)
+                    first = middle + 1;
+                else
+                    last = middle;
+            }
+            return first;
+        };
+
+        auto processSparseBlock = [&](const size_t iBlock) {
+            const size_t startRow      = iBlock * residualBlockSize;
+            const size_t endRow        = (iBlock + 1 == nBlocks) ? nDataRows : startRow + residualBlockSize;
+            const bool wholeColumns    = (nBlocks == 1);
+            const size_t kPrevBegin    = wholeColumns ? prevBegin : lowerBound(prevBegin, prevEnd, startRow);
+            const size_t kPrevEnd      = wholeColumns ? prevEnd : lowerBound(kPrevBegin, prevEnd, endRow);
+            const size_t kBegin        = wholeColumns ? begin : lowerBound(begin, end, startRow);
+            const size_t kEnd          = wholeColumns ? end : lowerBound(kBegin, end, endRow);
+            algorithmFPType * localDot = partialDotPtr + iBlock * yDim;
+
+            for (size_t ic = 0; ic < yDim; ic++)
+            {
+                algorithmFPType * r        = residualPtr + ic;
+                const algorithmFPType diff = (prevId >= 0) ? previousFeatureValuesPtr[ic] - b[prevId * yDim + ic] : 0;
+                if (diff != 0 && prevId > 0)
+                {
+                    for (size_t k = kPrevBegin; k < kPrevEnd; k++) r[rowIndices[k] * yDim] += diff * values[k];
+                }
+                else if (diff != 0 && interceptFlag)
+                {
+                    for (size_t i = startRow; i < endRow; i++) r[i * yDim] += diff;
+                }
+
+                localDot[ic] = 0;
+                if (id > 0)
+                {
+                    for (size_t k = kBegin; k < kEnd; k++) localDot[ic] += values[k] * r[rowIndices[k] * yDim];
+                }
+                else if (interceptFlag)
+                {
+                    for (size_t i = startRow; i < endRow; i++) localDot[ic] += r[i * yDim];
+                }
+            }
+        };
+
+        /* The intercept touches all rows, the sparse columns are split by rows only when they have enough non-zeros */
+        const bool denseWork = (prevId == 0 || id == 0) && interceptFlag;
+        if (nBlocks > 1 && (denseWork || (prevEnd - prevBegin) + (end - begin) >= residualBlockSize))
+        {
+            daal::threader_for(nBlocks, nBlocks, processSparseBlock);
+        }
+        else
+        {
+            nBlocks = 1;
+            processSparseBlock(0);
+        }
+    }
+    else
+    {
+        const DAAL_INT n    = (DAAL_INT)nDataRows;
+        const DAAL_INT dim  = (DAAL_INT)nTheta;
+        const DAAL_INT ione = 1;
+        const DAAL_INT incX = transposedData ? ione : dim;
+        DAAL_INT incR       = (DAAL_INT)yDim;
+
+        auto processBlock = [&](const size_t iBlock) {
+            const size_t startRow      = iBlock * residualBlockSize;
+            DAAL_INT localBlockSize    = (iBlock + 1 == nBlocks) ? nDataRows - startRow : residualBlockSize;
+            algorithmFPType * localDot = partialDotPtr + iBlock * yDim;
+            const algorithmFPType * prevCol =
+                (prevId > 0) ? X + (transposedData ? (prevId - 1) * n + startRow : (prevId - 1) + startRow * dim) : nullptr;
+            const algorithmFPType * col = (id > 0) ? X + (transposedData ? (id - 1) * n + startRow : (id - 1) + startRow * dim) : nullptr;
+
+            for (size_t ic = 0; ic < yDim; ic++)
+            {
+                algorithmFPType * r  = residualPtr + startRow * yDim + ic;
+                algorithmFPType diff = (prevId >= 0) ? previousFeatureValuesPtr[ic] - b[prevId * yDim + ic] : 0;
+                if (diff != 0 && prevCol)
+                {
+                    Blas<algorithmFPType, cpu>::xxaxpy(&localBlockSize, &diff, prevCol, &incX, r, &incR);
+                }
+                else if (diff != 0 && interceptFlag)
+                {
+                    for (DAAL_INT i = 0; i < localBlockSize; i++) r[i * yDim] += diff;
+                }
+
+                localDot[ic] = 0;
+                if (col)
+                {
+                    localDot[ic] = Blas<algorithmFPType, cpu>::xxdot(&localBlockSize, col, &incX, r, &incR);
+                }
+                else if (interceptFlag)
+                {
+                    for (DAAL_INT i = 0; i < localBlockSize; i++) localDot[ic] += r[i * yDim];
+                }
+            }
+        };
+
+        if (nBlocks == 1)
+        {
+            processBlock(0);
+        }
+        else
+        {
+            daal::threader_for(nBlocks, nBlocks, processBlock);
+        }
+    }
+
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        for (size_t ic = 0; ic < yDim; ic++)
+        {
+            dotPtr[ic] += partialDotPtr[iBlock * yDim + ic];
+        }
+    }
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status MSEKernel<algorithmFPType, method, cpu>::run(MSETask<algorithmFPType, cpu> & task)
 {
@@ -209,7 +209,9 @@ public:
           penaltyL1Ptr(nullptr),
           proxNT(nullptr),
           proxPtr(nullptr),
-          transposedData(false) {};
+          transposedData(false),
+          sparseData(false),
+          partialDotPtr(nullptr) {};
 
 private:
     void computeMSE(size_t blockSize, MSETask<algorithmFPType, cpu> & task, algorithmFPType * data, algorithmFPType * argumentArray,
@@ -219,6 +221,12 @@ private:
 
     Status run(MSETask<algorithmFPType, cpu> & task);
 
+    Status transposeCSR(CSRNumericTableIface * csrData, size_t nDataRows, size_t nTheta);
+
+    void computeSparseHessianDiagonal(size_t nDataRows, size_t nTheta);
+
+    void updateResidualAndDot(size_t nDataRows, size_t nTheta, size_t yDim, size_t id, bool interceptFlag);
+
     TArray<algorithmFPType, cpu> residual;
     TArray<algorithmFPType, cpu> gramMatrix;
     TArray<algorithmFPType, cpu> XY;
@@ -256,6 +264,16 @@ private:
     algorithmFPType * proxPtr;
     ReadRows<algorithmFPType, cpu> XPtr;
     bool transposedData;
+
+    /* Column-compressed copy of the CSR data used in the per-feature computations */
+    bool sparseData;
+    TArray<algorithmFPType, cpu> cscValues;
+    TArray<size_t, cpu> cscRowIndices;
+    TArray<size_t, cpu> cscColOffsets;
+
+    /* Per-block partial dot products of the feature and the residual */
+    TArray<algorithmFPType, cpu> partialDot;
+    algorithmFPType * partialDotPtr;
 };
 
 } // namespace internal
@@ -37,7 +37,8 @@ namespace internal
 using namespace daal::data_management;
 using namespace daal::internal;
 using namespace daal::services;
-static const size_t blockSizeDefault = 512;
+static const size_t blockSizeDefault  = 512;
+static const size_t residualBlockSize = 1024;
 
 template <typename algorithmFPType, CpuType cpu>
 MSETask<algorithmFPType, cpu>::MSETask(NumericTable * data, NumericTable * dependentVariables, NumericTable * argument, NumericTable * value,
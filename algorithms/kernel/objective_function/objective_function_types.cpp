@@ -110,7 +110,7 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 {
     using namespace services;
 
-    DAAL_CHECK(Argument::size() == 9, ErrorIncorrectNumberOfArguments);
+    DAAL_CHECK(Argument::size() == 10, ErrorIncorrectNumberOfArguments);
 
     const Input * algInput         = static_cast<const Input *>(input);
     const Parameter * algParameter = static_cast<const Parameter *>(par);
@@ -130,6 +130,10 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     {
         s |= checkNumericTable(get(hessianIdx).get(), hessianIdxStr(), 0, 0, nRows, nRows);
     }
+    if (algParameter->resultsToCompute & hessianVectorProduct)
+    {
+        s |= checkNumericTable(get(hessianVectorProductIdx).get(), hessianVectorProductIdxStr(), 0, 0, 1, nRows);
+    }
     return s;
 }
 
@@ -120,6 +120,12 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
         DAAL_CHECK_STATUS_VAR(status);
         Argument::set(componentOfProximalProjectionIdx, staticPointerCast<NumericTable, SerializationIface>(nt));
     }
+    if (algParameter->resultsToCompute & hessianVectorProduct && !Argument::get(hessianVectorProductIdx))
+    {
+        NumericTablePtr nt = NumericTablePtr(HomogenNumericTable<algorithmFPType>::create(1, nRows, NumericTable::doAllocate, zero, &status));
+        DAAL_CHECK_STATUS_VAR(status);
+        Argument::set(hessianVectorProductIdx, staticPointerCast<NumericTable, SerializationIface>(nt));
+    }
     return status;
 }
 
@@ -53,9 +53,9 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
-    Input * input         = static_cast<Input *>(_in);
-    Result * result       = static_cast<Result *>(_res);
-    Parameter * parameter = static_cast<Parameter *>(_par);
+    Input * input                             = static_cast<Input *>(_in);
+    Result * result                           = static_cast<Result *>(_res);
+    coordinate_descent::Parameter * parameter = static_cast<coordinate_descent::Parameter *>(_par);
 
     daal::services::Environment::env & env = *_env;
 
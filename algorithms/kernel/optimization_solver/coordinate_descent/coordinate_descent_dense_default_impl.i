@@ -148,11 +148,26 @@ services::Status CoordinateDescentKernel<algorithmFPType, method, cpu>::compute(
 
     const bool positive    = parameter->positive;
     const size_t startedId = parameter->skipTheFirstComponents ? 1 : 0;
-    size_t itr             = 0;
+    const size_t nFeatures = nRowsArgument - startedId;
+
+    /* Indices of the coordinates swept between the full sweeps when the active set screening is enabled.
+     * The active set is the non-zero pattern of the previous full sweep rather than the set kept by the strong rules:
+     * the rules compare the gradient with the L1 penalty, which is hidden in the proximal projection of the objective function,
+     * and the sequential rule needs the solution for the previous penalty on a path, while the solver minimizes a single objective.
+     * The full sweep that confirms the convergence is the same check of the KKT conditions that the strong rules require. */
+    TArray<size_t, cpu> activeSetT(parameter->activeSetScreening ? nFeatures : 0);
+    size_t * const activeSet = activeSetT.get();
+    DAAL_CHECK_MALLOC(!parameter->activeSetScreening || activeSet);
+    size_t nActive = 0;
+    bool fullSweep = true;
+
+    size_t itr = 0;
     for (itr = 0; itr < maxIterations; itr++)
     {
-        for (size_t id = startedId; id < (nRowsArgument); id++)
+        const size_t nSwept = fullSweep ? nFeatures : nActive;
+        for (size_t iSwept = 0; iSwept < nSwept; iSwept++)
         {
+            const size_t id = fullSweep ? startedId + iSwept : activeSet[iSwept];
             //const algorithmFPType prew = workValue[id];
             for (size_t ic = 0; ic < nColsArgument; ic++)
             {
@@ -199,12 +214,34 @@ services::Status CoordinateDescentKernel<algorithmFPType, method, cpu>::compute(
                 maxValue                           = maxValueCurr > maxValue ? maxValueCurr : maxValue;
             }
         }
-        if (maxDiff <= accuracyThreshold * maxValue)
+        const bool converged = (maxDiff <= accuracyThreshold * maxValue);
+        maxValue             = 0;
+        maxDiff              = 0;
+        if (!parameter->activeSetScreening)
         {
-            break;
+            if (converged) break;
+            continue;
         }
-        maxValue = 0;
-        maxDiff  = 0;
+
+        if (!fullSweep)
+        {
+            /* Convergence on the active set is confirmed by the full sweep that may add new coordinates */
+            fullSweep = converged;
+            continue;
+        }
+        if (converged) break;
+
+        nActive = 0;
+        for (size_t id = startedId; id < nRowsArgument; id++)
+        {
+            bool isActive = false;
+            for (size_t ic = 0; ic < nColsArgument; ic++)
+            {
+                isActive |= (workValue[id * nColsArgument + ic] != 0);
+            }
+            if (isActive) activeSet[nActive++] = id;
+        }
+        fullSweep = (nActive == 0 || nActive == nFeatures);
     }
     *nIter = itr + 1;
     return s;
@@ -90,6 +90,14 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+Parameter::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations, double accuracyThreshold, size_t seed)
+    : interface1::Parameter(function, nIterations, accuracyThreshold, seed), activeSetScreening(false)
+{}
+
+} // namespace interface2
 } // namespace coordinate_descent
 } // namespace optimization_solver
 } // namespace algorithms
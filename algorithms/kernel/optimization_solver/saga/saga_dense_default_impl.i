@@ -29,6 +29,9 @@
 #include "service_math.h"
 #include "service_utils.h"
 #include "service_numeric_table.h"
+#include "service_sort.h"
+#include "service_error_handling.h"
+#include "threading.h"
 #include "iterative_solver_kernel.h"
 #include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
 #include "algorithms/optimization_solver/saga/saga_types.h"
@@ -47,6 +50,79 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::algorithms::optimization_solver::iterative_solver::internal;
 
+/**
+ *  \brief Computes the gradients of single terms of the objective function.
+ *         Every thread uses its own copy of the objective function
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SagaTermGradient
+{
+public:
+    DAAL_NEW_DELETE();
+
+    static SagaTermGradient * create(const sum_of_functions::BatchPtr & function)
+    {
+        SagaTermGradient * result = new SagaTermGradient(function);
+        if (result && !result->isValid())
+        {
+            delete result;
+            result = nullptr;
+        }
+        return result;
+    }
+
+    services::Status compute(int index, size_t sizeArgument, algorithmFPType * gradient)
+    {
+        _index[0]          = index;
+        services::Status s = _function->computeNoThrow();
+        if (!s) return s;
+
+        NumericTablePtr gradientTable = _function->getResult()->get(optimization_solver::objective_function::gradientIdx);
+        ReadRows<algorithmFPType, cpu> gradientBD(*gradientTable, 0, sizeArgument);
+        DAAL_CHECK_BLOCK_STATUS(gradientBD);
+        const algorithmFPType * termGradient = gradientBD.get();
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < sizeArgument; k++)
+        {
+            gradient[k] = termGradient[k];
+        }
+        return s;
+    }
+
+private:
+    SagaTermGradient(const sum_of_functions::BatchPtr & function) : _function(function->clone())
+    {
+        if (_function.get())
+        {
+            _function->sumOfFunctionsParameter->batchIndices = HomogenNumericTableCPU<int, cpu>::create(_index, 1, 1);
+            _function->enableChecks(false);
+        }
+    }
+
+    bool isValid() const { return _function.get() && _function->sumOfFunctionsParameter->batchIndices.get(); }
+
+    sum_of_functions::BatchPtr _function;
+    int _index[1];
+};
+
+/**
+ *  \brief Computes the gradients of the terms of the objective function with the given indices in parallel
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeTermGradients(daal::tls<SagaTermGradient<algorithmFPType, cpu> *> & tlsGradient, const int * indices, size_t nTerms,
+                                      size_t sizeArgument, algorithmFPType * gradients)
+{
+    SafeStatus safeStat;
+    daal::threader_for(nTerms, nTerms, [&](size_t i) {
+        SagaTermGradient<algorithmFPType, cpu> * termGradient = tlsGradient.local();
+        DAAL_CHECK_THR(termGradient, ErrorMemoryAllocationFailed);
+        DAAL_CHECK_STATUS_THR(termGradient->compute(indices ? indices[i] : (int)i, sizeArgument, gradients + i * sizeArgument));
+    });
+    return safeStat.detach();
+}
+
 /**
  *  \Kernel for Saga calculation
  */
@@ -75,7 +151,7 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
 
     const size_t maxIterations      = parameter->nIterations;
     const algorithmFPType tolerance = parameter->accuracyThreshold;
-    const size_t batchSize          = 1; /* curently only batchSize = 1 supported */
+    const size_t batchSize          = parameter->batchSize;
 
     sum_of_functions::BatchPtr function = parameter->function;
     NumericTablePtr argumentTable(new HomogenNumericTableCPU<algorithmFPType, cpu>(workValue, 1, sizeArgument, s));
@@ -84,6 +160,7 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
 
     const size_t n                  = function->sumOfFunctionsParameter->numberOfTerms;
     const algorithmFPType inverse_n = algorithmFPType(1) / algorithmFPType(n);
+    const algorithmFPType inverse_b = algorithmFPType(1) / algorithmFPType(batchSize);
 
     sum_of_functions::BatchPtr get_auto_step                 = function->clone();
     get_auto_step->sumOfFunctionsParameter->resultsToCompute = optimization_solver::objective_function::lipschitzConstant;
@@ -119,7 +196,9 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
 
     size_t iterationsPerformed = 0;
 
-    RngTask<int, cpu> rngTask(nullptr, 1024);
+    /* Random indices are generated for nRngBatches batches at once */
+    const size_t nRngBatches = (batchSize < 1024) ? 1024 / batchSize : 1;
+    RngTask<int, cpu> rngTask(nullptr, nRngBatches * batchSize);
     DAAL_CHECK_MALLOC(rngTask.init(parameter->function->sumOfFunctionsParameter->numberOfTerms, engine));
     const int * pValues = nullptr;
 
@@ -130,6 +209,7 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
     if (!gradientsTableInput && !gradientsTableResult)
     {
         savedGradientsPtr.reset(n * sizeArgument);
+        DAAL_CHECK_MALLOC(savedGradientsPtr.get());
         savedGradients = savedGradientsPtr.get();
     }
     else
@@ -145,62 +225,44 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
             savedGradients = gradientsTableInputPtr.get();
         }
     }
-    TArray<int, cpu> batchIndicesT(batchSize);
-    int * batchIndicesPtr = batchIndicesT.get();
-
-    function->sumOfFunctionsParameter->batchIndices = HomogenNumericTableCPU<int, cpu>::create(batchIndicesPtr, batchSize, 1);
+    /* The proximal projection does not depend on the terms of the objective function, so a single term is passed to it */
+    SharedPtr<HomogenNumericTableCPU<int, cpu> > proxIndices = HomogenNumericTableCPU<int, cpu>::create(1, 1, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    proxIndices->getArray()[0] = 0;
 
     sum_of_functions::BatchPtr proximaProjection                 = function->clone();
     proximaProjection->sumOfFunctionsParameter->resultsToCompute = optimization_solver::objective_function::proximalProjection;
+    proximaProjection->sumOfFunctionsParameter->batchIndices     = proxIndices;
 
     TArray<algorithmFPType, cpu> summGradsPtr(sizeArgument);
     algorithmFPType * summGrads = summGradsPtr.get();
 
-    const algorithmFPType * gradient;
+    /* Gradients of the terms in the batch, the average change of the gradients in the batch
+     * and the indices of the batch sorted to find the repeated terms */
+    TArray<algorithmFPType, cpu> batchGradientsPtr(batchSize * sizeArgument);
+    TArray<algorithmFPType, cpu> batchStepPtr(sizeArgument);
+    TArray<int, cpu> sortedIndicesPtr(batchSize);
+    TArray<int, cpu> sortedPositionsPtr(batchSize);
+    DAAL_CHECK_MALLOC(summGrads && batchGradientsPtr.get() && batchStepPtr.get() && sortedIndicesPtr.get() && sortedPositionsPtr.get());
+    algorithmFPType * batchGradients = batchGradientsPtr.get();
+    algorithmFPType * batchStep      = batchStepPtr.get();
+    int * sortedIndices              = sortedIndicesPtr.get();
+    int * sortedPositions            = sortedPositionsPtr.get();
+
     const algorithmFPType * prox;
 
-    function->enableChecks(false);
     proximaProjection->enableChecks(false);
 
-    ReadRows<algorithmFPType, cpu> gradientPtr;
     ReadRows<algorithmFPType, cpu> proxPtr;
-    HomogenNumericTable<algorithmFPType> * hmgGradient;
     HomogenNumericTable<algorithmFPType> * hmgProx;
-    NumericTablePtr gradientResultPtr;
     NumericTablePtr proxResultPtr;
 
+    daal::tls<SagaTermGradient<algorithmFPType, cpu> *> tlsGradient([&]() { return SagaTermGradient<algorithmFPType, cpu>::create(function); });
+
     /* compute table of gradients if gradientsTableInput is absent */
     if (!gradientsTableInput)
     {
-        for (size_t k = 0; k < n; k++)
-        {
-            batchIndicesPtr[0] = k;
-            function->computeNoThrow();
-            if (k == 0)
-            {
-                gradientResultPtr = function->getResult()->get(optimization_solver::objective_function::gradientIdx);
-
-                hmgGradient = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(gradientResultPtr.get());
-
-                gradientPtr.set(*gradientResultPtr, 0, sizeArgument);
-                DAAL_CHECK_BLOCK_STATUS(gradientPtr);
-                gradient = gradientPtr.get();
-            }
-            else
-            {
-                if (!hmgGradient)
-                {
-                    gradientPtr.set(*gradientResultPtr, 0, sizeArgument);
-                    DAAL_CHECK_BLOCK_STATUS(gradientPtr);
-                    gradient = gradientPtr.get();
-                }
-            }
-
-            for (size_t i = 0; i < sizeArgument; i++)
-            {
-                savedGradients[k * sizeArgument + i] = gradient[i];
-            }
-        }
+        s = computeTermGradients<algorithmFPType, cpu>(tlsGradient, nullptr, n, sizeArgument, savedGradients);
     }
     /* compute sum of gradients */
     for (size_t i = 0; i < sizeArgument; i++) summGrads[i] = 0;
@@ -223,12 +285,13 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
 
     if (!s || host.isCancelled(s, 1))
     {
+        tlsGradient.reduce([](SagaTermGradient<algorithmFPType, cpu> * termGradient) { delete termGradient; });
         *nIterationsPerformed.get() = iterationsPerformed;
         return s;
     }
 
     NumericTablePtr batchIndicesNT = parameter->batchIndices;
-    ReadRows<algorithmFPType, cpu> batchIndicesBD;
+    ReadRows<int, cpu> batchIndicesBD;
 
     if (batchIndicesNT)
     {
@@ -238,45 +301,62 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
 
     for (size_t iter = 0; iter < maxIterations; iter++)
     {
+        const int * batch = nullptr;
         if (batchIndicesNT)
         {
-            batchIndicesPtr[0] = batchIndicesBD.get()[iter];
+            batch = batchIndicesBD.get() + iter * batchSize;
         }
         else
         {
-            if (iter % 1024 == 0) rngTask.getWithReplacement(pValues);
-            batchIndicesPtr[0] = pValues[iter % 1024];
+            if (iter % nRngBatches == 0) rngTask.getWithReplacement(pValues);
+            batch = pValues + (iter % nRngBatches) * batchSize;
         }
-        const size_t displacement = batchIndicesPtr[0] * sizeArgument;
 
         iterationsPerformed = iter;
 
         if (learningRateLength != 0) stepLength = learningRateArray[iter % learningRateLength];
         const algorithmFPType inverse_stepLength = algorithmFPType(1.0) / stepLength;
 
-        s = function->computeNoThrow();
+        s = computeTermGradients<algorithmFPType, cpu>(tlsGradient, batch, batchSize, sizeArgument, batchGradients);
 
         if (!s || host.isCancelled(s, 1))
         {
+            tlsGradient.reduce([](SagaTermGradient<algorithmFPType, cpu> * termGradient) { delete termGradient; });
             *nIterationsPerformed.get() = iterationsPerformed;
             return s;
         }
 
-        if (iter == 0 && gradientsTableInput)
+        /* Average change of the gradients in the batch with respect to the saved ones */
+        for (size_t k = 0; k < sizeArgument; k++) batchStep[k] = 0;
+        for (size_t j = 0; j < batchSize; j++)
         {
-            gradientResultPtr = function->getResult()->get(optimization_solver::objective_function::gradientIdx);
-            hmgGradient       = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(gradientResultPtr.get());
-            gradientPtr.set(*gradientResultPtr, 0, sizeArgument);
-            DAAL_CHECK_BLOCK_STATUS(gradientPtr);
-            gradient = gradientPtr.get();
+            const algorithmFPType * gradient = batchGradients + j * sizeArgument;
+            const algorithmFPType * saved    = savedGradients + batch[j] * sizeArgument;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < sizeArgument; k++)
+            {
+                batchStep[k] += gradient[k] - saved[k];
+            }
         }
-        else
+
+        /* The sum of the saved gradients changes once for every distinct term in the batch */
+        for (size_t j = 0; j < batchSize; j++)
+        {
+            sortedIndices[j]   = batch[j];
+            sortedPositions[j] = (int)j;
+        }
+        if (batchSize > 1) daal::algorithms::internal::qSort<int, int, cpu>(batchSize, sortedIndices, sortedPositions);
+        for (size_t j = 0; j < batchSize; j++)
         {
-            if (!hmgGradient)
+            if (j > 0 && sortedIndices[j] == sortedIndices[j - 1]) continue;
+            const algorithmFPType * gradient = batchGradients + sortedPositions[j] * sizeArgument;
+            const algorithmFPType * saved    = savedGradients + sortedIndices[j] * sizeArgument;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < sizeArgument; k++)
             {
-                gradientPtr.set(*gradientResultPtr, 0, sizeArgument);
-                DAAL_CHECK_BLOCK_STATUS(gradientPtr);
-                gradient = gradientPtr.get();
+                summGrads[k] += gradient[k] - saved[k];
             }
         }
 
@@ -288,8 +368,7 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
         PRAGMA_VECTOR_ALWAYS
         for (size_t k = 0; k < sizeArgument; k++)
         {
-            summGrads[k] += (gradient[k] - savedGradients[displacement + k]);
-            workValue[k] = workValue[k] - stepLength * (gradient[k] - savedGradients[displacement + k] + summGrads[k] * inverse_n);
+            workValue[k] = workValue[k] - stepLength * (batchStep[k] * inverse_b + summGrads[k] * inverse_n);
             workValue[k] *= inverse_stepLength;
         }
 
@@ -334,10 +413,13 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
             break;
         }
 
-        result |= daal::services::internal::daal_memcpy_s(savedGradients + displacement, sizeArgument * sizeof(algorithmFPType), gradient,
-                                                          sizeArgument * sizeof(algorithmFPType));
+        for (size_t j = 0; j < batchSize; j++)
+        {
+            result |= daal::services::internal::daal_memcpy_s(savedGradients + batch[j] * sizeArgument, sizeArgument * sizeof(algorithmFPType),
+                                                              batchGradients + j * sizeArgument, sizeArgument * sizeof(algorithmFPType));
+        }
     }
-    gradientPtr.release();
+    tlsGradient.reduce([](SagaTermGradient<algorithmFPType, cpu> * termGradient) { delete termGradient; });
     proxPtr.release();
     *nIterationsPerformed.get() = iterationsPerformed + 1;
     return (!result) ? s : Status(ErrorMemoryCopyFailedInternal);
@@ -63,7 +63,9 @@ services::Status Parameter::check() const
     }
     if (batchIndices)
     {
-        DAAL_CHECK_STATUS(s, data_management::checkNumericTable(batchIndices.get(), "batchIndices", 0, 0, 1, nIterations));
+        /* Each row holds the indices of the terms used at one iteration. Before mini-batches were supported
+         * the table had a single column and batchSize was ignored when the indices were provided */
+        DAAL_CHECK_STATUS(s, data_management::checkNumericTable(batchIndices.get(), "batchIndices", 0, 0, batchSize, nIterations));
     }
     if (batchSize > function->sumOfFunctionsParameter->numberOfTerms || batchSize == 0)
         return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ArgumentName, batchSizeStr()));
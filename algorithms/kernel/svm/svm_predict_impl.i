@@ -28,6 +28,8 @@
 #include "service_numeric_table.h"
 #include "service_blas.h"
 #include "service_memory.h"
+#include "threading.h"
+#include "service_error_handling.h"
 
 namespace daal
 {
@@ -43,6 +45,207 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::services::internal;
 
+/**
+ * Base class for threading subtask that computes decision function values for a block of input vectors.
+ * Kernel function values are computed for the blocks of support vectors and are reduced to decision
+ * function values immediately, so the memory footprint of the subtask does not depend on the size of input data
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SubTask
+{
+public:
+    DAAL_NEW_DELETE();
+    virtual ~SubTask() {}
+
+    /**
+     * Computes decision function values for the block of input vectors
+     * \param[in]  startRow  Index of the first vector in the block
+     * \param[in]  nRows     Number of vectors in the block
+     * \param[in]  xTable    Input data set
+     * \param[in]  svTable   Support vectors
+     * \param[in]  svCoeff   Classification coefficients of support vectors
+     * \param[in]  bias      Bias of the decision function
+     * \param[out] distance  Decision function values for the block of input vectors
+     * \return status of the call
+     */
+    Status predict(size_t startRow, size_t nRows, const NumericTable * xTable, const NumericTable * svTable, const algorithmFPType * svCoeff,
+                   algorithmFPType bias, algorithmFPType * distance)
+    {
+        service_memset_seq<algorithmFPType, cpu>(distance, bias, nRows);
+
+        NumericTablePtr xBlock;
+        Status s = getXBlock(startRow, nRows, xTable, xBlock);
+        DAAL_CHECK_STATUS_VAR(s);
+        _kernel->getInput()->set(kernel_function::X, xBlock);
+
+        const size_t nSV = svTable->getNumberOfRows();
+        for (size_t startSV = 0; startSV < nSV; startSV += _nSVInBlock)
+        {
+            const size_t nSVInBlock = (startSV + _nSVInBlock > nSV) ? nSV - startSV : _nSVInBlock;
+
+            NumericTablePtr svBlock;
+            s = getSVBlock(startSV, nSVInBlock, svTable, svBlock);
+            DAAL_CHECK_STATUS_VAR(s);
+            _kernel->getInput()->set(kernel_function::Y, svBlock);
+
+            NumericTablePtr kernelValues = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_aBuf.get(), nSVInBlock, nRows, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            _kfResult->set(kernel_function::values, kernelValues);
+
+            s = _kernel->computeNoThrow();
+            if (!s) return Status(services::ErrorSVMPredictKernerFunctionCall).add(s); //this order is expected by test system
+
+            char trans  = 'T';
+            DAAL_INT m_ = nSVInBlock;
+            DAAL_INT n_ = nRows;
+            algorithmFPType alpha(1.0);
+            DAAL_INT lda = m_;
+            DAAL_INT incx(1);
+            algorithmFPType beta(1.0);
+            DAAL_INT incy(1);
+
+            Blas<algorithmFPType, cpu>::xxgemv(&trans, &m_, &n_, &alpha, _aBuf.get(), &lda, svCoeff + startSV, &incx, &beta, distance, &incy);
+        }
+        return s;
+    }
+
+protected:
+    /**
+     * Retrieves the block of rows of the input data set as a numeric table
+     * \param[in]  startRow  Index of the first row in the block
+     * \param[in]  nRows     Number of rows in the block
+     * \param[in]  xTable    Input data set
+     * \param[out] xBlock    Numeric table that contains the block of rows
+     * \return status of the call
+     */
+    virtual Status getXBlock(size_t startRow, size_t nRows, const NumericTable * xTable, NumericTablePtr & xBlock) = 0;
+
+    /**
+     * Retrieves the block of support vectors as a numeric table
+     * \param[in]  startRow  Index of the first support vector in the block
+     * \param[in]  nRows     Number of support vectors in the block
+     * \param[in]  svTable   Support vectors
+     * \param[out] svBlock   Numeric table that contains the block of support vectors
+     * \return status of the call
+     */
+    virtual Status getSVBlock(size_t startRow, size_t nRows, const NumericTable * svTable, NumericTablePtr & svBlock) = 0;
+
+    /**
+     * Constructs a base threading subtask
+     * \param[in]  nRowsInBlock  Maximum number of input vectors processed in the iteration of a threader_for loop
+     * \param[in]  nSVInBlock    Maximum number of support vectors the kernel function is computed for at once
+     * \param[in]  kernel        Kernel function
+     * \param[out] valid         Flag. True if the task was constructed successfully, false otherwise
+     */
+    SubTask(size_t nRowsInBlock, size_t nSVInBlock, const kernel_function::KernelIfacePtr & kernel, bool & valid)
+        : _nSVInBlock(nSVInBlock), _aBuf(nRowsInBlock * nSVInBlock), _kernel(kernel->clone()), _kfResult(new kernel_function::Result())
+    {
+        if (!_aBuf.get() || !_kernel || !_kfResult)
+        {
+            valid = false;
+            return;
+        }
+        _kernel->setResult(_kfResult);
+        _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+    }
+
+private:
+    const size_t _nSVInBlock;
+    TArray<algorithmFPType, cpu> _aBuf; /*!< Kernel function values for the blocks of input and support vectors */
+    kernel_function::KernelIfacePtr _kernel;
+    kernel_function::ResultPtr _kfResult;
+};
+
+/** Class for threading subtask that works with dense input data */
+template <typename algorithmFPType, CpuType cpu>
+class SubTaskDense : public SubTask<algorithmFPType, cpu>
+{
+public:
+    typedef SubTask<algorithmFPType, cpu> super;
+
+    static super * create(size_t nRowsInBlock, size_t nSVInBlock, const kernel_function::KernelIfacePtr & kernel)
+    {
+        bool valid  = true;
+        super * res = new SubTaskDense(nRowsInBlock, nSVInBlock, kernel, valid);
+        if (res && valid) return res;
+        delete res;
+        return nullptr;
+    }
+
+protected:
+    Status getXBlock(size_t startRow, size_t nRows, const NumericTable * xTable, NumericTablePtr & xBlock) DAAL_C11_OVERRIDE
+    {
+        return getDataBlock(_xRows, startRow, nRows, xTable, xBlock);
+    }
+    Status getSVBlock(size_t startRow, size_t nRows, const NumericTable * svTable, NumericTablePtr & svBlock) DAAL_C11_OVERRIDE
+    {
+        return getDataBlock(_svRows, startRow, nRows, svTable, svBlock);
+    }
+
+private:
+    SubTaskDense(size_t nRowsInBlock, size_t nSVInBlock, const kernel_function::KernelIfacePtr & kernel, bool & valid)
+        : super(nRowsInBlock, nSVInBlock, kernel, valid)
+    {}
+
+    static Status getDataBlock(ReadRows<algorithmFPType, cpu> & rows, size_t startRow, size_t nRows, const NumericTable * a, NumericTablePtr & block)
+    {
+        rows.set(const_cast<NumericTable *>(a), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(rows);
+        Status s;
+        block = HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType *>(rows.get()), a->getNumberOfColumns(), nRows, &s);
+        return s;
+    }
+
+    ReadRows<algorithmFPType, cpu> _xRows;
+    ReadRows<algorithmFPType, cpu> _svRows;
+};
+
+/** Class for threading subtask that works with CSR input data */
+template <typename algorithmFPType, CpuType cpu>
+class SubTaskCSR : public SubTask<algorithmFPType, cpu>
+{
+public:
+    typedef SubTask<algorithmFPType, cpu> super;
+
+    static super * create(size_t nRowsInBlock, size_t nSVInBlock, const kernel_function::KernelIfacePtr & kernel)
+    {
+        bool valid  = true;
+        super * res = new SubTaskCSR(nRowsInBlock, nSVInBlock, kernel, valid);
+        if (res && valid) return res;
+        delete res;
+        return nullptr;
+    }
+
+protected:
+    Status getXBlock(size_t startRow, size_t nRows, const NumericTable * xTable, NumericTablePtr & xBlock) DAAL_C11_OVERRIDE
+    {
+        return getDataBlock(_xRows, startRow, nRows, xTable, xBlock);
+    }
+    Status getSVBlock(size_t startRow, size_t nRows, const NumericTable * svTable, NumericTablePtr & svBlock) DAAL_C11_OVERRIDE
+    {
+        return getDataBlock(_svRows, startRow, nRows, svTable, svBlock);
+    }
+
+private:
+    SubTaskCSR(size_t nRowsInBlock, size_t nSVInBlock, const kernel_function::KernelIfacePtr & kernel, bool & valid)
+        : super(nRowsInBlock, nSVInBlock, kernel, valid)
+    {}
+
+    static Status getDataBlock(ReadRowsCSR<algorithmFPType, cpu> & rows, size_t startRow, size_t nRows, const NumericTable * a,
+                               NumericTablePtr & block)
+    {
+        rows.set(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(a)), startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(rows);
+        Status s;
+        block = CSRNumericTable::create(const_cast<algorithmFPType *>(rows.values()), const_cast<size_t *>(rows.cols()),
+                                        const_cast<size_t *>(rows.rows()), a->getNumberOfColumns(), nRows, CSRNumericTableIface::oneBased, &s);
+        return s;
+    }
+
+    ReadRowsCSR<algorithmFPType, cpu> _xRows;
+    ReadRowsCSR<algorithmFPType, cpu> _svRows;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
 {
@@ -58,11 +261,11 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
         kernel_function::KernelIfacePtr kernel;
         {
             svm::interface1::Parameter * parameter = dynamic_cast<svm::interface1::Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
-            if (parameter) kernel = parameter->kernel->clone();
+            if (parameter) kernel = parameter->kernel;
         }
         {
             svm::interface2::Parameter * parameter = dynamic_cast<svm::interface2::Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
-            if (parameter) kernel = parameter->kernel->clone();
+            if (parameter) kernel = parameter->kernel;
         }
         DAAL_CHECK(kernel, ErrorNullParameterNotSupported);
 
@@ -85,39 +288,41 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
         DAAL_CHECK_BLOCK_STATUS(mtSVCoeff);
         const algorithmFPType * svCoeff = mtSVCoeff.get();
 
-        TArray<algorithmFPType, cpu> aBuf(nSV * nVectors);
-        DAAL_CHECK(aBuf.get(), ErrorMemoryAllocationFailed);
-        algorithmFPType * buf = aBuf.get();
+        /* Kernel function values are computed by tiles of nRowsInBlock input vectors and nSVInBlock support vectors,
+           hence the memory required by a thread does not depend on the number of input and support vectors */
+        const size_t nRowsInBlock = 256;
+        const size_t nSVInBlock   = (nSV < 1024 ? nSV : 1024);
+        size_t nBlocks            = nVectors / nRowsInBlock;
+        if (nBlocks * nRowsInBlock < nVectors) nBlocks++;
 
-        Status s;
-        NumericTablePtr shResNT = HomogenNumericTableCPU<algorithmFPType, cpu>::create(buf, nSV, nVectors, &s);
-        DAAL_CHECK_STATUS_VAR(s);
+        const NumericTable * x  = xTable.get();
+        const NumericTable * sv = svTable.get();
+        /* SubTaskCSR reads both tables through CSRNumericTableIface. When only one of them is CSR the dense subtask is used:
+           a CSR table returns its rows in the dense format */
+        const bool bCSR = (x->getDataLayout() == NumericTableIface::csrArray) && (sv->getDataLayout() == NumericTableIface::csrArray);
 
-        auto kfResultPtr = new kernel_function::Result();
-        DAAL_CHECK_MALLOC(kfResultPtr)
-        kernel_function::ResultPtr shRes(kfResultPtr);
-        shRes->set(kernel_function::values, shResNT);
-        kernel->setResult(shRes);
-        kernel->getInput()->set(kernel_function::X, xTable);
-        kernel->getInput()->set(kernel_function::Y, svTable);
-        kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
-        s                                       = kernel->computeNoThrow();
-        if (!s) return Status(services::ErrorSVMPredictKernerFunctionCall).add(s); //this order is expected by test system
-
-        char trans  = 'T';
-        DAAL_INT m_ = nSV;
-        DAAL_INT n_ = nVectors;
-        algorithmFPType alpha(1.0);
-        DAAL_INT lda = m_;
-        DAAL_INT incx(1);
-        algorithmFPType beta(1.0);
-        DAAL_INT incy(1);
-
-        service_memset<algorithmFPType, cpu>(distance, bias, nVectors);
-
-        Blas<algorithmFPType, cpu>::xgemv(&trans, &m_, &n_, &alpha, buf, &lda, svCoeff, &incx, &beta, distance, &incy);
+        typedef SubTask<algorithmFPType, cpu> TSubTask;
+        daal::ls<TSubTask *> lsTask([=, &kernel]() {
+            if (bCSR) return SubTaskCSR<algorithmFPType, cpu>::create(nRowsInBlock, nSVInBlock, kernel);
+            return SubTaskDense<algorithmFPType, cpu>::create(nRowsInBlock, nSVInBlock, kernel);
+        });
 
-        return s;
+        /* Process input data set block by block */
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            TSubTask * local = lsTask.local();
+            DAAL_CHECK_MALLOC_THR(local);
+            DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
+
+            const size_t startRow = iBlock * nRowsInBlock;
+            const size_t nRows    = (startRow + nRowsInBlock > nVectors) ? nVectors - startRow : nRowsInBlock;
+
+            Status s = local->predict(startRow, nRows, x, sv, svCoeff, bias, distance + startRow);
+            DAAL_CHECK_STATUS_THR(s);
+        });
+
+        lsTask.reduce([](TSubTask * local) { delete local; });
+        return safeStat.detach();
     }
 };
 
@@ -24,6 +24,7 @@
 #include "svm_train.h"
 #include "svm_train_kernel.h"
 #include "svm_train_boser_kernel.h"
+#include "svm_train_thunder_kernel.h"
 #include "classifier_training_types.h"
 
 namespace daal
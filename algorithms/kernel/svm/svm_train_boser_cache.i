@@ -359,6 +359,214 @@ protected:
     services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable;
 };
 
+/**
+ * LRU cache: the rows of kernel matrix that fit into cache are stored;
+ * the least recently used row is replaced when the requested row is not in cache
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVMCache<lruCache, algorithmFPType, cpu> : public SVMCacheImpl<algorithmFPType, cpu>
+{
+    typedef SVMCacheImpl<algorithmFPType, cpu> super;
+    typedef SVMCache<lruCache, algorithmFPType, cpu> this_type;
+    using super::_cache;
+    using super::_kernel;
+    using super::_lineSize;
+    using super::_shrinkingRowIndices;
+    using super::_doShrinking;
+
+public:
+    DAAL_NEW_DELETE();
+    /**
+     * Constructs LRU cache
+     *
+     * \param[in] cacheSize     Size of cache in bytes
+     * \param[in] lineSize      Number of elements in the cache line
+     * \param[in] doShrinking   Flag that enables use of the shrinking optimization technique
+     * \param[in] xTable        Input data set
+     * \param[in] kernel        Kernel function
+     */
+    static SVMCache * create(size_t cacheSize, size_t lineSize, bool doShrinking, const NumericTablePtr & xTable,
+                             const kernel_function::KernelIfacePtr & kernel, Status & s)
+    {
+        s.clear();
+        this_type * res = new this_type(lineSize, doShrinking, xTable, kernel);
+        if (!res)
+            s.add(ErrorMemoryAllocationFailed);
+        else
+        {
+            s = res->init(cacheSize, xTable);
+            if (!s)
+            {
+                delete res;
+                res = nullptr;
+            }
+        }
+        return res;
+    }
+
+    virtual Status getRowBlock(size_t rowIndex, size_t startColIndex, size_t blockSize, const algorithmFPType *& block) DAAL_C11_OVERRIDE
+    {
+        /* Single values, e.g. the diagonal of the matrix Q, are computed without loading the whole row into cache */
+        if (blockSize == 1 && _lineIndices[rowIndex] < 0) return getValue(rowIndex, startColIndex, block);
+
+        const algorithmFPType * line = nullptr;
+        Status s                     = getLine(rowIndex, line);
+        block                        = line + startColIndex;
+        return s;
+    }
+
+    virtual Status getTwoRowsBlock(size_t rowIndex1, size_t rowIndex2, size_t startColIndex, size_t blockSize, const algorithmFPType *& block1,
+                                   const algorithmFPType *& block2) DAAL_C11_OVERRIDE
+    {
+        /* The cache has at least two lines, so the second row does not replace the most recently used first one */
+        const algorithmFPType * line1 = nullptr;
+        const algorithmFPType * line2 = nullptr;
+        Status s                      = getLine(rowIndex1, line1);
+        if (s) s = getLine(rowIndex2, line2);
+        block1 = line1 + startColIndex;
+        block2 = line2 + startColIndex;
+        return s;
+    }
+
+    virtual Status updateShrinkingRowIndices(size_t nActiveVectors, const char * I) DAAL_C11_OVERRIDE;
+
+    ~SVMCache() {}
+
+protected:
+    /**
+     * Constructs the cache that stores the least recently used rows of kernel matrix
+     *
+     * \param[in] lineSize      Number of elements in the cache line
+     * \param[in] doShrinking   Flag that enables use of the shrinking optimization technique
+     * \param[in] xTable        Input data set
+     * \param[in] kernel        Kernel function
+     */
+    SVMCache(size_t lineSize, bool doShrinking, const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel)
+        : super(lineSize, doShrinking, kernel), _nLines(0), _head(-1), _tail(-1)
+    {}
+
+    Status init(size_t cacheSize, const NumericTablePtr & xTable)
+    {
+        Status s = super::init();
+        if (!s) return s;
+        _nLines = cacheSize / (_lineSize * sizeof(algorithmFPType));
+        if (_nLines < 2) _nLines = 2;
+        if (_nLines > _lineSize) _nLines = _lineSize;
+
+        _cache.reset(_nLines * _lineSize);
+        _row.reset(_lineSize);
+        _lineIndices.reset(_lineSize);
+        _rowIndices.reset(_nLines);
+        _prev.reset(_nLines);
+        _next.reset(_nLines);
+        DAAL_CHECK_MALLOC(_cache.get() && _row.get() && _lineIndices.get() && _rowIndices.get() && _prev.get() && _next.get());
+
+        /* All the lines are empty and linked into the list in the order of their use */
+        for (size_t i = 0; i < _lineSize; i++) _lineIndices[i] = -1;
+        for (size_t i = 0; i < _nLines; i++)
+        {
+            _rowIndices[i] = _lineSize;
+            _prev[i]       = (int)i - 1;
+            _next[i]       = (i + 1 < _nLines) ? (int)i + 1 : -1;
+        }
+        _head = 0;
+        _tail = (int)_nLines - 1;
+
+        _cacheTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_row.get(), 1, _lineSize, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        _kernel->getInput()->set(kernel_function::X, xTable);
+        _kernel->getInput()->set(kernel_function::Y, xTable);
+
+        auto kfResultPtr = new kernel_function::Result();
+        DAAL_CHECK_MALLOC(kfResultPtr)
+        kernel_function::ResultPtr shRes(kfResultPtr);
+        shRes->set(kernel_function::values, _cacheTable);
+        _kernel->setResult(shRes);
+        return s;
+    }
+
+    /**
+     * Returns the cache line with the row of kernel matrix and makes it the most recently used one.
+     * The least recently used line is replaced with the requested row if the row is not in cache
+     */
+    Status getLine(size_t rowIndex, const algorithmFPType *& line)
+    {
+        int iLine = _lineIndices[rowIndex];
+        Status s;
+        if (iLine < 0)
+        {
+            iLine = _head;
+            if (_rowIndices[iLine] < _lineSize) _lineIndices[_rowIndices[iLine]] = -1;
+            _rowIndices[iLine] = _lineSize;
+
+            s = computeLine(rowIndex, _cache.get() + iLine * _lineSize);
+            if (s)
+            {
+                _rowIndices[iLine]     = rowIndex;
+                _lineIndices[rowIndex] = iLine;
+            }
+        }
+        moveToTail(iLine);
+        line = _cache.get() + iLine * _lineSize;
+        return s;
+    }
+
+    /* Computes the row of kernel matrix with the columns ordered as the rows of the matrix Q */
+    Status computeLine(size_t rowIndex, algorithmFPType * line)
+    {
+        kernel_function::ParameterBase * par = _kernel->getParameter();
+        par->computationMode                 = kernel_function::matrixVector;
+        par->rowIndexX                       = 0;
+        par->rowIndexY                       = this->getDataRowIndex(rowIndex);
+        par->rowIndexResult                  = 0;
+        _cacheTable->setArray(_doShrinking ? _row.get() : line, _cacheTable->getNumberOfRows());
+        Status s = _kernel->computeNoThrow();
+        if (s && _doShrinking)
+        {
+            for (size_t j = 0; j < _lineSize; j++) line[j] = _row[_shrinkingRowIndices[j]];
+        }
+        return s;
+    }
+
+    Status getValue(size_t rowIndex, size_t colIndex, const algorithmFPType *& value)
+    {
+        kernel_function::ParameterBase * par = _kernel->getParameter();
+        par->computationMode                 = kernel_function::vectorVector;
+        par->rowIndexX                       = this->getDataRowIndex(colIndex);
+        par->rowIndexY                       = this->getDataRowIndex(rowIndex);
+        par->rowIndexResult                  = 0;
+        _cacheTable->setArray(_row.get(), _cacheTable->getNumberOfRows());
+        value = _row.get();
+        return _kernel->computeNoThrow();
+    }
+
+    void moveToTail(int iLine)
+    {
+        if (iLine == _tail) return;
+        if (_prev[iLine] >= 0)
+            _next[_prev[iLine]] = _next[iLine];
+        else
+            _head = _next[iLine];
+        _prev[_next[iLine]] = _prev[iLine];
+
+        _prev[iLine] = _tail;
+        _next[iLine] = -1;
+        _next[_tail] = iLine;
+        _tail        = iLine;
+    }
+
+protected:
+    size_t _nLines;                    /*!< Number of the rows of kernel matrix stored in cache */
+    TArray<algorithmFPType, cpu> _row; /*!< Buffer for the row of kernel matrix in the order of the input data set */
+    TArray<int, cpu> _lineIndices;     /*!< Indices of the cache lines that store the rows of the matrix Q, -1 if the row is not in cache */
+    TArray<size_t, cpu> _rowIndices;   /*!< Indices of the rows of the matrix Q stored in the cache lines */
+    TArray<int, cpu> _prev;            /*!< Previous line in the list of cache lines ordered by the time of use */
+    TArray<int, cpu> _next;            /*!< Next line in the list of cache lines ordered by the time of use */
+    int _head;                         /*!< Least recently used cache line */
+    int _tail;                         /*!< Most recently used cache line */
+    services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable;
+};
+
 } // namespace internal
 
 } // namespace training
@@ -833,6 +833,10 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setup(const ParameterT
     {
         _cache = SVMCache<simpleCache, algorithmFPType, cpu>::create(_nVectors, svmPar.doShrinking, xTable, kernel, s);
     }
+    else if (cacheSize >= 2 * _nVectors * sizeof(algorithmFPType))
+    {
+        _cache = SVMCache<lruCache, algorithmFPType, cpu>::create(cacheSize, _nVectors, svmPar.doShrinking, xTable, kernel, s);
+    }
     else
     {
         cacheSize = kernelFunctionBlockSize;
@@ -988,6 +992,46 @@ Status SVMCache<simpleCache, algorithmFPType, cpu>::updateShrinkingRowIndices(si
     }
     return (!result) ? Status() : Status(ErrorMemoryCopyFailedInternal);
 }
+
+/**
+ * \brief Move the indices of the shrunk feature vector to the end of the array and
+ *        re-order the cached rows and their columns accordingly
+ *
+ * \param[in] nActiveVectors Number of observations in a training data set that are used
+ *                           in sequential minimum optimization at the current iteration
+ * \param[in] I              Array of flags that describe the status of feature vectors
+ * \return                   Status of the call
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVMCache<lruCache, algorithmFPType, cpu>::updateShrinkingRowIndices(size_t nActiveVectors, const char * I)
+{
+    size_t i = 0;
+    size_t j = nActiveVectors - 1;
+    while (i < j)
+    {
+        while (!(I[i] & shrink) && i < nActiveVectors - 1) i++;
+        while ((I[j] & shrink) && j > 0) j--;
+        if (i >= j) break;
+        daal::services::internal::swap<cpu, size_t>(_shrinkingRowIndices[i], _shrinkingRowIndices[j]);
+
+        /* Swap the lines that store i-th and j-th row */
+        daal::services::internal::swap<cpu, int>(_lineIndices[i], _lineIndices[j]);
+        if (_lineIndices[i] >= 0) _rowIndices[_lineIndices[i]] = i;
+        if (_lineIndices[j] >= 0) _rowIndices[_lineIndices[j]] = j;
+
+        /* Swap i-th and j-th column in the cached rows */
+        for (size_t k = 0; k < _nLines; k++)
+        {
+            if (_rowIndices[k] < _lineSize)
+            {
+                daal::services::internal::swap<cpu, algorithmFPType>(_cache[k * _lineSize + i], _cache[k * _lineSize + j]);
+            }
+        }
+        i++;
+        j--;
+    }
+    return Status();
+}
 } // namespace internal
 } // namespace training
 } // namespace svm
@@ -0,0 +1,570 @@
+/* file: svm_train_thunder_impl.i */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  SVM training algorithm implementation with the thunder method
+//--
+*/
+/*
+//  DESCRIPTION
+//
+//  Definition of the functions for training with SVM 2-class classifier.
+//  At each iteration the working set of many violating variables is selected,
+//  the block of kernel matrix is computed at once with the kernel function,
+//  the sub-problem on the working set is solved with SMO and the gradient
+//  is updated for all the observations in parallel.
+//
+//  REFERENCES
+//
+//  1. Zeyi Wen, Jiashuai Shi, Qinbin Li, Bingsheng He, Jian Chen,
+//     ThunderSVM: A Fast SVM Library on GPUs and CPUs,
+//     Journal of Machine Learning Research 19 (2018), pp. 1-5
+//  2. Rong-En Fan, Pai-Hsuen Chen, Chih-Jen Lin,
+//     Working Set Selection Using Second Order Information
+//     for Training Support Vector Machines,
+//     Journal of Machine Learning Research 6 (2005), pp. 1889___1918
+*/
+
+#ifndef __SVM_TRAIN_THUNDER_IMPL_I__
+#define __SVM_TRAIN_THUNDER_IMPL_I__
+
+#include "threading.h"
+#include "service_heap.h"
+#include "svm_train_boser_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+services::Status SVMTrainImpl<thunder, algorithmFPType, ParameterType, cpu>::compute(const NumericTablePtr & xTable, NumericTable & yTable,
+                                                                                     daal::algorithms::Model * r, const ParameterType * svmPar)
+{
+    SVMThunderTask<algorithmFPType, ParameterType, cpu> task(xTable->getNumberOfRows());
+    Status s = task.setup(*svmPar, xTable, yTable);
+    if (!s) return s;
+    s = task.compute(*svmPar, xTable);
+    return s.ok() ? task.setResultsToModel(*xTable, *static_cast<Model *>(r), svmPar->C) : s;
+}
+
+/**
+ * \brief Construct the structure that stores the intermediate data used in SVM training
+ *
+ * \param[in] svmPar        Parameters of the algorithm
+ * \param[in] xTable        Pointer to numeric table that contains input data set
+ * \param[in] yTable        Pointer to numeric table that contains class labels
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMThunderTask<algorithmFPType, ParameterType, cpu>::setup(const ParameterType & svmPar, const NumericTablePtr & xTable,
+                                                                  NumericTable & yTable)
+{
+    /* The blocks of the matrix Q are computed explicitly, so the cache is used only to get the kernel diagonal */
+    ParameterType par(svmPar);
+    par.cacheSize   = 0;
+    par.doShrinking = false;
+    Status s        = super::setup(par, xTable, yTable);
+    if (!s) return s;
+
+    _inWS.reset(_nVectors);
+    DAAL_CHECK_MALLOC(_inWS.get());
+    services::internal::service_memset<char, cpu>(_inWS.get(), 0, _nVectors);
+    _kernel = svmPar.kernel->clone();
+    DAAL_CHECK_MALLOC(_kernel.get());
+    return s;
+}
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMThunderTask<algorithmFPType, ParameterType, cpu>::compute(const ParameterType & svmPar, const NumericTablePtr & xTable)
+{
+    const algorithmFPType C(svmPar.C);
+    const algorithmFPType eps(svmPar.accuracyThreshold);
+    const algorithmFPType tau(svmPar.tau);
+    Status s = this->init(C);
+    if (!s) return s;
+
+    /* Size of the working set is the largest power of 2 that does not exceed the number of observations */
+    size_t nWS = maxWorkingSetSize;
+    while (nWS > _nVectors) nWS >>= 1;
+
+    /* The block of the matrix Q used to update the gradient fits into the cache */
+    size_t blockSize = svmPar.cacheSize / (nWS * sizeof(algorithmFPType));
+    if (blockSize < kernelBlockRowsSize) blockSize = kernelBlockRowsSize;
+    if (blockSize > _nVectors) blockSize = _nVectors;
+
+    _kernelBlock.reset(nWS * (blockSize > nWS ? blockSize : nWS));
+    _wsBuffer.reset(4 * nWS);
+    _upCandidates.reset(nWS);
+    _lowCandidates.reset(nWS);
+    TArray<int, cpu> wsIndicesArr(nWS);
+    TArray<algorithmFPType, cpu> deltaAlphaArr(nWS);
+    DAAL_CHECK_MALLOC(_kernelBlock.get() && _wsBuffer.get() && _upCandidates.get() && _lowCandidates.get() && wsIndicesArr.get()
+                      && deltaAlphaArr.get());
+    int * const wsIndices              = wsIndicesArr.get();
+    algorithmFPType * const deltaAlpha = deltaAlphaArr.get();
+
+    _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+
+    for (size_t iter = 0; iter < svmPar.maxIterations;)
+    {
+        size_t nSelected           = 0;
+        const algorithmFPType diff = selectWorkingSet(nWS, wsIndices, nSelected);
+        if (diff < eps || nSelected < 2) break;
+
+        NumericTablePtr wsTable;
+        DAAL_CHECK_STATUS(s, copyWorkingSetRows(*xTable, wsIndices, nSelected, wsTable));
+        DAAL_CHECK_STATUS(s, computeKernelBlock(wsTable, wsTable, _kernelBlock.get()));
+
+        /* The sub-problem is solved with the accuracy relative to the violation of the optimality condition */
+        const algorithmFPType localEps = (algorithmFPType(0.1) * diff > eps) ? algorithmFPType(0.1) * diff : eps;
+        size_t maxIterations           = maxLocalIterations * nSelected;
+        if (maxIterations > svmPar.maxIterations - iter) maxIterations = svmPar.maxIterations - iter;
+
+        const size_t nIterations = solveLocal(wsIndices, nSelected, _kernelBlock.get(), C, localEps, tau, maxIterations, deltaAlpha);
+        if (!nIterations) break;
+        iter += nIterations;
+
+        DAAL_CHECK_STATUS(s, updateGradient(*xTable, wsTable, wsIndices, nSelected, deltaAlpha, blockSize));
+    }
+    return s;
+}
+
+/**
+ * \brief Keep the nMax candidates that go first in the order defined by the comparison.
+ *        When nMax candidates are collected they form a heap with the last of them at the top,
+ *        so a candidate is added in O(log(nMax)) operations
+ *
+ * \param[in,out] heap      Collected candidates
+ * \param[in,out] n         Number of the collected candidates
+ * \param[in]     nMax      Maximal number of the candidates
+ * \param[in]     c         New candidate
+ * \param[in]     compare   Comparison that returns true if the first candidate goes before the second one
+ */
+template <CpuType cpu, typename Candidate, typename Compare>
+DAAL_FORCEINLINE void addCandidate(Candidate * heap, size_t & n, size_t nMax, const Candidate & c, Compare compare)
+{
+    if (n < nMax)
+    {
+        heap[n++] = c;
+        if (n == nMax) daal::algorithms::internal::makeMaxHeap<cpu>(heap, heap + n, compare);
+    }
+    else if (compare(c, heap[0]))
+    {
+        heap[0] = c;
+        daal::algorithms::internal::internalAdjustMaxHeap<cpu>(heap, heap + n, n, size_t(0), compare);
+    }
+}
+
+/**
+ * \brief Sort the candidates collected by addCandidate in the order defined by the comparison
+ */
+template <CpuType cpu, typename Candidate, typename Compare>
+DAAL_FORCEINLINE void sortCandidates(Candidate * heap, size_t n, size_t nMax, Compare compare)
+{
+    if (n < nMax) daal::algorithms::internal::makeMaxHeap<cpu>(heap, heap + n, compare);
+    daal::algorithms::internal::sortMaxHeap<cpu>(heap, heap + n, compare);
+}
+
+/**
+ * \brief Select the working set of the variables that violate the optimality condition the most.
+ *        The variables with the largest values of -y[i]*grad[i] from I_up(alpha) and the variables
+ *        with the smallest values of -y[i]*grad[i] from I_low(alpha) are taken alternately.
+ *        At most nWS variables of each kind can be taken, so only nWS best candidates of each kind are kept
+ *        instead of sorting all the observations
+ *
+ * \param[in]  nWS          maximal number of the variables in the working set
+ * \param[out] wsIndices    indices of the selected variables
+ * \param[out] nSelected    number of the selected variables
+ *
+ * \return The function returns m(alpha) - M(alpha) where
+ *              m(alpha) = max(-y[i]*grad[i]): i belongs to I_up(alpha)
+ *              M(alpha) = min(-y[i]*grad[i]): i belongs to I_low(alpha)
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+algorithmFPType SVMThunderTask<algorithmFPType, ParameterType, cpu>::selectWorkingSet(size_t nWS, int * wsIndices, size_t & nSelected)
+{
+    const char * I               = _I.get();
+    const algorithmFPType * grad = _grad.get();
+    const algorithmFPType * y    = _y.get();
+    Candidate * upCandidates     = _upCandidates.get();
+    Candidate * lowCandidates    = _lowCandidates.get();
+    char * inWS                  = _inWS.get();
+
+    auto upFirst  = [](const Candidate & a, const Candidate & b) -> bool { return a.key > b.key; };
+    auto lowFirst = [](const Candidate & a, const Candidate & b) -> bool { return a.key < b.key; };
+
+    size_t nUp  = 0;
+    size_t nLow = 0;
+    for (size_t i = 0; i < _nVectors; i++)
+    {
+        const Candidate c = { -y[i] * grad[i], (int)i };
+        if (I[i] & up) addCandidate<cpu>(upCandidates, nUp, nWS, c, upFirst);
+        if (I[i] & low) addCandidate<cpu>(lowCandidates, nLow, nWS, c, lowFirst);
+    }
+    sortCandidates<cpu>(upCandidates, nUp, nWS, upFirst);
+    sortCandidates<cpu>(lowCandidates, nLow, nWS, lowFirst);
+
+    const algorithmFPType fpMax = MaxVal<algorithmFPType>::get();
+    const algorithmFPType ma    = nUp ? upCandidates[0].key : -fpMax;
+    const algorithmFPType Ma    = nLow ? lowCandidates[0].key : fpMax;
+
+    nSelected   = 0;
+    size_t iUp  = 0;
+    size_t iLow = 0;
+    bool found  = true;
+    while (found && nSelected < nWS)
+    {
+        found = false;
+        while (iUp < nUp)
+        {
+            const int i = upCandidates[iUp++].index;
+            if (!inWS[i])
+            {
+                inWS[i]                = 1;
+                wsIndices[nSelected++] = i;
+                found                  = true;
+                break;
+            }
+        }
+        while (iLow < nLow && nSelected < nWS)
+        {
+            const int i = lowCandidates[iLow++].index;
+            if (!inWS[i])
+            {
+                inWS[i]                = 1;
+                wsIndices[nSelected++] = i;
+                found                  = true;
+                break;
+            }
+        }
+    }
+    for (size_t i = 0; i < nSelected; i++) inWS[wsIndices[i]] = 0;
+    return ma - Ma;
+}
+
+/**
+ * \brief Copy the feature vectors of the working set into the numeric table of the same layout as the input data set
+ *
+ * \param[in]  xTable       Input data set
+ * \param[in]  wsIndices    Indices of the variables in the working set
+ * \param[in]  nWS          Number of the variables in the working set
+ * \param[out] wsTable      Numeric table with the feature vectors of the working set
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMThunderTask<algorithmFPType, ParameterType, cpu>::copyWorkingSetRows(const NumericTable & xTable, const int * wsIndices, size_t nWS,
+                                                                               NumericTablePtr & wsTable)
+{
+    const size_t nFeatures = xTable.getNumberOfColumns();
+    Status s;
+    if (xTable.getDataLayout() == NumericTableIface::csrArray)
+    {
+        CSRNumericTableIface * csrIface = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&xTable));
+        ReadRowsCSR<algorithmFPType, cpu> mtX;
+
+        _wsRowOffsets.reset(nWS + 1);
+        DAAL_CHECK_MALLOC(_wsRowOffsets.get());
+        size_t * rowOffsets = _wsRowOffsets.get();
+        rowOffsets[0]       = 1;
+        for (size_t i = 0; i < nWS; i++)
+        {
+            mtX.set(csrIface, wsIndices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(mtX);
+            rowOffsets[i + 1] = rowOffsets[i] + (mtX.rows()[1] - mtX.rows()[0]);
+        }
+
+        const size_t dataSize = rowOffsets[nWS] - rowOffsets[0];
+        _wsData.reset(dataSize);
+        _wsColIndices.reset(dataSize);
+        DAAL_CHECK_MALLOC(_wsData.get() && _wsColIndices.get());
+        for (size_t i = 0; i < nWS; i++)
+        {
+            mtX.set(csrIface, wsIndices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(mtX);
+            const size_t offset              = rowOffsets[i] - 1;
+            const size_t nNonZeroValuesInRow = rowOffsets[i + 1] - rowOffsets[i];
+            for (size_t j = 0; j < nNonZeroValuesInRow; j++)
+            {
+                _wsData[offset + j]       = mtX.values()[j];
+                _wsColIndices[offset + j] = mtX.cols()[j];
+            }
+        }
+        wsTable = CSRNumericTable::create(_wsData.get(), _wsColIndices.get(), rowOffsets, nFeatures, nWS, CSRNumericTableIface::oneBased, &s);
+    }
+    else
+    {
+        _wsData.reset(nWS * nFeatures);
+        DAAL_CHECK_MALLOC(_wsData.get());
+        ReadRows<algorithmFPType, cpu> mtX;
+        for (size_t i = 0; i < nWS; i++)
+        {
+            mtX.set(const_cast<NumericTable *>(&xTable), wsIndices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(mtX);
+            const algorithmFPType * xi = mtX.get();
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                _wsData[i * nFeatures + j] = xi[j];
+            }
+        }
+        wsTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_wsData.get(), nFeatures, nWS, &s);
+    }
+    return s;
+}
+
+/**
+ * \brief Compute the block of kernel function values K(a[i], b[j]) with a single call of the kernel function
+ *
+ * \param[in]  aTable       Feature vectors that correspond to the rows of the block
+ * \param[in]  bTable       Feature vectors that correspond to the columns of the block
+ * \param[out] result       Block of kernel function values
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMThunderTask<algorithmFPType, ParameterType, cpu>::computeKernelBlock(const NumericTablePtr & aTable, const NumericTablePtr & bTable,
+                                                                               algorithmFPType * result)
+{
+    Status s;
+    NumericTablePtr resultTable =
+        HomogenNumericTableCPU<algorithmFPType, cpu>::create(result, bTable->getNumberOfRows(), aTable->getNumberOfRows(), &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    _kernel->getInput()->set(kernel_function::X, aTable);
+    _kernel->getInput()->set(kernel_function::Y, bTable);
+
+    auto kfResultPtr = new kernel_function::Result();
+    DAAL_CHECK_MALLOC(kfResultPtr)
+    kernel_function::ResultPtr shRes(kfResultPtr);
+    shRes->set(kernel_function::values, resultTable);
+    _kernel->setResult(shRes);
+    return _kernel->computeNoThrow();
+}
+
+/**
+ * \brief Solve the sub-problem on the working set with SMO algorithm using WSS 3 from [2].
+ *        The values of alpha are updated, the changes of alpha are returned to update the gradient.
+ *
+ * \param[in]  wsIndices      Indices of the variables in the working set
+ * \param[in]  nWS            Number of the variables in the working set
+ * \param[in]  kernelWS       Kernel function values for the pairs of the feature vectors in the working set
+ * \param[in]  C              Upper bound in constraints of the quadratic optimization problem
+ * \param[in]  eps            Accuracy of the sub-problem solution
+ * \param[in]  tau            Parameter of the working set selection algorithm
+ * \param[in]  maxIterations  Maximal number of iterations
+ * \param[out] deltaAlpha     Differences between new and old values of alpha in the working set
+ *
+ * \return Number of the performed iterations
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+size_t SVMThunderTask<algorithmFPType, ParameterType, cpu>::solveLocal(const int * wsIndices, size_t nWS, const algorithmFPType * kernelWS,
+                                                                       algorithmFPType C, algorithmFPType eps, algorithmFPType tau,
+                                                                       size_t maxIterations, algorithmFPType * deltaAlpha)
+{
+    const algorithmFPType fpMax = MaxVal<algorithmFPType>::get();
+    const algorithmFPType zero(0.0);
+    const algorithmFPType two(2.0);
+
+    algorithmFPType * const grad  = _wsBuffer.get();
+    algorithmFPType * const alpha = grad + nWS;
+    algorithmFPType * const y     = alpha + nWS;
+    algorithmFPType * const kDiag = y + nWS;
+    for (size_t k = 0; k < nWS; k++)
+    {
+        grad[k]  = _grad[wsIndices[k]];
+        alpha[k] = _alpha[wsIndices[k]];
+        y[k]     = _y[wsIndices[k]];
+        kDiag[k] = _kernelDiag[wsIndices[k]];
+    }
+
+    size_t iter = 0;
+    for (; iter < maxIterations; ++iter)
+    {
+        /* Find i index of the working set: m(alpha) = max(-y[i]*grad[i]): i belongs to I_up(alpha) */
+        int Bi             = -1;
+        algorithmFPType ma = -fpMax;
+        for (size_t k = 0; k < nWS; k++)
+        {
+            const bool isUp = (y[k] > zero) ? (alpha[k] < C) : (alpha[k] > zero);
+            if (isUp && -y[k] * grad[k] >= ma)
+            {
+                ma = -y[k] * grad[k];
+                Bi = (int)k;
+            }
+        }
+        if (Bi < 0) break;
+
+        /* Find j index of the working set using the second order information */
+        const algorithmFPType * Ki = kernelWS + Bi * nWS;
+        int Bj                     = -1;
+        algorithmFPType Ma         = fpMax;
+        algorithmFPType GMin       = fpMax;
+        algorithmFPType delta      = zero;
+        for (size_t k = 0; k < nWS; k++)
+        {
+            const bool isLow = (y[k] > zero) ? (alpha[k] > zero) : (alpha[k] < C);
+            if (!isLow) continue;
+            const algorithmFPType ygrad = -y[k] * grad[k];
+            if (ygrad < Ma) Ma = ygrad;
+            if (ygrad >= ma) continue;
+
+            const algorithmFPType b = ma - ygrad;
+            algorithmFPType a       = kDiag[Bi] + kDiag[k] - two * Ki[k];
+            if (a <= zero) a = tau;
+            const algorithmFPType dt      = b / a;
+            const algorithmFPType objFunc = -b * dt;
+            if (objFunc <= GMin)
+            {
+                GMin  = objFunc;
+                Bj    = (int)k;
+                delta = dt;
+            }
+        }
+        if (Bj < 0 || ma - Ma < eps) break;
+
+        /* Update alpha and project it back to the feasible region */
+        const algorithmFPType oldAlphai = alpha[Bi];
+        const algorithmFPType oldAlphaj = alpha[Bj];
+        const algorithmFPType sum       = y[Bi] * oldAlphai + y[Bj] * oldAlphaj;
+
+        algorithmFPType newAlphai = oldAlphai + y[Bi] * delta;
+        if (newAlphai > C) newAlphai = C;
+        if (newAlphai < zero) newAlphai = zero;
+        algorithmFPType newAlphaj = y[Bj] * (sum - y[Bi] * newAlphai);
+        if (newAlphaj > C) newAlphaj = C;
+        if (newAlphaj < zero) newAlphaj = zero;
+        newAlphai = y[Bi] * (sum - y[Bj] * newAlphaj);
+
+        alpha[Bi] = newAlphai;
+        alpha[Bj] = newAlphaj;
+
+        /* Update the gradient of the sub-problem */
+        const algorithmFPType dyi  = y[Bi] * (newAlphai - oldAlphai);
+        const algorithmFPType dyj  = y[Bj] * (newAlphaj - oldAlphaj);
+        const algorithmFPType * Kj = kernelWS + Bj * nWS;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nWS; k++)
+        {
+            grad[k] += y[k] * (dyi * Ki[k] + dyj * Kj[k]);
+        }
+    }
+
+    for (size_t k = 0; k < nWS; k++)
+    {
+        deltaAlpha[k]        = alpha[k] - _alpha[wsIndices[k]];
+        _alpha[wsIndices[k]] = alpha[k];
+        this->updateI(C, wsIndices[k]);
+    }
+    return iter;
+}
+
+/**
+ * \brief Update the gradient for all the observations with the changes of alpha in the working set.
+ *        The kernel function values are computed by the blocks of observations,
+ *        the gradient is updated in parallel.
+ *
+ * \param[in] xTable        Input data set
+ * \param[in] wsTable       Feature vectors of the working set
+ * \param[in] wsIndices     Indices of the variables in the working set
+ * \param[in] nWS           Number of the variables in the working set
+ * \param[in] deltaAlpha    Differences between new and old values of alpha in the working set
+ * \param[in] blockSize     Number of observations in the block
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMThunderTask<algorithmFPType, ParameterType, cpu>::updateGradient(const NumericTable & xTable, const NumericTablePtr & wsTable,
+                                                                           const int * wsIndices, size_t nWS, const algorithmFPType * deltaAlpha,
+                                                                           size_t blockSize)
+{
+    const size_t nFeatures = xTable.getNumberOfColumns();
+    const bool isCSR       = (xTable.getDataLayout() == NumericTableIface::csrArray);
+
+    /* Coefficients y[k]*(alpha[k]_new - alpha[k]_old) of the rows of the block */
+    algorithmFPType * const coeff = _wsBuffer.get();
+    for (size_t k = 0; k < nWS; k++) coeff[k] = _y[wsIndices[k]] * deltaAlpha[k];
+
+    TArray<size_t, cpu> rowOffsetsArr(isCSR ? blockSize + 1 : 0);
+    DAAL_CHECK_MALLOC(!isCSR || rowOffsetsArr.get());
+
+    algorithmFPType * const grad         = _grad.get();
+    const algorithmFPType * const y      = _y.get();
+    const algorithmFPType * const kBlock = _kernelBlock.get();
+    const size_t nColumnBlockSize        = 256;
+    Status s;
+    for (size_t iStart = 0; iStart < _nVectors; iStart += blockSize)
+    {
+        const size_t nRows = (iStart + blockSize > _nVectors) ? _nVectors - iStart : blockSize;
+
+        /* The numeric table that references the block of observations */
+        NumericTablePtr blockTable;
+        ReadRows<algorithmFPType, cpu> mtX;
+        ReadRowsCSR<algorithmFPType, cpu> mtXCSR;
+        if (isCSR)
+        {
+            mtXCSR.set(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&xTable)), iStart, nRows);
+            DAAL_CHECK_BLOCK_STATUS(mtXCSR);
+            const size_t * rows = mtXCSR.rows();
+            size_t * rowOffsets = rowOffsetsArr.get();
+            for (size_t i = 0; i <= nRows; i++) rowOffsets[i] = rows[i] - rows[0] + 1;
+            blockTable = CSRNumericTable::create(const_cast<algorithmFPType *>(mtXCSR.values()), const_cast<size_t *>(mtXCSR.cols()), rowOffsets,
+                                                 nFeatures, nRows, CSRNumericTableIface::oneBased, &s);
+        }
+        else
+        {
+            mtX.set(const_cast<NumericTable *>(&xTable), iStart, nRows);
+            DAAL_CHECK_BLOCK_STATUS(mtX);
+            blockTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(const_cast<algorithmFPType *>(mtX.get()), nFeatures, nRows, &s);
+        }
+        DAAL_CHECK_STATUS_VAR(s);
+        DAAL_CHECK_STATUS(s, computeKernelBlock(wsTable, blockTable, _kernelBlock.get()));
+
+        /* grad[t] += y[t] * sum_k(coeff[k] * K(x[k], x[t])) */
+        const size_t nColumnBlocks = nRows / nColumnBlockSize + !!(nRows % nColumnBlockSize);
+        daal::threader_for(nColumnBlocks, nColumnBlocks, [&](size_t iBlock) {
+            const size_t tStart = iBlock * nColumnBlockSize;
+            const size_t tEnd   = (tStart + nColumnBlockSize > nRows) ? nRows : tStart + nColumnBlockSize;
+            algorithmFPType sum[nColumnBlockSize];
+            for (size_t t = tStart; t < tEnd; t++) sum[t - tStart] = algorithmFPType(0.0);
+            for (size_t k = 0; k < nWS; k++)
+            {
+                if (coeff[k] == algorithmFPType(0.0)) continue;
+                const algorithmFPType * Kk = kBlock + k * nRows;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t t = tStart; t < tEnd; t++)
+                {
+                    sum[t - tStart] += coeff[k] * Kk[t];
+                }
+            }
+            for (size_t t = tStart; t < tEnd; t++)
+            {
+                grad[iStart + t] += y[iStart + t] * sum[t - tStart];
+            }
+        });
+    }
+    return s;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,123 @@
+/* file: svm_train_thunder_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate SVM Training functions with the thunder method.
+//--
+*/
+
+#ifndef __SVM_TRAIN_THUNDER_KERNEL_H__
+#define __SVM_TRAIN_THUNDER_KERNEL_H__
+
+#include "numeric_table.h"
+#include "model.h"
+#include "daal_defines.h"
+#include "svm_train_types.h"
+#include "kernel.h"
+#include "service_micro_table.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+
+#include "svm_train_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Structure that stores the intermediate data used in SVM training with the thunder method.
+ * The alpha coefficients, the gradient and the results are the ones of SVMTrainTask
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+struct SVMThunderTask : public SVMTrainTask<algorithmFPType, ParameterType, cpu>
+{
+    typedef SVMTrainTask<algorithmFPType, ParameterType, cpu> super;
+
+    static const size_t maxWorkingSetSize   = 1024; /* Maximal number of the variables in the working set */
+    static const size_t maxLocalIterations  = 100;  /* Maximal number of iterations of the sub-problem solver per variable in the working set */
+    static const size_t kernelBlockRowsSize = 1024; /* Minimal number of rows in the block of the kernel matrix used to update the gradient */
+
+    /* Variable considered for the working set */
+    struct Candidate
+    {
+        algorithmFPType key; /* Value of -y[i]*grad[i] */
+        int index;           /* Index of the observation */
+    };
+
+    SVMThunderTask(size_t nVectors) : super(nVectors) {}
+
+    Status setup(const ParameterType & svmPar, const NumericTablePtr & xTable, NumericTable & yTable);
+
+    /* Solve the sub-problems on the working sets until the optimality condition holds */
+    Status compute(const ParameterType & svmPar, const NumericTablePtr & xTable);
+
+protected:
+    algorithmFPType selectWorkingSet(size_t nWS, int * wsIndices, size_t & nSelected);
+
+    Status copyWorkingSetRows(const NumericTable & xTable, const int * wsIndices, size_t nWS, NumericTablePtr & wsTable);
+
+    Status computeKernelBlock(const NumericTablePtr & aTable, const NumericTablePtr & bTable, algorithmFPType * result);
+
+    size_t solveLocal(const int * wsIndices, size_t nWS, const algorithmFPType * kernelWS, algorithmFPType C, algorithmFPType eps,
+                      algorithmFPType tau, size_t maxIterations, algorithmFPType * deltaAlpha);
+
+    Status updateGradient(const NumericTable & xTable, const NumericTablePtr & wsTable, const int * wsIndices, size_t nWS,
+                          const algorithmFPType * deltaAlpha, size_t blockSize);
+
+    using super::_nVectors;
+    using super::_y;
+    using super::_alpha;
+    using super::_grad;
+    using super::_kernelDiag;
+    using super::_I;
+
+    kernel_function::KernelIfacePtr _kernel;   /* Kernel function used to compute the blocks of the matrix Q */
+    TArray<algorithmFPType, cpu> _kernelBlock; /* Block of the matrix Q */
+    TArray<Candidate, cpu> _upCandidates;      /* Variables from I_up with the largest values of -y[i]*grad[i] */
+    TArray<Candidate, cpu> _lowCandidates;     /* Variables from I_low with the smallest values of -y[i]*grad[i] */
+    TArray<char, cpu> _inWS;                   /* Flags of the observations in the working set */
+    TArray<algorithmFPType, cpu> _wsData;      /* Feature vectors of the working set */
+    TArray<size_t, cpu> _wsColIndices;         /* Column indices of the feature vectors of the working set in CSR layout */
+    TArray<size_t, cpu> _wsRowOffsets;         /* Row offsets of the feature vectors of the working set in CSR layout */
+    TArray<algorithmFPType, cpu> _wsBuffer;    /* Gradient, coefficients, labels and kernel diagonal of the sub-problem */
+};
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+struct SVMTrainImpl<thunder, algorithmFPType, ParameterType, cpu> : public Kernel
+{
+    services::Status compute(const NumericTablePtr & xTable, NumericTable & yTable, daal::algorithms::Model * r, const ParameterType * par);
+};
+
+} // namespace internal
+
+} // namespace training
+
+} // namespace svm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,144 @@
+/* file: datasource_csv_parallel.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the parallel parsing of a .csv file.
+!
+!    The program writes a .csv file with an empty line in the middle and loads
+!    it twice: with the parallel parser used when the whole rest of the file is
+!    loaded into a numeric table, and row by row. Both ways stop at the empty
+!    line, so the file is loaded in two parts. The program checks that the
+!    loaded rows and their basic statistics match.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASOURCE_CSV_PARALLEL"></a>
+ * \example datasource_csv_parallel.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <fstream>
+
+using namespace std;
+using namespace daal;
+
+/* Parameters of the generated data set */
+const string datasetFileName = "datasource_csv_parallel.csv";
+const size_t nFeatures       = 4;
+const size_t nRowsFirstPart  = 20000; /* Number of rows before the empty line */
+const size_t nRowsSecondPart = 5000;  /* Number of rows after the empty line */
+const size_t maxRows         = nRowsFirstPart + nRowsSecondPart;
+
+const float accuracyThreshold = 1e-3f;
+
+void writeDataset();
+NumericTablePtr createTable();
+bool compareTables(const NumericTablePtr & a, const NumericTablePtr & b, float threshold);
+bool compareStatistics(const NumericTablePtr & a, const NumericTablePtr & b);
+
+int main()
+{
+    writeDataset();
+
+    /* Load the rest of the file with the parallel parser */
+    FileDataSource<CSVFeatureManager> parallelDataSource(datasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+    NumericTablePtr parallelFirst  = createTable();
+    NumericTablePtr parallelSecond = createTable();
+    parallelDataSource.loadDataBlock(parallelFirst.get());
+    parallelDataSource.loadDataBlock(parallelSecond.get());
+
+    /* Load the file row by row */
+    FileDataSource<CSVFeatureManager> sequentialDataSource(datasetFileName, DataSource::notAllocateNumericTable,
+                                                           DataSource::doDictionaryFromContext);
+    NumericTablePtr sequentialFirst  = createTable();
+    NumericTablePtr sequentialSecond = createTable();
+    sequentialDataSource.loadDataBlock(maxRows, sequentialFirst.get());
+    sequentialDataSource.loadDataBlock(maxRows, sequentialSecond.get());
+
+    printNumericTable(parallelFirst, "First rows loaded with the parallel parser:", 5);
+    printNumericTable(parallelSecond, "First rows after the empty line loaded with the parallel parser:", 5);
+
+    std::cout << "Number of rows loaded with the parallel parser: " << parallelFirst->getNumberOfRows() << " + "
+              << parallelSecond->getNumberOfRows() << std::endl;
+    std::cout << "Number of rows loaded row by row: " << sequentialFirst->getNumberOfRows() << " + " << sequentialSecond->getNumberOfRows()
+              << std::endl;
+
+    const bool bMatch = parallelFirst->getNumberOfRows() == nRowsFirstPart && parallelSecond->getNumberOfRows() == nRowsSecondPart
+                        && compareTables(parallelFirst, sequentialFirst, 0.0f) && compareTables(parallelSecond, sequentialSecond, 0.0f)
+                        && compareStatistics(parallelFirst, sequentialFirst) && compareStatistics(parallelSecond, sequentialSecond);
+    std::cout << (bMatch ? "Results match" : "Results differ") << std::endl;
+
+    return bMatch ? 0 : -1;
+}
+
+void writeDataset()
+{
+    std::ofstream file(datasetFileName.c_str(), std::ios::out | std::ios::binary);
+    for (size_t i = 0; i < maxRows; ++i)
+    {
+        /* The empty line ends with the Windows line terminator */
+        if (i == nRowsFirstPart) file << "\r\n";
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            file << (j ? "," : "") << double((i * 7 + j * 13) % 101) / 8.0 - 6.0;
+        }
+        file << "\n";
+    }
+}
+
+NumericTablePtr createTable()
+{
+    return NumericTablePtr(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+}
+
+bool compareTables(const NumericTablePtr & a, const NumericTablePtr & b, float threshold)
+{
+    const size_t nRows = a->getNumberOfRows();
+    const size_t nCols = a->getNumberOfColumns();
+    if (nRows != b->getNumberOfRows() || nCols != b->getNumberOfColumns()) return false;
+
+    BlockDescriptor<float> blockA;
+    BlockDescriptor<float> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const float * pA = blockA.getBlockPtr();
+    const float * pB = blockB.getBlockPtr();
+
+    bool bMatch = true;
+    for (size_t i = 0; i < nRows * nCols && bMatch; ++i)
+    {
+        const float diff  = (pA[i] > pB[i]) ? pA[i] - pB[i] : pB[i] - pA[i];
+        const float scale = (pA[i] > 0 ? pA[i] : -pA[i]) + 1.0f;
+        bMatch            = (diff <= threshold * scale);
+    }
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return bMatch;
+}
+
+bool compareStatistics(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    /* Minimums and maximums are exact, sums may differ in rounding as they are accumulated in a different order */
+    return compareTables(a->basicStatistics.get(NumericTableIface::minimum), b->basicStatistics.get(NumericTableIface::minimum), 0.0f)
+           && compareTables(a->basicStatistics.get(NumericTableIface::maximum), b->basicStatistics.get(NumericTableIface::maximum), 0.0f)
+           && compareTables(a->basicStatistics.get(NumericTableIface::sum), b->basicStatistics.get(NumericTableIface::sum), accuracyThreshold)
+           && compareTables(a->basicStatistics.get(NumericTableIface::sumSquares), b->basicStatistics.get(NumericTableIface::sumSquares),
+                            accuracyThreshold);
+}
@@ -0,0 +1,76 @@
+/* file: datastructures_mapped.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of using a numeric table stored in a memory-mapped binary file
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASTRUCTURES_MAPPED">
+ * \example datastructures_mapped.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+
+const std::string mappedFileName = "datastructures_mapped.bin";
+
+int main()
+{
+    std::cout << "Memory-mapped numeric table example" << std::endl << std::endl;
+
+    const size_t firstReadRow = 0;
+    const size_t nRead        = 3;
+
+    const size_t nObservations     = 10;
+    const size_t nFeatures         = 3;
+    double dDataSOA[nObservations] = { 1.0, 1.2, 1.4, 1.6, 1.8, 2.0, 2.2, 2.4, 2.6, 2.8 };
+    float fDataSOA[nObservations]  = { 3.1f, 3.2f, 3.3f, 3.4f, 3.5f, 3.6f, 3.7f, 3.8f, 3.9f, 4.0f };
+    int iDataSOA[nObservations]    = { -10, -20, -30, -40, -50, -60, -70, -80, -90, -100 };
+
+    /* Construct an SOA numeric table with nObservations rows and nFeatures columns */
+    SOANumericTablePtr dataTable = SOANumericTable::create(nFeatures, nObservations);
+    checkPtr(dataTable.get());
+    dataTable->setArray<double>(dDataSOA, 0);
+    dataTable->setArray<float>(fDataSOA, 1);
+    dataTable->setArray<int>(iDataSOA, 2);
+
+    /* Write the numeric table into the binary file with the columns stored contiguously */
+    services::Status status = MappedNumericTable::writeFile(mappedFileName, *dataTable, MappedNumericTable::columnLayout);
+    checkStatus(status);
+
+    /* Map the file into memory. The following runs that map the same file share its pages */
+    MappedNumericTablePtr mappedTable = MappedNumericTable::create(mappedFileName, MappedNumericTable::copyOnWrite, &status);
+    checkStatus(status);
+
+    /* Read a block of rows */
+    BlockDescriptor<double> doubleBlock;
+    mappedTable->getBlockOfRows(firstReadRow, nRead, readOnly, doubleBlock);
+    printArray<double>(doubleBlock.getBlockPtr(), nFeatures, doubleBlock.getNumberOfRows(), "Print the mapped table as double:");
+    mappedTable->releaseBlockOfRows(doubleBlock);
+
+    /* Read a feature (column). The values reference the mapped file as the types of the feature and of the block match */
+    BlockDescriptor<float> floatBlock;
+    mappedTable->getBlockOfColumnValues(1, firstReadRow, nObservations, readOnly, floatBlock);
+    printArray<float>(floatBlock.getBlockPtr(), 1, floatBlock.getNumberOfRows(), "Print the second feature of the mapped table:");
+    mappedTable->releaseBlockOfColumnValues(floatBlock);
+
+    return 0;
+}
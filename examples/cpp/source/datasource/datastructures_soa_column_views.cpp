@@ -0,0 +1,169 @@
+/* file: datastructures_soa_column_views.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the algorithms that read a structure of arrays (SOA)
+!    numeric table by columns.
+!
+!    The program stores the same data in a homogeneous numeric table and in
+!    an SOA numeric table with the float features. Low order moments,
+!    covariance and min-max normalization read the SOA table by columns
+!    without copying it. The program checks that their results match the
+!    results for the homogeneous numeric table.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASTRUCTURES_SOA_COLUMN_VIEWS"></a>
+ * \example datastructures_soa_column_views.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Parameters of the generated data set, the number of features is large enough for the moments to be computed by columns */
+const size_t nFeatures     = 256;
+const size_t nObservations = 2000;
+
+const float accuracyThreshold = 1e-3f;
+
+bool computeMoments(const NumericTablePtr & homogenData, const NumericTablePtr & soaData);
+bool computeCovariance(const NumericTablePtr & homogenData, const NumericTablePtr & soaData);
+bool computeMinMax(const NumericTablePtr & homogenData, const NumericTablePtr & soaData);
+bool compareTables(const NumericTablePtr & a, const NumericTablePtr & b);
+
+int main()
+{
+    /* Generate the data set in the feature-major order */
+    std::vector<float> values(nFeatures * nObservations);
+    for (size_t j = 0; j < nFeatures; ++j)
+        for (size_t i = 0; i < nObservations; ++i) values[j * nObservations + i] = float((i * 31 + j * 17) % 97) / 10.0f - 4.8f + float(j) * 0.01f;
+
+    /* Construct an SOA numeric table that references the columns of the data set */
+    SOANumericTablePtr soaData = SOANumericTable::create(nFeatures, nObservations, DictionaryIface::equal);
+    checkPtr(soaData.get());
+    for (size_t j = 0; j < nFeatures; ++j) soaData->setArray<float>(&values[j * nObservations], j);
+
+    /* Construct a homogeneous numeric table with the same data */
+    services::SharedPtr<HomogenNumericTable<float> > homogenData =
+        HomogenNumericTable<float>::create(nFeatures, nObservations, NumericTable::doAllocate);
+    checkPtr(homogenData.get());
+    float * rows = homogenData->getArray();
+    for (size_t i = 0; i < nObservations; ++i)
+        for (size_t j = 0; j < nFeatures; ++j) rows[i * nFeatures + j] = values[j * nObservations + i];
+
+    const bool bMomentsMatch    = computeMoments(homogenData, soaData);
+    const bool bCovarianceMatch = computeCovariance(homogenData, soaData);
+    const bool bMinMaxMatch     = computeMinMax(homogenData, soaData);
+
+    std::cout << "Low order moments: " << (bMomentsMatch ? "match" : "differ") << std::endl;
+    std::cout << "Covariance: " << (bCovarianceMatch ? "match" : "differ") << std::endl;
+    std::cout << "Min-max normalization: " << (bMinMaxMatch ? "match" : "differ") << std::endl;
+
+    const bool bMatch = bMomentsMatch && bCovarianceMatch && bMinMaxMatch;
+    std::cout << (bMatch ? "Results match" : "Results differ") << std::endl;
+
+    return bMatch ? 0 : -1;
+}
+
+bool computeMoments(const NumericTablePtr & homogenData, const NumericTablePtr & soaData)
+{
+    /* Create algorithm objects to compute low order moments using the default method */
+    low_order_moments::Batch<> homogenAlgorithm;
+    low_order_moments::Batch<> soaAlgorithm;
+    homogenAlgorithm.input.set(low_order_moments::data, homogenData);
+    soaAlgorithm.input.set(low_order_moments::data, soaData);
+    homogenAlgorithm.compute();
+    soaAlgorithm.compute();
+
+    low_order_moments::ResultPtr homogenResult = homogenAlgorithm.getResult();
+    low_order_moments::ResultPtr soaResult     = soaAlgorithm.getResult();
+    printNumericTable(soaResult->get(low_order_moments::mean), "Mean (first 10 features):", 1, 10);
+
+    return compareTables(homogenResult->get(low_order_moments::minimum), soaResult->get(low_order_moments::minimum))
+           && compareTables(homogenResult->get(low_order_moments::maximum), soaResult->get(low_order_moments::maximum))
+           && compareTables(homogenResult->get(low_order_moments::sum), soaResult->get(low_order_moments::sum))
+           && compareTables(homogenResult->get(low_order_moments::sumSquares), soaResult->get(low_order_moments::sumSquares))
+           && compareTables(homogenResult->get(low_order_moments::mean), soaResult->get(low_order_moments::mean))
+           && compareTables(homogenResult->get(low_order_moments::variance), soaResult->get(low_order_moments::variance));
+}
+
+bool computeCovariance(const NumericTablePtr & homogenData, const NumericTablePtr & soaData)
+{
+    /* Create algorithm objects to compute a variance-covariance matrix using the default method */
+    covariance::Batch<> homogenAlgorithm;
+    covariance::Batch<> soaAlgorithm;
+    homogenAlgorithm.input.set(covariance::data, homogenData);
+    soaAlgorithm.input.set(covariance::data, soaData);
+    homogenAlgorithm.compute();
+    soaAlgorithm.compute();
+
+    covariance::ResultPtr homogenResult = homogenAlgorithm.getResult();
+    covariance::ResultPtr soaResult     = soaAlgorithm.getResult();
+    printNumericTable(soaResult->get(covariance::covariance), "Covariance matrix (upper left block):", 10, 10);
+
+    return compareTables(homogenResult->get(covariance::covariance), soaResult->get(covariance::covariance))
+           && compareTables(homogenResult->get(covariance::mean), soaResult->get(covariance::mean));
+}
+
+bool computeMinMax(const NumericTablePtr & homogenData, const NumericTablePtr & soaData)
+{
+    /* Create algorithm objects to normalize the data using the default method */
+    normalization::minmax::Batch<> homogenAlgorithm;
+    normalization::minmax::Batch<> soaAlgorithm;
+    homogenAlgorithm.input.set(normalization::minmax::data, homogenData);
+    soaAlgorithm.input.set(normalization::minmax::data, soaData);
+    homogenAlgorithm.compute();
+    soaAlgorithm.compute();
+
+    NumericTablePtr homogenResult = homogenAlgorithm.getResult()->get(normalization::minmax::normalizedData);
+    NumericTablePtr soaResult     = soaAlgorithm.getResult()->get(normalization::minmax::normalizedData);
+    printNumericTable(soaResult, "Normalized data (upper left block):", 10, 10);
+
+    return compareTables(homogenResult, soaResult);
+}
+
+bool compareTables(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    const size_t nCols = a->getNumberOfColumns();
+    if (nRows != b->getNumberOfRows() || nCols != b->getNumberOfColumns()) return false;
+
+    BlockDescriptor<float> blockA;
+    BlockDescriptor<float> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const float * pA = blockA.getBlockPtr();
+    const float * pB = blockB.getBlockPtr();
+
+    bool bMatch = true;
+    for (size_t i = 0; i < nRows * nCols && bMatch; ++i)
+    {
+        const float diff  = (pA[i] > pB[i]) ? pA[i] - pB[i] : pB[i] - pA[i];
+        const float scale = (pA[i] > 0 ? pA[i] : -pA[i]) + 1.0f;
+        bMatch            = (diff <= accuracyThreshold * scale);
+    }
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return bMatch;
+}
@@ -0,0 +1,191 @@
+/* file: df_reg_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of decision forest regression with the data stored in the
+!    compressed sparse rows (CSR) format in the batch processing mode.
+!
+!    The program stores the training and test data in homogeneous and CSR
+!    numeric tables. It trains the decision forest regression models in the
+!    memory saving mode, which reads the training data by columns, on both
+!    tables, and checks that the predictions of the models match.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_REG_CSR_BATCH"></a>
+ * \example df_reg_csr_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::decision_forest::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures            = 13; /* Number of features in training and testing data sets */
+
+/* Decision forest parameters */
+const size_t nTrees = 20;
+
+const float accuracyThreshold = 1e-5f;
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable);
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data);
+NumericTablePtr toCSR(const NumericTablePtr & table);
+float maxRelativeDifference(const NumericTablePtr & a, const NumericTablePtr & b);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Train and test the models on the dense and the CSR data */
+    NumericTablePtr densePrediction = testModel(trainModel(trainData, trainDependentVariable), testData);
+    NumericTablePtr csrPrediction   = testModel(trainModel(toCSR(trainData), trainDependentVariable), toCSR(testData));
+
+    printNumericTables<float, float>(densePrediction, csrPrediction, "Dense data", "CSR data",
+                                     "Decision forest prediction results (first 10 rows):", 10);
+
+    const float diff = maxRelativeDifference(densePrediction, csrPrediction);
+    std::cout << "Maximal relative difference of the predictions: " << diff << std::endl;
+    std::cout << ((diff <= accuracyThreshold) ? "Results match" : "Results differ") << std::endl;
+
+    return (diff <= accuracyThreshold) ? 0 : -1;
+}
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable)
+{
+    /* Create an algorithm object to train the decision forest regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, dependentVariable);
+
+    algorithm.parameter.nTrees           = nTrees;
+    algorithm.parameter.memorySavingMode = true;
+
+    /* Build the decision forest regression model */
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data)
+{
+    /* Create an algorithm object to predict values of decision forest regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of decision forest regression */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+NumericTablePtr toCSR(const NumericTablePtr & table)
+{
+    const size_t nRows = table->getNumberOfRows();
+    const size_t nCols = table->getNumberOfColumns();
+    BlockDescriptor<float> block;
+    table->getBlockOfRows(0, nRows, readOnly, block);
+    const float * dense = block.getBlockPtr();
+
+    /* Store the non-zero values with the one-based column indices and row offsets */
+    std::vector<float> values;
+    std::vector<size_t> colIndices;
+    std::vector<size_t> rowOffsets(1, 1);
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        for (size_t j = 0; j < nCols; ++j)
+        {
+            if (dense[i * nCols + j] == 0.0f) continue;
+            values.push_back(dense[i * nCols + j]);
+            colIndices.push_back(j + 1);
+        }
+        rowOffsets.push_back(values.size() + 1);
+    }
+    table->releaseBlockOfRows(block);
+
+    CSRNumericTablePtr csr = CSRNumericTable::create<float>(NULL, NULL, NULL, nCols, nRows);
+    csr->allocateDataMemory(values.size());
+    float * csrValues;
+    size_t * csrColIndices;
+    size_t * csrRowOffsets;
+    csr->getArrays<float>(&csrValues, &csrColIndices, &csrRowOffsets);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        csrValues[i]     = values[i];
+        csrColIndices[i] = colIndices[i];
+    }
+    for (size_t i = 0; i <= nRows; ++i) csrRowOffsets[i] = rowOffsets[i];
+    return csr;
+}
+
+float maxRelativeDifference(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    BlockDescriptor<float> blockA;
+    BlockDescriptor<float> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const float * pA = blockA.getBlockPtr();
+    const float * pB = blockB.getBlockPtr();
+
+    float diff = 0.0f;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const float d     = (pA[i] > pB[i]) ? pA[i] - pB[i] : pB[i] - pA[i];
+        const float scale = (pA[i] > 0 ? pA[i] : -pA[i]) + 1.0f;
+        if (d / scale > diff) diff = d / scale;
+    }
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return diff;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+}
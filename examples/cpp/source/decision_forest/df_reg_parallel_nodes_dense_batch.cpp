@@ -0,0 +1,158 @@
+/* file: df_reg_parallel_nodes_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of decision forest regression with parallel node splitting
+!    in the batch processing mode.
+!
+!    The program trains two decision forest regression models on the same
+!    training data set with the same seed: one sequentially and one with
+!    parallel node splitting. It checks that both models give the same
+!    predictions on the training and test data sets.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_REG_PARALLEL_NODES_DENSE_BATCH"></a>
+ * \example df_reg_parallel_nodes_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::decision_forest::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName         = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName          = "../data/batch/df_regression_test.csv";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures                    = 13; /* Number of features in training and testing data sets */
+
+/* Decision forest parameters */
+/* Parallel node splitting is used when there are more threads than trees */
+const size_t nTrees = 2;
+const size_t seed   = 777;
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable, bool parallelNodeSplitting);
+NumericTablePtr predict(const training::ResultPtr & trainingResult, const NumericTablePtr & data);
+size_t countMismatches(const NumericTablePtr & a, const NumericTablePtr & b);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    training::ResultPtr sequentialResult = trainModel(trainData, trainDependentVariable, false);
+    training::ResultPtr parallelResult   = trainModel(trainData, trainDependentVariable, true);
+
+    NumericTablePtr sequentialPrediction = predict(sequentialResult, testData);
+    NumericTablePtr parallelPrediction   = predict(parallelResult, testData);
+    printNumericTable(sequentialPrediction, "Prediction of the sequentially trained model (first 10 rows):", 10);
+    printNumericTable(parallelPrediction, "Prediction of the model trained with parallel node splitting (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+
+    const size_t nTestMismatches  = countMismatches(sequentialPrediction, parallelPrediction);
+    const size_t nTrainMismatches = countMismatches(predict(sequentialResult, trainData), predict(parallelResult, trainData));
+    std::cout << "Number of different predictions on the training data set: " << nTrainMismatches << std::endl;
+    std::cout << "Number of different predictions on the test data set: " << nTestMismatches << std::endl;
+    std::cout << ((nTestMismatches || nTrainMismatches) ? "Models differ" : "Models match") << std::endl;
+
+    return (nTestMismatches || nTrainMismatches) ? -1 : 0;
+}
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable, bool parallelNodeSplitting)
+{
+    /* Create an algorithm object to train the decision forest regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, dependentVariable);
+
+    /* The models are the same when all features are checked in each node and a leaf node has more than one observation */
+    algorithm.parameter.nTrees                    = nTrees;
+    algorithm.parameter.featuresPerNode           = nFeatures;
+    algorithm.parameter.minObservationsInLeafNode = 5;
+    algorithm.parameter.engine                    = algorithms::engines::mt2203::Batch<>::create(seed);
+    algorithm.parameter.parallelNodeSplitting     = parallelNodeSplitting;
+
+    /* Build the decision forest regression model */
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+NumericTablePtr predict(const training::ResultPtr & trainingResult, const NumericTablePtr & data)
+{
+    /* Create an algorithm object to predict values of decision forest regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of decision forest regression */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+size_t countMismatches(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    BlockDescriptor<> blockA;
+    BlockDescriptor<> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const float * pA = blockA.getBlockPtr();
+    const float * pB = blockB.getBlockPtr();
+
+    size_t nMismatches = 0;
+    for (size_t i = 0; i < nRows; ++i) nMismatches += (pA[i] != pB[i]);
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return nMismatches;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
@@ -0,0 +1,236 @@
+/* file: df_reg_predict_check_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of decision forest regression prediction check in the batch
+!    processing mode.
+!
+!    The program trains the decision forest regression model, computes
+!    predictions for the test data with the prediction algorithm and checks
+!    them against the predictions computed by the trees obtained with the
+!    model traversal.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DF_REG_PREDICT_CHECK_DENSE_BATCH"></a>
+ * \example df_reg_predict_check_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::decision_forest::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName         = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName          = "../data/batch/df_regression_test.csv";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures                    = 13; /* Number of features in training and testing data sets */
+
+/* Decision forest parameters */
+const size_t nTrees = 20;
+
+const double accuracyThreshold = 1e-5;
+
+/* Tree node obtained with the model traversal */
+struct TreeNode
+{
+    size_t level;
+    bool isLeaf;
+    size_t featureIndex;
+    double featureValueOrResponse;
+    size_t right; /* Index of the right child in the traversal order, the left child follows its parent */
+};
+
+/** Visitor class implementing TreeNodeVisitor interface, collects tree nodes in the depth-first order */
+class CollectNodeVisitor : public daal::algorithms::tree_utils::regression::TreeNodeVisitor
+{
+public:
+    CollectNodeVisitor(std::vector<TreeNode> & nodes) : _nodes(nodes) {}
+
+    virtual bool onLeafNode(const daal::algorithms::tree_utils::regression::LeafNodeDescriptor & desc)
+    {
+        TreeNode node = { desc.level, true, 0, desc.response, 0 };
+        _nodes.push_back(node);
+        return true;
+    }
+
+    virtual bool onSplitNode(const daal::algorithms::tree_utils::regression::SplitNodeDescriptor & desc)
+    {
+        TreeNode node = { desc.level, false, desc.featureIndex, desc.featureValue, 0 };
+        _nodes.push_back(node);
+        return true;
+    }
+
+private:
+    std::vector<TreeNode> & _nodes;
+};
+
+training::ResultPtr trainModel();
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & testData);
+void collectTrees(const Model & model, std::vector<std::vector<TreeNode> > & trees);
+double predictByTrees(const std::vector<std::vector<TreeNode> > & trees, const float * x);
+bool isCategorical(size_t featureIndex);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    NumericTablePtr prediction = testModel(trainingResult, testData);
+    printNumericTable(prediction, "Decision forest prediction results (first 10 rows):", 10);
+
+    std::vector<std::vector<TreeNode> > trees;
+    collectTrees(*trainingResult->get(training::model), trees);
+
+    const size_t nRows = testData->getNumberOfRows();
+    BlockDescriptor<float> xBlock;
+    BlockDescriptor<float> predictionBlock;
+    testData->getBlockOfRows(0, nRows, readOnly, xBlock);
+    prediction->getBlockOfRows(0, nRows, readOnly, predictionBlock);
+
+    size_t nMismatches = 0;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const double expected = predictByTrees(trees, xBlock.getBlockPtr() + i * nFeatures);
+        const double actual   = predictionBlock.getBlockPtr()[i];
+        const double diff     = (expected > actual) ? expected - actual : actual - expected;
+        const double scale    = (expected > 0 ? expected : -expected) + 1.0;
+        if (diff > accuracyThreshold * scale) ++nMismatches;
+    }
+
+    testData->releaseBlockOfRows(xBlock);
+    prediction->releaseBlockOfRows(predictionBlock);
+
+    std::cout << "Number of predictions different from the traversed trees: " << nMismatches << std::endl;
+    std::cout << (nMismatches ? "Predictions differ" : "Predictions match") << std::endl;
+
+    return nMismatches ? -1 : 0;
+}
+
+training::ResultPtr trainModel()
+{
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    /* Create an algorithm object to train the decision forest regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainDependentVariable);
+
+    algorithm.parameter.nTrees = nTrees;
+
+    /* Build the decision forest regression model */
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & testData)
+{
+    /* Create an algorithm object to predict values of decision forest regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of decision forest regression */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+void collectTrees(const Model & model, std::vector<std::vector<TreeNode> > & trees)
+{
+    trees.resize(model.getNumberOfTrees());
+    for (size_t iTree = 0; iTree < trees.size(); ++iTree)
+    {
+        std::vector<TreeNode> & nodes = trees[iTree];
+        CollectNodeVisitor visitor(nodes);
+        model.traverseDFS(iTree, visitor);
+
+        /* The right child of a split node is the next node of the following level after the left subtree */
+        std::vector<size_t> splitNodes;
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            while (!splitNodes.empty() && nodes[splitNodes.back()].level >= nodes[i].level) splitNodes.pop_back();
+            if (!splitNodes.empty() && (i != splitNodes.back() + 1)) nodes[splitNodes.back()].right = i;
+            if (!nodes[i].isLeaf) splitNodes.push_back(i);
+        }
+    }
+}
+
+double predictByTrees(const std::vector<std::vector<TreeNode> > & trees, const float * x)
+{
+    double sum = 0.0;
+    for (size_t iTree = 0; iTree < trees.size(); ++iTree)
+    {
+        const std::vector<TreeNode> & nodes = trees[iTree];
+        size_t i                            = 0;
+        while (!nodes[i].isLeaf)
+        {
+            const TreeNode & node = nodes[i];
+            const double value    = x[node.featureIndex];
+            const bool goRight    = isCategorical(node.featureIndex) ? (int(value) != int(node.featureValueOrResponse)) :
+                                                                       (value > node.featureValueOrResponse);
+            i                     = goRight ? node.right : i + 1;
+        }
+        sum += nodes[i].featureValueOrResponse;
+    }
+    return sum / double(trees.size());
+}
+
+bool isCategorical(size_t featureIndex)
+{
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        if (categoricalFeaturesIndices[i] == featureIndex) return true;
+    return false;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
@@ -0,0 +1,188 @@
+/* file: gbt_reg_custom_loss_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression with a user-defined loss
+!    function in the batch processing mode.
+!
+!    The program implements the squared loss with the LossFunctionIface
+!    interface, trains the gradient boosted trees regression models with it
+!    and with the built-in squared loss, and checks that their predictions for
+!    the test data set match.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_CUSTOM_LOSS_DENSE_BATCH"></a>
+ * \example gbt_reg_custom_loss_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures            = 13; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+
+const double accuracyThreshold = 1e-4;
+
+/** User-defined squared loss function, L(y,f) = ([y-f(x)]^2)/2 */
+class SquaredLoss : public training::LossFunctionIface
+{
+public:
+    virtual services::Status getGradients(size_t n, const float * y, const float * f, float * gradients, float * hessians) const
+    {
+        return getGradientsImpl(n, y, f, gradients, hessians);
+    }
+
+    virtual services::Status getGradients(size_t n, const double * y, const double * f, double * gradients, double * hessians) const
+    {
+        return getGradientsImpl(n, y, f, gradients, hessians);
+    }
+
+private:
+    template <typename algorithmFPType>
+    services::Status getGradientsImpl(size_t n, const algorithmFPType * y, const algorithmFPType * f, algorithmFPType * gradients,
+                                      algorithmFPType * hessians) const
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            gradients[i] = f[i] - y[i];
+            hessians[i]  = 1;
+        }
+        return services::Status();
+    }
+};
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable,
+                               const training::LossFunctionIfacePtr & customLoss);
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data);
+double maxRelativeDifference(const NumericTablePtr & a, const NumericTablePtr & b);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    training::ResultPtr builtInResult = trainModel(trainData, trainDependentVariable, training::LossFunctionIfacePtr());
+    training::ResultPtr customResult  = trainModel(trainData, trainDependentVariable, training::LossFunctionIfacePtr(new SquaredLoss()));
+
+    NumericTablePtr builtInPrediction = testModel(builtInResult, testData);
+    NumericTablePtr customPrediction  = testModel(customResult, testData);
+
+    printNumericTable(customPrediction, "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+
+    const double diff = maxRelativeDifference(builtInPrediction, customPrediction);
+    std::cout << "Maximal relative difference from the predictions of the built-in squared loss: " << diff << std::endl;
+    std::cout << ((diff <= accuracyThreshold) ? "Results match" : "Results differ") << std::endl;
+
+    return (diff <= accuracyThreshold) ? 0 : -1;
+}
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable,
+                               const training::LossFunctionIfacePtr & customLoss)
+{
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, dependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+
+    /* Use the user-defined loss function if it is provided */
+    if (customLoss)
+    {
+        algorithm.parameter().loss       = training::custom;
+        algorithm.parameter().customLoss = customLoss;
+    }
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data)
+{
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+double maxRelativeDifference(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    BlockDescriptor<double> blockA;
+    BlockDescriptor<double> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const double * pA = blockA.getBlockPtr();
+    const double * pB = blockB.getBlockPtr();
+
+    double diff = 0.0;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const double d     = (pA[i] > pB[i]) ? pA[i] - pB[i] : pB[i] - pA[i];
+        const double scale = (pA[i] > 0 ? pA[i] : -pA[i]) + 1.0;
+        if (d / scale > diff) diff = d / scale;
+    }
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return diff;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+}
@@ -0,0 +1,154 @@
+/* file: gbt_reg_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression in the distributed processing mode.
+!
+!    The program splits the training data set into blocks, trains the gradient boosted
+!    trees regression model on them and computes regression for the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_DENSE_DISTRIBUTED"></a>
+ * \example gbt_reg_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures            = 13; /* Number of features in training and testing data sets */
+const size_t nBlocks              = 4;  /* Number of blocks the training data set is split into */
+const size_t nRowsInBlock         = 95; /* Number of observations in a block of the training data set */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+
+training::ResultPtr trainModel();
+void testModel(const training::ResultPtr & res);
+void createTables(NumericTablePtr & pData, NumericTablePtr & pDependentVar, NumericTablePtr & pMergedData);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    training::ResultPtr trainingResult = trainModel();
+    testModel(trainingResult);
+
+    return 0;
+}
+
+training::ResultPtr trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm object to merge the histograms and to build the trees on the master node */
+    training::Distributed<step2Master> masterAlgorithm;
+    masterAlgorithm.parameter.maxIterations = maxIterations;
+
+    /* Create algorithm objects to compute the histograms on the local nodes */
+    services::SharedPtr<training::Distributed<step1Local> > localAlgorithms[nBlocks];
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        /* Retrieve the block of the training data from the input file */
+        NumericTablePtr trainData, trainDependentVariable, mergedData;
+        createTables(trainData, trainDependentVariable, mergedData);
+        trainDataSource.loadDataBlock(nRowsInBlock, mergedData.get());
+
+        localAlgorithms[i].reset(new training::Distributed<step1Local>());
+        localAlgorithms[i]->input.set(training::data, trainData);
+        localAlgorithms[i]->input.set(training::dependentVariable, trainDependentVariable);
+        localAlgorithms[i]->parameter.maxIterations = maxIterations;
+    }
+
+    /* Compute the summaries of the feature values on the local nodes and merge them into the bin borders on the master node */
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        localAlgorithms[i]->compute();
+        masterAlgorithm.input.add(training::binSketchesFromStep1, localAlgorithms[i]->getPartialResult()->get(training::binSketches));
+    }
+    masterAlgorithm.compute();
+
+    /* The local nodes compute the histograms of the gradients and the master node splits the nodes until all the trees are built */
+    NumericTablePtr binBorders  = masterAlgorithm.getPartialResult()->get(training::binBorders);
+    NumericTablePtr levelSplits = masterAlgorithm.getPartialResult()->get(training::levelSplits);
+    do
+    {
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            localAlgorithms[i]->input.set(training::binBordersFromStep2, binBorders);
+            localAlgorithms[i]->input.set(training::levelSplitsFromStep2, levelSplits);
+            localAlgorithms[i]->compute();
+
+            masterAlgorithm.input.add(training::histogramsFromStep1, localAlgorithms[i]->getPartialResult()->get(training::histograms));
+        }
+
+        masterAlgorithm.compute();
+        binBorders  = masterAlgorithm.getPartialResult()->get(training::binBorders);
+        levelSplits = masterAlgorithm.getPartialResult()->get(training::levelSplits);
+    } while (!masterAlgorithm.getPartialResult()->isTrainingFinished());
+
+    /* Build the gradient boosted trees regression model */
+    masterAlgorithm.finalizeCompute();
+
+    /* Retrieve the algorithm results */
+    return masterAlgorithm.getResult();
+}
+
+void testModel(const training::ResultPtr & trainingResult)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData, testGroundTruth, mergedData;
+    createTables(testData, testGroundTruth, mergedData);
+    testDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    prediction::ResultPtr predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(prediction::prediction), "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
+
+void createTables(NumericTablePtr & pData, NumericTablePtr & pDependentVar, NumericTablePtr & pMergedData)
+{
+    /* Create Numeric Tables for the data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    pMergedData.reset(new MergedNumericTable(pData, pDependentVar));
+}
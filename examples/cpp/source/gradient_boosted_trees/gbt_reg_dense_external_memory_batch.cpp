@@ -0,0 +1,154 @@
+/* file: gbt_reg_dense_external_memory_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression in the batch processing mode
+!    with the binned training data stored in the external memory.
+!
+!    The program trains two gradient boosted trees regression models on a training
+!    datasetFileName: one with the binned data kept in memory and one with the
+!    binned data stored in a temporary file by small pages of observations.
+!    Then it compares the predictions of both models on the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_DENSE_EXTERNAL_MEMORY_BATCH"></a>
+ * \example gbt_reg_dense_external_memory_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName         = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName          = "../data/batch/df_regression_test.csv";
+const size_t categoricalFeaturesIndices[] = { 3 };
+const size_t nFeatures                    = 13; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations          = 40;
+const size_t externalMemoryPageSize = 100; /* Number of observations in a page of the binned data */
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable, size_t pageSize);
+NumericTablePtr testModel(const training::ResultPtr & res, const NumericTablePtr & data);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Train the models with the binned data in memory and in the external memory */
+    training::ResultPtr inMemoryResult       = trainModel(trainData, trainDependentVariable, 0);
+    training::ResultPtr externalMemoryResult = trainModel(trainData, trainDependentVariable, externalMemoryPageSize);
+
+    NumericTablePtr inMemoryPrediction       = testModel(inMemoryResult, testData);
+    NumericTablePtr externalMemoryPrediction = testModel(externalMemoryResult, testData);
+
+    printNumericTable(inMemoryPrediction, "Gradient boosted trees prediction results, in-memory training (first 10 rows):", 10);
+    printNumericTable(externalMemoryPrediction, "Gradient boosted trees prediction results, external memory training (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+
+    /* Compare the predictions of the models */
+    const size_t nRows = testData->getNumberOfRows();
+    BlockDescriptor<> block1;
+    BlockDescriptor<> block2;
+    inMemoryPrediction->getBlockOfRows(0, nRows, readOnly, block1);
+    externalMemoryPrediction->getBlockOfRows(0, nRows, readOnly, block2);
+    const DAAL_DATA_TYPE * p1 = block1.getBlockPtr();
+    const DAAL_DATA_TYPE * p2 = block2.getBlockPtr();
+
+    DAAL_DATA_TYPE maxDiff = 0;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const DAAL_DATA_TYPE diff = (p1[i] > p2[i]) ? p1[i] - p2[i] : p2[i] - p1[i];
+        if (diff > maxDiff) maxDiff = diff;
+    }
+    inMemoryPrediction->releaseBlockOfRows(block1);
+    externalMemoryPrediction->releaseBlockOfRows(block2);
+
+    std::cout << "Maximal difference of the predictions: " << maxDiff << std::endl;
+
+    return 0;
+}
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable, size_t pageSize)
+{
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, dependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+
+    /* Store the binned training data in a temporary file by pages of observations if pageSize is non-zero */
+    algorithm.parameter().externalMemoryPageSize = pageSize;
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data)
+{
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    NumericTableDictionaryPtr pDictionary = pData->getDictionarySharedPtr();
+    for (size_t i = 0, n = sizeof(categoricalFeaturesIndices) / sizeof(categoricalFeaturesIndices[0]); i < n; ++i)
+        (*pDictionary)[categoricalFeaturesIndices[i]].featureType = data_feature_utils::DAAL_CATEGORICAL;
+}
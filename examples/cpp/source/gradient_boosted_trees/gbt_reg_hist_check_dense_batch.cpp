@@ -0,0 +1,204 @@
+/* file: gbt_reg_hist_check_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the gradient boosted trees regression training check with
+!    the histogram split method in the batch processing mode.
+!
+!    The program trains a single tree with the squared loss, the shrinkage 1
+!    and no regularization, so the response of every leaf is the mean of the
+!    dependent values of the training observations that fall into it. The
+!    histograms of the larger kids are derived from the histograms of their
+!    parents and smaller siblings by subtraction, hence wrong subtraction
+!    changes the splits and the responses of the leaves below them. The
+!    program routes the training observations through the tree obtained with
+!    the model traversal and checks the responses and sizes of the leaves.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_HIST_CHECK_DENSE_BATCH"></a>
+ * \example gbt_reg_hist_check_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const size_t nFeatures      = 13; /* Number of features in training data set */
+
+/* Gradient boosted trees training parameters */
+const size_t maxTreeDepth              = 6;
+const size_t minObservationsInLeafNode = 5;
+
+const double accuracyThreshold = 1e-4;
+
+/* Tree node obtained with the model traversal */
+struct TreeNode
+{
+    size_t level;
+    bool isLeaf;
+    size_t featureIndex;
+    double featureValueOrResponse;
+    size_t right; /* Index of the right child in the traversal order, the left child follows its parent */
+};
+
+/** Visitor class implementing TreeNodeVisitor interface, collects tree nodes in the depth-first order */
+class CollectNodeVisitor : public daal::algorithms::tree_utils::regression::TreeNodeVisitor
+{
+public:
+    CollectNodeVisitor(std::vector<TreeNode> & nodes) : _nodes(nodes) {}
+
+    virtual bool onLeafNode(const daal::algorithms::tree_utils::regression::LeafNodeDescriptor & desc)
+    {
+        TreeNode node = { desc.level, true, 0, desc.response, 0 };
+        _nodes.push_back(node);
+        return true;
+    }
+
+    virtual bool onSplitNode(const daal::algorithms::tree_utils::regression::SplitNodeDescriptor & desc)
+    {
+        TreeNode node = { desc.level, false, desc.featureIndex, desc.featureValue, 0 };
+        _nodes.push_back(node);
+        return true;
+    }
+
+private:
+    std::vector<TreeNode> & _nodes;
+};
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable);
+void collectTrees(const Model & model, std::vector<std::vector<TreeNode> > & trees);
+size_t findLeaf(const std::vector<TreeNode> & nodes, const float * x);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    training::ResultPtr trainingResult = trainModel(trainData, trainDependentVariable);
+
+    std::vector<std::vector<TreeNode> > trees;
+    collectTrees(*trainingResult->get(training::model), trees);
+    const std::vector<TreeNode> & nodes = trees[0];
+
+    /* Accumulate the dependent values of the training observations in the leaves */
+    const size_t nRows = trainData->getNumberOfRows();
+    std::vector<double> sums(nodes.size(), 0.0);
+    std::vector<size_t> counts(nodes.size(), 0);
+
+    BlockDescriptor<float> xBlock;
+    BlockDescriptor<float> yBlock;
+    trainData->getBlockOfRows(0, nRows, readOnly, xBlock);
+    trainDependentVariable->getBlockOfRows(0, nRows, readOnly, yBlock);
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const size_t iLeaf = findLeaf(nodes, xBlock.getBlockPtr() + i * nFeatures);
+        sums[iLeaf] += yBlock.getBlockPtr()[i];
+        ++counts[iLeaf];
+    }
+    trainData->releaseBlockOfRows(xBlock);
+    trainDependentVariable->releaseBlockOfRows(yBlock);
+
+    size_t nLeaves     = 0;
+    size_t nSplits     = 0;
+    size_t nMismatches = 0;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (!nodes[i].isLeaf)
+        {
+            ++nSplits;
+            continue;
+        }
+        ++nLeaves;
+        if (counts[i] < minObservationsInLeafNode)
+        {
+            ++nMismatches;
+            continue;
+        }
+        const double expected = sums[i] / double(counts[i]);
+        const double actual   = nodes[i].featureValueOrResponse;
+        const double diff     = (expected > actual) ? expected - actual : actual - expected;
+        const double scale    = (expected > 0 ? expected : -expected) + 1.0;
+        if (diff > accuracyThreshold * scale) ++nMismatches;
+    }
+
+    std::cout << "Number of split nodes: " << nSplits << ", number of leaves: " << nLeaves << std::endl;
+    std::cout << "Number of leaves with wrong responses or sizes: " << nMismatches << std::endl;
+    std::cout << ((nMismatches || nSplits < 2) ? "Leaves differ" : "Leaves match") << std::endl;
+
+    return (nMismatches || nSplits < 2) ? -1 : 0;
+}
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable)
+{
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, dependentVariable);
+
+    /* A single tree with the leaf responses equal to the means of the dependent values */
+    algorithm.parameter().maxIterations             = 1;
+    algorithm.parameter().maxTreeDepth              = maxTreeDepth;
+    algorithm.parameter().minObservationsInLeafNode = minObservationsInLeafNode;
+    algorithm.parameter().shrinkage                 = 1.0;
+    algorithm.parameter().lambda                    = 0.0;
+    algorithm.parameter().splitMethod               = daal::algorithms::gbt::training::inexact;
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+void collectTrees(const Model & model, std::vector<std::vector<TreeNode> > & trees);
+size_t findLeaf(const std::vector<TreeNode> & nodes, const float * x)
+{
+    size_t i = 0;
+    while (!nodes[i].isLeaf)
+    {
+        const TreeNode & node = nodes[i];
+        i                     = (double(x[node.featureIndex]) > node.featureValueOrResponse) ? node.right : i + 1;
+    }
+    return i;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+}
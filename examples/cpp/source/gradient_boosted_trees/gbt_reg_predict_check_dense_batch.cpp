@@ -0,0 +1,229 @@
+/* file: gbt_reg_predict_check_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression prediction check in the
+!    batch processing mode.
+!
+!    The program trains the gradient boosted trees regression model, computes
+!    predictions for the training and test data with the prediction algorithm
+!    and checks them against the predictions computed by the trees obtained
+!    with the model traversal. All features are ordered and the data sets
+!    have more rows than a block of rows processed together, hence the
+!    prediction algorithm uses the multi-row tree traversal.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_PREDICT_CHECK_DENSE_BATCH"></a>
+ * \example gbt_reg_predict_check_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures            = 13; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+
+const double accuracyThreshold = 1e-5;
+
+/* Tree node obtained with the model traversal */
+struct TreeNode
+{
+    size_t level;
+    bool isLeaf;
+    size_t featureIndex;
+    double featureValueOrResponse;
+    size_t right; /* Index of the right child in the traversal order, the left child follows its parent */
+};
+
+/** Visitor class implementing TreeNodeVisitor interface, collects tree nodes in the depth-first order */
+class CollectNodeVisitor : public daal::algorithms::tree_utils::regression::TreeNodeVisitor
+{
+public:
+    CollectNodeVisitor(std::vector<TreeNode> & nodes) : _nodes(nodes) {}
+
+    virtual bool onLeafNode(const daal::algorithms::tree_utils::regression::LeafNodeDescriptor & desc)
+    {
+        TreeNode node = { desc.level, true, 0, desc.response, 0 };
+        _nodes.push_back(node);
+        return true;
+    }
+
+    virtual bool onSplitNode(const daal::algorithms::tree_utils::regression::SplitNodeDescriptor & desc)
+    {
+        TreeNode node = { desc.level, false, desc.featureIndex, desc.featureValue, 0 };
+        _nodes.push_back(node);
+        return true;
+    }
+
+private:
+    std::vector<TreeNode> & _nodes;
+};
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable);
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data);
+void collectTrees(const Model & model, std::vector<std::vector<TreeNode> > & trees);
+double predictByTrees(const std::vector<std::vector<TreeNode> > & trees, const float * x);
+size_t countMismatches(const std::vector<std::vector<TreeNode> > & trees, const NumericTablePtr & data, const NumericTablePtr & prediction);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    training::ResultPtr trainingResult = trainModel(trainData, trainDependentVariable);
+
+    NumericTablePtr trainPrediction = testModel(trainingResult, trainData);
+    NumericTablePtr testPrediction  = testModel(trainingResult, testData);
+    printNumericTable(testPrediction, "Gradient boosted trees prediction results (first 10 rows):", 10);
+
+    std::vector<std::vector<TreeNode> > trees;
+    collectTrees(*trainingResult->get(training::model), trees);
+
+    const size_t nTrainMismatches = countMismatches(trees, trainData, trainPrediction);
+    const size_t nTestMismatches  = countMismatches(trees, testData, testPrediction);
+    std::cout << "Number of predictions different from the traversed trees on the training data set: " << nTrainMismatches << std::endl;
+    std::cout << "Number of predictions different from the traversed trees on the test data set: " << nTestMismatches << std::endl;
+    std::cout << ((nTrainMismatches || nTestMismatches) ? "Predictions differ" : "Predictions match") << std::endl;
+
+    return (nTrainMismatches || nTestMismatches) ? -1 : 0;
+}
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable)
+{
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, dependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data)
+{
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+void collectTrees(const Model & model, std::vector<std::vector<TreeNode> > & trees)
+{
+    trees.resize(model.getNumberOfTrees());
+    for (size_t iTree = 0; iTree < trees.size(); ++iTree)
+    {
+        std::vector<TreeNode> & nodes = trees[iTree];
+        CollectNodeVisitor visitor(nodes);
+        model.traverseDFS(iTree, visitor);
+
+        /* The right child of a split node is the next node of the following level after the left subtree */
+        std::vector<size_t> splitNodes;
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            while (!splitNodes.empty() && nodes[splitNodes.back()].level >= nodes[i].level) splitNodes.pop_back();
+            if (!splitNodes.empty() && (i != splitNodes.back() + 1)) nodes[splitNodes.back()].right = i;
+            if (!nodes[i].isLeaf) splitNodes.push_back(i);
+        }
+    }
+}
+
+double predictByTrees(const std::vector<std::vector<TreeNode> > & trees, const float * x)
+{
+    double sum = 0.0;
+    for (size_t iTree = 0; iTree < trees.size(); ++iTree)
+    {
+        const std::vector<TreeNode> & nodes = trees[iTree];
+        size_t i                            = 0;
+        while (!nodes[i].isLeaf)
+        {
+            const TreeNode & node = nodes[i];
+            i                     = (double(x[node.featureIndex]) > node.featureValueOrResponse) ? node.right : i + 1;
+        }
+        sum += nodes[i].featureValueOrResponse;
+    }
+    return sum;
+}
+
+size_t countMismatches(const std::vector<std::vector<TreeNode> > & trees, const NumericTablePtr & data, const NumericTablePtr & prediction)
+{
+    const size_t nRows = data->getNumberOfRows();
+    BlockDescriptor<float> xBlock;
+    BlockDescriptor<float> predictionBlock;
+    data->getBlockOfRows(0, nRows, readOnly, xBlock);
+    prediction->getBlockOfRows(0, nRows, readOnly, predictionBlock);
+
+    size_t nMismatches = 0;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const double expected = predictByTrees(trees, xBlock.getBlockPtr() + i * nFeatures);
+        const double actual   = predictionBlock.getBlockPtr()[i];
+        const double diff     = (expected > actual) ? expected - actual : actual - expected;
+        const double scale    = (expected > 0 ? expected : -expected) + 1.0;
+        if (diff > accuracyThreshold * scale) ++nMismatches;
+    }
+
+    data->releaseBlockOfRows(xBlock);
+    prediction->releaseBlockOfRows(predictionBlock);
+    return nMismatches;
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+}
@@ -0,0 +1,172 @@
+/* file: gbt_reg_quantile_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression with the quantile loss
+!    in the batch processing mode.
+!
+!    The program trains the gradient boosted trees regression model that
+!    predicts the 0.9 quantile of the dependent variable. It checks that the
+!    mean quantile loss of the predictions on the training data set is less
+!    than the mean loss of the 0.9 quantile of the dependent variable, the
+!    best constant approximation, and that most of the training observations
+!    are below the predictions.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_QUANTILE_DENSE_BATCH"></a>
+ * \example gbt_reg_quantile_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures            = 13; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+const double quantileAlpha = 0.9;
+
+const double minCoverage = 0.75; /* Minimal fraction of the training observations below the prediction */
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable);
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data);
+double quantileLoss(double y, double f);
+void getValues(const NumericTablePtr & table, std::vector<double> & values);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    training::ResultPtr trainingResult = trainModel(trainData, trainDependentVariable);
+
+    printNumericTable(testModel(trainingResult, testData), "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+
+    std::vector<double> y;
+    std::vector<double> prediction;
+    getValues(trainDependentVariable, y);
+    getValues(testModel(trainingResult, trainData), prediction);
+
+    std::vector<double> sortedY(y);
+    std::sort(sortedY.begin(), sortedY.end());
+    const double quantile = sortedY[size_t(quantileAlpha * double(sortedY.size() - 1))];
+
+    double modelLoss    = 0.0;
+    double constantLoss = 0.0;
+    size_t nBelow       = 0;
+    for (size_t i = 0; i < y.size(); ++i)
+    {
+        modelLoss += quantileLoss(y[i], prediction[i]);
+        constantLoss += quantileLoss(y[i], quantile);
+        nBelow += (y[i] <= prediction[i]);
+    }
+    modelLoss /= double(y.size());
+    constantLoss /= double(y.size());
+    const double coverage = double(nBelow) / double(y.size());
+
+    std::cout << "Mean quantile loss of the model on the training data set: " << modelLoss << std::endl;
+    std::cout << "Mean quantile loss of the 0.9 quantile on the training data set: " << constantLoss << std::endl;
+    std::cout << "Fraction of the training observations below the prediction: " << coverage << std::endl;
+
+    const bool bMatch = (modelLoss < constantLoss) && (coverage >= minCoverage);
+    std::cout << (bMatch ? "Results match" : "Results differ") << std::endl;
+
+    return bMatch ? 0 : -1;
+}
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable)
+{
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, dependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.parameter().loss          = training::quantile;
+    algorithm.parameter().quantileAlpha = quantileAlpha;
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data)
+{
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+double quantileLoss(double y, double f)
+{
+    const double r = y - f;
+    return (r > 0) ? quantileAlpha * r : (quantileAlpha - 1.0) * r;
+}
+
+void getValues(const NumericTablePtr & table, std::vector<double> & values)
+{
+    const size_t nRows = table->getNumberOfRows();
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, nRows, readOnly, block);
+    values.assign(block.getBlockPtr(), block.getBlockPtr() + nRows);
+    table->releaseBlockOfRows(block);
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+}
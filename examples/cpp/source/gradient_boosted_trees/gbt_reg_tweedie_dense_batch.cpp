@@ -0,0 +1,173 @@
+/* file: gbt_reg_tweedie_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression with the tweedie loss
+!    in the batch processing mode.
+!
+!    The program trains the gradient boosted trees regression model with the
+!    tweedie loss with the variance power 1.5 and the log link. It checks that
+!    the predictions, the means of the dependent variable, are positive, and
+!    that the mean loss of the predictions on the training data set is less
+!    than the mean loss of the mean of the dependent variable, the best
+!    constant approximation.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_TWEEDIE_DENSE_BATCH"></a>
+ * \example gbt_reg_tweedie_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+const string trainDatasetFileName = "../data/batch/df_regression_train.csv";
+const string testDatasetFileName  = "../data/batch/df_regression_test.csv";
+const size_t nFeatures            = 13; /* Number of features in training and testing data sets */
+
+/* Gradient boosted trees training parameters */
+const size_t maxIterations = 40;
+const double tweediePower  = 1.5;
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable);
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data);
+double tweedieLoss(double y, double mean);
+void getValues(const NumericTablePtr & table, std::vector<double> & values);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainDependentVariable;
+    loadData(trainDatasetFileName, trainData, trainDependentVariable);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    training::ResultPtr trainingResult = trainModel(trainData, trainDependentVariable);
+
+    printNumericTable(testModel(trainingResult, testData), "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+
+    std::vector<double> y;
+    std::vector<double> prediction;
+    getValues(trainDependentVariable, y);
+    getValues(testModel(trainingResult, trainData), prediction);
+
+    double mean = 0.0;
+    for (size_t i = 0; i < y.size(); ++i) mean += y[i];
+    mean /= double(y.size());
+
+    double modelLoss    = 0.0;
+    double constantLoss = 0.0;
+    size_t nNonPositive = 0;
+    for (size_t i = 0; i < y.size(); ++i)
+    {
+        if (prediction[i] <= 0)
+        {
+            ++nNonPositive;
+            continue;
+        }
+        modelLoss += tweedieLoss(y[i], prediction[i]);
+        constantLoss += tweedieLoss(y[i], mean);
+    }
+    modelLoss /= double(y.size());
+    constantLoss /= double(y.size());
+
+    std::cout << "Number of non-positive predictions on the training data set: " << nNonPositive << std::endl;
+    std::cout << "Mean tweedie loss of the model on the training data set: " << modelLoss << std::endl;
+    std::cout << "Mean tweedie loss of the mean on the training data set: " << constantLoss << std::endl;
+
+    const bool bMatch = !nNonPositive && (modelLoss < constantLoss);
+    std::cout << (bMatch ? "Results match" : "Results differ") << std::endl;
+
+    return bMatch ? 0 : -1;
+}
+
+training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariable)
+{
+    /* Create an algorithm object to train the gradient boosted trees regression model with the default method */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariable, dependentVariable);
+
+    algorithm.parameter().maxIterations = maxIterations;
+    algorithm.parameter().loss          = training::tweedie;
+    algorithm.parameter().tweediePower  = tweediePower;
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const training::ResultPtr & trainingResult, const NumericTablePtr & data)
+{
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, data);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+/* Tweedie negative log-likelihood up to the terms independent of the mean */
+double tweedieLoss(double y, double mean)
+{
+    return -y * std::pow(mean, 1.0 - tweediePower) / (1.0 - tweediePower) + std::pow(mean, 2.0 - tweediePower) / (2.0 - tweediePower);
+}
+
+void getValues(const NumericTablePtr & table, std::vector<double> & values)
+{
+    const size_t nRows = table->getNumberOfRows();
+    BlockDescriptor<double> block;
+    table->getBlockOfRows(0, nRows, readOnly, block);
+    values.assign(block.getBlockPtr(), block.getBlockPtr() + nRows);
+    table->releaseBlockOfRows(block);
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pDependentVar)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::notAllocate));
+    pDependentVar.reset(new HomogenNumericTable<>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pDependentVar));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+}
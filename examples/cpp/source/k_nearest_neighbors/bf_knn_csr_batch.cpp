@@ -0,0 +1,162 @@
+/* file: bf_knn_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of brute force k-Nearest Neighbor in the batch processing mode
+!    with the data stored in the compressed sparse rows (CSR) format.
+!
+!    The program stores the training and test data in homogeneous and CSR
+!    numeric tables. The distances are computed with GEMM when both the
+!    training and the test data are dense and with the sparse matrix
+!    multiplication when any of them is in the CSR format. The program checks
+!    that the predictions for all four combinations of the layouts match.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-BF_KNN_CSR_BATCH"></a>
+ * \example bf_knn_csr_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/k_nearest_neighbors_train.csv";
+string testDatasetFileName  = "../data/batch/k_nearest_neighbors_test.csv";
+
+const size_t nFeatures = 5;
+const size_t nClasses  = 5;
+
+/* The distances computed in different ways differ in rounding, so the neighbors at almost equal distances may be swapped */
+const double maxMismatchFraction = 0.01;
+
+classifier::ModelPtr trainModel(const NumericTablePtr & trainData, const NumericTablePtr & trainGroundTruth);
+NumericTablePtr testModel(const classifier::ModelPtr & model, const NumericTablePtr & testData);
+NumericTablePtr toCSR(const NumericTablePtr & table);
+size_t countMismatches(const NumericTablePtr & a, const NumericTablePtr & b);
+void loadData(const string & fileName, NumericTablePtr & data, NumericTablePtr & groundTruth);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainGroundTruth;
+    loadData(trainDatasetFileName, trainData, trainGroundTruth);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    NumericTablePtr csrTrainData = toCSR(trainData);
+    NumericTablePtr csrTestData  = toCSR(testData);
+
+    /* Train the models on the dense and the CSR data */
+    classifier::ModelPtr denseModel = trainModel(trainData, trainGroundTruth);
+    classifier::ModelPtr csrModel   = trainModel(csrTrainData, trainGroundTruth);
+
+    /* Predict the test data in all combinations of the layouts */
+    NumericTablePtr densePrediction        = testModel(denseModel, testData);
+    NumericTablePtr csrTestPrediction      = testModel(denseModel, csrTestData);
+    NumericTablePtr csrTrainPrediction     = testModel(csrModel, testData);
+    NumericTablePtr csrTrainTestPrediction = testModel(csrModel, csrTestData);
+
+    printNumericTables<int, int>(testGroundTruth, csrTrainTestPrediction, "Ground truth", "Classification results",
+                                 "BF kNN classification results, CSR data (first 20 observations):", 20);
+
+    const size_t nRows       = testData->getNumberOfRows();
+    const size_t nMismatches = countMismatches(densePrediction, csrTestPrediction) + countMismatches(densePrediction, csrTrainPrediction)
+                               + countMismatches(densePrediction, csrTrainTestPrediction);
+    std::cout << "Number of predictions different from the dense data: " << nMismatches << " of " << 3 * nRows << std::endl;
+
+    const bool bMatch = (double(nMismatches) <= maxMismatchFraction * double(3 * nRows));
+    std::cout << (bMatch ? "Results match" : "Results differ") << std::endl;
+
+    return bMatch ? 0 : -1;
+}
+
+classifier::ModelPtr trainModel(const NumericTablePtr & trainData, const NumericTablePtr & trainGroundTruth)
+{
+    /* Create an algorithm object to train the BF kNN model */
+    bf_knn_classification::training::Batch<> algorithm;
+
+    /* Pass the training data set and dependent values to the algorithm */
+    algorithm.getInput()->set(classifier::training::data, trainData);
+    algorithm.getInput()->set(classifier::training::labels, trainGroundTruth);
+    algorithm.parameter().nClasses = nClasses;
+
+    /* Train the BF kNN model */
+    algorithm.compute();
+
+    /* Retrieve the results of the training algorithm */
+    return algorithm.getResult()->get(classifier::training::model);
+}
+
+NumericTablePtr testModel(const classifier::ModelPtr & model, const NumericTablePtr & testData)
+{
+    /* Create an algorithm object for BF kNN prediction with the default method */
+    bf_knn_classification::prediction::Batch<> algorithm;
+
+    /* Pass the testing data set and trained model to the algorithm */
+    algorithm.getInput()->set(classifier::prediction::data, testData);
+    algorithm.getInput()->set(classifier::prediction::model, model);
+    algorithm.parameter().nClasses = nClasses;
+
+    /* Compute prediction results */
+    algorithm.compute();
+
+    /* Retrieve algorithm results */
+    return algorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+size_t countMismatches(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    BlockDescriptor<int> blockA;
+    BlockDescriptor<int> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const int * pA = blockA.getBlockPtr();
+    const int * pB = blockB.getBlockPtr();
+
+    size_t nMismatches = 0;
+    for (size_t i = 0; i < nRows; ++i) nMismatches += (pA[i] != pB[i]);
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return nMismatches;
+}
+
+void loadData(const string & fileName, NumericTablePtr & data, NumericTablePtr & groundTruth)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and labels */
+    data.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    groundTruth.reset(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(data, groundTruth));
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
@@ -0,0 +1,156 @@
+/* file: bf_knn_ivf_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of brute force k-Nearest Neighbor in the batch processing mode
+!    with the inverted file index.
+!
+!    The program trains two brute force kNN models: one with the default method
+!    that searches all training observations exactly and one with the ivfDense
+!    method that searches only the inverted lists closest to the observation.
+!    Then it compares the predictions of both models on the test data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-BF_KNN_IVF_DENSE_BATCH"></a>
+ * \example bf_knn_ivf_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/k_nearest_neighbors_train.csv";
+string testDatasetFileName  = "../data/batch/k_nearest_neighbors_test.csv";
+
+const size_t nFeatures = 5;
+const size_t nClasses  = 5;
+
+/* Inverted file index parameters */
+const size_t nLists  = 16; /* Number of inverted lists built on the training stage */
+const size_t nProbes = 4;  /* Number of inverted lists searched for each observation on the prediction stage */
+
+template <bf_knn_classification::training::Method method>
+classifier::ModelPtr trainModel(const NumericTablePtr & trainData, const NumericTablePtr & trainGroundTruth);
+NumericTablePtr testModel(const classifier::ModelPtr & model, const NumericTablePtr & testData);
+void loadData(const string & fileName, NumericTablePtr & data, NumericTablePtr & groundTruth);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainGroundTruth;
+    loadData(trainDatasetFileName, trainData, trainGroundTruth);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Train the models with the exact search and with the inverted file index */
+    classifier::ModelPtr exactModel = trainModel<bf_knn_classification::training::defaultDense>(trainData, trainGroundTruth);
+    classifier::ModelPtr ivfModel   = trainModel<bf_knn_classification::training::ivfDense>(trainData, trainGroundTruth);
+
+    NumericTablePtr exactPrediction = testModel(exactModel, testData);
+    NumericTablePtr ivfPrediction   = testModel(ivfModel, testData);
+
+    printNumericTables<int, int>(testGroundTruth, exactPrediction, "Ground truth", "Classification results",
+                                 "BF kNN classification results, exact search (first 20 observations):", 20);
+    printNumericTables<int, int>(testGroundTruth, ivfPrediction, "Ground truth", "Classification results",
+                                 "BF kNN classification results, inverted file index (first 20 observations):", 20);
+
+    /* Compare the predictions of the models */
+    const size_t nRows = testData->getNumberOfRows();
+    BlockDescriptor<int> block1;
+    BlockDescriptor<int> block2;
+    exactPrediction->getBlockOfRows(0, nRows, readOnly, block1);
+    ivfPrediction->getBlockOfRows(0, nRows, readOnly, block2);
+    const int * p1 = block1.getBlockPtr();
+    const int * p2 = block2.getBlockPtr();
+
+    size_t nEqual = 0;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        if (p1[i] == p2[i]) ++nEqual;
+    }
+    exactPrediction->releaseBlockOfRows(block1);
+    ivfPrediction->releaseBlockOfRows(block2);
+
+    std::cout << "Predictions equal to the exact search: " << nEqual << " of " << nRows << std::endl;
+
+    return 0;
+}
+
+template <bf_knn_classification::training::Method method>
+classifier::ModelPtr trainModel(const NumericTablePtr & trainData, const NumericTablePtr & trainGroundTruth)
+{
+    /* Create an algorithm object to train the BF kNN model */
+    bf_knn_classification::training::Batch<float, method> algorithm;
+
+    /* Pass the training data set and dependent values to the algorithm */
+    algorithm.getInput()->set(classifier::training::data, trainData);
+    algorithm.getInput()->set(classifier::training::labels, trainGroundTruth);
+    algorithm.parameter().nClasses = nClasses;
+
+    /* Cluster the training data into the inverted lists, used by the ivfDense method only */
+    algorithm.parameter().nLists = nLists;
+
+    /* Train the BF kNN model */
+    algorithm.compute();
+
+    /* Retrieve the results of the training algorithm */
+    return algorithm.getResult()->get(classifier::training::model);
+}
+
+NumericTablePtr testModel(const classifier::ModelPtr & model, const NumericTablePtr & testData)
+{
+    /* Create an algorithm object for BF kNN prediction with the default method */
+    bf_knn_classification::prediction::Batch<> algorithm;
+
+    /* Pass the testing data set and trained model to the algorithm */
+    algorithm.getInput()->set(classifier::prediction::data, testData);
+    algorithm.getInput()->set(classifier::prediction::model, model);
+    algorithm.parameter().nClasses = nClasses;
+
+    /* Search the given number of the closest inverted lists if the model has the index */
+    algorithm.parameter().nProbes = nProbes;
+
+    /* Compute prediction results */
+    algorithm.compute();
+
+    /* Retrieve algorithm results */
+    return algorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+void loadData(const string & fileName, NumericTablePtr & data, NumericTablePtr & groundTruth)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and labels */
+    data.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    groundTruth.reset(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(data, groundTruth));
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
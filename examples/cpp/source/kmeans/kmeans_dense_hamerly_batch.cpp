@@ -0,0 +1,133 @@
+/* file: kmeans_dense_hamerly_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense K-Means clustering with Hamerly's bounds in the batch
+!    processing mode.
+!
+!    The program runs the K-Means algorithm with the lloydDense and
+!    lloydHamerlyDense methods from the same initial centroids and checks that
+!    the assignments and the objective function values match.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_DENSE_HAMERLY_BATCH"></a>
+ * \example kmeans_dense_hamerly_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/kmeans_dense.csv";
+
+/* K-Means algorithm parameters */
+const size_t nClusters   = 20;
+const size_t nIterations = 5;
+
+const float accuracyThreshold = 1e-4f;
+
+template <kmeans::Method method>
+kmeans::ResultPtr runKMeans(const NumericTablePtr & data, const NumericTablePtr & centroids);
+size_t countMismatches(const NumericTablePtr & a, const NumericTablePtr & b);
+float getValue(const NumericTablePtr & table);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+    NumericTablePtr data = dataSource.getNumericTable();
+
+    /* Get initial clusters for the K-Means algorithm */
+    kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+
+    init.input.set(kmeans::init::data, data);
+    init.compute();
+
+    NumericTablePtr centroids = init.getResult()->get(kmeans::init::centroids);
+
+    /* Run the K-Means algorithm with both methods from the same initial centroids */
+    kmeans::ResultPtr lloydResult   = runKMeans<kmeans::lloydDense>(data, centroids);
+    kmeans::ResultPtr hamerlyResult = runKMeans<kmeans::lloydHamerlyDense>(data, centroids);
+
+    /* Print the clusterization results */
+    printNumericTable(hamerlyResult->get(kmeans::assignments), "First 10 cluster assignments:", 10);
+    printNumericTable(hamerlyResult->get(kmeans::centroids), "First 10 dimensions of centroids:", 20, 10);
+    printNumericTable(hamerlyResult->get(kmeans::objectiveFunction), "Objective function value:");
+
+    const size_t nMismatches = countMismatches(lloydResult->get(kmeans::assignments), hamerlyResult->get(kmeans::assignments));
+    const float lloydGoal    = getValue(lloydResult->get(kmeans::objectiveFunction));
+    const float hamerlyGoal  = getValue(hamerlyResult->get(kmeans::objectiveFunction));
+    const float goalDiff     = (lloydGoal > hamerlyGoal ? lloydGoal - hamerlyGoal : hamerlyGoal - lloydGoal) / lloydGoal;
+
+    std::cout << "Number of assignments different from lloydDense: " << nMismatches << std::endl;
+    std::cout << "Relative difference of the objective function from lloydDense: " << goalDiff << std::endl;
+    std::cout << ((nMismatches || goalDiff > accuracyThreshold) ? "Results differ" : "Results match") << std::endl;
+
+    return (nMismatches || goalDiff > accuracyThreshold) ? -1 : 0;
+}
+
+template <kmeans::Method method>
+kmeans::ResultPtr runKMeans(const NumericTablePtr & data, const NumericTablePtr & centroids)
+{
+    /* Create an algorithm object for the K-Means algorithm */
+    kmeans::Batch<float, method> algorithm(nClusters, nIterations);
+
+    algorithm.input.set(kmeans::data, data);
+    algorithm.input.set(kmeans::inputCentroids, centroids);
+
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+size_t countMismatches(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    BlockDescriptor<int> blockA;
+    BlockDescriptor<int> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const int * pA = blockA.getBlockPtr();
+    const int * pB = blockB.getBlockPtr();
+
+    size_t nMismatches = 0;
+    for (size_t i = 0; i < nRows; ++i) nMismatches += (pA[i] != pB[i]);
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return nMismatches;
+}
+
+float getValue(const NumericTablePtr & table)
+{
+    BlockDescriptor<float> block;
+    table->getBlockOfRows(0, 1, readOnly, block);
+    const float value = block.getBlockPtr()[0];
+    table->releaseBlockOfRows(block);
+    return value;
+}
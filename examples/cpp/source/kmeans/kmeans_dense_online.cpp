@@ -0,0 +1,125 @@
+/* file: kmeans_dense_online.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense mini-batch K-Means clustering in the online processing mode
+!
+!    The program checks convergence of the mini-batch algorithm: the objective
+!    function of the whole data set for the computed centroids must be less
+!    than for the initial centroids and close to the one reached by the batch
+!    Lloyd algorithm from the same initial centroids.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_DENSE_ONLINE"></a>
+ * \example kmeans_dense_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string datasetFileName       = "../data/batch/kmeans_dense.csv";
+const size_t nVectorsInBlock = 1000;
+
+/* K-Means algorithm parameters */
+const size_t nClusters        = 20;
+const size_t nBatchIterations = 20;
+
+/* Maximal relative excess of the objective function over the one of the batch algorithm */
+const float convergenceThreshold = 0.1f;
+
+float computeObjectiveFunction(const NumericTablePtr & data, const NumericTablePtr & centroids, size_t nIterations);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the first block of the data from the input file */
+    dataSource.loadDataBlock(nVectorsInBlock);
+
+    /* Get initial clusters for the K-Means algorithm from the first block */
+    kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+
+    init.input.set(kmeans::init::data, dataSource.getNumericTable());
+    init.compute();
+
+    NumericTablePtr centroids = init.getResult()->get(kmeans::init::centroids);
+
+    /* Create an algorithm object for the mini-batch K-Means algorithm in the online processing mode */
+    kmeans::Online<float, kmeans::miniBatchDense> algorithm(nClusters);
+
+    algorithm.input.set(kmeans::inputCentroids, centroids);
+
+    /* Every block of the data is a mini-batch that moves the centroids */
+    do
+    {
+        algorithm.input.set(kmeans::data, dataSource.getNumericTable());
+        algorithm.compute();
+    } while (dataSource.loadDataBlock(nVectorsInBlock) == nVectorsInBlock);
+
+    /* Compute the centroids from the partial result */
+    algorithm.finalizeCompute();
+
+    /* Print the clusterization results */
+    printNumericTable(algorithm.getResult()->get(kmeans::centroids), "First 10 dimensions of centroids:", 20, 10);
+    printNumericTable(algorithm.getResult()->get(kmeans::objectiveFunction), "Objective function value:");
+
+    /* Evaluate the centroids on the whole data set */
+    FileDataSource<CSVFeatureManager> fullDataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+    fullDataSource.loadDataBlock();
+    NumericTablePtr data = fullDataSource.getNumericTable();
+
+    const float initialGoal = computeObjectiveFunction(data, centroids, 0);
+    const float onlineGoal  = computeObjectiveFunction(data, algorithm.getResult()->get(kmeans::centroids), 0);
+    const float batchGoal   = computeObjectiveFunction(data, centroids, nBatchIterations);
+
+    std::cout << "Objective function for the initial centroids: " << initialGoal << std::endl;
+    std::cout << "Objective function for the mini-batch centroids: " << onlineGoal << std::endl;
+    std::cout << "Objective function for the batch Lloyd centroids: " << batchGoal << std::endl;
+
+    const bool converged = (onlineGoal < initialGoal) && (onlineGoal <= batchGoal * (1.0f + convergenceThreshold));
+    std::cout << (converged ? "Mini-batch K-Means converged" : "Mini-batch K-Means did not converge") << std::endl;
+
+    return converged ? 0 : -1;
+}
+
+float computeObjectiveFunction(const NumericTablePtr & data, const NumericTablePtr & centroids, size_t nIterations)
+{
+    /* Create an algorithm object for the batch K-Means algorithm, zero iterations only assign the observations */
+    kmeans::Batch<> algorithm(nClusters, nIterations);
+
+    algorithm.input.set(kmeans::data, data);
+    algorithm.input.set(kmeans::inputCentroids, centroids);
+
+    algorithm.compute();
+
+    BlockDescriptor<float> block;
+    NumericTablePtr goal = algorithm.getResult()->get(kmeans::objectiveFunction);
+    goal->getBlockOfRows(0, 1, readOnly, block);
+    const float value = block.getBlockPtr()[0];
+    goal->releaseBlockOfRows(block);
+    return value;
+}
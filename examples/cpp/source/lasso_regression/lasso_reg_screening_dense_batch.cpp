@@ -0,0 +1,151 @@
+/* file: lasso_reg_screening_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of multiple lasso regression with the active set screening
+!    of the coordinate descent solver in the batch processing mode.
+!
+!    The program trains the multiple lasso regression models with the
+!    coordinate descent solvers that sweep all coordinates and that sweep only
+!    the non-zero coordinates between the full sweeps. It checks that the
+!    coefficients of the models match.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LASSO_REG_SCREENING_DENSE_BATCH"></a>
+ * \example lasso_reg_screening_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::lasso_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training and testing data sets */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+
+/* Lasso regression and coordinate descent parameters */
+const float lassoParameter    = 0.1f;
+const size_t nIterations      = 10000;
+const double solverAccuracy   = 1e-7;
+const float accuracyThreshold = 1e-3f;
+
+NumericTablePtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariables, bool activeSetScreening);
+float maxRelativeDifference(const NumericTablePtr & a, const NumericTablePtr & b);
+size_t countZeros(const NumericTablePtr & table);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainDependentVariables(new HomogenNumericTable<>(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(trainData, trainDependentVariables));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Train the models without and with the active set screening */
+    NumericTablePtr fullSweepBeta = trainModel(trainData, trainDependentVariables, false);
+    NumericTablePtr screeningBeta = trainModel(trainData, trainDependentVariables, true);
+
+    printNumericTable(fullSweepBeta, "LASSO Regression coefficients without screening:");
+    printNumericTable(screeningBeta, "LASSO Regression coefficients with screening:");
+
+    const float diff = maxRelativeDifference(fullSweepBeta, screeningBeta);
+    std::cout << "Number of zero coefficients without screening: " << countZeros(fullSweepBeta) << std::endl;
+    std::cout << "Number of zero coefficients with screening: " << countZeros(screeningBeta) << std::endl;
+    std::cout << "Maximal relative difference of the coefficients: " << diff << std::endl;
+    std::cout << ((diff <= accuracyThreshold) ? "Results match" : "Results differ") << std::endl;
+
+    return (diff <= accuracyThreshold) ? 0 : -1;
+}
+
+NumericTablePtr trainModel(const NumericTablePtr & data, const NumericTablePtr & dependentVariables, bool activeSetScreening)
+{
+    /* Create the coordinate descent solver with the same settings as the default lasso regression solver */
+    services::SharedPtr<optimization_solver::coordinate_descent::Batch<> > solver(new optimization_solver::coordinate_descent::Batch<>());
+    solver->parameter().nIterations            = nIterations;
+    solver->parameter().accuracyThreshold      = solverAccuracy;
+    solver->parameter().selection              = optimization_solver::coordinate_descent::cyclic;
+    solver->parameter().skipTheFirstComponents = true;
+    solver->parameter().activeSetScreening     = activeSetScreening;
+
+    /* Create an algorithm object to train the multiple lasso regression model with the coordinate descent solver */
+    training::Batch<> algorithm(solver);
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, data);
+    algorithm.input.set(training::dependentVariables, dependentVariables);
+    algorithm.parameter().lassoParameters =
+        NumericTablePtr(new HomogenNumericTable<>(nDependentVariables, 1, NumericTable::doAllocate, lassoParameter));
+
+    /* Build the multiple lasso regression model */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(training::model)->getBeta();
+}
+
+float maxRelativeDifference(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    const size_t nCols = a->getNumberOfColumns();
+    BlockDescriptor<float> blockA;
+    BlockDescriptor<float> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const float * pA = blockA.getBlockPtr();
+    const float * pB = blockB.getBlockPtr();
+
+    float diff = 0.0f;
+    for (size_t i = 0; i < nRows * nCols; ++i)
+    {
+        const float d     = (pA[i] > pB[i]) ? pA[i] - pB[i] : pB[i] - pA[i];
+        const float scale = (pA[i] > 0 ? pA[i] : -pA[i]) + 1.0f;
+        if (d / scale > diff) diff = d / scale;
+    }
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return diff;
+}
+
+size_t countZeros(const NumericTablePtr & table)
+{
+    const size_t nRows = table->getNumberOfRows();
+    const size_t nCols = table->getNumberOfColumns();
+    BlockDescriptor<float> block;
+    table->getBlockOfRows(0, nRows, readOnly, block);
+    const float * values = block.getBlockPtr();
+
+    size_t nZeros = 0;
+    for (size_t i = 0; i < nRows * nCols; ++i) nZeros += (values[i] == 0.0f);
+
+    table->releaseBlockOfRows(block);
+    return nZeros;
+}
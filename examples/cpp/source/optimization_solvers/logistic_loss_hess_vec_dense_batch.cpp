@@ -0,0 +1,131 @@
+/* file: logistic_loss_hess_vec_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the product of the hessian of the logistic loss objective
+!    function and a vector in the batch processing mode.
+!
+!    The program computes the hessian-vector product without forming the
+!    hessian and checks that it matches the product of the explicitly
+!    computed hessian and the same vector.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOGISTIC_LOSS_HESS_VEC_DENSE_BATCH"></a>
+ * \example logistic_loss_hess_vec_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <vector>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::optimization_solver;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/XM_100.csv";
+const size_t nFeatures       = 100; /* Number of features in the data set */
+const size_t nParameters     = nFeatures + 1;
+
+/* Logistic loss parameters */
+const float penaltyL2 = 0.1f;
+
+const float accuracyThreshold = 1e-3f;
+
+float maxRelativeDifference(const std::vector<float> & a, const NumericTablePtr & b);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for input data and dependent variables */
+    NumericTablePtr data(new HomogenNumericTable<float>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr dependentVariables(new HomogenNumericTable<float>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(data, dependentVariables));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+
+    /* Set the argument of the objective function and the vector the hessian is multiplied by */
+    std::vector<float> argument(nParameters);
+    std::vector<float> direction(nParameters);
+    for (size_t i = 0; i < nParameters; ++i)
+    {
+        argument[i]  = float(i % 7) * 0.01f - 0.03f;
+        direction[i] = float((i * 13) % 11) * 0.1f - 0.5f;
+    }
+
+    /* Create an algorithm object to compute the logistic loss objective function */
+    logistic_loss::Batch<float> func(data->getNumberOfRows());
+    func.input.set(logistic_loss::data, data);
+    func.input.set(logistic_loss::dependentVariables, dependentVariables);
+    func.input.set(logistic_loss::argument, HomogenNumericTable<float>::create(&argument[0], 1, nParameters));
+    func.input.set(logistic_loss::direction, HomogenNumericTable<float>::create(&direction[0], 1, nParameters));
+
+    func.parameter().penaltyL2        = penaltyL2;
+    func.parameter().interceptFlag    = true;
+    func.parameter().resultsToCompute = objective_function::hessian | objective_function::hessianVectorProduct;
+
+    /* Compute the hessian and the hessian-vector product */
+    func.compute();
+
+    NumericTablePtr hessian              = func.getResult()->get(objective_function::hessianIdx);
+    NumericTablePtr hessianVectorProduct = func.getResult()->get(objective_function::hessianVectorProductIdx);
+    printNumericTable(hessianVectorProduct, "Hessian-vector product (first 10 rows):", 10);
+
+    /* Multiply the explicitly computed hessian by the vector */
+    BlockDescriptor<float> hessianBlock;
+    hessian->getBlockOfRows(0, nParameters, readOnly, hessianBlock);
+    const float * h = hessianBlock.getBlockPtr();
+    std::vector<float> product(nParameters, 0.0f);
+    for (size_t i = 0; i < nParameters; ++i)
+        for (size_t j = 0; j < nParameters; ++j) product[i] += h[i * nParameters + j] * direction[j];
+    hessian->releaseBlockOfRows(hessianBlock);
+
+    const float diff = maxRelativeDifference(product, hessianVectorProduct);
+    std::cout << "Maximal relative difference from the product of the hessian and the vector: " << diff << std::endl;
+
+    const bool bMatch = (diff <= accuracyThreshold);
+    std::cout << (bMatch ? "Results match" : "Results differ") << std::endl;
+
+    return bMatch ? 0 : -1;
+}
+
+float maxRelativeDifference(const std::vector<float> & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a.size();
+    BlockDescriptor<float> block;
+    b->getBlockOfRows(0, nRows, readOnly, block);
+    const float * pB = block.getBlockPtr();
+
+    float diff = 0.0f;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const float d     = (a[i] > pB[i]) ? a[i] - pB[i] : pB[i] - a[i];
+        const float scale = (a[i] > 0 ? a[i] : -a[i]) + 1.0f;
+        if (d / scale > diff) diff = d / scale;
+    }
+
+    b->releaseBlockOfRows(block);
+    return diff;
+}
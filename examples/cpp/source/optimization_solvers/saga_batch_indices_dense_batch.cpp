@@ -0,0 +1,163 @@
+/* file: saga_batch_indices_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the SAGA algorithm with the user-defined indices of the
+!    terms in the mini-batches.
+!
+!    The program checks that:
+!     - the default size of the batch is 1,
+!     - the table of the batch indices must have nIterations rows and
+!       batchSize columns,
+!     - the mini-batches that repeat the same term batchSize times give the
+!       same minimum as the batches of size 1 with this term.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SAGA_BATCH_INDICES_DENSE_BATCH"></a>
+ * \example saga_batch_indices_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+const string datasetFileName = "../data/batch/lbfgs.csv";
+const size_t nFeatures       = 10; /* Number of features in training and testing data sets */
+
+/* SAGA algorithm parameters */
+const size_t nIterations = 1000;
+const size_t batchSize   = 4;
+
+const float accuracyThreshold = 1e-5f;
+
+NumericTablePtr createBatchIndices(size_t nTerms, size_t nColumns);
+NumericTablePtr computeMinimum(const optimization_solver::sum_of_functions::BatchPtr & function, const NumericTablePtr & batchIndices,
+                               size_t nColumns);
+float maxRelativeDifference(const NumericTablePtr & a, const NumericTablePtr & b);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for input data and dependent variables */
+    NumericTablePtr data(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr dependentVariables(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(data, dependentVariables));
+
+    /* Retrieve the data from input file */
+    dataSource.loadDataBlock(mergedData.get());
+
+    const size_t nTerms = data->getNumberOfRows();
+    services::SharedPtr<optimization_solver::mse::Batch<> > mseObjectiveFunction(new optimization_solver::mse::Batch<>(nTerms));
+    mseObjectiveFunction->input.set(optimization_solver::mse::data, data);
+    mseObjectiveFunction->input.set(optimization_solver::mse::dependentVariables, dependentVariables);
+
+    /* The default SAGA algorithm uses one term of the objective function at each iteration */
+    optimization_solver::saga::Batch<> defaultAlgorithm(mseObjectiveFunction);
+    const bool bDefaultBatchSize = (defaultAlgorithm.parameter().batchSize == 1);
+    std::cout << "Default batch size: " << defaultAlgorithm.parameter().batchSize << std::endl;
+
+    /* The table of the batch indices with one column does not fit the batch of size batchSize */
+    optimization_solver::saga::Batch<> checkAlgorithm(mseObjectiveFunction);
+    checkAlgorithm.parameter().nIterations  = nIterations;
+    checkAlgorithm.parameter().batchSize    = batchSize;
+    checkAlgorithm.parameter().batchIndices = createBatchIndices(nTerms, 1);
+    const bool bWrongShapeRejected          = !checkAlgorithm.parameter().check();
+    checkAlgorithm.parameter().batchIndices = createBatchIndices(nTerms, batchSize);
+    const bool bShapeAccepted               = checkAlgorithm.parameter().check();
+    std::cout << "Batch indices of size " << nIterations << " x 1 are " << (bWrongShapeRejected ? "rejected" : "accepted") << std::endl;
+    std::cout << "Batch indices of size " << nIterations << " x " << batchSize << " are " << (bShapeAccepted ? "accepted" : "rejected")
+              << std::endl;
+
+    /* Run the SAGA algorithm with the batches of one term and with the batches that repeat this term */
+    NumericTablePtr singleTermMinimum   = computeMinimum(mseObjectiveFunction, createBatchIndices(nTerms, 1), 1);
+    NumericTablePtr repeatedTermMinimum = computeMinimum(mseObjectiveFunction, createBatchIndices(nTerms, batchSize), batchSize);
+
+    printNumericTable(singleTermMinimum, "Minimum for the batches of one term:");
+    printNumericTable(repeatedTermMinimum, "Minimum for the batches of the repeated term:");
+
+    const float diff = maxRelativeDifference(singleTermMinimum, repeatedTermMinimum);
+    std::cout << "Maximal relative difference of the minimums: " << diff << std::endl;
+
+    const bool bMatch = bDefaultBatchSize && bWrongShapeRejected && bShapeAccepted && (diff <= accuracyThreshold);
+    std::cout << (bMatch ? "Results match" : "Results differ") << std::endl;
+
+    return bMatch ? 0 : -1;
+}
+
+NumericTablePtr createBatchIndices(size_t nTerms, size_t nColumns)
+{
+    /* Each row of the table repeats the same index of the term nColumns times */
+    services::SharedPtr<HomogenNumericTable<int> > batchIndices = HomogenNumericTable<int>::create(nColumns, nIterations, NumericTable::doAllocate);
+    checkPtr(batchIndices.get());
+    int * indices = batchIndices->getArray();
+    for (size_t i = 0; i < nIterations; ++i)
+        for (size_t j = 0; j < nColumns; ++j) indices[i * nColumns + j] = int((i * 7919) % nTerms);
+    return batchIndices;
+}
+
+NumericTablePtr computeMinimum(const optimization_solver::sum_of_functions::BatchPtr & function, const NumericTablePtr & batchIndices,
+                               size_t nColumns)
+{
+    /* Create objects to compute the SAGA result using the default method */
+    optimization_solver::saga::Batch<> sagaAlgorithm(function);
+
+    /* Set input objects for the the SAGA algorithm */
+    sagaAlgorithm.input.set(optimization_solver::iterative_solver::inputArgument,
+                            HomogenNumericTable<>::create(1, nFeatures + 1, NumericTable::doAllocate, 0.0f));
+    sagaAlgorithm.parameter().nIterations       = nIterations;
+    sagaAlgorithm.parameter().accuracyThreshold = 0.0;
+    sagaAlgorithm.parameter().batchSize         = nColumns;
+    sagaAlgorithm.parameter().batchIndices      = batchIndices;
+
+    /* Compute the SAGA result */
+    sagaAlgorithm.compute();
+
+    return sagaAlgorithm.getResult()->get(optimization_solver::iterative_solver::minimum);
+}
+
+float maxRelativeDifference(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    BlockDescriptor<float> blockA;
+    BlockDescriptor<float> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const float * pA = blockA.getBlockPtr();
+    const float * pB = blockB.getBlockPtr();
+
+    float diff = 0.0f;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const float d     = (pA[i] > pB[i]) ? pA[i] - pB[i] : pB[i] - pA[i];
+        const float scale = (pA[i] > 0 ? pA[i] : -pA[i]) + 1.0f;
+        if (d / scale > diff) diff = d / scale;
+    }
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return diff;
+}
@@ -0,0 +1,163 @@
+/* file: svm_two_class_lru_cache_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of two-class support vector machine (SVM) classification
+!    with the least recently used (LRU) cache of the kernel matrix rows.
+!
+!    The program trains the SVM models with the Boser method and the
+!    shrinking optimization twice: with the cache large enough for the whole
+!    kernel matrix and with the cache that holds only a part of its rows, so
+!    the rows are evicted and recomputed. It checks that the predictions of
+!    both models match.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SVM_TWO_CLASS_LRU_CACHE_BATCH"></a>
+ * \example svm_two_class_lru_cache_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/svm_two_class_train_dense.csv";
+
+string testDatasetFileName = "../data/batch/svm_two_class_test_dense.csv";
+
+const size_t nFeatures = 20;
+
+/* Cache sizes in bytes: the whole kernel matrix of 2000 observations and 100 of its rows */
+const size_t fullCacheSize = 40000000;
+const size_t lruCacheSize  = 100 * 2000 * sizeof(float);
+
+/* Number of iterations between the shrinking steps */
+const size_t shrinkingStep = 100;
+
+/* Parameters for the SVM kernel function */
+kernel_function::KernelIfacePtr kernel(new kernel_function::rbf::Batch<>());
+
+const float accuracyThreshold = 1e-3f;
+
+svm::training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & labels, size_t cacheSize);
+NumericTablePtr testModel(const svm::training::ResultPtr & trainingResult, const NumericTablePtr & data);
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pLabels);
+float maxAbsDifference(const NumericTablePtr & a, const NumericTablePtr & b);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    NumericTablePtr trainData;
+    NumericTablePtr trainGroundTruth;
+    loadData(trainDatasetFileName, trainData, trainGroundTruth);
+
+    NumericTablePtr testData;
+    NumericTablePtr testGroundTruth;
+    loadData(testDatasetFileName, testData, testGroundTruth);
+
+    /* Train and test the models with the full cache and with the LRU cache */
+    NumericTablePtr fullCachePrediction = testModel(trainModel(trainData, trainGroundTruth, fullCacheSize), testData);
+    NumericTablePtr lruCachePrediction  = testModel(trainModel(trainData, trainGroundTruth, lruCacheSize), testData);
+
+    printNumericTables<float, float>(fullCachePrediction, lruCachePrediction, "Full cache", "LRU cache",
+                                     "SVM classification results (first 20 observations):", 20);
+
+    const float diff = maxAbsDifference(fullCachePrediction, lruCachePrediction);
+    std::cout << "Maximal absolute difference of the results: " << diff << std::endl;
+    std::cout << ((diff <= accuracyThreshold) ? "Results match" : "Results differ") << std::endl;
+
+    return (diff <= accuracyThreshold) ? 0 : -1;
+}
+
+svm::training::ResultPtr trainModel(const NumericTablePtr & data, const NumericTablePtr & labels, size_t cacheSize)
+{
+    /* Create an algorithm object to train the SVM model with the Boser method */
+    svm::training::Batch<float, svm::training::boser> algorithm;
+
+    algorithm.parameter.kernel        = kernel;
+    algorithm.parameter.cacheSize     = cacheSize;
+    algorithm.parameter.doShrinking   = true;
+    algorithm.parameter.shrinkingStep = shrinkingStep;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, data);
+    algorithm.input.set(classifier::training::labels, labels);
+
+    /* Build the SVM model */
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const svm::training::ResultPtr & trainingResult, const NumericTablePtr & data)
+{
+    /* Create an algorithm object to predict SVM values */
+    svm::prediction::Batch<> algorithm;
+
+    algorithm.parameter.kernel = kernel;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, data);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+
+    /* Predict SVM values */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+void loadData(const std::string & fileName, NumericTablePtr & pData, NumericTablePtr & pLabels)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(fileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for the data and labels */
+    pData.reset(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    pLabels.reset(new HomogenNumericTable<>(1, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(pData, pLabels));
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(mergedData.get());
+}
+
+float maxAbsDifference(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    BlockDescriptor<float> blockA;
+    BlockDescriptor<float> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const float * pA = blockA.getBlockPtr();
+    const float * pB = blockB.getBlockPtr();
+
+    float diff = 0.0f;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const float d = (pA[i] > pB[i]) ? pA[i] - pB[i] : pB[i] - pA[i];
+        if (d > diff) diff = d;
+    }
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return diff;
+}
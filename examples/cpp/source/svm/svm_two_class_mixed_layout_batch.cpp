@@ -0,0 +1,168 @@
+/* file: svm_two_class_mixed_layout_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of two-class support vector machine (SVM) classification
+!    with the test data and the support vectors stored in different layouts.
+!
+!    The program trains the SVM model on CSR data, so the support vectors are
+!    stored in a CSR numeric table. Then it computes predictions for the test
+!    data stored in the CSR format and for the same data stored in a dense
+!    numeric table, and checks that the results match.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SVM_TWO_CLASS_MIXED_LAYOUT_BATCH"></a>
+ * \example svm_two_class_mixed_layout_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/svm_two_class_train_csr.csv";
+string trainLabelsFileName  = "../data/batch/svm_two_class_train_labels.csv";
+
+string testDatasetFileName = "../data/batch/svm_two_class_test_csr.csv";
+
+/* Parameters for the SVM kernel functions */
+kernel_function::KernelIfacePtr csrKernel(new kernel_function::linear::Batch<float, kernel_function::linear::fastCSR>());
+kernel_function::KernelIfacePtr denseKernel(new kernel_function::linear::Batch<float, kernel_function::linear::defaultDense>());
+
+const float accuracyThreshold = 1e-4f;
+
+svm::training::ResultPtr trainModel();
+NumericTablePtr testModel(const svm::training::ResultPtr & trainingResult, const NumericTablePtr & testData,
+                          const kernel_function::KernelIfacePtr & kernel);
+NumericTablePtr toDense(const NumericTablePtr & table);
+float maxAbsDifference(const NumericTablePtr & a, const NumericTablePtr & b);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 3, &trainDatasetFileName, &trainLabelsFileName, &testDatasetFileName);
+
+    svm::training::ResultPtr trainingResult = trainModel();
+
+    NumericTablePtr csrTestData(createSparseTable<float>(testDatasetFileName));
+    NumericTablePtr denseTestData = toDense(csrTestData);
+
+    /* Both the test data and the support vectors are in the CSR format */
+    NumericTablePtr csrPrediction = testModel(trainingResult, csrTestData, csrKernel);
+    /* The test data is dense while the support vectors are in the CSR format */
+    NumericTablePtr mixedPrediction = testModel(trainingResult, denseTestData, denseKernel);
+
+    printNumericTables<float, float>(csrPrediction, mixedPrediction, "CSR data\t", "Dense data",
+                                     "SVM classification results (first 20 observations):", 20);
+
+    const float diff = maxAbsDifference(csrPrediction, mixedPrediction);
+    std::cout << "Maximal absolute difference of the results: " << diff << std::endl;
+    std::cout << ((diff <= accuracyThreshold) ? "Results match" : "Results differ") << std::endl;
+
+    return (diff <= accuracyThreshold) ? 0 : -1;
+}
+
+svm::training::ResultPtr trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainLabelsDataSource(trainLabelsFileName, DataSource::doAllocateNumericTable,
+                                                            DataSource::doDictionaryFromContext);
+
+    /* Create numeric table for training data */
+    CSRNumericTablePtr trainData(createSparseTable<float>(trainDatasetFileName));
+
+    /* Retrieve the data from the input file */
+    trainLabelsDataSource.loadDataBlock();
+
+    /* Create an algorithm object to train the SVM model */
+    svm::training::Batch<> algorithm;
+
+    algorithm.parameter.kernel    = csrKernel;
+    algorithm.parameter.cacheSize = 40000000;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainLabelsDataSource.getNumericTable());
+
+    /* Build the SVM model with the support vectors stored in the CSR format */
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+NumericTablePtr testModel(const svm::training::ResultPtr & trainingResult, const NumericTablePtr & testData,
+                          const kernel_function::KernelIfacePtr & kernel)
+{
+    /* Create an algorithm object to predict SVM values */
+    svm::prediction::Batch<> algorithm;
+
+    algorithm.parameter.kernel = kernel;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data, testData);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+
+    /* Predict SVM values */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+NumericTablePtr toDense(const NumericTablePtr & table)
+{
+    const size_t nRows = table->getNumberOfRows();
+    const size_t nCols = table->getNumberOfColumns();
+    NumericTablePtr dense(new HomogenNumericTable<float>(nCols, nRows, NumericTable::doAllocate));
+
+    /* A CSR numeric table returns its rows in the dense format */
+    BlockDescriptor<float> src;
+    BlockDescriptor<float> dst;
+    table->getBlockOfRows(0, nRows, readOnly, src);
+    dense->getBlockOfRows(0, nRows, writeOnly, dst);
+    const float * pSrc = src.getBlockPtr();
+    float * pDst       = dst.getBlockPtr();
+    for (size_t i = 0; i < nRows * nCols; ++i) pDst[i] = pSrc[i];
+    table->releaseBlockOfRows(src);
+    dense->releaseBlockOfRows(dst);
+    return dense;
+}
+
+float maxAbsDifference(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    BlockDescriptor<float> blockA;
+    BlockDescriptor<float> blockB;
+    a->getBlockOfRows(0, nRows, readOnly, blockA);
+    b->getBlockOfRows(0, nRows, readOnly, blockB);
+    const float * pA = blockA.getBlockPtr();
+    const float * pB = blockB.getBlockPtr();
+
+    float diff = 0.0f;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        const float d = (pA[i] > pB[i]) ? pA[i] - pB[i] : pB[i] - pA[i];
+        if (d > diff) diff = d;
+    }
+
+    a->releaseBlockOfRows(blockA);
+    b->releaseBlockOfRows(blockB);
+    return diff;
+}
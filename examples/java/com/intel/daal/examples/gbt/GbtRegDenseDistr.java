@@ -0,0 +1,159 @@
+/* file: GbtRegDenseDistr.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+ //  Content:
+ //     Java example of gradient boosted trees regression in the distributed processing mode.
+ //
+ //     The program splits the training data set into blocks, trains the gradient boosted
+ //     trees regression model on them and predicts previously unseen data.
+ ////////////////////////////////////////////////////////////////////////////////
+ */
+
+/**
+ * <a name="DAAL-EXAMPLE-JAVA-GbtRegDenseDistr">
+ * @example GbtRegDenseDistr.java
+ */
+
+package com.intel.daal.examples.gbt;
+
+import com.intel.daal.algorithms.gbt.regression.*;
+import com.intel.daal.algorithms.gbt.regression.prediction.*;
+import com.intel.daal.algorithms.gbt.regression.training.*;
+import com.intel.daal.data_management.data.NumericTable;
+import com.intel.daal.data_management.data.HomogenNumericTable;
+import com.intel.daal.data_management.data.MergedNumericTable;
+import com.intel.daal.data_management.data_source.DataSource;
+import com.intel.daal.data_management.data_source.FileDataSource;
+import com.intel.daal.examples.utils.Service;
+import com.intel.daal.services.DaalContext;
+
+class GbtRegDenseDistr {
+    /* Input data set parameters */
+    private static final String trainDataset = "../data/batch/df_regression_train.csv";
+
+    private static final String testDataset  = "../data/batch/df_regression_test.csv";
+
+    private static final int nFeatures    = 13;
+    private static final int nBlocks      = 4;  /* Number of blocks the training data set is split into */
+    private static final int nRowsInBlock = 95; /* Number of observations in a block of the training data set */
+
+    /* Gradient boosted trees regression algorithm parameters */
+    private static final int maxIterations = 40;
+
+    private static NumericTable testGroundTruth;
+
+    private static DaalContext context = new DaalContext();
+
+    public static void main(String[] args) throws java.io.FileNotFoundException, java.io.IOException {
+
+        TrainingResult trainingResult = trainModel();
+
+        PredictionResult predictionResult = testModel(trainingResult);
+
+        printResults(predictionResult);
+
+        context.dispose();
+    }
+
+    private static TrainingResult trainModel() {
+        FileDataSource trainDataSource = new FileDataSource(context, trainDataset,
+                DataSource.DictionaryCreationFlag.DoDictionaryFromContext,
+                DataSource.NumericTableAllocationFlag.NotAllocateNumericTable);
+
+        /* Create an algorithm object to merge the histograms and to build the trees on the master node */
+        TrainingDistributedStep2Master masterAlgorithm = new TrainingDistributedStep2Master(context, Float.class, TrainingMethod.defaultDense);
+        masterAlgorithm.parameter.setMaxIterations(maxIterations);
+
+        /* Create algorithm objects to compute the histograms on the local nodes */
+        TrainingDistributedStep1Local[] localAlgorithms = new TrainingDistributedStep1Local[nBlocks];
+        for (int i = 0; i < nBlocks; i++) {
+            /* Retrieve the block of the training data from the input file */
+            NumericTable trainData = new HomogenNumericTable(context, Float.class, nFeatures, 0, NumericTable.AllocationFlag.NotAllocate);
+            NumericTable trainGroundTruth = new HomogenNumericTable(context, Float.class, 1, 0, NumericTable.AllocationFlag.NotAllocate);
+            MergedNumericTable mergedData = new MergedNumericTable(context);
+            mergedData.addNumericTable(trainData);
+            mergedData.addNumericTable(trainGroundTruth);
+            trainDataSource.loadDataBlock(nRowsInBlock, mergedData);
+
+            localAlgorithms[i] = new TrainingDistributedStep1Local(context, Float.class, TrainingMethod.defaultDense);
+            localAlgorithms[i].input.set(InputId.data, trainData);
+            localAlgorithms[i].input.set(InputId.dependentVariable, trainGroundTruth);
+            localAlgorithms[i].parameter.setMaxIterations(maxIterations);
+        }
+
+        /* Compute the summaries of the feature values on the local nodes and merge them into the bin borders on the master node */
+        for (int i = 0; i < nBlocks; i++) {
+            DistributedStep1LocalPartialResult localResult = localAlgorithms[i].compute();
+            masterAlgorithm.input.add(DistributedStep2MasterInputId.binSketchesFromStep1,
+                    localResult.get(DistributedStep1LocalPartialResultId.binSketches));
+        }
+        DistributedStep2MasterPartialResult masterResult = masterAlgorithm.compute();
+
+        /* The local nodes compute the histograms of the gradients and the master node splits the nodes until all the trees are built */
+        do {
+            NumericTable binBorders = masterResult.get(DistributedStep2MasterPartialResultId.binBorders);
+            NumericTable levelSplits = masterResult.get(DistributedStep2MasterPartialResultId.levelSplits);
+            for (int i = 0; i < nBlocks; i++) {
+                localAlgorithms[i].input.set(DistributedStep1LocalInputId.binBordersFromStep2, binBorders);
+                localAlgorithms[i].input.set(DistributedStep1LocalInputId.levelSplitsFromStep2, levelSplits);
+                DistributedStep1LocalPartialResult localResult = localAlgorithms[i].compute();
+
+                masterAlgorithm.input.add(DistributedStep2MasterInputId.histogramsFromStep1,
+                        localResult.get(DistributedStep1LocalPartialResultId.histograms));
+            }
+            masterResult = masterAlgorithm.compute();
+        } while (!masterResult.isTrainingFinished());
+
+        /* Build the gradient boosted trees regression model */
+        return masterAlgorithm.finalizeCompute();
+    }
+
+    private static PredictionResult testModel(TrainingResult trainingResult) {
+        FileDataSource testDataSource = new FileDataSource(context, testDataset,
+                DataSource.DictionaryCreationFlag.DoDictionaryFromContext,
+                DataSource.NumericTableAllocationFlag.NotAllocateNumericTable);
+
+        /* Create Numeric Tables for testing data and ground truth values */
+        NumericTable testData = new HomogenNumericTable(context, Float.class, nFeatures, 0, NumericTable.AllocationFlag.NotAllocate);
+        testGroundTruth = new HomogenNumericTable(context, Float.class, 1, 0, NumericTable.AllocationFlag.NotAllocate);
+        MergedNumericTable mergedData = new MergedNumericTable(context);
+        mergedData.addNumericTable(testData);
+        mergedData.addNumericTable(testGroundTruth);
+
+        /* Retrieve the data from an input file */
+        testDataSource.loadDataBlock(mergedData);
+
+        /* Create algorithm objects for gradient boosted trees regression prediction with the default method */
+        PredictionBatch algorithm = new PredictionBatch(context, Float.class, PredictionMethod.defaultDense);
+
+        /* Pass a testing data set and the trained model to the algorithm */
+        Model model = trainingResult.get(TrainingResultId.model);
+        algorithm.input.set(NumericTableInputId.data, testData);
+        algorithm.input.set(ModelInputId.model, model);
+
+        /* Compute prediction results */
+        return algorithm.compute();
+    }
+
+    private static void printResults(PredictionResult predictionResult) {
+        NumericTable predictionResults = predictionResult.get(PredictionResultId.prediction);
+
+        Service.printNumericTable("Gradient boosted trees prediction results (first 10 rows):", predictionResults, 10);
+        Service.printNumericTable("Ground truth (first 10 rows):", testGroundTruth, 10);
+    }
+}
@@ -71,6 +71,7 @@ em\EmGmmDenseBatch ^
 gbt\GbtClsDenseBatch ^
 gbt\GbtClsTraversedModelBuilder ^
 gbt\GbtRegDenseBatch ^
+gbt\GbtRegDenseDistr ^
 gbt\GbtRegTraversedModelBuilder ^
 kdtree_knn_classification\KDTreeKNNDenseBatch ^
 kmeans\KMeansDenseBatch ^
@@ -136,6 +137,7 @@ svm\SVMMultiClassDenseBatch ^
 svm\SVMMultiClassCSRBatch ^
 svm\SVMMultiClassModelBuilder ^
 svm\SVMTwoClassDenseBatch ^
+svm\SVMTwoClassThunderDenseBatch ^
 svm\SVMTwoClassCSRBatch ^
 svm\SVMTwoClassModelBuilder ^
 services\LibraryVersionInfoExample ^
@@ -52,6 +52,8 @@ const int undefined = -2;
 enum Method
 {
     defaultDense = 0, /*!< Default: performance-oriented method */
+    kdTreeDense  = 1  /*!< Method that finds neighborhoods of observations with range queries to KD-tree built over the data.
+                           Intended for the data of low to medium dimensionality */
 };
 
 /**
@@ -544,7 +546,9 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 
     double epsilon;               /*!< Radius of neighborhood */
     size_t minObservations;       /*!< Minimal total weight of observations in neighborhood of core observation */
-    bool memorySavingMode;        /*!< If true then use memory saving (but slower) mode */
+    bool memorySavingMode;        /*!< If true then use memory saving (but slower) mode. Only the default mode assigns
+                                       the observations to clusters in parallel, the memory saving mode expands
+                                       the clusters sequentially */
     DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the results to compute */
 
     size_t blockIndex; /*!< Unique identifier of block initially passed for computation on the local node */
@@ -94,7 +94,7 @@ namespace interface1
  * \snippet decision_forest/decision_forest_classification_training_types.h Parameter source code
  */
 /* [interface1::Parameter source code] */
-struct DAAL_EXPORT Parameter : public classifier::interface1::Parameter, public daal::algorithms::decision_forest::training::Parameter
+struct DAAL_EXPORT Parameter : public classifier::interface1::Parameter, public daal::algorithms::decision_forest::training::interface1::Parameter
 {
     /** Default constructor */
     DAAL_DEPRECATED Parameter(size_t nClasses) : classifier::interface1::Parameter(nClasses) {}
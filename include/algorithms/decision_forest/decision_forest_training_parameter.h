@@ -132,7 +132,34 @@ public:
 };
 /* [Parameter source code] */
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__TRAINING__PARAMETER"></a>
+ * \brief Parameters for the decision forest algorithm
+ *
+ * \snippet decision_forest/decision_forest_training_parameter.h interface2::Parameter source code
+ */
+/* [interface2::Parameter source code] */
+class DAAL_EXPORT Parameter : public interface1::Parameter
+{
+public:
+    Parameter() : parallelNodeSplitting(false) {}
+
+    bool parallelNodeSplitting; /*!< If true and the number of trees is less than the number of threads then
+                                       sibling nodes of a tree and features of a node are processed in parallel.
+                                       The trained model is the same as the sequential one when all features are checked
+                                       in each node (featuresPerNode is equal to the number of features) and
+                                       minObservationsInLeafNode is greater than 1. Otherwise the order in which nodes draw
+                                       random numbers depends on scheduling and the model may differ */
+};
+/* [interface2::Parameter source code] */
+} // namespace interface2
+using interface2::Parameter;
 /** @} */
 } // namespace training
 } // namespace decision_forest
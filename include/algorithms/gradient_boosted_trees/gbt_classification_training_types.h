@@ -124,6 +124,31 @@ struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algori
 /* [Parameter source code] */
 } // namespace interface2
 
+/**
+ * \brief Contains version 3.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface3
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__PARAMETER"></a>
+ * \brief Gradient Boosted Trees algorithm parameters
+ *
+ * \snippet gradient_boosted_trees/gbt_classification_training_types.h interface3::Parameter source code
+ */
+/* [interface3::Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface2::Parameter
+{
+    /** Default constructor */
+    Parameter(size_t nClasses) : interface2::Parameter(nClasses), externalMemoryPageSize(0) {}
+
+    size_t externalMemoryPageSize; /*!< Used with 'inexact' split finding method only.
+                                        If non-zero then the binned features are stored in a temporary file
+                                        in pages of this number of observations, which are read at every level
+                                        of a tree, so the data does not have to fit into memory. Default is 0 */
+};
+/* [interface3::Parameter source code] */
+} // namespace interface3
+
 namespace interface1
 {
 /**
@@ -197,7 +222,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
-using interface2::Parameter;
+using interface3::Parameter;
 using interface1::Result;
 using interface1::ResultPtr;
 
@@ -0,0 +1,400 @@
+/* file: gbt_regression_training_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for model-based training
+//  in the distributed processing mode
+//--
+*/
+
+#ifndef __GBT_REGRESSSION_TRAINING_DISTRIBUTED_H__
+#define __GBT_REGRESSSION_TRAINING_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/training.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace interface1
+{
+/**
+ * @defgroup gbt_regression_training_distributed Distributed
+ * @ingroup gbt_regression_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDCONTAINER"></a>
+ * \brief Class containing methods for gradient boosted trees regression model-based training in the distributed processing mode
+ */
+template <ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDCONTAINER_STEP1LOCAL_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing methods for gradient boosted trees regression model-based training
+ *        in the first step of the distributed processing mode
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer<step1Local, algorithmFPType, method, cpu> : public TrainingContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for gradient boosted trees model-based training with a specified environment
+     * in the first step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    ~DistributedContainer();
+
+    /**
+     * Computes a partial result of gradient boosted trees model-based training
+     * in the first step of the distributed processing mode
+     *
+     * \return Status of computations
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Does nothing, the first step of the distributed processing mode does not compute the result
+     *
+     * \return Status of computations
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing methods for gradient boosted trees regression model-based training
+ *        in the second step of the distributed processing mode
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer<step2Master, algorithmFPType, method, cpu> : public TrainingContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for gradient boosted trees model-based training with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    ~DistributedContainer();
+
+    /**
+     * Computes a partial result of gradient boosted trees model-based training
+     * in the second step of the distributed processing mode
+     *
+     * \return Status of computations
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of gradient boosted trees model-based training
+     * in the second step of the distributed processing mode
+     *
+     * \return Status of computations
+     */
+    services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED"></a>
+ * \brief Provides methods for gradient boosted trees regression model-based training in the distributed processing mode.
+ *
+ * The trees are built level by level. Every local node keeps its part of the data set, and the master node
+ * keeps the trees being built. On the first iteration the first step computes the \ref binSketches of the local data,
+ * and the second step merges them into the \ref binBorders of the features. On every next iteration the first step
+ * computes the \ref histograms of the gradients of the nodes of the current level on the local data, and the second step
+ * merges the histograms and computes the \ref levelSplits of the nodes. The iterations end when the isTrainingFinished()
+ * method of the partial result of the second step returns true.
+ *
+ * Only the squared loss and the inexact split finding method are supported in the distributed processing mode.
+ * The categorical features, the sampling of the observations and of the features, the memory saving mode,
+ * the external memory mode and the variable importance are not supported, the checks of the input fail for them.
+ * <!-- \n<a href="DAAL-REF-GBT__REGRESSION__TRAINING-ALGORITHM">gradient boosted trees algorithm description and usage models</a> -->
+ *
+ * \tparam step             Step of the algorithm in the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for model-based training, double or float
+ * \tparam method           gradient boosted trees training method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method  Computation methods
+ *
+ * \par References
+ *      - \ref gbt::regression::interface1::Model "Model" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+template <ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Distributed : public Training<distributed>
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Performs gradient boosted trees regression model-based training in the first step of the distributed processing mode.
+ *        The same object is used for all the iterations on the local node, it keeps the internal data in its partial result
+ * <!-- \n<a href="DAAL-REF-GBT__REGRESSION__TRAINING-ALGORITHM">gradient boosted trees algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for model-based training, double or float
+ * \tparam method           gradient boosted trees training method, \ref Method
+ */
+template <typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public Training<distributed>
+{
+public:
+    typedef algorithms::gbt::regression::training::DistributedStep1LocalInput InputType;
+    typedef algorithms::gbt::regression::training::Parameter ParameterType;
+    typedef algorithms::gbt::regression::training::DistributedStep1LocalPartialResult PartialResultType;
+
+    /** Default constructor */
+    Distributed() { initialize(); }
+
+    /**
+     * Constructs a gradient boosted trees training algorithm in the first step of the distributed processing mode
+     * by copying input objects and parameters of another gradient boosted trees training algorithm
+     * \param[in] other Algorithm to use as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> & other) : input(other.input), parameter(other.parameter) { initialize(); }
+
+    ~Distributed() {}
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Registers user-allocated memory to store a partial result of model-based training
+     * \param[in] partialResult    Structure to store a partial result of model-based training
+     *
+     * \return Status of computations
+     */
+    services::Status setPartialResult(const DistributedStep1LocalPartialResultPtr & partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres          = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains a partial result of model-based training
+     * \return Structure that contains a partial result of model-based training
+     */
+    DistributedStep1LocalPartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Validates the parameters of the finalizeCompute() method
+     */
+    services::Status checkFinalizeComputeParams() DAAL_C11_OVERRIDE { return services::Status(); }
+
+    /**
+     * Returns a pointer to a newly allocated gradient boosted trees training algorithm
+     * with a copy of the input objects and parameters of this gradient boosted trees training algorithm
+     * in the first step of the distributed processing mode
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Training \ref interface1::Parameter "parameters" */
+
+protected:
+    DistributedStep1LocalPartialResultPtr _partialResult;
+
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE { return services::Status(); }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE { return services::Status(); }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _partialResult.reset(new PartialResultType());
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Performs gradient boosted trees regression model-based training in the second step of the distributed processing mode.
+ *        The same object is used for all the iterations on the master node, it keeps the trees being built in its partial result
+ * <!-- \n<a href="DAAL-REF-GBT__REGRESSION__TRAINING-ALGORITHM">gradient boosted trees algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for model-based training, double or float
+ * \tparam method           gradient boosted trees training method, \ref Method
+ *
+ * \par References
+ *      - \ref gbt::regression::interface1::Model "Model" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+template <typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public Training<distributed>
+{
+public:
+    typedef algorithms::gbt::regression::training::DistributedStep2MasterInput InputType;
+    typedef algorithms::gbt::regression::training::Parameter ParameterType;
+    typedef algorithms::gbt::regression::training::Result ResultType;
+    typedef algorithms::gbt::regression::training::DistributedStep2MasterPartialResult PartialResultType;
+
+    /** Default constructor */
+    Distributed() { initialize(); }
+
+    /**
+     * Constructs a gradient boosted trees training algorithm in the second step of the distributed processing mode
+     * by copying input objects and parameters of another gradient boosted trees training algorithm
+     * \param[in] other Algorithm to use as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> & other) : input(other.input), parameter(other.parameter) { initialize(); }
+
+    ~Distributed() {}
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Registers user-allocated memory to store a partial result of model-based training
+     * \param[in] partialResult    Structure to store a partial result of model-based training
+     *
+     * \return Status of computations
+     */
+    services::Status setPartialResult(const DistributedStep2MasterPartialResultPtr & partialResult)
+    {
+        DAAL_CHECK(partialResult, services::ErrorNullPartialResult);
+        _partialResult = partialResult;
+        _pres          = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains a partial result of model-based training
+     * \return Structure that contains a partial result of model-based training
+     */
+    DistributedStep2MasterPartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Registers user-allocated memory to store the result of model-based training
+     * \param[in] res    Structure to store the result of model-based training
+     *
+     * \return Status of computations
+     */
+    services::Status setResult(const ResultPtr & res)
+    {
+        DAAL_CHECK(res, services::ErrorNullResult)
+        _result = res;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains the result of model-based training
+     * \return Structure that contains the result of model-based training
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Returns a pointer to a newly allocated gradient boosted trees training algorithm
+     * with a copy of the input objects and parameters of this gradient boosted trees training algorithm
+     * in the second step of the distributed processing mode
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Training \ref interface1::Parameter "parameters" */
+
+protected:
+    DistributedStep2MasterPartialResultPtr _partialResult;
+    ResultPtr _result;
+
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(_pres, &parameter, method);
+        _res               = _result.get();
+        return s;
+    }
+
+    services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, &parameter, method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE { return services::Status(); }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _partialResult.reset(new PartialResultType());
+        _result.reset(new ResultType());
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
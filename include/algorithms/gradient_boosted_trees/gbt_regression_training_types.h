@@ -68,11 +68,19 @@ enum Method
 /**
 * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__LOSS_FUNCTION_TYPE"></a>
 * \brief Loss function type
+*
+* The poisson and tweedie losses model the logarithm of the mean of the dependent variable.
+* The trained model keeps the log link, so the prediction returns exp(f(x)), the mean of the dependent variable
 */
 enum LossFunctionType
 {
-    squared, /* L(y,f) = ([y-f(x)]^2)/2 */
-    custom   /* Should be differentiable up to the second order */
+    squared,     /* L(y,f) = ([y-f(x)]^2)/2 */
+    custom,      /* Defined by Parameter::customLoss, should be differentiable up to the second order */
+    pseudoHuber, /* Pseudo-Huber loss, L(y,f) = delta^2*(sqrt(1 + ([y-f(x)]/delta)^2) - 1) */
+    quantile,    /* Quantile (pinball) loss, L(y,f) = max(alpha*[y-f(x)], (alpha-1)*[y-f(x)]) */
+    poisson,     /* Poisson negative log-likelihood with the log link, L(y,f) = exp(f(x)) - y*f(x) */
+    tweedie      /* Tweedie negative log-likelihood with the log link and the variance power p from (1, 2),
+                    L(y,f) = -y*exp((1-p)*f(x))/(1-p) + exp((2-p)*f(x))/(2-p) */
 };
 
 /**
@@ -106,11 +114,115 @@ enum ResultNumericTableId
     lastResultNumericTableId = variableImportanceByGain
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALINPUTID"></a>
+ * \brief Available identifiers of input objects for model-based training in the first step of the distributed processing mode
+ */
+enum DistributedStep1LocalInputId
+{
+    binBordersFromStep2 = lastInputId + 1, /*!< %Numeric table with the bin borders of the features computed on the master node,
+                                                set on the second call of the first step only */
+    levelSplitsFromStep2,                  /*!< %Numeric table with the splits of the nodes of the tree level computed on the master node,
+                                                set on the third and the next calls of the first step */
+    lastDistributedStep1LocalInputId = levelSplitsFromStep2
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERINPUTID"></a>
+ * \brief Available identifiers of input objects for model-based training in the second step of the distributed processing mode
+ */
+enum DistributedStep2MasterInputId
+{
+    binSketchesFromStep1, /*!< %DataCollection of numeric tables with the summaries of the feature values computed on the local nodes,
+                               set on the first call of the second step only */
+    histogramsFromStep1,  /*!< %DataCollection of numeric tables with the histograms of the gradients computed on the local nodes,
+                               set on the second and the next calls of the second step */
+    lastDistributedStep2MasterInputId = histogramsFromStep1
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALPARTIALRESULTID"></a>
+ * \brief Available identifiers of partial results of model-based training in the first step of the distributed processing mode
+ */
+enum DistributedStep1LocalPartialResultId
+{
+    binSketches, /*!< %Numeric table with the summaries of the feature values computed on the local node,
+                      set on the first call of the first step only */
+    histograms,  /*!< %Numeric table with the histograms of the gradients of the nodes of the tree level computed on the local node,
+                      set on the second and the next calls of the first step */
+    lastDistributedStep1LocalPartialResultId = histograms
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERPARTIALRESULTID"></a>
+ * \brief Available identifiers of partial results of model-based training in the second step of the distributed processing mode
+ */
+enum DistributedStep2MasterPartialResultId
+{
+    binBorders,  /*!< %Numeric table with the bin borders of the features, set on the first call of the second step only */
+    levelSplits, /*!< %Numeric table with the splits of the nodes of the tree level, set on the second and the next calls
+                      of the second step until the training is finished */
+    lastDistributedStep2MasterPartialResultId = levelSplits
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDPARTIALRESULTDATAID"></a>
+ * \brief Available identifiers of the internal data kept in partial results of model-based training in the distributed processing mode
+ */
+enum DistributedPartialResultDataId
+{
+    internalResult = lastDistributedStep1LocalPartialResultId + 1, /*!< %DataCollection with the internal data of the algorithm
+                                                                        kept on the node between the calls of the step */
+    lastDistributedPartialResultDataId = internalResult
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__LOSSFUNCTIONIFACE"></a>
+ * \brief Interface of the user-defined loss function L(y,f) for the gradient boosted trees regression training.
+ *        The methods are called in parallel for the blocks of observations and must be thread-safe
+ */
+class DAAL_EXPORT LossFunctionIface : public Base
+{
+public:
+    virtual ~LossFunctionIface() {}
+
+    /**
+     * Computes the first and the second order derivatives of the loss function with respect to f for the block of observations
+     * \param[in]  n          Number of observations in the block
+     * \param[in]  y          Array of n values of the dependent variable
+     * \param[in]  f          Array of n current approximations of the dependent variable
+     * \param[out] gradients  Array of n first order derivatives of the loss function
+     * \param[out] hessians   Array of n second order derivatives of the loss function
+     * \return Status of computations
+     */
+    virtual services::Status getGradients(size_t n, const float * y, const float * f, float * gradients, float * hessians) const;
+
+    /**
+     * \copydoc getGradients(size_t, const float *, const float *, float *, float *) const
+     */
+    virtual services::Status getGradients(size_t n, const double * y, const double * f, double * gradients, double * hessians) const;
+
+    /**
+     * Computes the initial approximation of the dependent variable, the mean of its values by default
+     * \param[in]  n   Number of observations
+     * \param[in]  y   Array of n values of the dependent variable
+     * \param[out] f0  Initial approximation of the dependent variable
+     * \return Status of computations
+     */
+    virtual services::Status getInitialApproximation(size_t n, const float * y, float & f0) const;
+
+    /**
+     * \copydoc getInitialApproximation(size_t, const float *, float &) const
+     */
+    virtual services::Status getInitialApproximation(size_t n, const double * y, double & f0) const;
+};
+typedef services::SharedPtr<LossFunctionIface> LossFunctionIfacePtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__PARAMETER"></a>
  * \brief Parameters for the gradient boosted trees algorithm
@@ -165,7 +277,264 @@ public:
     * \return Status of checking
     */
     services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    Input(size_t nElements) : algorithms::regression::training::Input(nElements) {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSSION__TRAINING__DISTRIBUTEDSTEP1LOCALINPUT"></a>
+ * \brief %Input objects for model-based training in the first step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep1LocalInput : public Input
+{
+public:
+    /** Default constructor */
+    DistributedStep1LocalInput();
+
+    /** Copy constructor */
+    DistributedStep1LocalInput(const DistributedStep1LocalInput & other) : Input(other) {}
+
+    virtual ~DistributedStep1LocalInput() {}
+
+    using Input::get;
+    using Input::set;
+
+    /**
+     * Returns an input object for model-based training in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(DistributedStep1LocalInputId id) const;
+
+    /**
+     * Sets an input object for model-based training in the first step of the distributed processing mode
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(DistributedStep1LocalInputId id, const data_management::NumericTablePtr & value);
+
+    /**
+    * Checks an input object for the gradient boosted trees algorithm in the first step of the distributed processing mode
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    * \return Status of checking
+    */
+    services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSSION__TRAINING__DISTRIBUTEDSTEP2MASTERINPUT"></a>
+ * \brief %Input objects for model-based training in the second step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep2MasterInput : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    DistributedStep2MasterInput();
+
+    /** Copy constructor */
+    DistributedStep2MasterInput(const DistributedStep2MasterInput & other) : daal::algorithms::Input(other) {}
+
+    virtual ~DistributedStep2MasterInput() {}
+
+    /**
+     * Returns an input object for model-based training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(DistributedStep2MasterInputId id) const;
+
+    /**
+     * Sets an input object for model-based training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(DistributedStep2MasterInputId id, const data_management::DataCollectionPtr & ptr);
+
+    /**
+     * Adds the output of the first step computed on a local node to the input of the second step
+     * \param[in] id    Identifier of the input object
+     * \param[in] value Numeric table with the output of the first step, \ref binSketches or \ref histograms
+     */
+    void add(DistributedStep2MasterInputId id, const data_management::NumericTablePtr & value);
+
+    /**
+    * Checks an input object for the gradient boosted trees algorithm in the second step of the distributed processing mode
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    * \return Status of checking
+    */
+    services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSSION__TRAINING__DISTRIBUTEDSTEP1LOCALPARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of model-based training
+ *        in the first step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep1LocalPartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(DistributedStep1LocalPartialResult)
+    DistributedStep1LocalPartialResult();
+
+    virtual ~DistributedStep1LocalPartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of model-based training in the first step of the distributed processing mode
+     * \param[in] input     Pointer to an object containing the input data
+     * \param[in] parameter %Parameter of model-based training
+     * \param[in] method    Computation method for the algorithm
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Returns a partial result of model-based training in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(DistributedStep1LocalPartialResultId id) const;
+
+    /**
+     * Sets a partial result of model-based training in the first step of the distributed processing mode
+     * \param[in] id      Identifier of the partial result
+     * \param[in] value   Pointer to the partial result
+     */
+    void set(DistributedStep1LocalPartialResultId id, const data_management::NumericTablePtr & value);
+
+    /**
+     * Returns the internal data of model-based training in the first step of the distributed processing mode
+     * \param[in] id    Identifier of the internal data
+     * \return          Internal data that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(DistributedPartialResultDataId id) const;
+
+    /**
+     * Sets the internal data of model-based training in the first step of the distributed processing mode
+     * \param[in] id      Identifier of the internal data
+     * \param[in] value   Pointer to the internal data
+     */
+    void set(DistributedPartialResultDataId id, const data_management::DataCollectionPtr & value);
+
+    /**
+     * Checks partial results of model-based training in the first step of the distributed processing mode
+     * \param[in] input   %Input object for the algorithm
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks partial results of model-based training in the first step of the distributed processing mode
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<DistributedStep1LocalPartialResult> DistributedStep1LocalPartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSSION__TRAINING__DISTRIBUTEDSTEP2MASTERPARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of model-based training
+ *        in the second step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep2MasterPartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(DistributedStep2MasterPartialResult)
+    DistributedStep2MasterPartialResult();
+
+    virtual ~DistributedStep2MasterPartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of model-based training in the second step of the distributed processing mode
+     * \param[in] input     Pointer to an object containing the input data
+     * \param[in] parameter %Parameter of model-based training
+     * \param[in] method    Computation method for the algorithm
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Returns a partial result of model-based training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(DistributedStep2MasterPartialResultId id) const;
+
+    /**
+     * Sets a partial result of model-based training in the second step of the distributed processing mode
+     * \param[in] id      Identifier of the partial result
+     * \param[in] value   Pointer to the partial result
+     */
+    void set(DistributedStep2MasterPartialResultId id, const data_management::NumericTablePtr & value);
+
+    /**
+     * Returns the internal data of model-based training in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the internal data
+     * \return          Internal data that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(DistributedPartialResultDataId id) const;
+
+    /**
+     * Sets the internal data of model-based training in the second step of the distributed processing mode
+     * \param[in] id      Identifier of the internal data
+     * \param[in] value   Pointer to the internal data
+     */
+    void set(DistributedPartialResultDataId id, const data_management::DataCollectionPtr & value);
+
+    /**
+     * Returns true if all the trees are built and the model can be obtained with the finalizeCompute() method
+     * \return Flag of the end of training
+     */
+    bool isTrainingFinished() const;
+
+    /**
+     * Returns the number of features in the input data of the local nodes
+     * \return Number of features, 0 if it is not known yet
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Checks partial results of model-based training in the second step of the distributed processing mode
+     * \param[in] input   %Input object for the algorithm
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks partial results of model-based training in the second step of the distributed processing mode
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
 };
+typedef services::SharedPtr<DistributedStep2MasterPartialResult> DistributedStep2MasterPartialResultPtr;
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSSION__TRAINING__RESULT"></a>
@@ -188,6 +557,16 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const Parameter * parameter, const int method);
 
+    /**
+     * Allocates memory to store the result of model-based training in the second step of the distributed processing mode
+     * \param[in] partialResult Pointer to an object containing the partial result of the second step
+     * \param[in] parameter     %Parameter of model-based training
+     * \param[in] method        Computation method for the algorithm
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::PartialResult * partialResult, const Parameter * parameter, const int method);
+
     /**
      * Returns the result of model-based training
      * \param[in] id    Identifier of the result
@@ -236,8 +615,48 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__PARAMETER"></a>
+ * \brief Parameters for the gradient boosted trees algorithm
+ *
+ * \snippet gradient_boosted_trees/gbt_regression_training_types.h interface2::Parameter source code
+ */
+/* [interface2::Parameter source code] */
+class DAAL_EXPORT Parameter : public interface1::Parameter
+{
+public:
+    Parameter();
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    double huberDelta;                           /*!< Scale of the residual of the pseudo-Huber loss, greater than 0. The loss is close to
+                                                      the squared loss for residuals much smaller than huberDelta and grows
+                                                      linearly with the slope huberDelta for residuals much larger than it */
+    double quantileAlpha;                        /*!< Quantile of the dependent variable predicted with the quantile loss, from (0, 1) */
+    double tweediePower;                         /*!< Variance power of the tweedie loss, from (1, 2) */
+    interface1::LossFunctionIfacePtr customLoss; /*!< User-defined loss function used when loss is custom */
+    size_t externalMemoryPageSize;               /*!< Used with 'inexact' split finding method only.
+                                                      If non-zero then the binned features are stored in a temporary file
+                                                      in pages of this number of observations, which are read at every level
+                                                      of a tree, so the data does not have to fit into memory. Default is 0 */
+};
+/* [interface2::Parameter source code] */
+} // namespace interface2
+using interface1::LossFunctionIface;
+using interface1::LossFunctionIfacePtr;
+using interface2::Parameter;
 using interface1::Input;
+using interface1::DistributedStep1LocalInput;
+using interface1::DistributedStep2MasterInput;
+using interface1::DistributedStep1LocalPartialResult;
+using interface1::DistributedStep1LocalPartialResultPtr;
+using interface1::DistributedStep2MasterPartialResult;
+using interface1::DistributedStep2MasterPartialResultPtr;
 using interface1::Result;
 using interface1::ResultPtr;
 
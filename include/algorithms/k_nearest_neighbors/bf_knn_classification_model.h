@@ -161,7 +161,54 @@ private:
 typedef services::SharedPtr<Model> ModelPtr;
 } // namespace interface1
 
-using interface1::Parameter;
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__BF_KNN_CLASSIFICATION__PARAMETER"></a>
+ * \brief BF kNN algorithm parameters
+ *
+ * \snippet k_nearest_neighbors/bf_knn_classification_model.h interface2::Parameter source code
+ */
+/* [interface2::Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface1::Parameter
+{
+    /**
+     *  Parameter constructor
+     *  \param[in] nClasses             Number of classes
+     *  \param[in] nNeighbors           Number of neighbors
+     *  \param[in] dataUse              The option to enable/disable an usage of the input dataset in kNN model
+     */
+    Parameter(size_t nClasses = 2, size_t nNeighbors = 1, DataUseInModel dataUse = doNotUse)
+        : interface1::Parameter(nClasses, nNeighbors, dataUse), nLists(0), nProbes(8), maxIterations(10)
+    {}
+
+    /**
+     *  Parameter copy constructor
+     *  \param[in] other             Object to copy
+     */
+    Parameter(const Parameter& other)
+        : interface1::Parameter(other), nLists(other.nLists), nProbes(other.nProbes), maxIterations(other.maxIterations)
+    {}
+
+    /**
+     * Checks a parameter of the BF kNN algorithm
+     */
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t nLists;        /*!< Number of inverted lists built by the ivfDense training method.
+                               If 0, the square root of the number of observations is used */
+    size_t nProbes;       /*!< Number of inverted lists searched by the prediction with the model trained by the ivfDense method.
+                               Larger values increase the recall and the prediction time */
+    size_t maxIterations; /*!< Number of k-means iterations used to build the inverted lists */
+};
+/* [interface2::Parameter source code] */
+} // namespace interface2
+
+using interface2::Parameter;
 using interface1::Model;
 using interface1::ModelPtr;
 
@@ -58,7 +58,10 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    ivfDense     = 1  /*!< Method that builds the inverted file index for the approximate search of the nearest neighbors.
+                           The training data is clustered into Parameter::nLists lists, and the prediction searches
+                           only Parameter::nProbes lists with the closest centroids */
 };
 
 /**
@@ -91,7 +94,8 @@ public:
      * \param[in] method Computation method for the algorithm
      */
     template<typename algorithmFPType>
-    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const Parameter *parameter, int method);
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input *input, const bf_knn_classification::interface1::Parameter *parameter,
+                                          int method);
 
 protected:
     /** \private */
@@ -0,0 +1,229 @@
+/* file: kmeans_online.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for K-Means algorithm in the online
+//  processing mode
+//--
+*/
+
+#ifndef __KMEANS_ONLINE_H__
+#define __KMEANS_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/kmeans/kmeans_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace interface1
+{
+/**
+ * @defgroup kmeans_online Online
+ * @ingroup kmeans_compute
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of K-Means algorithm.
+ *        This class is associated with the daal::algorithms::kmeans::Online class
+ *        and supports the method of K-Means computation in the online processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of K-Means, double or float
+ * \tparam method           Computation method of the algorithm, \ref daal::algorithms::kmeans::Method
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for K-Means algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    virtual ~OnlineContainer();
+    /**
+     * Updates the partial result of K-Means algorithm with the next block of data
+     * in the online processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of K-Means algorithm in the online processing mode
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__ONLINE"></a>
+ * \brief Computes the results of K-Means algorithm in the online processing mode.
+ *        Each call of compute() assigns the observations of the next block of data to the current centroids
+ *        and moves the centroids towards the observations assigned to them, the learning rate of a cluster
+ *        decreases with the number of observations assigned to it so far.
+ *        The partial result holds the whole state of the algorithm and can be serialized between the blocks.
+ * <!-- \n<a href="DAAL-REF-KMEANS-ALGORITHM">K-Means algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of K-Means, double or float
+ * \tparam method           Computation method of the algorithm, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods for K-Means algorithm
+ *      - \ref InputId          Identifiers of input objects for K-Means algorithm
+ *      - \ref PartialResultId  Identifiers of partial results of K-Means algorithm
+ *      - \ref ResultId         Identifiers of results of K-Means algorithm
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = miniBatchDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    typedef algorithms::kmeans::Input InputType;
+    typedef algorithms::kmeans::Parameter ParameterType;
+    typedef algorithms::kmeans::Result ResultType;
+    typedef algorithms::kmeans::PartialResult PartialResultType;
+
+    /**
+     *  Main constructor
+     *  \param[in] nClusters   Number of clusters
+     */
+    Online(size_t nClusters) : parameter(nClusters, 1)
+    {
+        initialize();
+        parameter.assignFlag = false;
+    }
+
+    /**
+     * Constructs K-Means algorithm by copying input objects and parameters
+     * of another K-Means algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> & other) : parameter(other.parameter)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+        input.set(inputCentroids, other.input.get(inputCentroids));
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains the results of K-Means algorithm
+     * \return Structure that contains the results of K-Means algorithm
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Registers user-allocated memory to store the results of K-Means algorithm
+     * \param[in] result  Structure to store the results of K-Means algorithm
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains computed partial results
+     * \return Structure that contains computed partial results
+     */
+    PartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Sets the structure that contains computed partial results
+     * \param[in] partialRes  Structure that contains partial results
+     * \param[in] initFlag    Flag that specifies whether the partial results are initialized,
+     *                        e.g. were computed on the previous blocks of data and deserialized
+     */
+    services::Status setPartialResult(const PartialResultPtr & partialRes, bool initFlag = false)
+    {
+        DAAL_CHECK(partialRes, services::ErrorNullPartialResult);
+        _partialResult = partialRes;
+        _pres          = _partialResult.get();
+        setInitFlag(initFlag);
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated K-Means algorithm with a copy of input objects
+     * and parameters of this K-Means algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const { return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl()); }
+
+protected:
+    virtual Online<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Online<algorithmFPType, method>(*this); }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result.reset(new ResultType());
+        services::Status s = _result->allocate<algorithmFPType>(_pres, _par, (int)method);
+        _res               = _result.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult.reset(new PartialResultType());
+        services::Status s = _partialResult->allocate<algorithmFPType>(_in, _par, (int)method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _partialResult->initialize<algorithmFPType>(_in, _par, (int)method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in                   = &input;
+        _par                  = &parameter;
+    }
+
+public:
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< K-Means parameters structure */
+
+private:
+    PartialResultPtr _partialResult;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+#endif
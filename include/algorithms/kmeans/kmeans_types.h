@@ -48,9 +48,13 @@ namespace kmeans
  */
 enum Method
 {
-    lloydDense   = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
-    defaultDense = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR     = 1  /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydDense        = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
+    defaultDense      = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
+    lloydCSR          = 1, /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydHamerlyDense = 2, /*!< Lloyd algorithm for dense numeric tables that uses Hamerly's bounds
+                                on the distances to skip computation of the distances to all centroids */
+    miniBatchDense    = 3  /*!< Mini-batch algorithm for dense numeric tables in the online processing mode:
+                                centroids are updated after each block of data with per-cluster learning rates */
 };
 
 /**
@@ -91,12 +95,15 @@ enum MasterInputId
 enum PartialResultId
 {
     nObservations,                                  /*!< Table containing the number of observations assigned to centroids */
-    partialSums,                                    /*!< Table containing the sum of observations assigned to centroids */
+    partialSums,                                    /*!< Table containing the sum of observations assigned to centroids,
+                                                         the centroids themselves for the \ref miniBatchDense method */
     partialObjectiveFunction,                       /*!< Table containing an objective function value */
     partialGoalFunction = partialObjectiveFunction, /*!< Table containing an objective function value \DAAL_DEPRECATED */
     partialAssignments,                             /*!< Table containing assignments of observations to particular clusters */
-    partialCandidatesDistances, /*!< Table containing goal function of observations most distant from their assigned cluster center */
-    partialCandidatesCentroids, /*!< Table containing observations most distant from their assigned cluster center */
+    partialCandidatesDistances, /*!< Table containing goal function of observations most distant from their assigned cluster center,
+                                     not used by the \ref miniBatchDense method */
+    partialCandidatesCentroids, /*!< Table containing observations most distant from their assigned cluster center,
+                                     not used by the \ref miniBatchDense method */
     lastPartialResultId = partialCandidatesCentroids
 };
 
@@ -206,7 +213,7 @@ public:
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__PARTIALRESULT"></a>
- * \brief Partial results obtained with the compute() method of K-Means algorithm in the batch processing mode
+ * \brief Partial results obtained with the compute() method of K-Means algorithm in the distributed and online processing modes
  */
 class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
 {
@@ -225,6 +232,17 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
 
+    /**
+     * Initializes partial results of K-Means algorithm in the online processing mode
+     * with the initial centroids, each of them is counted as one observation assigned to its cluster.
+     * The partial sums hold the current centroids in this mode
+     * \param[in] input        Pointer to the structure of the input objects
+     * \param[in] parameter    Pointer to the structure of the algorithm parameters
+     * \param[in] method       Computation method of the algorithm
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
     /**
      * Returns a partial result of K-Means algorithm
      * \param[in] id   Identifier of the partial result
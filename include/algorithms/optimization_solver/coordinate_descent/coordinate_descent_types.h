@@ -180,7 +180,38 @@ typedef services::SharedPtr<Result> ResultPtr;
 
 /** @} */
 } // namespace interface1
-using interface1::Parameter;
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__COORDINATE_DESCENT__PARAMETER"></a>
+ * \brief %Parameter base class for the Coordinate descent algorithm
+ *
+ * \snippet optimization_solver/coordinate_descent/coordinate_descent_types.h interface2::Parameter source code
+ */
+/* [interface2::Parameter source code] */
+struct DAAL_EXPORT Parameter : public interface1::Parameter
+{
+    /**
+     * Constructs the parameter base class of the Coordinate descent algorithm
+     * \param[in] function                 Objective function represented as sum of functions
+     * \param[in] nIterations              Maximal number of iterations of the algorithm
+     * \param[in] accuracyThreshold        Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] seed                     Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05, size_t seed = 777);
+
+    virtual ~Parameter() {}
+
+    bool activeSetScreening; /*!< If true, the sweeps are restricted to the coordinates with non-zero values after each full sweep,
+                                  and a full sweep is used to check the convergence on the active set */
+};
+/* [interface2::Parameter source code] */
+} // namespace interface2
+using interface2::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
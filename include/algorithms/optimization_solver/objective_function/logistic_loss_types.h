@@ -58,7 +58,9 @@ enum InputId
     argument = (int)sum_of_functions::argument, /*!< Numeric table of size 1 x p with input argument of the objective function */
     data,                                       /*!< Numeric table of size n x p with data */
     dependentVariables,                         /*!< Numeric table of size n x 1 with dependent variables */
-    lastInputId = dependentVariables
+    direction,                                  /*!< Numeric table of size p x 1 with the vector multiplied by the hessian
+                                                     when objective_function::hessianVectorProduct is computed */
+    lastInputId = direction
 };
 
 /**
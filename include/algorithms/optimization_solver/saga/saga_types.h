@@ -240,16 +240,16 @@ struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Par
      * \param[in] function                 Objective function represented as sum of functions
      * \param[in] nIterations              Maximal number of iterations of the algorithm
      * \param[in] accuracyThreshold        Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
-     * \param[in] batchIndices             Numeric table that represents 32 bit integer indices of terms in the objective function.
-     *                                      If no indices are provided, the implementation will generate random indices.
-     * \param[in] batchSize                Number of batch indices to compute the stochastic gradient. If batchSize is equal to the number of terms
-                                            in objective function then no random sampling is performed, and all terms are used to calculate the gradient.
-                                            This parameter is ignored if batchIndices is provided.
+     * \param[in] batchIndices             Numeric table of size nIterations x batchSize that represents 32 bit integer indices of terms
+     *                                      in the objective function. If no indices are provided, the implementation will generate random indices.
+     *                                      The table must have batchSize columns, previously it had one column and batchSize was ignored
+     * \param[in] batchSize                Number of terms of the objective function used at each iteration. The gradients of the terms
+     *                                      in the batch are computed in parallel
      * \param[in] learningRateSequence     Numeric table that contains value of the learning rate
      * \param[in] seed                     Seed for random generation of 32 bit integer indices of terms in the objective function. \DAAL_DEPRECATED_USE{ engine }
      */
     Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05,
-              const data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(), const size_t batchSize = 128,
+              const data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(), const size_t batchSize = 1,
               const data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(), size_t seed = 777);
 
     virtual ~Parameter() {}
@@ -261,8 +261,8 @@ struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Par
      */
     virtual services::Status check() const DAAL_C11_OVERRIDE;
 
-    data_management::NumericTablePtr batchIndices;         /*!< Numeric table that represents 32 bit integer indices of terms
-                                                                   in the objective function. If no indices are provided,
+    data_management::NumericTablePtr batchIndices;         /*!< Numeric table of size nIterations x batchSize that represents 32 bit integer
+                                                                   indices of terms in the objective function. If no indices are provided,
                                                                    the implementation will generate random indices. */
     data_management::NumericTablePtr learningRateSequence; /*!< Numeric table that contains value of the learning rate */
     size_t seed;                                           /*!< Seed for random generation of 32 bit integer indices of terms
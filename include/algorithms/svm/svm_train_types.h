@@ -53,6 +53,8 @@ namespace training
 enum Method
 {
     boser        = 0, /*!< Method proposed by Boser et al. */
+    thunder      = 1, /*!< Method that solves the sub-problems on large working sets selected at once,
+                           similar to the one used in ThunderSVM */
     defaultDense = 0  /*!< Default method */
 };
 
@@ -66,6 +66,7 @@
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data/merged_numeric_table.h"
 #include "data_management/data/row_merged_numeric_table.h"
+#include "data_management/data/mapped_numeric_table.h"
 #include "data_management/data/matrix.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
@@ -79,6 +80,7 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "algorithms/kmeans/kmeans_init_types.h"
 #include "algorithms/kmeans/kmeans_init_batch.h"
 #include "algorithms/kmeans/kmeans_init_distributed.h"
@@ -295,6 +297,7 @@
 #include "algorithms/gradient_boosted_trees/gbt_regression_model_builder.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_predict.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_batch.h"
+#include "algorithms/gradient_boosted_trees/gbt_regression_training_distributed.h"
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
 #include "algorithms/logistic_regression/logistic_regression_model.h"
 #include "algorithms/logistic_regression/logistic_regression_model_builder.h"
@@ -196,9 +196,145 @@ private:
 
     services::SharedPtr<services::ErrorCollection> _errors;
 };
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__BLOCKCOMPRESSIONSTREAM"></a>
+ * \brief %BlockCompressionStream class splits input raw data into blocks of the fixed size
+ *        and compresses the blocks independently of each other in parallel.
+ *        The compressed data starts with the table of sizes of the blocks,
+ *        so that it is decompressed in parallel by \ref BlockDecompressionStream
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref CompressionMethod enum
+ */
+class DAAL_EXPORT BlockCompressionStream : public Base
+{
+public:
+    /**
+     * %BlockCompressionStream constructor
+     * \param method    %Compression method used for every block
+     * \param level     Optional parameter, compression level
+     * \param blockSize Optional parameter, size of raw data blocks compressed independently
+     */
+    BlockCompressionStream(CompressionMethod method, CompressionLevel level = defaultLevel, size_t blockSize = 1024 * 1024);
+    virtual ~BlockCompressionStream();
+
+    /**
+     * Writes the next DataBlock to %BlockCompressionStream.
+     * The filled blocks are compressed in parallel when there are enough of them to occupy all threads
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void push_back(DataBlock * inBlock);
+    /**
+     * Writes the next DataBlock to %BlockCompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void operator<<(DataBlock * inBlock) { push_back(inBlock); }
+    /**
+     * Writes the next DataBlock to %BlockCompressionStream
+     * \param[in] inBlock  Next DataBlock to be compressed
+     */
+    virtual void operator<<(DataBlock inBlock) { push_back(&inBlock); }
+    /**
+     * Compresses the blocks written so far and returns the size of compressed data including the table of sizes of the blocks
+     * \return Size in bytes
+     */
+    virtual size_t getCompressedDataSize();
+    /**
+     * Copies compressed data stored in %BlockCompressionStream to an external array
+     * \param[out] outPtr Pointer to the array where compressed data is stored
+     * \param[in] outSize Number of bytes available in external memory, at least getCompressedDataSize()
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(byte * outPtr, size_t outSize);
+
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    void * _blocks;
+
+    CompressionMethod _method;
+    CompressionLevel _level;
+    size_t _blockSize;
+    size_t _nCompressed;
+    size_t _readPos;
+
+    void compressBlocks(bool bAll);
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__BLOCKDECOMPRESSIONSTREAM"></a>
+ * \brief %BlockDecompressionStream class decompresses the data compressed by \ref BlockCompressionStream.
+ *        The blocks are decompressed in parallel into one buffer
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ */
+class DAAL_EXPORT BlockDecompressionStream : public Base
+{
+public:
+    /** %BlockDecompressionStream constructor */
+    BlockDecompressionStream();
+    virtual ~BlockDecompressionStream();
+
+    /**
+     * Writes the next part of compressed data to %BlockDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock with compressed data
+     */
+    virtual void push_back(DataBlock * inBlock);
+    /**
+     * Writes the next part of compressed data to %BlockDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock with compressed data
+     */
+    virtual void operator<<(DataBlock * inBlock) { push_back(inBlock); }
+    /**
+     * Writes the next part of compressed data to %BlockDecompressionStream
+     * \param[in] inBlock  Next DataBlock with compressed data
+     */
+    virtual void operator<<(DataBlock inBlock) { push_back(&inBlock); }
+    /**
+     * Decompresses the data written so far and returns the size of decompressed data
+     * \return Size in bytes
+     */
+    virtual size_t getDecompressedDataSize();
+    /**
+     * Copies the next part of decompressed data stored in %BlockDecompressionStream to an external array
+     * \param[out] outPtr Pointer to the array where decompressed data is stored
+     * \param[in] outSize Number of bytes to copy
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(byte * outPtr, size_t outSize);
+    /**
+     * Returns the pointer to the next part of decompressed data and skips it, so that the data is read without copying
+     * \param[in] size Number of bytes to read
+     * \return Pointer that shares the ownership of the buffer with decompressed data, or an empty pointer
+     *         if the part is not aligned by DAAL_MALLOC_DEFAULT_ALIGNMENT. In the latter case the stream is not changed
+     */
+    virtual services::SharedPtr<byte> readDecompressedArray(size_t size);
+
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    byte * _compressed;
+    size_t _compressedSize;
+    size_t _compressedCapacity;
+
+    services::SharedPtr<byte> _decompressed;
+    size_t _decompressedDataSize;
+    size_t _readPos;
+
+    void decompressBlocks();
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
 } // namespace interface1
 using interface1::CompressionStream;
 using interface1::DecompressionStream;
+using interface1::BlockCompressionStream;
+using interface1::BlockDecompressionStream;
 /** @} */
 
 } //namespace data_management
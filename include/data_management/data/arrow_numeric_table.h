@@ -134,6 +134,18 @@ public:
     services::Status releaseBlockOfColumnValues(BlockDescriptor<float> & block) DAAL_C11_OVERRIDE { return releaseTFeature<float>(block); }
     services::Status releaseBlockOfColumnValues(BlockDescriptor<int> & block) DAAL_C11_OVERRIDE { return releaseTFeature<int>(block); }
 
+    bool hasSingleChunkColumns() const DAAL_C11_OVERRIDE
+    {
+        const int ncols = _table->num_columns();
+        for (int j = 0; j < ncols; ++j)
+        {
+            const std::shared_ptr<const arrow::Column> columnPtr = _table->column(j);
+            DAAL_ASSERT(columnPtr);
+            if (columnPtr->data()->num_chunks() != 1) return false;
+        }
+        return true;
+    }
+
 protected:
     services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
     {
@@ -264,62 +276,46 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        if (ncols == 1)
+        {
+            /* Rows of a single column table are the values of the column */
+            return getTFeature<T>(0, idx, nrows, rwFlag, block);
+        }
+
         if (!block.resizeBuffer(ncols, nrows))
         {
             return services::Status(services::ErrorMemoryAllocationFailed);
         }
 
-        T lbuf[32];
-        size_t di        = 32;
         T * const buffer = block.getBlockPtr();
 
-        for (size_t i = 0; i < nrows; i += di)
+        /* Every column is sliced once and its chunks are converted directly into the strided positions of the block */
+        for (size_t j = 0; j < ncols; ++j)
         {
-            if (i + di > nrows)
-            {
-                di = nrows - i;
-            }
+            const NumericTableFeature & f                        = (*_ddict)[j];
+            const std::shared_ptr<const arrow::Column> columnPtr = _table->column(j);
+            DAAL_ASSERT(columnPtr);
+            const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = columnPtr->data();
+            DAAL_ASSERT(columnChunkedArrayPtr);
+            const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx, nrows);
+            DAAL_ASSERT(sliceChunkedArrayPtr);
+            const arrow::ChunkedArray & sliceChunkedArray = *sliceChunkedArrayPtr;
+            const int chunkCount                          = sliceChunkedArray.num_chunks();
+            DAAL_ASSERT(chunkCount > 0);
 
-            for (size_t j = 0; j < ncols; ++j)
+            size_t offset = 0;
+            for (int chunk = 0; chunk < chunkCount; ++chunk)
             {
-                const NumericTableFeature & f                        = (*_ddict)[j];
-                const std::shared_ptr<const arrow::Column> columnPtr = _table->column(j);
-                DAAL_ASSERT(columnPtr);
-                const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = columnPtr->data();
-                DAAL_ASSERT(columnChunkedArrayPtr);
-                const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx + i, di);
-                DAAL_ASSERT(sliceChunkedArrayPtr);
-                const arrow::ChunkedArray & sliceChunkedArray = *sliceChunkedArrayPtr;
-                const int chunkCount                          = sliceChunkedArray.num_chunks();
-                DAAL_ASSERT(chunkCount > 0);
-                if (chunkCount == 1)
-                {
-                    const char * const ptr = getPtr(sliceChunkedArray.chunk(0), f);
-                    DAAL_ASSERT(ptr);
-                    internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(di, ptr, lbuf);
-                }
-                else
-                {
-                    size_t offset = 0;
-                    for (int chunk = 0; chunk < chunkCount; ++chunk)
-                    {
-                        const std::shared_ptr<const arrow::Array> arrayPtr = sliceChunkedArray.chunk(chunk);
-                        DAAL_ASSERT(arrayPtr);
-                        const int64_t chunkLength = arrayPtr->length();
-                        DAAL_ASSERT(chunkLength > 0);
-                        const char * const ptr = getPtr(arrayPtr, f);
-                        DAAL_ASSERT(ptr);
-                        internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(chunkLength, ptr, &(lbuf[offset]));
-                        offset += chunkLength;
-                    }
-                    DAAL_ASSERT(offset == di);
-                }
-
-                for (size_t ii = 0; ii < di; ++ii)
-                {
-                    buffer[(i + ii) * ncols + j] = lbuf[ii];
-                }
+                const std::shared_ptr<const arrow::Array> arrayPtr = sliceChunkedArray.chunk(chunk);
+                DAAL_ASSERT(arrayPtr);
+                const int64_t chunkLength = arrayPtr->length();
+                const char * const ptr    = getPtr(arrayPtr, f);
+                DAAL_ASSERT(ptr);
+                internal::getVectorStrideUpCast(f.indexType, internal::getConversionDataType<T>())(chunkLength, ptr, f.typeSize,
+                                                                                                   buffer + offset * ncols + j, ncols * sizeof(T));
+                offset += chunkLength;
             }
+            DAAL_ASSERT(offset == nrows);
         }
 
         return services::Status();
@@ -405,7 +401,7 @@ private:
                     internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(chunkLength, ptr, destPtr + offset);
                     offset += chunkLength;
                 }
-                DAAL_ASSERT(offset == di);
+                DAAL_ASSERT(offset == nrows);
             }
         }
         return services::Status();
@@ -141,6 +141,26 @@ public:
     virtual int getUpdateVersion() = 0;
 };
 
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__SHAREDBUFFERDATAARCHIVEIFACE"></a>
+ *  \brief Abstract interface class of a data archive that keeps its data in one shared buffer.
+ *  The parts of the buffer are read without copying the data.
+ */
+class SharedBufferDataArchiveIface
+{
+public:
+    virtual ~SharedBufferDataArchiveIface() {}
+
+    /**
+     *  Returns the pointer to the next part of the archive without copying the data and skips this part.
+     *  The pointer shares the ownership of the memory that stores the archive
+     *  \param[in]  size  Size of the part of the archive in bytes
+     *  \return Pointer to the part of the archive, or an empty pointer if the part is out of the archive
+     *          or its address is not aligned by DAAL_MALLOC_DEFAULT_ALIGNMENT. In the latter case the archive is not changed
+     */
+    virtual services::SharedPtr<byte> readSharedPtr(size_t size) = 0;
+};
+
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__DATAARCHIVEIMPL"></a>
  *  \brief Abstract interface class that defines methods to access and modify a serialized object.
@@ -166,6 +186,20 @@ public:
     int getUpdateVersion() DAAL_C11_OVERRIDE { return _updateVersion; }
 
 protected:
+    inline size_t alignValueUp(size_t value)
+    {
+        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+        {
+            return value;
+        }
+
+        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
+
+        size_t alignedValue = value + alignm1;
+        alignedValue &= ~alignm1;
+        return alignedValue;
+    }
+
     int _majorVersion;
     int _minorVersion;
     int _updateVersion;
@@ -463,20 +497,6 @@ protected:
         blockOffset[currentWriteBlock]        = 0;
     }
 
-    inline size_t alignValueUp(size_t value)
-    {
-        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
-        {
-            return value;
-        }
-
-        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
-
-        size_t alignedValue = value + alignm1;
-        alignedValue &= ~alignm1;
-        return alignedValue;
-    }
-
     services::SharedPtr<services::ErrorCollection> _errors;
 
 private:
@@ -734,6 +754,337 @@ private:
     services::SharedPtr<services::ErrorCollection> _errors;
 };
 
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__REFERENCEDATAARCHIVE"></a>
+ *  \brief Implements the abstract DataArchiveIface interface for reading the serialized object
+ *  from a shared byte buffer without copying the buffer.
+ *  The archive has the same format as \ref DataArchive
+ */
+class ReferenceDataArchive : public DataArchiveImpl, public SharedBufferDataArchiveIface
+{
+public:
+    /**
+     *  Constructor of a data archive that references a byte buffer
+     *  \param[in]  ptr   Pointer to the byte buffer with the archive data
+     *  \param[in]  size  Size of the buffer in bytes
+     */
+    ReferenceDataArchive(const services::SharedPtr<byte> & ptr, size_t size)
+        : _buffer(ptr), _size(size), _readOffset(0), _errors(new services::ErrorCollection())
+    {}
+
+    void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE { this->_errors->add(services::ErrorDataArchiveInternal); }
+
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        size_t alignedSize = alignValueUp(size);
+        if (_size < _readOffset + alignedSize)
+        {
+            this->_errors->add(services::ErrorDataArchiveInternal);
+            return;
+        }
+
+        int result = daal::services::internal::daal_memcpy_s(ptr, size, _buffer.get() + _readOffset, size);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        _readOffset += alignedSize;
+    }
+
+    services::SharedPtr<byte> readSharedPtr(size_t size) DAAL_C11_OVERRIDE
+    {
+        size_t alignedSize = alignValueUp(size);
+        byte * ptr         = _buffer.get() + _readOffset;
+        if (size == 0 || _size < _readOffset + alignedSize || ((size_t)ptr & (DAAL_MALLOC_DEFAULT_ALIGNMENT - 1)))
+        {
+            return services::SharedPtr<byte>();
+        }
+
+        _readOffset += alignedSize;
+        return services::SharedPtr<byte>(_buffer, _buffer.get(), ptr);
+    }
+
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return _size; }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE { return _buffer; }
+
+    byte * getArchiveAsArray() DAAL_C11_OVERRIDE { return _buffer.get(); }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE { return std::string((char *)_buffer.get(), _size); }
+
+    size_t copyArchiveToArray(byte * ptr, size_t maxLength) const DAAL_C11_OVERRIDE
+    {
+        if (_size == 0 || _size > maxLength)
+        {
+            return _size;
+        }
+
+        int result = daal::services::internal::daal_memcpy_s(ptr, maxLength, _buffer.get(), _size);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return 0;
+        }
+        return _size;
+    }
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    services::SharedPtr<byte> _buffer;
+    size_t _size;
+    size_t _readOffset;
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__BLOCKCOMPRESSEDDATAARCHIVE"></a>
+ *  \brief Implements the abstract DataArchiveIface interface for writing the serialized object
+ *  into the stream of independently compressed blocks, which are compressed in parallel
+ */
+class BlockCompressedDataArchive : public DataArchiveImpl
+{
+public:
+    /**
+     *  Constructor of a block compressed data archive
+     *  \param[in]  method     %Compression method
+     *  \param[in]  level      %Compression level
+     *  \param[in]  blockSize  Size of raw data blocks compressed independently
+     */
+    BlockCompressedDataArchive(CompressionMethod method, CompressionLevel level = defaultLevel, size_t blockSize = 1024 * 1024)
+    {
+        compressionStream = new daal::data_management::BlockCompressionStream(method, level, blockSize);
+        serializedBuffer  = 0;
+    }
+
+    /** \private */
+    ~BlockCompressedDataArchive()
+    {
+        if (serializedBuffer)
+        {
+            daal::services::daal_free(serializedBuffer);
+        }
+        delete compressionStream;
+    }
+
+    void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        DataBlock wBlock;
+        wBlock.setPtr(ptr);
+        wBlock.setSize(size);
+        compressionStream->push_back(&wBlock);
+    }
+
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE {}
+
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return compressionStream->getCompressedDataSize(); }
+
+    byte * getArchiveAsArray() DAAL_C11_OVERRIDE
+    {
+        if (serializedBuffer)
+        {
+            return serializedBuffer;
+        }
+
+        size_t length = getSizeOfArchive();
+
+        if (length == 0)
+        {
+            return 0;
+        }
+
+        serializedBuffer = (byte *)daal::services::daal_malloc(length);
+        if (serializedBuffer == 0)
+        {
+            return 0;
+        }
+
+        compressionStream->copyCompressedArray(serializedBuffer, length);
+        return serializedBuffer;
+    }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE
+    {
+        size_t length = getSizeOfArchive();
+
+        if (length == 0)
+        {
+            return services::SharedPtr<byte>();
+        }
+
+        services::SharedPtr<byte> serializedBufferPtr((byte *)daal::services::daal_malloc(length), services::ServiceDeleter());
+        if (!serializedBufferPtr)
+        {
+            return services::SharedPtr<byte>();
+        }
+
+        copyArchiveToArray(serializedBufferPtr.get(), length);
+
+        return serializedBufferPtr;
+    }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE
+    {
+        size_t length = getSizeOfArchive();
+        char * buffer = (char *)getArchiveAsArray();
+
+        return std::string(buffer, length);
+    }
+
+    size_t copyArchiveToArray(byte * ptr, size_t maxLength) const DAAL_C11_OVERRIDE
+    {
+        size_t length = getSizeOfArchive();
+
+        if (length == 0 || length > maxLength)
+        {
+            return length;
+        }
+
+        compressionStream->copyCompressedArray(ptr, length);
+        return length;
+    }
+
+    /**
+    * Returns errors during the computation
+    * \return Errors during the computation
+    */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return compressionStream->getErrors(); }
+
+private:
+    byte * serializedBuffer;
+    daal::data_management::BlockCompressionStream * compressionStream;
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__BLOCKDECOMPRESSEDDATAARCHIVE"></a>
+ *  \brief Implements the abstract DataArchiveIface interface for reading the serialized object
+ *  from the stream of independently compressed blocks, which are decompressed in parallel into one buffer.
+ *  The parts of the buffer are read without copying by \ref readSharedPtr
+ */
+class BlockDecompressedDataArchive : public DataArchiveImpl, public SharedBufferDataArchiveIface
+{
+public:
+    /**
+     *  Constructor of a block decompressed data archive from a byte array of compressed data
+     *  \param[in]  ptr   Pointer to the byte array with data compressed by \ref BlockCompressedDataArchive
+     *  \param[in]  size  Size of the byte array
+     */
+    BlockDecompressedDataArchive(byte * ptr, size_t size)
+    {
+        decompressionStream = new daal::data_management::BlockDecompressionStream();
+        serializedBuffer    = 0;
+
+        DataBlock wBlock;
+        wBlock.setPtr(ptr);
+        wBlock.setSize(size);
+        decompressionStream->push_back(&wBlock);
+    }
+
+    /** \private */
+    ~BlockDecompressedDataArchive()
+    {
+        if (serializedBuffer)
+        {
+            daal::services::daal_free(serializedBuffer);
+        }
+        delete decompressionStream;
+    }
+
+    void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        DataBlock wBlock;
+        wBlock.setPtr(ptr);
+        wBlock.setSize(size);
+        decompressionStream->push_back(&wBlock);
+    }
+
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE { decompressionStream->copyDecompressedArray(ptr, size); }
+
+    services::SharedPtr<byte> readSharedPtr(size_t size) DAAL_C11_OVERRIDE { return decompressionStream->readDecompressedArray(size); }
+
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return decompressionStream->getDecompressedDataSize(); }
+
+    byte * getArchiveAsArray() DAAL_C11_OVERRIDE
+    {
+        if (serializedBuffer)
+        {
+            return serializedBuffer;
+        }
+
+        size_t length = getSizeOfArchive();
+
+        if (length == 0)
+        {
+            return 0;
+        }
+
+        serializedBuffer = (byte *)daal::services::daal_malloc(length);
+        if (serializedBuffer == 0)
+        {
+            return 0;
+        }
+
+        decompressionStream->copyDecompressedArray(serializedBuffer, length);
+        return serializedBuffer;
+    }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE
+    {
+        size_t length = getSizeOfArchive();
+
+        if (length == 0)
+        {
+            return services::SharedPtr<byte>();
+        }
+
+        services::SharedPtr<byte> serializedBufferPtr((byte *)daal::services::daal_malloc(length), services::ServiceDeleter());
+        if (!serializedBufferPtr)
+        {
+            return services::SharedPtr<byte>();
+        }
+
+        copyArchiveToArray(serializedBufferPtr.get(), length);
+
+        return serializedBufferPtr;
+    }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE
+    {
+        size_t length = getSizeOfArchive();
+        char * buffer = (char *)getArchiveAsArray();
+
+        return std::string(buffer, length);
+    }
+
+    size_t copyArchiveToArray(byte * ptr, size_t maxLength) const DAAL_C11_OVERRIDE
+    {
+        size_t length = getSizeOfArchive();
+
+        if (length == 0 || length > maxLength)
+        {
+            return length;
+        }
+
+        decompressionStream->copyDecompressedArray(ptr, length);
+        return length;
+    }
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return decompressionStream->getErrors(); }
+
+private:
+    byte * serializedBuffer;
+    daal::data_management::BlockDecompressionStream * decompressionStream;
+};
+
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INPUTDATAARCHIVE"></a>
  *  \brief Provides methods to create an archive data object (serialized) and access this object
@@ -842,6 +1193,12 @@ public:
         _arch->write((byte *)ptr, size * sizeof(T));
     }
 
+    /**
+     *  Provided for the symmetry with OutputDataArchive::referenceArray, the data is serialized by set()
+     *  \return false
+     */
+    bool referenceArray(services::SharedPtr<byte> & ptr, size_t size) { return false; }
+
     /**
      *  Performs data serialization creating a data segment
      *  \tparam  T        Class that implements SerializationIface
@@ -1036,6 +1393,21 @@ public:
         archiveHeader();
     }
 
+    /**
+     *  Constructor of an output data archive that references a byte array without copying it.
+     *  Numeric tables deserialized from the archive reference the array instead of copying the data
+     *  when the data is aligned in the array by DAAL_MALLOC_DEFAULT_ALIGNMENT.
+     *  Such tables share the ownership of the array: modification of the table data modifies the array
+     *  and vice versa, so the array must not be modified while the tables are in use
+     *  \param[in]  ptr   Pointer to the byte array with the archive data
+     *  \param[in]  size  Size of the byte array
+     */
+    OutputDataArchive(const services::SharedPtr<byte> & ptr, size_t size) : _errors(new services::ErrorCollection())
+    {
+        _arch = new ReferenceDataArchive(ptr, size);
+        archiveHeader();
+    }
+
     ~OutputDataArchive() { delete _arch; }
 
     /**
@@ -1117,6 +1489,30 @@ public:
         _arch->read((byte *)ptr, size * sizeof(T));
     }
 
+    /**
+     *  Performs data deserialization of an array of bytes without copying the data,
+     *  if the archive keeps its data in one shared buffer and the array is aligned in the buffer.
+     *  The array is not copied, so modification of the data referenced by ptr modifies the archive buffer and vice versa
+     *  \param[out]  ptr   Pointer that references the data in the archive buffer
+     *  \param[in]   size  Size of the array in bytes
+     *  \return true if the pointer references the archive buffer, false if the data must be read by set()
+     */
+    bool referenceArray(services::SharedPtr<byte> & ptr, size_t size) const
+    {
+        SharedBufferDataArchiveIface * arch = dynamic_cast<SharedBufferDataArchiveIface *>(_arch);
+        if (!arch)
+        {
+            return false;
+        }
+        services::SharedPtr<byte> data = arch->readSharedPtr(size);
+        if (!data)
+        {
+            return false;
+        }
+        ptr = data;
+        return true;
+    }
+
     /**
      *  Performs data deserialization of a data segment
      *  \tparam  T        Class that implements SerializationIface
@@ -1234,9 +1630,13 @@ protected:
 
 } // namespace interface1
 using interface1::DataArchiveIface;
+using interface1::SharedBufferDataArchiveIface;
 using interface1::DataArchive;
 using interface1::CompressedDataArchive;
 using interface1::DecompressedDataArchive;
+using interface1::ReferenceDataArchive;
+using interface1::BlockCompressedDataArchive;
+using interface1::BlockDecompressedDataArchive;
 using interface1::InputDataArchive;
 using interface1::OutputDataArchive;
 
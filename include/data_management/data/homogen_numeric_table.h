@@ -810,13 +810,21 @@ protected:
     {
         NumericTable::serialImpl<Archive, onDeserialize>(archive);
 
+        size_t size = getNumberOfColumns() * getNumberOfRows();
+
         if (onDeserialize)
         {
+            /* Reference the data in the archive buffer instead of copying it when the archive keeps its data
+               in one shared buffer and the data is aligned in it. The table then shares the buffer with the archive:
+               it is marked as user allocated, so it does not free the buffer, and writes into the table modify the buffer */
+            if (size && archive->referenceArray(_ptr, size * sizeof(DataType)))
+            {
+                _memStatus = userAllocated;
+                return services::Status();
+            }
             allocateDataMemoryImpl();
         }
 
-        size_t size = getNumberOfColumns() * getNumberOfRows();
-
         archive->set((DataType *)_ptr.get(), size);
 
         return services::Status();
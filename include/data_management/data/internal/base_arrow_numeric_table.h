@@ -44,6 +44,13 @@ public:
      */
     virtual bool isMutable() const = 0;
 
+    /**
+     *  Returns whether every column of the numeric table is stored in a single chunk,
+     *  so that the values of a column are contiguous in memory
+     *  \return true if every column is stored in a single chunk, false otherwise
+     */
+    virtual bool hasSingleChunkColumns() const { return false; }
+
 protected:
     ArrowNumericTable(size_t featnum, size_t obsnum, services::Status & st) : NumericTable(featnum, obsnum, DictionaryIface::notEqual, st) {}
 };
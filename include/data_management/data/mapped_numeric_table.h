@@ -0,0 +1,173 @@
+/* file: mapped_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of a numeric table stored in a binary file mapped into memory.
+//--
+*/
+
+#ifndef __MAPPED_NUMERIC_TABLE_H__
+#define __MAPPED_NUMERIC_TABLE_H__
+
+#include <string>
+
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/internal/conversion.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__MAPPEDNUMERICTABLE"></a>
+ *  \brief Class that provides methods to access data stored in a binary file, which is mapped into memory.
+ *         The file consists of the header with the data dictionary and the data section that starts at the page boundary.
+ *         The data section stores the rows one by one or the columns one by one.
+ *         The pages of the file are loaded by the operating system on the first access and are shared by all the processes
+ *         that map the same file. Blocks of rows of the row layout and blocks of column values of the column layout
+ *         reference the mapped memory when the feature types match the requested data type.
+ *         The file is written by \ref MappedNumericTable::writeFile
+ */
+class DAAL_EXPORT MappedNumericTable : public NumericTable
+{
+public:
+    /**
+     * Layouts of the data section of the file
+     */
+    enum FileLayout
+    {
+        rowLayout    = 0, /*!< The values of every row are stored contiguously */
+        columnLayout = 1  /*!< The values of every column are stored contiguously */
+    };
+
+    /**
+     * Modes of mapping the file into memory
+     */
+    enum MappingMode
+    {
+        copyOnWrite  = 0, /*!< Modifications of the table are visible only to the current process and are not saved to the file */
+        writeThrough = 1  /*!< Modifications of the table are saved to the file */
+    };
+
+    /**
+     *  Constructs a numeric table that maps the file into memory
+     *  \param[in]  fileName  Name of the file written by MappedNumericTable::writeFile
+     *  \param[in]  mode      Mode of mapping the file
+     *  \param[out] stat      Status of the numeric table construction
+     *  \return Numeric table that references the mapped file
+     */
+    static services::SharedPtr<MappedNumericTable> create(const std::string & fileName, MappingMode mode = copyOnWrite,
+                                                          services::Status * stat = NULL);
+
+    /**
+     *  Writes the numeric table into the file in the format of the memory-mapped numeric table.
+     *  The features of floating-point and 32-bit or narrower integer types keep their types, other features are stored as double
+     *  \param[in]  fileName  Name of the file
+     *  \param[in]  table     Numeric table to write
+     *  \param[in]  layout    Layout of the data section of the file
+     *  \return Status of the operation
+     */
+    static services::Status writeFile(const std::string & fileName, NumericTable & table, FileLayout layout = rowLayout);
+
+    virtual ~MappedNumericTable();
+
+    /**
+     *  Returns the layout of the data section of the mapped file
+     *  \return Layout of the data section
+     */
+    FileLayout getFileLayout() const { return _fileLayout; }
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> & block) DAAL_C11_OVERRIDE;
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> & block) DAAL_C11_OVERRIDE;
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> & block) DAAL_C11_OVERRIDE;
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double> & block) DAAL_C11_OVERRIDE;
+    services::Status releaseBlockOfRows(BlockDescriptor<float> & block) DAAL_C11_OVERRIDE;
+    services::Status releaseBlockOfRows(BlockDescriptor<int> & block) DAAL_C11_OVERRIDE;
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                            BlockDescriptor<double> & block) DAAL_C11_OVERRIDE;
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                            BlockDescriptor<float> & block) DAAL_C11_OVERRIDE;
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                            BlockDescriptor<int> & block) DAAL_C11_OVERRIDE;
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double> & block) DAAL_C11_OVERRIDE;
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float> & block) DAAL_C11_OVERRIDE;
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int> & block) DAAL_C11_OVERRIDE;
+
+    /**
+     *  The table is serialized in the format of SOANumericTable, so it is deserialized as SOANumericTable
+     *  \return Serialization tag of SOANumericTable
+     */
+    int getSerializationTag() const DAAL_C11_OVERRIDE;
+
+    services::Status serializeImpl(InputDataArchive * arch) DAAL_C11_OVERRIDE;
+
+    services::Status deserializeImpl(const OutputDataArchive * arch) DAAL_C11_OVERRIDE;
+
+protected:
+    MappedNumericTable(const std::string & fileName, MappingMode mode, services::Status & st);
+
+    services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE;
+
+    services::Status setNumberOfRowsImpl(size_t nrow) DAAL_C11_OVERRIDE;
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE;
+
+    void freeDataMemoryImpl() DAAL_C11_OVERRIDE {}
+
+private:
+    template <typename T>
+    services::Status getTBlock(size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> & block);
+
+    template <typename T>
+    services::Status releaseTBlock(BlockDescriptor<T> & block);
+
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> & block);
+
+    template <typename T>
+    services::Status releaseTFeature(BlockDescriptor<T> & block);
+
+    /* Location of the value of the feature in the row */
+    byte * getLocation(size_t feat_idx, size_t idx) const { return _data.get() + _offsets[feat_idx] + idx * getStride(feat_idx); }
+
+    /* Distance in bytes between the values of the feature in the consecutive rows */
+    size_t getStride(size_t feat_idx) const { return _fileLayout == rowLayout ? _rowSize : (*_ddict)[feat_idx].typeSize; }
+
+    services::SharedPtr<byte> _data;            /* Data section of the mapped file, the pointer unmaps the file when released */
+    FileLayout _fileLayout;                     /* Layout of the data section */
+    size_t _rowSize;                            /* Size of a row of the row layout in bytes */
+    services::Collection<DAAL_UINT64> _offsets; /* Offsets of the features in the row or of the columns in the data section */
+};
+typedef services::SharedPtr<MappedNumericTable> MappedNumericTablePtr;
+/** @} */
+} // namespace interface1
+using interface1::MappedNumericTable;
+using interface1::MappedNumericTablePtr;
+
+} // namespace data_management
+} // namespace daal
+#endif
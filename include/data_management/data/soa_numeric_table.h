@@ -380,6 +380,13 @@ protected:
     }
 
 private:
+    /* Returns true if the block of rows references the only column of the table */
+    template <typename T>
+    bool isColumnView(size_t ncols) const
+    {
+        return ncols == 1 && features::internal::getIndexNumType<T>() == (*_ddict)[0].indexType;
+    }
+
     template <typename T>
     services::Status getTBlock(size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> & block)
     {
@@ -395,6 +402,13 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        if (isColumnView<T>(ncols))
+        {
+            /* Rows of a single column table are the values of the column */
+            block.setPtr(&(_arrays[0]), _arrays[0].get() + idx * sizeof(T), 1, nrows);
+            return services::Status();
+        }
+
         if (!block.resizeBuffer(ncols, nrows))
         {
             return services::Status(services::ErrorMemoryAllocationFailed);
@@ -435,7 +449,7 @@ private:
     template <typename T>
     services::Status releaseTBlock(BlockDescriptor<T> & block)
     {
-        if (block.getRWFlag() & (int)writeOnly)
+        if ((block.getRWFlag() & (int)writeOnly) && !isColumnView<T>(getNumberOfColumns()))
         {
             size_t ncols = getNumberOfColumns();
             size_t nrows = block.getNumberOfRows();
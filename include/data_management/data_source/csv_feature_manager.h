@@ -327,6 +327,30 @@ public:
      */
     void setDelimiter(char delimiter) { _delimiter = delimiter; }
 
+    /**
+     *  Returns the character used as a delimiter for parsing CSV data
+     */
+    char getDelimiter() const { return _delimiter; }
+
+    /**
+     *  Checks whether every feature is continuous and is stored in its own column of the numeric table,
+     *  so that the rows of CSV data can be converted independently of each other
+     *  \return True if the rows of CSV data can be converted independently of each other
+     */
+    bool isRowParsingIndependent() const
+    {
+        if (_modifiersManager) return false;
+
+        const size_t nFeatures = funcList.size();
+        if (!nFeatures || auxVect.size() != nFeatures) return false;
+
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            if (funcList[i] != ModifierIface::contFunc || auxVect[i].idx != i || auxVect[i].wide != 1) return false;
+        }
+        return true;
+    }
+
 public:
     /**
      * Gets number of columns which must be allocated in numeric table
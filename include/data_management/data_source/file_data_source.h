@@ -29,6 +29,8 @@
 #include "services/daal_memory.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data_source/csv_data_source.h"
+#include "data_management/data_source/csv_feature_manager.h"
+#include "data_management/data_source/internal/csv_parallel_parser.h"
 #include "data_management/data/data_dictionary.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
@@ -98,6 +100,55 @@ public:
     }
 
 public:
+    using super::loadDataBlock;
+
+    /**
+     *  Loads the rest of the file into the provided Numeric Table.
+     *  If all the features are continuous and are not modified, the remaining part of the file is read into memory
+     *  and is parsed in parallel: the data is split into byte ranges aligned to the line boundaries
+     *  and every range is converted by a single thread directly into its own rows of the Numeric Table.
+     *  As the row-by-row reader, the parser stops at the first empty line.
+     *  The remaining part of the file is kept in memory until it is parsed, so the peak memory consumption
+     *  is the size of that part plus the size of the Numeric Table. Use loadDataBlock(maxRows, nt) to load large files by parts
+     *  \param[in] nt  Pointer to the Numeric Table
+     *  \return Number of loaded rows
+     */
+    size_t loadDataBlock(NumericTable * nt) DAAL_C11_OVERRIDE
+    {
+        services::Status s = super::checkDictionary();
+        if (s)
+        {
+            s |= super::checkInputNumericTable(nt);
+        }
+        if (!s || !isParallelParsingSupported(super::getFeatureManager()))
+        {
+            return super::loadDataBlock(nt);
+        }
+
+        s = super::skipHeader();
+        if (!s)
+        {
+            _status.add(services::throwIfPossible(s));
+            return 0;
+        }
+
+        char * data = NULL;
+        size_t size = 0;
+        s           = readRemainingData(data, size);
+        if (s)
+        {
+            s = loadDataBlockParallel(data, size, nt);
+        }
+        daal::services::daal_free(data);
+
+        if (!s)
+        {
+            _status.add(services::throwIfPossible(s));
+            return 0;
+        }
+        return nt->getNumberOfRows();
+    }
+
     services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
     {
         services::Status s = super::createDictionaryFromContext();
@@ -176,6 +227,160 @@ protected:
     }
 
 private:
+    static bool isParallelParsingSupported(const CSVFeatureManager & featureManager) { return featureManager.isRowParsingIndependent(); }
+
+    template <typename OtherFeatureManager>
+    static bool isParallelParsingSupported(const OtherFeatureManager & featureManager)
+    {
+        return false;
+    }
+
+    static char getDelimiter(const CSVFeatureManager & featureManager) { return featureManager.getDelimiter(); }
+
+    template <typename OtherFeatureManager>
+    static char getDelimiter(const OtherFeatureManager & featureManager)
+    {
+        return ',';
+    }
+
+    /* Reads the data remaining in the file buffer and in the file up to the first empty line into a single array.
+     * The data that follows the empty line is left in the file buffer or in the file for the next loads */
+    services::Status readRemainingData(char *& data, size_t & size)
+    {
+        size_t capacity = (size_t)_fileBufferLen;
+        data            = (char *)daal::services::daal_malloc(capacity);
+        size            = 0;
+        if (!data)
+        {
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        if (_fileBufferPos < _readedFromFileLen)
+        {
+            size = (size_t)(_readedFromFileLen - _fileBufferPos);
+            daal::services::internal::daal_memcpy_s(data, capacity, _fileBuffer + _fileBufferPos, size);
+        }
+        _fileBufferPos     = 0;
+        _readedFromFileLen = 0;
+
+        /* Only the lines that are not complete yet are scanned again after every read */
+        size_t lineBegin = 0;
+        size_t pos       = 0;
+        bool bEmptyLine  = internal::findEmptyCsvLine(data, size, pos);
+        lineBegin += pos;
+
+        while (!bEmptyLine && !feof(_file))
+        {
+            if (size == capacity)
+            {
+                char * newData = (char *)daal::services::daal_malloc(capacity * 2);
+                if (!newData)
+                {
+                    return services::Status(services::ErrorMemoryAllocationFailed);
+                }
+                daal::services::internal::daal_memcpy_s(newData, capacity * 2, data, size);
+                daal::services::daal_free(data);
+                data = newData;
+                capacity *= 2;
+            }
+
+            size += fread(data + size, 1, capacity - size, _file);
+            if (ferror(_file))
+            {
+                return services::Status(services::ErrorOnFileRead);
+            }
+
+            bEmptyLine = internal::findEmptyCsvLine(data + lineBegin, size - lineBegin, pos);
+            lineBegin += pos;
+        }
+
+        if (bEmptyLine)
+        {
+            /* Skip the empty line as the row-by-row reader does and return the rest of the data back */
+            size_t next = lineBegin;
+            while (data[next] == '\r') ++next;
+            ++next;
+
+            const size_t nUnread = size - next;
+            if (nUnread <= (size_t)_fileBufferLen)
+            {
+                daal::services::internal::daal_memcpy_s(_fileBuffer, _fileBufferLen, data + next, nUnread);
+                _readedFromFileLen = (int)nUnread;
+            }
+            else if (fseek(_file, -(long)nUnread, SEEK_CUR))
+            {
+                return services::Status(services::ErrorOnFileRead);
+            }
+            size = lineBegin;
+        }
+        return services::Status();
+    }
+
+    services::Status loadDataBlockParallel(const char * data, size_t size, NumericTable * nt)
+    {
+        const size_t nBlocks = internal::getNumberOfCsvBlocks(size);
+        services::Collection<size_t> rowOffsets(nBlocks + 1);
+        DAAL_CHECK(rowOffsets.size() == nBlocks + 1, services::ErrorMemoryAllocationFailed);
+
+        services::Status s = internal::countCsvRows(data, size, nBlocks, &rowOffsets[0]);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        const size_t nRows = rowOffsets[nBlocks];
+        s |= super::resetNumericTable(nt, nRows);
+        DAAL_CHECK_STATUS_VAR(s);
+        if (!nRows)
+        {
+            return s;
+        }
+
+        const size_t nColumns = nt->getNumberOfColumns();
+        BlockDescriptor<DAAL_DATA_TYPE> block;
+        s |= nt->getBlockOfRows(0, nRows, writeOnly, block);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        s |= internal::parseCsvRows(data, size, getDelimiter(super::getFeatureManager()), nBlocks, &rowOffsets[0], nColumns, block.getBlockPtr());
+        if (s)
+        {
+            s |= updateStatisticsParallel(nt, block.getBlockPtr(), nRows);
+        }
+
+        s |= nt->releaseBlockOfRows(block);
+        return s;
+    }
+
+    /* Computes the basic statistics of all the loaded rows at once instead of updating them row by row */
+    services::Status updateStatisticsParallel(NumericTable * nt, const DAAL_DATA_TYPE * rows, size_t nRows)
+    {
+        const size_t nColumns = nt->getNumberOfColumns();
+        services::Collection<double> statistics(4 * nColumns);
+        DAAL_CHECK(statistics.size() == 4 * nColumns, services::ErrorMemoryAllocationFailed);
+
+        double * values    = &statistics[0];
+        services::Status s = internal::computeCsvRowsStatistics(rows, nRows, nColumns, values, values + nColumns, values + 2 * nColumns,
+                                                                values + 3 * nColumns);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        const NumericTable::BasicStatisticsId ids[] = { NumericTable::minimum, NumericTable::maximum, NumericTable::sum, NumericTable::sumSquares };
+        for (size_t k = 0; k < 4; k++)
+        {
+            NumericTablePtr ntStatistics = nt->basicStatistics.get(ids[k]);
+            DAAL_CHECK(ntStatistics.get(), services::ErrorIncorrectInputNumericTable);
+
+            BlockDescriptor<SummaryStatisticsType> block;
+            s |= ntStatistics->getBlockOfRows(0, 1, writeOnly, block);
+            DAAL_CHECK_STATUS_VAR(s);
+            SummaryStatisticsType * result = block.getBlockPtr();
+            DAAL_CHECK(result, services::ErrorIncorrectInputNumericTable);
+
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                result[j] = (SummaryStatisticsType)values[k * nColumns + j];
+            }
+            s |= ntStatistics->releaseBlockOfRows(block);
+        }
+        return s;
+    }
+
     services::Status initialize(const std::string & fileName)
     {
         _file              = NULL;
@@ -0,0 +1,95 @@
+/* file: csv_parallel_parser.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __CSV_PARALLEL_PARSER_H__
+#define __CSV_PARALLEL_PARSER_H__
+
+#include "services/base.h"
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/**
+ * Finds the first empty line of the CSV data, i.e. the first line that contains only the line terminator.
+ * The data sources stop loading the rows at the first empty line
+ * \param[in]  data  Pointer to the CSV data
+ * \param[in]  size  Size of the CSV data in bytes
+ * \param[out] pos   Position of the first empty line if it is found,
+ *                   otherwise the position of the last line which is not terminated yet
+ * \return true if the data contains an empty line, false otherwise
+ */
+DAAL_EXPORT bool findEmptyCsvLine(const char * data, size_t size, size_t & pos);
+
+/**
+ * Returns the number of blocks the CSV data of the given size is split into for the parallel parsing.
+ * Each block is a byte range of the data moved forward to the nearest line boundary
+ * \param[in] size  Size of the CSV data in bytes
+ * \return Number of blocks
+ */
+DAAL_EXPORT size_t getNumberOfCsvBlocks(size_t size);
+
+/**
+ * Counts non-empty lines of the CSV data in parallel
+ * \param[in]  data        Pointer to the CSV data
+ * \param[in]  size        Size of the CSV data in bytes
+ * \param[in]  nBlocks     Number of blocks returned by getNumberOfCsvBlocks()
+ * \param[out] rowOffsets  Array of size nBlocks + 1, on output the i-th element is the index
+ *                         of the first row of the i-th block, the last element is the total number of rows
+ * \return Status of computations
+ */
+DAAL_EXPORT services::Status countCsvRows(const char * data, size_t size, size_t nBlocks, size_t * rowOffsets);
+
+/**
+ * Parses the continuous features of the CSV data in parallel.
+ * Every block is parsed by a single thread into the rows starting at the offset computed by countCsvRows(),
+ * so the threads write into disjoint ranges of rows of the output array
+ * \param[in]  data        Pointer to the CSV data
+ * \param[in]  size        Size of the CSV data in bytes
+ * \param[in]  delimiter   Character that separates the values in a line
+ * \param[in]  nBlocks     Number of blocks returned by getNumberOfCsvBlocks()
+ * \param[in]  rowOffsets  Row offsets of the blocks computed by countCsvRows()
+ * \param[in]  nColumns    Number of values in a line
+ * \param[out] rows        Array of size rowOffsets[nBlocks] * nColumns to store the parsed values
+ * \return Status of computations
+ */
+DAAL_EXPORT services::Status parseCsvRows(const char * data, size_t size, char delimiter, size_t nBlocks, const size_t * rowOffsets,
+                                          size_t nColumns, DAAL_DATA_TYPE * rows);
+
+/**
+ * Computes the minimum, the maximum, the sum and the sum of squares of every column of the parsed rows in parallel
+ * \param[in]  rows        Row-major array of size nRows * nColumns
+ * \param[in]  nRows       Number of rows
+ * \param[in]  nColumns    Number of columns
+ * \param[out] minimum     Array of size nColumns to store the minimums
+ * \param[out] maximum     Array of size nColumns to store the maximums
+ * \param[out] sum         Array of size nColumns to store the sums
+ * \param[out] sumSquares  Array of size nColumns to store the sums of squares
+ * \return Status of computations
+ */
+DAAL_EXPORT services::Status computeCsvRowsStatistics(const DAAL_DATA_TYPE * rows, size_t nRows, size_t nColumns, double * minimum,
+                                                      double * maximum, double * sum, double * sumSquares);
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
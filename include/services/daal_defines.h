@@ -354,6 +354,8 @@ const int SERIALIZATION_GBT_REGRESSION_MODEL_ID                             = 10
 const int SERIALIZATION_GBT_REGRESSION_TRAINING_RESULT_ID                   = 107140;
 const int SERIALIZATION_GBT_REGRESSION_PREDICTION_RESULT_ID                 = 107150;
 const int SERIALIZATION_GBT_DECISION_TREE_ID                                = 107160;
+const int SERIALIZATION_GBT_REGRESSION_STEP1_PARTIAL_RESULT_ID              = 107170;
+const int SERIALIZATION_GBT_REGRESSION_STEP2_PARTIAL_RESULT_ID              = 107180;
 
 const int SERIALIZATION_DECISION_TREE_CLASSIFICATION_MODEL_ID           = 108000;
 const int SERIALIZATION_DECISION_TREE_CLASSIFICATION_TRAINING_RESULT_ID = 108010;
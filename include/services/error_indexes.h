@@ -326,6 +326,9 @@ enum ErrorID
                                                                          *   compressed block header size */
     ErrorRleDataFormatNotFullBlock      = -9022, /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
+
+    ErrorBlockCompressionDataFormat = -9023, /*!< Input compressed stream is not in the format of the block compression stream
+                                                                         *   or is corrupted */
     // Min-max normalization errors: -9400..-9499
     ErrorLowerBoundGreaterThanOrEqualToUpperBound = -9400, /*!< Lower bound parameter greater than or equal to upper bound */
 
@@ -373,7 +376,8 @@ enum ErrorID
     ErrorGbtPredictIncorrectNumberOfIterations = -30001, /*!< Number of iterations value in GBT parameter is not consistent with the model */
 
     // Data management errors:  -80001..
-    ErrorUserAllocatedMemory = -80001, /*!< Couldn't free memory allocated by user */
+    ErrorUserAllocatedMemory      = -80001, /*!< Couldn't free memory allocated by user */
+    ErrorMappedNumericTableFormat = -80002, /*!< File is not in the format of the memory-mapped numeric table or is corrupted */
 
     //Math errors: -90000..-100000
     ErrorDataSourseNotAvailable = -90041, /*!< ErrorDataSourseNotAvailable */
@@ -383,6 +387,7 @@ enum ErrorID
     ErrorOnFileOpen             = -90045, /*!< Error on file open */
     ErrorOnFileRead             = -90046, /*!< Error on file read */
     ErrorNullByteInjection      = -90047, /*!< Error null byte injection */
+    ErrorOnFileWrite            = -90048, /*!< Error on file write */
 
     ErrorKDBNoConnection      = -90051, /*!< ErrorKDBNoConnection */
     ErrorKDBWrongCredentials  = -90052, /*!< ErrorKDBWrongCredentials */
@@ -193,6 +193,23 @@ public class Parameter extends com.intel.daal.algorithms.classifier.Parameter {
         return cGetResultsToCompute(this.cObject);
     }
 
+    /**
+     * Returns the flag that enables parallel node splitting: if it is set and the number of trees is less than
+     * the number of threads then sibling nodes of a tree and features of a node are processed in parallel
+     * @return Flag that enables parallel node splitting
+     */
+    public boolean getParallelNodeSplitting() {
+        return cGetParallelNodeSplitting(this.cObject);
+    }
+
+    /**
+     * Sets the flag that enables parallel node splitting. Default is false
+     * @param value Flag that enables parallel node splitting
+     */
+    public void setParallelNodeSplitting(boolean value) {
+        cSetParallelNodeSplitting(this.cObject, value);
+    }
+
     private native long cGetNTrees(long parAddr);
     private native void cSetNTrees(long parAddr, long value);
 
@@ -221,5 +238,8 @@ public class Parameter extends com.intel.daal.algorithms.classifier.Parameter {
     private native int cGetVariableImportanceMode(long parAddr);
     private native void cSetVariableImportanceMode(long parAddr, int value);
 
+    private native boolean cGetParallelNodeSplitting(long parAddr);
+    private native void cSetParallelNodeSplitting(long parAddr, boolean value);
+
 }
 /** @} */
@@ -0,0 +1,74 @@
+/* file: DistributedStep1LocalInput.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup gbt_regression_training_distributed
+ * @{
+ */
+package com.intel.daal.algorithms.gbt.regression.training;
+
+import com.intel.daal.utils.*;
+import com.intel.daal.data_management.data.Factory;
+import com.intel.daal.data_management.data.NumericTable;
+import com.intel.daal.services.DaalContext;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALINPUT"></a>
+ * @brief %Input objects for gradient boosted trees regression model-based training in the first step
+ *        of the distributed processing mode
+ */
+public final class DistributedStep1LocalInput extends TrainingInput {
+    /** @private */
+    static {
+        LibUtils.loadLibrary();
+    }
+
+    public DistributedStep1LocalInput(DaalContext context, long cInput) {
+        super(context, cInput);
+    }
+
+    /**
+     * Sets the input object computed on the master node
+     * @param id    Identifier of the input object
+     * @param val   Value of the input object
+     */
+    public void set(DistributedStep1LocalInputId id, NumericTable val) {
+        if (id != DistributedStep1LocalInputId.binBordersFromStep2 && id != DistributedStep1LocalInputId.levelSplitsFromStep2) {
+            throw new IllegalArgumentException("id unsupported");
+        }
+
+        cSetStep1Input(cObject, id.getValue(), val.getCObject());
+    }
+
+    /**
+     * Returns the input object computed on the master node
+     * @param id Identifier of the input object
+     * @return   Input object that corresponds to the given identifier
+     */
+    public NumericTable get(DistributedStep1LocalInputId id) {
+        if (id != DistributedStep1LocalInputId.binBordersFromStep2 && id != DistributedStep1LocalInputId.levelSplitsFromStep2) {
+            throw new IllegalArgumentException("id unsupported");
+        }
+
+        return (NumericTable)Factory.instance().createObject(getContext(), cGetStep1Input(cObject, id.getValue()));
+    }
+
+    private native void cSetStep1Input(long inputAddr, int id, long ntAddr);
+
+    private native long cGetStep1Input(long inputAddr, int id);
+}
+/** @} */
@@ -0,0 +1,53 @@
+/* file: DistributedStep1LocalInputId.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup gbt_regression_training_distributed
+ * @{
+ */
+package com.intel.daal.algorithms.gbt.regression.training;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALINPUTID"></a>
+ * @brief Available identifiers of input objects for model-based training in the first step of the distributed processing mode
+ */
+public final class DistributedStep1LocalInputId {
+    private int _value;
+
+    /**
+     * Constructs the object identifier using the provided value
+     * @param value     Value corresponding to the object identifier
+     */
+    public DistributedStep1LocalInputId(int value) {
+        _value = value;
+    }
+
+    /**
+     * Returns the value corresponding to the object identifier
+     * @return Value corresponding to the object identifier
+     */
+    public int getValue() {
+        return _value;
+    }
+
+    private static final int binBordersFromStep2Id = 2;
+    private static final int levelSplitsFromStep2Id = 3;
+
+    public static final DistributedStep1LocalInputId binBordersFromStep2 = new DistributedStep1LocalInputId(binBordersFromStep2Id); /*!< Bin borders of the features computed on the master node, set on the second call of the first step only */
+    public static final DistributedStep1LocalInputId levelSplitsFromStep2 = new DistributedStep1LocalInputId(levelSplitsFromStep2Id); /*!< Splits of the nodes of the tree level computed on the master node */
+}
+/** @} */
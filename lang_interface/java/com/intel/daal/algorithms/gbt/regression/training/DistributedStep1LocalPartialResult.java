@@ -0,0 +1,83 @@
+/* file: DistributedStep1LocalPartialResult.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup gbt_regression_training_distributed
+ * @{
+ */
+package com.intel.daal.algorithms.gbt.regression.training;
+
+import com.intel.daal.utils.*;
+import com.intel.daal.data_management.data.Factory;
+import com.intel.daal.data_management.data.NumericTable;
+import com.intel.daal.services.DaalContext;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALPARTIALRESULT"></a>
+ * @brief Provides methods to access partial results obtained with the compute() method of gradient boosted trees
+ *        regression model-based training in the first step of the distributed processing mode
+ */
+public final class DistributedStep1LocalPartialResult extends com.intel.daal.algorithms.PartialResult {
+    /** @private */
+    static {
+        LibUtils.loadLibrary();
+    }
+
+    /**
+     * Default constructor. Constructs empty partial result
+     * @param context   Context to manage the partial result
+     */
+    public DistributedStep1LocalPartialResult(DaalContext context) {
+        super(context);
+        this.cObject = cNewPartialResult();
+    }
+
+    public DistributedStep1LocalPartialResult(DaalContext context, long cPartialResult) {
+        super(context, cPartialResult);
+    }
+
+    /**
+     * Returns a partial result of model-based training
+     * @param id   Identifier of the partial result, @ref DistributedStep1LocalPartialResultId
+     * @return     Partial result that corresponds to the given identifier
+     */
+    public NumericTable get(DistributedStep1LocalPartialResultId id) {
+        if (id != DistributedStep1LocalPartialResultId.binSketches && id != DistributedStep1LocalPartialResultId.histograms) {
+            throw new IllegalArgumentException("id unsupported");
+        }
+        return (NumericTable)Factory.instance().createObject(getContext(), cGetPartialResultTable(getCObject(), id.getValue()));
+    }
+
+    /**
+     * Sets a partial result of model-based training
+     * @param id      Identifier of the partial result, @ref DistributedStep1LocalPartialResultId
+     * @param value   Value of the partial result
+     */
+    public void set(DistributedStep1LocalPartialResultId id, NumericTable value) {
+        if (id != DistributedStep1LocalPartialResultId.binSketches && id != DistributedStep1LocalPartialResultId.histograms) {
+            throw new IllegalArgumentException("id unsupported");
+        }
+        cSetPartialResultTable(getCObject(), id.getValue(), value.getCObject());
+    }
+
+    private native long cNewPartialResult();
+
+    private native long cGetPartialResultTable(long cPartialResult, int id);
+
+    private native void cSetPartialResultTable(long cPartialResult, int id, long cNumericTable);
+}
+/** @} */
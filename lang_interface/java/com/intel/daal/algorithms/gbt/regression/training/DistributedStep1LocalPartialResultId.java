@@ -0,0 +1,53 @@
+/* file: DistributedStep1LocalPartialResultId.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup gbt_regression_training_distributed
+ * @{
+ */
+package com.intel.daal.algorithms.gbt.regression.training;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP1LOCALPARTIALRESULTID"></a>
+ * @brief Available identifiers of partial results of model-based training in the first step of the distributed processing mode
+ */
+public final class DistributedStep1LocalPartialResultId {
+    private int _value;
+
+    /**
+     * Constructs the object identifier using the provided value
+     * @param value     Value corresponding to the object identifier
+     */
+    public DistributedStep1LocalPartialResultId(int value) {
+        _value = value;
+    }
+
+    /**
+     * Returns the value corresponding to the object identifier
+     * @return Value corresponding to the object identifier
+     */
+    public int getValue() {
+        return _value;
+    }
+
+    private static final int binSketchesId = 0;
+    private static final int histogramsId = 1;
+
+    public static final DistributedStep1LocalPartialResultId binSketches = new DistributedStep1LocalPartialResultId(binSketchesId); /*!< Summaries of the feature values computed on the local node on the first call of the first step */
+    public static final DistributedStep1LocalPartialResultId histograms = new DistributedStep1LocalPartialResultId(histogramsId); /*!< Histograms of the gradients of the nodes of the tree level computed on the local node */
+}
+/** @} */
@@ -0,0 +1,59 @@
+/* file: DistributedStep2MasterInput.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup gbt_regression_training_distributed
+ * @{
+ */
+package com.intel.daal.algorithms.gbt.regression.training;
+
+import com.intel.daal.utils.*;
+import com.intel.daal.data_management.data.NumericTable;
+import com.intel.daal.services.DaalContext;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERINPUT"></a>
+ * @brief %Input objects for gradient boosted trees regression model-based training in the second step
+ *        of the distributed processing mode
+ */
+public final class DistributedStep2MasterInput extends com.intel.daal.algorithms.Input {
+    /** @private */
+    static {
+        LibUtils.loadLibrary();
+    }
+
+    public DistributedStep2MasterInput(DaalContext context, long cInput) {
+        super(context, cInput);
+    }
+
+    /**
+     * Adds the output of the first step computed on a local node to the input of the second step
+     * @param id    Identifier of the input object
+     * @param val   Numeric table computed on the local node, DistributedStep1LocalPartialResultId.binSketches
+     *              or DistributedStep1LocalPartialResultId.histograms
+     */
+    public void add(DistributedStep2MasterInputId id, NumericTable val) {
+        if (id != DistributedStep2MasterInputId.binSketchesFromStep1 && id != DistributedStep2MasterInputId.histogramsFromStep1) {
+            throw new IllegalArgumentException("id unsupported");
+        }
+
+        cAddInput(cObject, id.getValue(), val.getCObject());
+    }
+
+    private native void cAddInput(long inputAddr, int id, long ntAddr);
+}
+/** @} */
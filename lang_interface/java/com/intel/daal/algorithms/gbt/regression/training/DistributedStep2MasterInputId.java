@@ -0,0 +1,53 @@
+/* file: DistributedStep2MasterInputId.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup gbt_regression_training_distributed
+ * @{
+ */
+package com.intel.daal.algorithms.gbt.regression.training;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERINPUTID"></a>
+ * @brief Available identifiers of input objects for model-based training in the second step of the distributed processing mode
+ */
+public final class DistributedStep2MasterInputId {
+    private int _value;
+
+    /**
+     * Constructs the object identifier using the provided value
+     * @param value     Value corresponding to the object identifier
+     */
+    public DistributedStep2MasterInputId(int value) {
+        _value = value;
+    }
+
+    /**
+     * Returns the value corresponding to the object identifier
+     * @return Value corresponding to the object identifier
+     */
+    public int getValue() {
+        return _value;
+    }
+
+    private static final int binSketchesFromStep1Id = 0;
+    private static final int histogramsFromStep1Id = 1;
+
+    public static final DistributedStep2MasterInputId binSketchesFromStep1 = new DistributedStep2MasterInputId(binSketchesFromStep1Id); /*!< Summaries of the feature values computed on the local nodes, set on the first call of the second step only */
+    public static final DistributedStep2MasterInputId histogramsFromStep1 = new DistributedStep2MasterInputId(histogramsFromStep1Id); /*!< Histograms of the gradients computed on the local nodes */
+}
+/** @} */
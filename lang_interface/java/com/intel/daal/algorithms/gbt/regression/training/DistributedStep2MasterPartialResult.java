@@ -0,0 +1,104 @@
+/* file: DistributedStep2MasterPartialResult.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup gbt_regression_training_distributed
+ * @{
+ */
+package com.intel.daal.algorithms.gbt.regression.training;
+
+import com.intel.daal.utils.*;
+import com.intel.daal.data_management.data.Factory;
+import com.intel.daal.data_management.data.NumericTable;
+import com.intel.daal.services.DaalContext;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERPARTIALRESULT"></a>
+ * @brief Provides methods to access partial results obtained with the compute() method of gradient boosted trees
+ *        regression model-based training in the second step of the distributed processing mode
+ */
+public final class DistributedStep2MasterPartialResult extends com.intel.daal.algorithms.PartialResult {
+    /** @private */
+    static {
+        LibUtils.loadLibrary();
+    }
+
+    /**
+     * Default constructor. Constructs empty partial result
+     * @param context   Context to manage the partial result
+     */
+    public DistributedStep2MasterPartialResult(DaalContext context) {
+        super(context);
+        this.cObject = cNewPartialResult();
+    }
+
+    public DistributedStep2MasterPartialResult(DaalContext context, long cPartialResult) {
+        super(context, cPartialResult);
+    }
+
+    /**
+     * Returns a partial result of model-based training
+     * @param id   Identifier of the partial result, @ref DistributedStep2MasterPartialResultId
+     * @return     Partial result that corresponds to the given identifier
+     */
+    public NumericTable get(DistributedStep2MasterPartialResultId id) {
+        if (id != DistributedStep2MasterPartialResultId.binBorders && id != DistributedStep2MasterPartialResultId.levelSplits) {
+            throw new IllegalArgumentException("id unsupported");
+        }
+        return (NumericTable)Factory.instance().createObject(getContext(), cGetPartialResultTable(getCObject(), id.getValue()));
+    }
+
+    /**
+     * Sets a partial result of model-based training
+     * @param id      Identifier of the partial result, @ref DistributedStep2MasterPartialResultId
+     * @param value   Value of the partial result
+     */
+    public void set(DistributedStep2MasterPartialResultId id, NumericTable value) {
+        if (id != DistributedStep2MasterPartialResultId.binBorders && id != DistributedStep2MasterPartialResultId.levelSplits) {
+            throw new IllegalArgumentException("id unsupported");
+        }
+        cSetPartialResultTable(getCObject(), id.getValue(), value.getCObject());
+    }
+
+    /**
+     * Returns true if all the trees are built and the model can be obtained with the finalizeCompute() method
+     * of the algorithm in the second step of the distributed processing mode
+     * @return Flag of the end of training
+     */
+    public boolean isTrainingFinished() {
+        return cIsTrainingFinished(getCObject());
+    }
+
+    /**
+     * Returns the number of features in the input data of the local nodes
+     * @return Number of features, 0 if it is not known yet
+     */
+    public long getNumberOfFeatures() {
+        return cGetNumberOfFeatures(getCObject());
+    }
+
+    private native long cNewPartialResult();
+
+    private native long cGetPartialResultTable(long cPartialResult, int id);
+
+    private native void cSetPartialResultTable(long cPartialResult, int id, long cNumericTable);
+
+    private native boolean cIsTrainingFinished(long cPartialResult);
+
+    private native long cGetNumberOfFeatures(long cPartialResult);
+}
+/** @} */
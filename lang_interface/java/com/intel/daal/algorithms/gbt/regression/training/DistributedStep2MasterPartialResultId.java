@@ -0,0 +1,53 @@
+/* file: DistributedStep2MasterPartialResultId.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup gbt_regression_training_distributed
+ * @{
+ */
+package com.intel.daal.algorithms.gbt.regression.training;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDSTEP2MASTERPARTIALRESULTID"></a>
+ * @brief Available identifiers of partial results of model-based training in the second step of the distributed processing mode
+ */
+public final class DistributedStep2MasterPartialResultId {
+    private int _value;
+
+    /**
+     * Constructs the object identifier using the provided value
+     * @param value     Value corresponding to the object identifier
+     */
+    public DistributedStep2MasterPartialResultId(int value) {
+        _value = value;
+    }
+
+    /**
+     * Returns the value corresponding to the object identifier
+     * @return Value corresponding to the object identifier
+     */
+    public int getValue() {
+        return _value;
+    }
+
+    private static final int binBordersId = 0;
+    private static final int levelSplitsId = 1;
+
+    public static final DistributedStep2MasterPartialResultId binBorders = new DistributedStep2MasterPartialResultId(binBordersId); /*!< Bin borders of the features computed on the first call of the second step */
+    public static final DistributedStep2MasterPartialResultId levelSplits = new DistributedStep2MasterPartialResultId(levelSplitsId); /*!< Splits of the nodes of the tree level */
+}
+/** @} */
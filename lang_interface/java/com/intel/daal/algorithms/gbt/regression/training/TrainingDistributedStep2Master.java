@@ -0,0 +1,165 @@
+/* file: TrainingDistributedStep2Master.java */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/**
+ * @ingroup gbt_regression_training_distributed
+ * @{
+ */
+package com.intel.daal.algorithms.gbt.regression.training;
+
+import com.intel.daal.utils.*;
+import com.intel.daal.algorithms.Precision;
+import com.intel.daal.algorithms.TrainingDistributed;
+import com.intel.daal.services.DaalContext;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__TRAININGDISTRIBUTEDSTEP2MASTER"></a>
+ * @brief Runs gradient boosted trees regression model-based training in the second step of the distributed processing mode.
+ *        Merges the outputs of the local nodes and builds the trees.
+ *        The same object is used for all the iterations of the training
+ * <!-- \n<a href="DAAL-REF-GBT__REGRESSION-ALGORITHM">gradient boosted trees regression algorithm description and usage models</a> -->
+ *
+ * \par References
+ *      - com.intel.daal.algorithms.gbt.regression.training.DistributedStep2MasterInput class
+ *      - com.intel.daal.algorithms.gbt.regression.training.DistributedStep2MasterPartialResult class
+ *      - com.intel.daal.algorithms.gbt.regression.Model class
+ */
+public class TrainingDistributedStep2Master extends TrainingDistributed {
+    public DistributedStep2MasterInput input;     /*!< %Input data */
+    public Parameter  parameter;     /*!< Parameters of the algorithm */
+    public TrainingMethod method;   /*!< %Training method for the algorithm */
+    private Precision                 prec; /*!< Precision of intermediate computations */
+
+    /** @private */
+    static {
+        LibUtils.loadLibrary();
+    }
+
+    /**
+     * Constructs the gradient boosted trees regression training algorithm by copying input objects and parameters
+     * of another gradient boosted trees regression training algorithm
+     * @param context   Context to manage gradient boosted trees regression training
+     * @param other     An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    public TrainingDistributedStep2Master(DaalContext context, TrainingDistributedStep2Master other) {
+        super(context);
+        this.method = other.method;
+        prec = other.prec;
+
+        this.cObject = cClone(other.cObject, prec.getValue(), method.getValue());
+        input = new DistributedStep2MasterInput(getContext(), cGetInput(cObject, prec.getValue(), method.getValue()));
+        parameter = new Parameter(getContext(), cInitParameter(this.cObject, prec.getValue(), method.getValue()));
+    }
+
+    /**
+     * Constructs the gradient boosted trees regression training algorithm in the second step
+     * of the distributed processing mode
+     * @param context   Context to manage gradient boosted trees regression training
+     * @param cls       Data type to use in intermediate computations for gradient boosted trees regression training,
+     *                  Double.class or Float.class
+     * @param method    gradient boosted trees regression training method, @ref TrainingMethod
+     */
+    public TrainingDistributedStep2Master(DaalContext context, Class<? extends Number> cls, TrainingMethod method) {
+        super(context);
+
+        this.method = method;
+        if (this.method != TrainingMethod.defaultDense) {
+            throw new IllegalArgumentException("method unsupported");
+        }
+
+        if (cls != Double.class && cls != Float.class) {
+            throw new IllegalArgumentException("type unsupported");
+        }
+
+        if (cls == Double.class) {
+            prec = Precision.doublePrecision;
+        } else {
+            prec = Precision.singlePrecision;
+        }
+
+        this.cObject = cInit(prec.getValue(), method.getValue());
+        input = new DistributedStep2MasterInput(getContext(), cGetInput(cObject, prec.getValue(), method.getValue()));
+        parameter = new Parameter(getContext(), cInitParameter(this.cObject, prec.getValue(), method.getValue()));
+    }
+
+    /**
+     * Computes a partial result of gradient boosted trees regression model-based training
+     * in the second step of the distributed processing mode
+     * @return Partial result of gradient boosted trees regression model-based training
+     */
+    @Override
+    public DistributedStep2MasterPartialResult compute() {
+        super.compute();
+        return new DistributedStep2MasterPartialResult(getContext(), cGetPartialResult(cObject, prec.getValue(), method.getValue()));
+    }
+
+    /**
+     * Builds the gradient boosted trees regression model when the training is finished
+     * @return Result of gradient boosted trees regression model-based training
+     */
+    @Override
+    public TrainingResult finalizeCompute() {
+        super.finalizeCompute();
+        return new TrainingResult(getContext(), cGetResult(cObject, prec.getValue(), method.getValue()));
+    }
+
+    /**
+     * Registers user-allocated memory to store the partial result of model-based training
+     * @param partialResult    Structure to store the partial result of model-based training
+     */
+    public void setPartialResult(DistributedStep2MasterPartialResult partialResult) {
+        cSetPartialResult(cObject, prec.getValue(), method.getValue(), partialResult.getCObject());
+    }
+
+    /**
+     * Registers user-allocated memory to store the result of model-based training
+     * @param result    Structure to store the result of model-based training
+     */
+    public void setResult(TrainingResult result) {
+        cSetResult(cObject, prec.getValue(), method.getValue(), result.getCObject());
+    }
+
+    /**
+     * Returns the newly allocated gradient boosted trees regression training algorithm
+     * with a copy of input objects and parameters of this algorithm
+     * @param context   Context to manage gradient boosted trees regression training
+     *
+     * @return The newly allocated algorithm
+     */
+    @Override
+    public TrainingDistributedStep2Master clone(DaalContext context) {
+        return new TrainingDistributedStep2Master(context, this);
+    }
+
+    private native long cInit(int prec, int method);
+
+    private native long cInitParameter(long algAddr, int prec, int method);
+
+    private native long cGetInput(long algAddr, int prec, int method);
+
+    private native long cGetPartialResult(long algAddr, int prec, int method);
+
+    private native void cSetPartialResult(long algAddr, int prec, int method, long cPartialResult);
+
+    private native long cGetResult(long algAddr, int prec, int method);
+
+    private native void cSetResult(long algAddr, int prec, int method, long cResult);
+
+    private native long cClone(long algAddr, int prec, int method);
+}
+/** @} */
@@ -41,6 +41,10 @@ public final class TrainingResult extends com.intel.daal.algorithms.Result {
         LibUtils.loadLibrary();
     }
 
+    public TrainingResult(DaalContext context, long cResult) {
+        super(context, cResult);
+    }
+
     public TrainingResult(DaalContext context, long cAlgorithm, Precision prec, ComputeMode cmode) {
         super(context);
         this.cObject = cGetResult(cAlgorithm, prec.getValue(), cmode.getValue());
@@ -130,6 +130,21 @@ public class Parameter extends com.intel.daal.algorithms.optimization_solver.ite
         return cGetSkipTheFirstComponentsFlag(this.cObject);
     }
 
+    /**
+    * Sets the flag that restricts the sweeps to the coordinates with non-zero values after each full sweep
+    * @param flag The flag to enable the active set screening
+    */
+    public void setActiveSetScreeningFlag(boolean flag) {
+        cSetActiveSetScreeningFlag(this.cObject, flag);
+    }
+
+    /**
+     * Gets the flag that restricts the sweeps to the coordinates with non-zero values after each full sweep
+     * @return The flag to enable the active set screening
+     */
+    public boolean getActiveSetScreeningFlag() {
+        return cGetActiveSetScreeningFlag(this.cObject);
+    }
 
     /**
      * Sets the engine to be used by the algorithm
@@ -148,5 +163,7 @@ public class Parameter extends com.intel.daal.algorithms.optimization_solver.ite
     private native boolean cGetPositiveFlag(long parAddr);
     private native void cSetSkipTheFirstComponentsFlag(long parAddr, boolean flag);
     private native boolean cGetSkipTheFirstComponentsFlag(long parAddr);
+    private native void cSetActiveSetScreeningFlag(long parAddr, boolean flag);
+    private native boolean cGetActiveSetScreeningFlag(long parAddr);
 }
 /** @} */
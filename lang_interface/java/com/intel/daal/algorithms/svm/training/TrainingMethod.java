@@ -47,8 +47,10 @@ public final class TrainingMethod {
         return _value;
     }
 
-    private static final int BoserValue = 0;
+    private static final int BoserValue   = 0;
+    private static final int ThunderValue = 1;
 
-    public static final TrainingMethod boser = new TrainingMethod(BoserValue); /*!< Method proposed by Boser et al. */
+    public static final TrainingMethod boser   = new TrainingMethod(BoserValue);   /*!< Method proposed by Boser et al. */
+    public static final TrainingMethod thunder = new TrainingMethod(ThunderValue); /*!< Method similar to the one used in ThunderSVM */
 }
 /** @} */
@@ -252,6 +252,30 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_decision_1forest_classific
     (*(dfct::Parameter *)parAddr).varImportance = decision_forest::training::VariableImportanceMode(value);
 }
 
+/*
+* Class:     com_intel_daal_algorithms_decision_forest_classification_training_Parameter
+* Method:    cGetParallelNodeSplitting
+* Signature: (J)Z
+*/
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_algorithms_decision_1forest_classification_training_Parameter_cGetParallelNodeSplitting(JNIEnv *,
+                                                                                                                                       jobject,
+                                                                                                                                       jlong parAddr)
+{
+    return (jboolean)(*(dfct::Parameter *)parAddr).parallelNodeSplitting;
+}
+
+/*
+* Class:     com_intel_daal_algorithms_decision_forest_classification_training_Parameter
+* Method:    cSetParallelNodeSplitting
+* Signature: (JZ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_decision_1forest_classification_training_Parameter_cSetParallelNodeSplitting(JNIEnv *, jobject,
+                                                                                                                                   jlong parAddr,
+                                                                                                                                   jboolean value)
+{
+    (*(dfct::Parameter *)parAddr).parallelNodeSplitting = value;
+}
+
 /*
 * Class:     com_intel_daal_algorithms_decision_forest_classification_training_TrainingResult
 * Method:    cGetResult
@@ -249,6 +249,29 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_decision_1forest_regressio
     (*(dfrt::Parameter *)parAddr).varImportance = decision_forest::training::VariableImportanceMode(value);
 }
 
+/*
+* Class:     com_intel_daal_algorithms_decision_forest_regression_training_Parameter
+* Method:    cGetParallelNodeSplitting
+* Signature: (J)Z
+*/
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_algorithms_decision_1forest_regression_training_Parameter_cGetParallelNodeSplitting(JNIEnv *, jobject,
+                                                                                                                                   jlong parAddr)
+{
+    return (jboolean)(*(dfrt::Parameter *)parAddr).parallelNodeSplitting;
+}
+
+/*
+* Class:     com_intel_daal_algorithms_decision_forest_regression_training_Parameter
+* Method:    cSetParallelNodeSplitting
+* Signature: (JZ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_decision_1forest_regression_training_Parameter_cSetParallelNodeSplitting(JNIEnv *, jobject,
+                                                                                                                               jlong parAddr,
+                                                                                                                               jboolean value)
+{
+    (*(dfrt::Parameter *)parAddr).parallelNodeSplitting = value;
+}
+
 /*
 * Class:     com_intel_daal_algorithms_decision_forest_regression_training_TrainingResult
 * Method:    cGetResult
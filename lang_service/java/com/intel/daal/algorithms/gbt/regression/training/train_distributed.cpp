@@ -0,0 +1,195 @@
+/* file: train_distributed.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <jni.h>
+
+#include "daal.h"
+#include "com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local.h"
+#include "com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master.h"
+#include "common_helpers.h"
+
+USING_COMMON_NAMESPACES()
+namespace gbtrt = daal::algorithms::gbt::regression::training;
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local
+* Method:    cInit
+* Signature: (II)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local_cInit(JNIEnv *, jobject, jint prec,
+                                                                                                                   jint method)
+{
+    return jniDistributed<step1Local, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::newObj(prec, method);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local
+* Method:    cInitParameter
+* Signature: (JII)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local_cInitParameter(JNIEnv *, jobject,
+                                                                                                                            jlong algAddr, jint prec,
+                                                                                                                            jint method)
+{
+    return jniDistributed<step1Local, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::getParameter(prec, method, algAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local
+* Method:    cGetInput
+* Signature: (JII)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local_cGetInput(JNIEnv *, jobject,
+                                                                                                                       jlong algAddr, jint prec,
+                                                                                                                       jint method)
+{
+    return jniDistributed<step1Local, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::getInput(prec, method, algAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local
+* Method:    cGetPartialResult
+* Signature: (JII)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local_cGetPartialResult(JNIEnv *, jobject,
+                                                                                                                               jlong algAddr,
+                                                                                                                               jint prec, jint method)
+{
+    return jniDistributed<step1Local, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::getPartialResult(prec, method, algAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local
+* Method:    cSetPartialResult
+* Signature: (JIIJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local_cSetPartialResult(JNIEnv *, jobject,
+                                                                                                                              jlong algAddr,
+                                                                                                                              jint prec, jint method,
+                                                                                                                              jlong presAddr)
+{
+    jniDistributed<step1Local, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::setPartialResult<gbtrt::DistributedStep1LocalPartialResult>(
+        prec, method, algAddr, presAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local
+* Method:    cClone
+* Signature: (JII)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep1Local_cClone(JNIEnv *, jobject, jlong algAddr,
+                                                                                                                    jint prec, jint method)
+{
+    return jniDistributed<step1Local, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::getClone(prec, method, algAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master
+* Method:    cInit
+* Signature: (II)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master_cInit(JNIEnv *, jobject, jint prec,
+                                                                                                                    jint method)
+{
+    return jniDistributed<step2Master, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::newObj(prec, method);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master
+* Method:    cInitParameter
+* Signature: (JII)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master_cInitParameter(JNIEnv *, jobject,
+                                                                                                                             jlong algAddr, jint prec,
+                                                                                                                             jint method)
+{
+    return jniDistributed<step2Master, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::getParameter(prec, method, algAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master
+* Method:    cGetInput
+* Signature: (JII)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master_cGetInput(JNIEnv *, jobject,
+                                                                                                                        jlong algAddr, jint prec,
+                                                                                                                        jint method)
+{
+    return jniDistributed<step2Master, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::getInput(prec, method, algAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master
+* Method:    cGetPartialResult
+* Signature: (JII)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master_cGetPartialResult(JNIEnv *, jobject,
+                                                                                                                                jlong algAddr,
+                                                                                                                                jint prec,
+                                                                                                                                jint method)
+{
+    return jniDistributed<step2Master, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::getPartialResult(prec, method, algAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master
+* Method:    cSetPartialResult
+* Signature: (JIIJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master_cSetPartialResult(JNIEnv *, jobject,
+                                                                                                                               jlong algAddr,
+                                                                                                                               jint prec, jint method,
+                                                                                                                               jlong presAddr)
+{
+    jniDistributed<step2Master, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::setPartialResult<gbtrt::DistributedStep2MasterPartialResult>(
+        prec, method, algAddr, presAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master
+* Method:    cGetResult
+* Signature: (JII)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master_cGetResult(JNIEnv *, jobject,
+                                                                                                                         jlong algAddr, jint prec,
+                                                                                                                         jint method)
+{
+    return jniDistributed<step2Master, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::getResult(prec, method, algAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master
+* Method:    cSetResult
+* Signature: (JIIJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master_cSetResult(JNIEnv *, jobject,
+                                                                                                                        jlong algAddr, jint prec,
+                                                                                                                        jint method, jlong resAddr)
+{
+    jniDistributed<step2Master, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::setResult<gbtrt::Result>(prec, method, algAddr, resAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master
+* Method:    cClone
+* Signature: (JII)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_TrainingDistributedStep2Master_cClone(JNIEnv *, jobject, jlong algAddr,
+                                                                                                                     jint prec, jint method)
+{
+    return jniDistributed<step2Master, gbtrt::Method, gbtrt::Distributed, gbtrt::defaultDense>::getClone(prec, method, algAddr);
+}
@@ -0,0 +1,152 @@
+/* file: train_distributed_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <jni.h>
+
+#include "daal.h"
+#include "com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalInput.h"
+#include "com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterInput.h"
+#include "com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalPartialResult.h"
+#include "com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult.h"
+#include "common_helpers.h"
+
+USING_COMMON_NAMESPACES()
+namespace gbtrt = daal::algorithms::gbt::regression::training;
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalInput
+* Method:    cSetStep1Input
+* Signature: (JIJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalInput_cSetStep1Input(JNIEnv *, jobject,
+                                                                                                                        jlong inputAddr, jint id,
+                                                                                                                        jlong ntAddr)
+{
+    jniInput<gbtrt::DistributedStep1LocalInput>::set<gbtrt::DistributedStep1LocalInputId, NumericTable>(inputAddr, id, ntAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalInput
+* Method:    cGetStep1Input
+* Signature: (JI)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalInput_cGetStep1Input(JNIEnv *, jobject,
+                                                                                                                         jlong inputAddr, jint id)
+{
+    return jniInput<gbtrt::DistributedStep1LocalInput>::get<gbtrt::DistributedStep1LocalInputId, NumericTable>(inputAddr, id);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterInput
+* Method:    cAddInput
+* Signature: (JIJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterInput_cAddInput(JNIEnv *, jobject,
+                                                                                                                    jlong inputAddr, jint id,
+                                                                                                                    jlong ntAddr)
+{
+    jniInput<gbtrt::DistributedStep2MasterInput>::add<gbtrt::DistributedStep2MasterInputId, NumericTable>(inputAddr, id, ntAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalPartialResult
+* Method:    cNewPartialResult
+* Signature: ()J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalPartialResult_cNewPartialResult(JNIEnv *, jobject)
+{
+    return jniArgument<gbtrt::DistributedStep1LocalPartialResult>::newObj();
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalPartialResult
+* Method:    cGetPartialResultTable
+* Signature: (JI)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalPartialResult_cGetPartialResultTable(
+    JNIEnv *, jobject, jlong presAddr, jint id)
+{
+    return jniArgument<gbtrt::DistributedStep1LocalPartialResult>::get<gbtrt::DistributedStep1LocalPartialResultId, NumericTable>(presAddr, id);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalPartialResult
+* Method:    cSetPartialResultTable
+* Signature: (JIJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep1LocalPartialResult_cSetPartialResultTable(
+    JNIEnv *, jobject, jlong presAddr, jint id, jlong ntAddr)
+{
+    jniArgument<gbtrt::DistributedStep1LocalPartialResult>::set<gbtrt::DistributedStep1LocalPartialResultId, NumericTable>(presAddr, id, ntAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult
+* Method:    cNewPartialResult
+* Signature: ()J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult_cNewPartialResult(JNIEnv *,
+                                                                                                                                     jobject)
+{
+    return jniArgument<gbtrt::DistributedStep2MasterPartialResult>::newObj();
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult
+* Method:    cGetPartialResultTable
+* Signature: (JI)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult_cGetPartialResultTable(
+    JNIEnv *, jobject, jlong presAddr, jint id)
+{
+    return jniArgument<gbtrt::DistributedStep2MasterPartialResult>::get<gbtrt::DistributedStep2MasterPartialResultId, NumericTable>(presAddr, id);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult
+* Method:    cSetPartialResultTable
+* Signature: (JIJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult_cSetPartialResultTable(
+    JNIEnv *, jobject, jlong presAddr, jint id, jlong ntAddr)
+{
+    jniArgument<gbtrt::DistributedStep2MasterPartialResult>::set<gbtrt::DistributedStep2MasterPartialResultId, NumericTable>(presAddr, id, ntAddr);
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult
+* Method:    cIsTrainingFinished
+* Signature: (J)Z
+*/
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult_cIsTrainingFinished(
+    JNIEnv *, jobject, jlong presAddr)
+{
+    return (jboolean)staticPointerCast<gbtrt::DistributedStep2MasterPartialResult, SerializationIface>(*(SerializationIfacePtr *)presAddr)
+        ->isTrainingFinished();
+}
+
+/*
+* Class:     com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult
+* Method:    cGetNumberOfFeatures
+* Signature: (J)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_gbt_regression_training_DistributedStep2MasterPartialResult_cGetNumberOfFeatures(
+    JNIEnv *, jobject, jlong presAddr)
+{
+    return (jlong)staticPointerCast<gbtrt::DistributedStep2MasterPartialResult, SerializationIface>(*(SerializationIfacePtr *)presAddr)
+        ->getNumberOfFeatures();
+}
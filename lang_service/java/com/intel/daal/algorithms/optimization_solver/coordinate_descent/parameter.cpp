@@ -114,6 +114,28 @@ JNIEXPORT jboolean JNICALL
     return ((coordinate_descent::Parameter *)parAddr)->skipTheFirstComponents;
 }
 
+/*
+ * Class:     com_intel_daal_algorithms_optimization_solver_coordinate_descent_Parameter
+ * Method:    cSetActiveSetScreeningFlag
+ * Signature: (JZ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_optimization_1solver_coordinate_1descent_Parameter_cSetActiveSetScreeningFlag(
+    JNIEnv *, jobject, jlong parAddr, jboolean activeSetScreening)
+{
+    ((coordinate_descent::Parameter *)parAddr)->activeSetScreening = activeSetScreening;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_optimization_solver_coordinate_descent_Parameter
+ * Method:    cGetActiveSetScreeningFlag
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL
+    Java_com_intel_daal_algorithms_optimization_1solver_coordinate_1descent_Parameter_cGetActiveSetScreeningFlag(JNIEnv *, jobject, jlong parAddr)
+{
+    return ((coordinate_descent::Parameter *)parAddr)->activeSetScreening;
+}
+
 /*
  * Class:     com_intel_daal_algorithms_optimization_solver_coordinate_descent_Parameter
  * Method:    cSetEngine
@@ -0,0 +1,532 @@
+/* file: block_compression_stream.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the block (de-)compression stream.
+//
+//  The stream consists of the header (magic number, compression method,
+//  number of blocks), the table of raw and compressed sizes of the blocks
+//  and the compressed blocks. Every block is compressed by its own compressor,
+//  so the blocks are compressed and decompressed independently in parallel.
+//--
+*/
+
+#include "compression_stream.h"
+#include "zlibcompression.h"
+#include "lzocompression.h"
+#include "rlecompression.h"
+#include "bzip2compression.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace
+{
+const DAAL_UINT64 blockStreamMagic = 0x314B4C424C414144ULL; /* "DAALBLK1" */
+const size_t nHeaderFields         = 3;
+const size_t nBlocksInThread       = 2;
+
+struct CompressedBlock
+{
+    CompressedBlock(size_t capacity)
+        : raw((byte *)daal::services::daal_malloc(capacity)), rawSize(0), rawCapacity(capacity), compressed(NULL), compressedSize(0)
+    {}
+
+    ~CompressedBlock()
+    {
+        daal::services::daal_free(raw);
+        daal::services::daal_free(compressed);
+    }
+
+    byte * raw;
+    size_t rawSize;
+    size_t rawCapacity;
+    byte * compressed;
+    size_t compressedSize;
+    services::SharedPtr<services::ErrorCollection> errors;
+};
+
+typedef services::SharedPtr<CompressedBlock> CompressedBlockPtr;
+typedef services::Collection<CompressedBlockPtr> CBC;
+
+template <CompressionMethod method>
+CompressorImpl * createCompressor(CompressionLevel level)
+{
+    Compressor<method> * compressor = new Compressor<method>();
+    compressor->parameter.level     = level;
+    return compressor;
+}
+
+CompressorImpl * createCompressor(CompressionMethod method, CompressionLevel level)
+{
+    switch (method)
+    {
+    case zlib: return createCompressor<zlib>(level);
+    case lzo: return createCompressor<lzo>(level);
+    case rle: return createCompressor<rle>(level);
+    case bzip2: return createCompressor<bzip2>(level);
+    }
+    return NULL;
+}
+
+DecompressorImpl * createDecompressor(CompressionMethod method)
+{
+    switch (method)
+    {
+    case zlib: return new Decompressor<zlib>();
+    case lzo: return new Decompressor<lzo>();
+    case rle: return new Decompressor<rle>();
+    case bzip2: return new Decompressor<bzip2>();
+    }
+    return NULL;
+}
+
+/* Compresses the raw data of the block into the buffer that grows while the compressor fills it up */
+void compressBlock(CompressedBlock & block, CompressionMethod method, CompressionLevel level)
+{
+    block.errors.reset(new services::ErrorCollection());
+    block.errors->setCanThrow(false);
+
+    services::SharedPtr<CompressorImpl> compressor(createCompressor(method, level));
+    if (!compressor)
+    {
+        block.errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+
+    size_t capacity  = block.rawSize + block.rawSize / 8 + 1024;
+    block.compressed = (byte *)daal::services::daal_malloc(capacity);
+    if (!block.compressed)
+    {
+        block.errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    compressor->setInputDataBlock(block.raw, block.rawSize, 0);
+    do
+    {
+        if (block.compressedSize == capacity)
+        {
+            const size_t newCapacity = 2 * capacity;
+            byte * newCompressed     = (byte *)daal::services::daal_malloc(newCapacity);
+            if (!newCompressed)
+            {
+                block.errors->add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            daal::services::internal::daal_memcpy_s(newCompressed, newCapacity, block.compressed, block.compressedSize);
+            daal::services::daal_free(block.compressed);
+            block.compressed = newCompressed;
+            capacity         = newCapacity;
+        }
+        compressor->run(block.compressed, capacity - block.compressedSize, block.compressedSize);
+        block.compressedSize += compressor->getUsedOutputDataBlockSize();
+    } while (compressor->isOutputDataBlockFull() && compressor->getErrors()->size() == 0);
+
+    if (compressor->getErrors()->size() != 0)
+    {
+        block.errors->add(*(compressor->getErrors()));
+        return;
+    }
+
+    daal::services::daal_free(block.raw);
+    block.raw         = NULL;
+    block.rawCapacity = 0;
+}
+
+/* Copies the part of the source array that intersects the range [pos, pos + size) of the stream */
+size_t copyRange(const byte * src, size_t srcSize, size_t & srcPos, size_t & pos, byte * dst, size_t size, size_t & copied)
+{
+    if (pos < srcPos + srcSize && copied < size)
+    {
+        const size_t offset = pos - srcPos;
+        size_t n            = srcSize - offset;
+        if (n > size - copied) n = size - copied;
+        daal::services::internal::daal_memcpy_s(dst + copied, n, src + offset, n);
+        copied += n;
+        pos += n;
+    }
+    srcPos += srcSize;
+    return copied;
+}
+
+} // namespace
+
+//block compression stream realization
+BlockCompressionStream::BlockCompressionStream(CompressionMethod method, CompressionLevel level, size_t blockSize)
+    : _blocks(NULL),
+      _method(method),
+      _level(level),
+      _blockSize(blockSize),
+      _nCompressed(0),
+      _readPos(0),
+      _errors(new services::ErrorCollection())
+{
+    this->_errors->setCanThrow(false);
+    if (blockSize == 0 || method > bzip2)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    _blocks = (void *)new CBC;
+}
+
+BlockCompressionStream::~BlockCompressionStream()
+{
+    if (_blocks)
+    {
+        delete (CBC *)_blocks;
+    }
+    _blocks = NULL;
+}
+
+void BlockCompressionStream::compressBlocks(bool bAll)
+{
+    CBC & blocks        = *(CBC *)_blocks;
+    const size_t nFull  = (bAll || blocks.size() == 0 || blocks[blocks.size() - 1]->rawSize == _blockSize) ? blocks.size() : blocks.size() - 1;
+    const size_t nToRun = nFull - _nCompressed;
+    if (nToRun == 0) return;
+
+    CompressedBlockPtr * toRun     = &blocks[_nCompressed];
+    const CompressionMethod method = _method;
+    const CompressionLevel level   = _level;
+    daal::threader_for(nToRun, nToRun, [&](size_t i) { compressBlock(*toRun[i], method, level); });
+
+    for (size_t i = 0; i < nToRun; i++)
+    {
+        if (toRun[i]->errors->size() != 0)
+        {
+            this->_errors->add(*(toRun[i]->errors));
+        }
+    }
+    _nCompressed = nFull;
+}
+
+void BlockCompressionStream::push_back(DataBlock * block)
+{
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    //checkParams;
+    if (block == NULL || block->getPtr() == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if (block->getSize() == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    //end checkParams;
+
+    CBC & blocks       = *(CBC *)_blocks;
+    const byte * inPtr = block->getPtr();
+    size_t inSize      = block->getSize();
+    while (inSize > 0)
+    {
+        if (blocks.size() == _nCompressed || blocks[blocks.size() - 1]->rawSize == _blockSize)
+        {
+            CompressedBlockPtr newBlock(new CompressedBlock(_blockSize));
+            if (!newBlock->raw)
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            blocks.push_back(newBlock);
+        }
+        CompressedBlock & last = *blocks[blocks.size() - 1];
+
+        const size_t n = (inSize < _blockSize - last.rawSize) ? inSize : _blockSize - last.rawSize;
+        daal::services::internal::daal_memcpy_s(last.raw + last.rawSize, n, inPtr, n);
+        last.rawSize += n;
+        inPtr += n;
+        inSize -= n;
+    }
+
+    /* Compress the filled blocks when there are enough of them to occupy all the threads */
+    if (blocks.size() - _nCompressed > nBlocksInThread * threader_get_threads_number())
+    {
+        compressBlocks(false);
+    }
+}
+
+size_t BlockCompressionStream::getCompressedDataSize()
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    compressBlocks(true);
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+
+    const CBC & blocks = *(CBC *)_blocks;
+    size_t size        = (nHeaderFields + 2 * blocks.size()) * sizeof(DAAL_UINT64);
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        size += blocks[i]->compressedSize;
+    }
+    return size - _readPos;
+}
+
+size_t BlockCompressionStream::copyCompressedArray(byte * ptr, size_t size)
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if (ptr == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if (size == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    compressBlocks(true);
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+
+    const CBC & blocks = *(CBC *)_blocks;
+    services::Collection<DAAL_UINT64> header(nHeaderFields + 2 * blocks.size());
+    header[0] = blockStreamMagic;
+    header[1] = (DAAL_UINT64)_method;
+    header[2] = (DAAL_UINT64)blocks.size();
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        header[nHeaderFields + 2 * i]     = (DAAL_UINT64)blocks[i]->rawSize;
+        header[nHeaderFields + 2 * i + 1] = (DAAL_UINT64)blocks[i]->compressedSize;
+    }
+
+    size_t copied = 0;
+    size_t srcPos = 0;
+    copyRange((const byte *)header.data(), header.size() * sizeof(DAAL_UINT64), srcPos, _readPos, ptr, size, copied);
+    for (size_t i = 0; i < blocks.size() && copied < size; i++)
+    {
+        copyRange(blocks[i]->compressed, blocks[i]->compressedSize, srcPos, _readPos, ptr, size, copied);
+    }
+    return copied;
+}
+
+//block decompression stream realization
+BlockDecompressionStream::BlockDecompressionStream()
+    : _compressed(NULL), _compressedSize(0), _compressedCapacity(0), _decompressedDataSize(0), _readPos(0), _errors(new services::ErrorCollection())
+{
+    this->_errors->setCanThrow(false);
+}
+
+BlockDecompressionStream::~BlockDecompressionStream()
+{
+    daal::services::daal_free(_compressed);
+    _compressed = NULL;
+}
+
+void BlockDecompressionStream::push_back(DataBlock * block)
+{
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+    //checkParams;
+    if (block == NULL || block->getPtr() == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    const size_t inSize = block->getSize();
+    if (inSize == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    //end checkParams;
+
+    if (_compressedSize + inSize > _compressedCapacity)
+    {
+        const size_t newCapacity = (2 * _compressedCapacity > _compressedSize + inSize) ? 2 * _compressedCapacity : _compressedSize + inSize;
+        byte * newCompressed     = (byte *)daal::services::daal_malloc(newCapacity);
+        if (!newCompressed)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        if (_compressedSize) daal::services::internal::daal_memcpy_s(newCompressed, newCapacity, _compressed, _compressedSize);
+        daal::services::daal_free(_compressed);
+        _compressed         = newCompressed;
+        _compressedCapacity = newCapacity;
+    }
+    daal::services::internal::daal_memcpy_s(_compressed + _compressedSize, inSize, block->getPtr(), inSize);
+    _compressedSize += inSize;
+    _decompressed.reset();
+    _decompressedDataSize = 0;
+}
+
+void BlockDecompressionStream::decompressBlocks()
+{
+    if (this->_errors->size() != 0 || _decompressed || _compressedSize == 0)
+    {
+        return;
+    }
+
+    const DAAL_UINT64 * header = (const DAAL_UINT64 *)_compressed;
+    if (_compressedSize < nHeaderFields * sizeof(DAAL_UINT64) || header[0] != blockStreamMagic || header[1] > (DAAL_UINT64)bzip2
+        || header[2] > (_compressedSize / sizeof(DAAL_UINT64) - nHeaderFields) / 2)
+    {
+        this->_errors->add(services::ErrorBlockCompressionDataFormat);
+        return;
+    }
+    const CompressionMethod method = (CompressionMethod)header[1];
+    const size_t nBlocks           = (size_t)header[2];
+    const DAAL_UINT64 * sizes      = header + nHeaderFields;
+
+    /* Offsets of the blocks in the compressed and decompressed data */
+    services::Collection<size_t> inOffsets(nBlocks + 1);
+    services::Collection<size_t> outOffsets(nBlocks + 1);
+    inOffsets[0]  = (nHeaderFields + 2 * nBlocks) * sizeof(DAAL_UINT64);
+    outOffsets[0] = 0;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        if (sizes[2 * i] == 0 || sizes[2 * i + 1] == 0 || sizes[2 * i + 1] > _compressedSize - inOffsets[i])
+        {
+            this->_errors->add(services::ErrorBlockCompressionDataFormat);
+            return;
+        }
+        inOffsets[i + 1]  = inOffsets[i] + (size_t)sizes[2 * i + 1];
+        outOffsets[i + 1] = outOffsets[i] + (size_t)sizes[2 * i];
+    }
+    if (inOffsets[nBlocks] != _compressedSize)
+    {
+        this->_errors->add(services::ErrorBlockCompressionDataFormat);
+        return;
+    }
+
+    _decompressedDataSize = outOffsets[nBlocks];
+    if (_decompressedDataSize == 0)
+    {
+        return;
+    }
+    services::SharedPtr<byte> decompressed((byte *)daal::services::daal_malloc(_decompressedDataSize), services::ServiceDeleter());
+    if (!decompressed)
+    {
+        _decompressedDataSize = 0;
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    services::Collection<bool> failed(nBlocks);
+    byte * in  = _compressed;
+    byte * out = decompressed.get();
+    daal::threader_for(nBlocks, nBlocks, [&](size_t i) {
+        failed[i] = true;
+        services::SharedPtr<DecompressorImpl> decompressor(createDecompressor(method));
+        if (!decompressor) return;
+
+        const size_t rawSize = outOffsets[i + 1] - outOffsets[i];
+        size_t used          = 0;
+        decompressor->setInputDataBlock(in, inOffsets[i + 1] - inOffsets[i], inOffsets[i]);
+        do
+        {
+            decompressor->run(out, rawSize - used, outOffsets[i] + used);
+            used += decompressor->getUsedOutputDataBlockSize();
+        } while (decompressor->isOutputDataBlockFull() && used < rawSize && decompressor->getErrors()->size() == 0);
+
+        failed[i] = (decompressor->getErrors()->size() != 0 || used != rawSize);
+    });
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        if (failed[i])
+        {
+            _decompressedDataSize = 0;
+            this->_errors->add(services::ErrorBlockCompressionDataFormat);
+            return;
+        }
+    }
+    _decompressed = decompressed;
+}
+
+size_t BlockDecompressionStream::getDecompressedDataSize()
+{
+    decompressBlocks();
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    return _decompressedDataSize - _readPos;
+}
+
+size_t BlockDecompressionStream::copyDecompressedArray(byte * ptr, size_t size)
+{
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if (ptr == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if (size == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    const size_t availSize = getDecompressedDataSize();
+    const size_t readSize  = size < availSize ? size : availSize;
+    if (readSize)
+    {
+        daal::services::internal::daal_memcpy_s(ptr, size, _decompressed.get() + _readPos, readSize);
+        _readPos += readSize;
+    }
+    return readSize;
+}
+
+services::SharedPtr<byte> BlockDecompressionStream::readDecompressedArray(size_t size)
+{
+    if (size == 0 || getDecompressedDataSize() < size)
+    {
+        return services::SharedPtr<byte>();
+    }
+    byte * ptr = _decompressed.get() + _readPos;
+    if ((size_t)ptr & (DAAL_MALLOC_DEFAULT_ALIGNMENT - 1))
+    {
+        return services::SharedPtr<byte>();
+    }
+    _readPos += size;
+    return services::SharedPtr<byte>(_decompressed, _decompressed.get(), ptr);
+}
+
+} // namespace data_management
+} // namespace daal
@@ -120,6 +120,15 @@
     DECLARE_DAAL_STRING_CONST(nTransactions)                     \
     DECLARE_DAAL_STRING_CONST(maxBins)                           \
     DECLARE_DAAL_STRING_CONST(minBinSize)                        \
+    DECLARE_DAAL_STRING_CONST(loss)                              \
+    DECLARE_DAAL_STRING_CONST(huberDelta)                        \
+    DECLARE_DAAL_STRING_CONST(quantileAlpha)                     \
+    DECLARE_DAAL_STRING_CONST(tweediePower)                      \
+    DECLARE_DAAL_STRING_CONST(customLoss)                        \
+    DECLARE_DAAL_STRING_CONST(splitMethod)                       \
+    DECLARE_DAAL_STRING_CONST(memorySavingMode)                  \
+    DECLARE_DAAL_STRING_CONST(externalMemoryPageSize)            \
+    DECLARE_DAAL_STRING_CONST(varImportance)                     \
     DECLARE_DAAL_STRING_CONST(maxItemsetSize)                    \
     DECLARE_DAAL_STRING_CONST(minItemsetSize)                    \
     DECLARE_DAAL_STRING_CONST(largeItemsets)                     \
@@ -165,8 +174,12 @@
     DECLARE_DAAL_STRING_CONST(inputWeights)                      \
     DECLARE_DAAL_STRING_CONST(inputCovariances)                  \
     DECLARE_DAAL_STRING_CONST(inputMeans)                        \
+    DECLARE_DAAL_STRING_CONST(binBordersFromStep2)               \
+    DECLARE_DAAL_STRING_CONST(levelSplitsFromStep2)              \
     DECLARE_DAAL_STRING_CONST(inputOfStep2)                      \
     DECLARE_DAAL_STRING_CONST(inputOfStep2FromStep1)             \
+    DECLARE_DAAL_STRING_CONST(binSketchesFromStep1)              \
+    DECLARE_DAAL_STRING_CONST(histogramsFromStep1)               \
     DECLARE_DAAL_STRING_CONST(inputOfStep3FromStep1)             \
     DECLARE_DAAL_STRING_CONST(inputOfStep3FromStep2)             \
     DECLARE_DAAL_STRING_CONST(inputOfStep4FromStep3)             \
@@ -179,6 +192,10 @@
     DECLARE_DAAL_STRING_CONST(outOfBagErrorPerObservation)       \
     DECLARE_DAAL_STRING_CONST(outputOfStep1ForStep2)             \
     DECLARE_DAAL_STRING_CONST(outputOfStep1ForStep3)             \
+    DECLARE_DAAL_STRING_CONST(binSketches)                       \
+    DECLARE_DAAL_STRING_CONST(histograms)                        \
+    DECLARE_DAAL_STRING_CONST(binBorders)                        \
+    DECLARE_DAAL_STRING_CONST(levelSplits)                       \
     DECLARE_DAAL_STRING_CONST(outputOfStep2ForStep3)             \
     DECLARE_DAAL_STRING_CONST(outputOfStep4)                     \
     DECLARE_DAAL_STRING_CONST(batchIndices)                      \
@@ -271,8 +288,10 @@
     DECLARE_DAAL_STRING_CONST(variableImportance)                \
     DECLARE_DAAL_STRING_CONST(gradientIdx)                       \
     DECLARE_DAAL_STRING_CONST(hessianIdx)                        \
+    DECLARE_DAAL_STRING_CONST(hessianVectorProductIdx)           \
     DECLARE_DAAL_STRING_CONST(inputArgument)                     \
     DECLARE_DAAL_STRING_CONST(dependentVariables)                \
+    DECLARE_DAAL_STRING_CONST(direction)                         \
     DECLARE_DAAL_STRING_CONST(a)                                 \
     DECLARE_DAAL_STRING_CONST(sigma)                             \
     DECLARE_DAAL_STRING_CONST(location)                          \
@@ -371,7 +390,8 @@
     DECLARE_DAAL_STRING_CONST(step13Assignments)                 \
     DECLARE_DAAL_STRING_CONST(step13AssignmentQueries)           \
     DECLARE_DAAL_STRING_CONST(gramMatrix)                        \
-    DECLARE_DAAL_STRING_CONST(lassoParameters)
+    DECLARE_DAAL_STRING_CONST(lassoParameters)                   \
+    DECLARE_DAAL_STRING_CONST(nProbes)
 
 /**
  *  Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) namespace
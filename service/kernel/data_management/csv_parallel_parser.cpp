@@ -0,0 +1,373 @@
+/* file: csv_parallel_parser.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the parallel parser of CSV data.
+//
+//  The data is split into byte ranges, the beginning of every range is moved
+//  forward to the nearest line boundary, so the ranges contain whole lines.
+//  The first pass counts the lines of every range, the second pass parses
+//  the lines of every range into the rows starting at the prefix sum of counts.
+//--
+*/
+
+#include <string.h>
+
+#include "data_management/data_source/internal/csv_parallel_parser.h"
+#include "services/daal_memory.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+namespace
+{
+const size_t minCsvBlockSize        = 65536;
+const size_t maxCsvBlocksInThread   = 4;
+const size_t minStatisticsBlockRows = 4096;
+const size_t maxStackTokenLength    = 64;
+const int maxExactPowerOf10         = 22;
+const DAAL_UINT64 maxExactMantissa  = (DAAL_UINT64)1 << 53;
+
+const double exactPowersOf10[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+inline bool isDigit(char c)
+{
+    return (unsigned char)(c - '0') < 10;
+}
+
+inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\t';
+}
+
+/* Returns the position of the first line of the block, i.e. the position that follows
+ * the end of the line which contains the nominal beginning of the block */
+size_t getBlockBegin(const char * data, size_t size, size_t nBlocks, size_t iBlock)
+{
+    if (iBlock == 0) return 0;
+    if (iBlock >= nBlocks) return size;
+
+    const size_t nominalBegin = (size / nBlocks) * iBlock;
+    if (nominalBegin == 0) return 0;
+
+    const char * lineEnd = (const char *)memchr(data + nominalBegin - 1, '\n', size - nominalBegin + 1);
+    return lineEnd ? (size_t)(lineEnd - data) + 1 : size;
+}
+
+/* Calls the functor for every non-empty line in the range [begin, end), line terminators are not included */
+template <typename Func>
+void forEachLine(const char * begin, const char * end, const Func & func)
+{
+    while (begin < end)
+    {
+        const char * lineEnd = (const char *)memchr(begin, '\n', end - begin);
+        const char * next    = lineEnd ? lineEnd + 1 : end;
+        if (!lineEnd) lineEnd = end;
+
+        while (lineEnd > begin && lineEnd[-1] == '\r') --lineEnd;
+        if (lineEnd > begin) func(begin, lineEnd);
+
+        begin = next;
+    }
+}
+
+/* Converts a token of the form [+-]digits[.digits][(e|E)[+-]digits] into a floating-point value.
+ * The conversion is done only if the result is exact: the significand fits into the mantissa
+ * of double and the power of 10 is exactly representable, so the result is correctly rounded.
+ * Returns false for all other tokens */
+bool parseDecimalFast(const char * p, const char * end, double & value)
+{
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    DAAL_UINT64 mantissa = 0;
+    int nSignificant     = 0;
+    int exponent         = 0;
+    bool hasDigits       = false;
+
+    for (; p < end && isDigit(*p); ++p)
+    {
+        hasDigits = true;
+        mantissa  = mantissa * 10 + (*p - '0');
+        if (mantissa && ++nSignificant > 19) return false;
+    }
+    if (p < end && *p == '.')
+    {
+        for (++p; p < end && isDigit(*p); ++p)
+        {
+            hasDigits = true;
+            mantissa  = mantissa * 10 + (*p - '0');
+            if (mantissa && ++nSignificant > 19) return false;
+            --exponent;
+        }
+    }
+    if (!hasDigits) return false;
+
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        ++p;
+        bool negativeExponent = false;
+        if (p < end && (*p == '-' || *p == '+'))
+        {
+            negativeExponent = (*p == '-');
+            ++p;
+        }
+        if (p == end || !isDigit(*p)) return false;
+
+        int exponentValue = 0;
+        for (; p < end && isDigit(*p); ++p)
+        {
+            if (exponentValue < 10000) exponentValue = exponentValue * 10 + (*p - '0');
+        }
+        exponent += (negativeExponent ? -exponentValue : exponentValue);
+    }
+    if (p != end) return false;
+
+    if (mantissa == 0)
+    {
+        value = (negative ? -0.0 : 0.0);
+        return true;
+    }
+    if (mantissa > maxExactMantissa || exponent > maxExactPowerOf10 || exponent < -maxExactPowerOf10) return false;
+
+    value = (double)mantissa;
+    value = (exponent >= 0 ? value * exactPowersOf10[exponent] : value / exactPowersOf10[-exponent]);
+    if (negative) value = -value;
+    return true;
+}
+
+/* Converts a token that is not handled by the fast path, e.g. a number with too many significant digits,
+ * 'inf' or 'nan', with the generic conversion routine which requires a null-terminated string */
+double parseValueGeneric(const char * begin, const char * end)
+{
+    const size_t length = end - begin;
+
+    char stackBuffer[maxStackTokenLength];
+    char * buffer = (length < maxStackTokenLength ? stackBuffer : (char *)services::daal_malloc(length + 1));
+    if (!buffer) return 0.0;
+
+    for (size_t i = 0; i < length; i++) buffer[i] = begin[i];
+    buffer[length] = '\0';
+
+    const double value = services::daal_string_to_double(buffer, 0);
+
+    if (buffer != stackBuffer) services::daal_free(buffer);
+    return value;
+}
+
+inline double parseValue(const char * begin, const char * end)
+{
+    while (begin < end && isSpace(*begin)) ++begin;
+    while (end > begin && isSpace(end[-1])) --end;
+    if (begin == end) return 0.0;
+
+    double value;
+    return parseDecimalFast(begin, end, value) ? value : parseValueGeneric(begin, end);
+}
+
+/* Parses a line into the row, missing values are set to zero and extra values are ignored */
+void parseLine(const char * begin, const char * end, char delimiter, size_t nColumns, DAAL_DATA_TYPE * row)
+{
+    size_t j = 0;
+    for (const char * token = begin; j < nColumns && token <= end; j++)
+    {
+        const char * tokenEnd = (const char *)memchr(token, delimiter, end - token);
+        if (!tokenEnd) tokenEnd = end;
+
+        row[j] = (DAAL_DATA_TYPE)parseValue(token, tokenEnd);
+        token  = tokenEnd + 1;
+    }
+    for (; j < nColumns; j++) row[j] = (DAAL_DATA_TYPE)0;
+}
+
+struct LineCounter
+{
+    size_t & nLines;
+    explicit LineCounter(size_t & n) : nLines(n) {}
+    void operator()(const char *, const char *) const { ++nLines; }
+};
+
+struct LineParser
+{
+    char delimiter;
+    size_t nColumns;
+    DAAL_DATA_TYPE *& row;
+    LineParser(char d, size_t n, DAAL_DATA_TYPE *& r) : delimiter(d), nColumns(n), row(r) {}
+    void operator()(const char * begin, const char * end) const
+    {
+        parseLine(begin, end, delimiter, nColumns, row);
+        row += nColumns;
+    }
+};
+
+/* Computes the statistics of the rows [begin, end) of the row-major array */
+void computeStatistics(const DAAL_DATA_TYPE * rows, size_t begin, size_t end, size_t nColumns, double * minimum, double * maximum, double * sum,
+                       double * sumSquares)
+{
+    for (size_t j = 0; j < nColumns; j++)
+    {
+        const double value = rows[begin * nColumns + j];
+        minimum[j]         = value;
+        maximum[j]         = value;
+        sum[j]             = value;
+        sumSquares[j]      = value * value;
+    }
+    for (size_t i = begin + 1; i < end; i++)
+    {
+        const DAAL_DATA_TYPE * row = rows + i * nColumns;
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            const double value = row[j];
+            if (minimum[j] > value) minimum[j] = value;
+            if (maximum[j] < value) maximum[j] = value;
+            sum[j] += value;
+            sumSquares[j] += value * value;
+        }
+    }
+}
+
+} // namespace
+
+bool findEmptyCsvLine(const char * data, size_t size, size_t & pos)
+{
+    size_t begin = 0;
+    while (begin < size)
+    {
+        const char * lineEnd = (const char *)memchr(data + begin, '\n', size - begin);
+        if (!lineEnd) break;
+
+        size_t i = begin;
+        while (data + i < lineEnd && data[i] == '\r') ++i;
+        if (data + i == lineEnd)
+        {
+            pos = begin;
+            return true;
+        }
+        begin = (size_t)(lineEnd - data) + 1;
+    }
+    pos = begin;
+    return false;
+}
+
+size_t getNumberOfCsvBlocks(size_t size)
+{
+    const size_t maxBlocks = maxCsvBlocksInThread * threader_get_threads_number();
+    const size_t nBlocks   = size / minCsvBlockSize;
+    return (nBlocks < 1 ? 1 : (nBlocks > maxBlocks ? maxBlocks : nBlocks));
+}
+
+services::Status countCsvRows(const char * data, size_t size, size_t nBlocks, size_t * rowOffsets)
+{
+    DAAL_CHECK(rowOffsets, services::ErrorNullPtr);
+    DAAL_CHECK(nBlocks > 0, services::ErrorIncorrectParameter);
+    DAAL_CHECK(data || !size, services::ErrorNullPtr);
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = getBlockBegin(data, size, nBlocks, iBlock);
+        const size_t end   = getBlockBegin(data, size, nBlocks, iBlock + 1);
+
+        size_t nLines = 0;
+        forEachLine(data + begin, data + end, LineCounter(nLines));
+        rowOffsets[iBlock + 1] = nLines;
+    });
+
+    rowOffsets[0] = 0;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        rowOffsets[i + 1] += rowOffsets[i];
+    }
+    return services::Status();
+}
+
+services::Status parseCsvRows(const char * data, size_t size, char delimiter, size_t nBlocks, const size_t * rowOffsets, size_t nColumns,
+                              DAAL_DATA_TYPE * rows)
+{
+    DAAL_CHECK(rowOffsets, services::ErrorNullPtr);
+    DAAL_CHECK(nBlocks > 0, services::ErrorIncorrectParameter);
+    DAAL_CHECK(data || !size, services::ErrorNullPtr);
+    DAAL_CHECK(rows || !rowOffsets[nBlocks], services::ErrorNullPtr);
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = getBlockBegin(data, size, nBlocks, iBlock);
+        const size_t end   = getBlockBegin(data, size, nBlocks, iBlock + 1);
+
+        DAAL_DATA_TYPE * row = rows + rowOffsets[iBlock] * nColumns;
+        forEachLine(data + begin, data + end, LineParser(delimiter, nColumns, row));
+    });
+
+    return services::Status();
+}
+
+services::Status computeCsvRowsStatistics(const DAAL_DATA_TYPE * rows, size_t nRows, size_t nColumns, double * minimum, double * maximum,
+                                          double * sum, double * sumSquares)
+{
+    DAAL_CHECK(rows || !nRows, services::ErrorNullPtr);
+    DAAL_CHECK(minimum && maximum && sum && sumSquares, services::ErrorNullPtr);
+    if (!nRows || !nColumns) return services::Status();
+
+    const size_t maxBlocks = maxCsvBlocksInThread * threader_get_threads_number();
+    size_t nBlocks         = nRows / minStatisticsBlockRows;
+    nBlocks                = (nBlocks < 1 ? 1 : (nBlocks > maxBlocks ? maxBlocks : nBlocks));
+    const size_t blockSize = nRows / nBlocks;
+
+    /* Every block computes its own statistics, the partial results are combined in the order of the blocks */
+    double * partial = (double *)services::daal_malloc(nBlocks * 4 * nColumns * sizeof(double));
+    DAAL_CHECK_MALLOC(partial);
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = (iBlock + 1 == nBlocks ? nRows : begin + blockSize);
+        double * stat      = partial + iBlock * 4 * nColumns;
+        computeStatistics(rows, begin, end, nColumns, stat, stat + nColumns, stat + 2 * nColumns, stat + 3 * nColumns);
+    });
+
+    for (size_t j = 0; j < nColumns; j++)
+    {
+        minimum[j]    = partial[j];
+        maximum[j]    = partial[nColumns + j];
+        sum[j]        = partial[2 * nColumns + j];
+        sumSquares[j] = partial[3 * nColumns + j];
+    }
+    for (size_t iBlock = 1; iBlock < nBlocks; iBlock++)
+    {
+        const double * stat = partial + iBlock * 4 * nColumns;
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            if (minimum[j] > stat[j]) minimum[j] = stat[j];
+            if (maximum[j] < stat[nColumns + j]) maximum[j] = stat[nColumns + j];
+            sum[j] += stat[2 * nColumns + j];
+            sumSquares[j] += stat[3 * nColumns + j];
+        }
+    }
+
+    services::daal_free(partial);
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
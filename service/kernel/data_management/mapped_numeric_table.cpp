@@ -0,0 +1,627 @@
+/** file mapped_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the numeric table stored in a binary file mapped into memory.
+//
+//  The file starts with the header of DAAL_UINT64 values: magic number, version,
+//  layout, number of rows, number of features, size of a row, offset and size
+//  of the data section, followed by the index type, feature type, number of
+//  categories and offset of every feature. The data section starts at the offset
+//  aligned to the mapping granularity, so it starts at a page boundary.
+//--
+*/
+
+#include <cstdio>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "mapped_numeric_table.h"
+#include "soa_numeric_table.h"
+#include "data_archive.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+namespace
+{
+const DAAL_UINT64 mappedFileMagic   = 0x31544E4D4C414144ULL; /* "DAALMNT1" */
+const DAAL_UINT64 mappedFileVersion = 1;
+const size_t nHeaderFields          = 8;
+const size_t nFeatureFields         = 4;
+const size_t dataSectionAlignment   = 1 << 16; /* Multiple of the page size and of the allocation granularity of Windows */
+const size_t columnAlignment        = DAAL_MALLOC_DEFAULT_ALIGNMENT;
+const size_t writeBufferSize        = 1 << 20;
+
+enum HeaderField
+{
+    fieldMagic = 0,
+    fieldVersion,
+    fieldLayout,
+    fieldNRows,
+    fieldNFeatures,
+    fieldRowSize,
+    fieldDataOffset,
+    fieldDataSize
+};
+
+inline size_t alignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+/* Unmaps the file when the last pointer to the mapped memory is released */
+class MappingDeleter : public services::DeleterIface
+{
+public:
+    MappingDeleter(size_t size) : _size(size) {}
+
+    void operator()(const void * ptr) DAAL_C11_OVERRIDE
+    {
+#if defined(_WIN32) || defined(_WIN64)
+        UnmapViewOfFile(ptr);
+#else
+        munmap((void *)ptr, _size);
+#endif
+    }
+
+private:
+    size_t _size;
+};
+
+services::SharedPtr<byte> mapFile(const std::string & fileName, MappedNumericTable::MappingMode mode, size_t & size, services::Status & st)
+{
+    const bool bWrite = (mode == MappedNumericTable::writeThrough);
+    void * ptr        = NULL;
+    size              = 0;
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ | (bWrite ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        st.add(services::ErrorOnFileOpen);
+        return services::SharedPtr<byte>();
+    }
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingA(file, NULL, bWrite ? PAGE_READWRITE : PAGE_WRITECOPY, 0, 0, NULL);
+        if (mapping)
+        {
+            ptr = MapViewOfFile(mapping, bWrite ? FILE_MAP_WRITE : FILE_MAP_COPY, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+        size = (size_t)fileSize.QuadPart;
+    }
+    CloseHandle(file);
+#else
+    const int fd = open(fileName.c_str(), bWrite ? O_RDWR : O_RDONLY);
+    if (fd < 0)
+    {
+        st.add(services::ErrorOnFileOpen);
+        return services::SharedPtr<byte>();
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        size = (size_t)fileStat.st_size;
+        ptr  = mmap(NULL, size, PROT_READ | PROT_WRITE, bWrite ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+        if (ptr == MAP_FAILED) ptr = NULL;
+    }
+    close(fd);
+#endif
+    if (!ptr)
+    {
+        st.add(services::ErrorOnFileRead);
+        return services::SharedPtr<byte>();
+    }
+    return services::SharedPtr<byte>((byte *)ptr, MappingDeleter(size));
+}
+
+/* Type the feature is stored in the file with */
+features::IndexNumType getStoredType(features::IndexNumType type)
+{
+    switch (type)
+    {
+    case features::DAAL_FLOAT32: return features::DAAL_FLOAT32;
+    case features::DAAL_INT32_S:
+    case features::DAAL_INT16_S:
+    case features::DAAL_INT16_U:
+    case features::DAAL_INT8_S:
+    case features::DAAL_INT8_U: return features::DAAL_INT32_S;
+    default: return features::DAAL_FLOAT64;
+    }
+}
+
+inline size_t getTypeSize(DAAL_UINT64 type)
+{
+    return type == features::DAAL_FLOAT64 ? sizeof(double) : sizeof(float);
+}
+
+/* Copies the values of the feature from the table to the buffer with the given distance between the values */
+template <typename T>
+services::Status readColumn(NumericTable & table, size_t feat_idx, size_t idx, size_t nrows, byte * dst, size_t dstStride)
+{
+    BlockDescriptor<T> block;
+    services::Status s = table.getBlockOfColumnValues(feat_idx, idx, nrows, readOnly, block);
+    if (s)
+    {
+        const T * values = block.getBlockPtr();
+        for (size_t i = 0; i < nrows; i++)
+        {
+            *(T *)(dst + i * dstStride) = values[i];
+        }
+    }
+    table.releaseBlockOfColumnValues(block);
+    return s;
+}
+
+services::Status readColumn(NumericTable & table, DAAL_UINT64 type, size_t feat_idx, size_t idx, size_t nrows, byte * dst, size_t dstStride)
+{
+    switch (type)
+    {
+    case features::DAAL_FLOAT32: return readColumn<float>(table, feat_idx, idx, nrows, dst, dstStride);
+    case features::DAAL_INT32_S: return readColumn<int>(table, feat_idx, idx, nrows, dst, dstStride);
+    default: return readColumn<double>(table, feat_idx, idx, nrows, dst, dstStride);
+    }
+}
+
+services::Status writeBytes(FILE * file, const void * ptr, size_t size)
+{
+    return (fwrite(ptr, 1, size, file) == size) ? services::Status() : services::Status(services::ErrorOnFileWrite);
+}
+
+services::Status writeZeros(FILE * file, size_t size)
+{
+    const byte zeros[columnAlignment] = { 0 };
+    services::Status s;
+    for (size_t i = 0; i < size; i += columnAlignment)
+    {
+        DAAL_CHECK_STATUS(s, writeBytes(file, zeros, (size - i < columnAlignment) ? size - i : columnAlignment));
+    }
+    return s;
+}
+
+services::Status writeData(FILE * file, NumericTable & table, const services::Collection<DAAL_UINT64> & header, byte * buffer)
+{
+    services::Status s;
+    const size_t nRows                = header[fieldNRows];
+    const size_t nFeatures            = header[fieldNFeatures];
+    const size_t rowSize              = header[fieldRowSize];
+    const DAAL_UINT64 * featureFields = &header[nHeaderFields];
+
+    if (header[fieldLayout] == MappedNumericTable::rowLayout)
+    {
+        const size_t blockSize = (writeBufferSize / rowSize > 0) ? writeBufferSize / rowSize : 1;
+        for (size_t idx = 0; idx < nRows; idx += blockSize)
+        {
+            const size_t n = (idx + blockSize < nRows) ? blockSize : nRows - idx;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const DAAL_UINT64 * f = featureFields + j * nFeatureFields;
+                DAAL_CHECK_STATUS(s, readColumn(table, f[0], j, idx, n, buffer + f[3], rowSize));
+            }
+            DAAL_CHECK_STATUS(s, writeBytes(file, buffer, n * rowSize));
+        }
+        return s;
+    }
+
+    size_t offset = 0;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const DAAL_UINT64 * f = featureFields + j * nFeatureFields;
+        const size_t typeSize = getTypeSize(f[0]);
+        DAAL_CHECK_STATUS(s, writeZeros(file, f[3] - offset));
+
+        const size_t blockSize = writeBufferSize / typeSize;
+        for (size_t idx = 0; idx < nRows; idx += blockSize)
+        {
+            const size_t n = (idx + blockSize < nRows) ? blockSize : nRows - idx;
+            DAAL_CHECK_STATUS(s, readColumn(table, f[0], j, idx, n, buffer, typeSize));
+            DAAL_CHECK_STATUS(s, writeBytes(file, buffer, n * typeSize));
+        }
+        offset += nRows * typeSize;
+    }
+    return s;
+}
+
+} // namespace
+
+MappedNumericTable::MappedNumericTable(const std::string & fileName, MappingMode mode, services::Status & st)
+    : NumericTable(0, 0, DictionaryIface::notEqual, st), _fileLayout(rowLayout), _rowSize(0)
+{
+    if (!st) return;
+
+    size_t fileSize                = 0;
+    services::SharedPtr<byte> file = mapFile(fileName, mode, fileSize, st);
+    if (!st) return;
+
+    /* Check the header */
+    const DAAL_UINT64 * header = (const DAAL_UINT64 *)file.get();
+    if (fileSize < nHeaderFields * sizeof(DAAL_UINT64) || header[fieldMagic] != mappedFileMagic || header[fieldVersion] != mappedFileVersion
+        || header[fieldLayout] > columnLayout || header[fieldNFeatures] == 0
+        || header[fieldNFeatures] > (fileSize / sizeof(DAAL_UINT64) - nHeaderFields) / nFeatureFields
+        || header[fieldDataOffset] < (nHeaderFields + nFeatureFields * header[fieldNFeatures]) * sizeof(DAAL_UINT64)
+        || header[fieldDataOffset] % dataSectionAlignment != 0 || header[fieldDataOffset] > fileSize
+        || header[fieldDataSize] > fileSize - header[fieldDataOffset])
+    {
+        st.add(services::ErrorMappedNumericTableFormat);
+        return;
+    }
+
+    const size_t nRows     = header[fieldNRows];
+    const size_t nFeatures = header[fieldNFeatures];
+    const size_t dataSize  = header[fieldDataSize];
+    _fileLayout            = (FileLayout)header[fieldLayout];
+    _rowSize               = header[fieldRowSize];
+    if (_fileLayout == rowLayout && (_rowSize == 0 || nRows > dataSize / _rowSize))
+    {
+        st.add(services::ErrorMappedNumericTableFormat);
+        return;
+    }
+
+    /* Fill the dictionary and the offsets of the features */
+    st |= _ddict->setNumberOfFeatures(nFeatures);
+    if (!st) return;
+    if (!_offsets.resize(nFeatures))
+    {
+        st.add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    const DAAL_UINT64 * featureFields = header + nHeaderFields;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const DAAL_UINT64 * f = featureFields + j * nFeatureFields;
+        NumericTableFeature feature;
+        switch (f[0])
+        {
+        case features::DAAL_FLOAT32: feature.setType<float>(); break;
+        case features::DAAL_FLOAT64: feature.setType<double>(); break;
+        case features::DAAL_INT32_S: feature.setType<int>(); break;
+        default: st.add(services::ErrorMappedNumericTableFormat); return;
+        }
+        const size_t end = (_fileLayout == rowLayout) ? _rowSize : dataSize;
+        const size_t len = (_fileLayout == rowLayout) ? feature.typeSize : nRows * feature.typeSize;
+        if (f[1] > features::DAAL_CONTINUOUS || f[3] > end || len > end - f[3]
+            || (_fileLayout == columnLayout && nRows > dataSize / feature.typeSize))
+        {
+            st.add(services::ErrorMappedNumericTableFormat);
+            return;
+        }
+        feature.featureType    = (features::FeatureType)f[1];
+        feature.categoryNumber = f[2];
+        st |= _ddict->setFeature(feature, j);
+        if (!st) return;
+        _offsets.push_back(f[3]);
+    }
+
+    _data      = services::SharedPtr<byte>(file, file.get(), file.get() + header[fieldDataOffset]);
+    _obsnum    = nRows;
+    _layout    = (_fileLayout == rowLayout) ? aos : soa;
+    _memStatus = userAllocated;
+}
+
+MappedNumericTable::~MappedNumericTable() {}
+
+services::SharedPtr<MappedNumericTable> MappedNumericTable::create(const std::string & fileName, MappingMode mode, services::Status * stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(MappedNumericTable, fileName, mode);
+}
+
+services::Status MappedNumericTable::writeFile(const std::string & fileName, NumericTable & table, FileLayout layout)
+{
+    const size_t nRows              = table.getNumberOfRows();
+    const size_t nFeatures          = table.getNumberOfColumns();
+    NumericTableDictionaryPtr ddict = table.getDictionarySharedPtr();
+    DAAL_CHECK(nFeatures > 0 && ddict, services::ErrorIncorrectNumberOfFeatures);
+
+    /* Header and the features description */
+    services::Collection<DAAL_UINT64> header(nHeaderFields + nFeatureFields * nFeatures);
+    DAAL_CHECK_MALLOC(header.data());
+    size_t offset = 0;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const NumericTableFeature & feature = (*ddict)[j];
+        DAAL_UINT64 * f                     = &header[nHeaderFields + j * nFeatureFields];
+        f[0]                                = getStoredType(feature.indexType);
+        f[1]                                = feature.featureType;
+        f[2]                                = feature.categoryNumber;
+        f[3]                                = (layout == rowLayout) ? offset : alignUp(offset, columnAlignment);
+        offset                              = f[3] + ((layout == rowLayout) ? 1 : nRows) * getTypeSize(f[0]);
+    }
+    header[fieldMagic]      = mappedFileMagic;
+    header[fieldVersion]    = mappedFileVersion;
+    header[fieldLayout]     = layout;
+    header[fieldNRows]      = nRows;
+    header[fieldNFeatures]  = nFeatures;
+    header[fieldRowSize]    = (layout == rowLayout) ? offset : 0;
+    header[fieldDataOffset] = alignUp(header.size() * sizeof(DAAL_UINT64), dataSectionAlignment);
+    header[fieldDataSize]   = (layout == rowLayout) ? offset * nRows : offset;
+
+    byte * buffer = (byte *)daal::services::daal_malloc(writeBufferSize > offset ? writeBufferSize : offset);
+    DAAL_CHECK_MALLOC(buffer);
+
+    FILE * file = NULL;
+#if (defined(_MSC_VER) && (_MSC_VER >= 1400))
+    if (fopen_s(&file, fileName.c_str(), "wb") != 0) file = NULL;
+#else
+    file = fopen(fileName.c_str(), "wb");
+#endif
+    if (!file)
+    {
+        daal::services::daal_free(buffer);
+        return services::Status(services::ErrorOnFileOpen);
+    }
+
+    services::Status s = writeBytes(file, header.data(), header.size() * sizeof(DAAL_UINT64));
+    if (s) s |= writeZeros(file, header[fieldDataOffset] - header.size() * sizeof(DAAL_UINT64));
+    if (s) s |= writeData(file, table, header, buffer);
+
+    if (fclose(file) != 0 && s) s.add(services::ErrorOnFileWrite);
+    daal::services::daal_free(buffer);
+    return s;
+}
+
+services::Status MappedNumericTable::getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> & block)
+{
+    return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+}
+services::Status MappedNumericTable::getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> & block)
+{
+    return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+}
+services::Status MappedNumericTable::getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> & block)
+{
+    return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+}
+
+services::Status MappedNumericTable::releaseBlockOfRows(BlockDescriptor<double> & block)
+{
+    return releaseTBlock<double>(block);
+}
+services::Status MappedNumericTable::releaseBlockOfRows(BlockDescriptor<float> & block)
+{
+    return releaseTBlock<float>(block);
+}
+services::Status MappedNumericTable::releaseBlockOfRows(BlockDescriptor<int> & block)
+{
+    return releaseTBlock<int>(block);
+}
+
+services::Status MappedNumericTable::getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                                            BlockDescriptor<double> & block)
+{
+    return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+}
+services::Status MappedNumericTable::getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                                            BlockDescriptor<float> & block)
+{
+    return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+}
+services::Status MappedNumericTable::getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                                            BlockDescriptor<int> & block)
+{
+    return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+}
+
+services::Status MappedNumericTable::releaseBlockOfColumnValues(BlockDescriptor<double> & block)
+{
+    return releaseTFeature<double>(block);
+}
+services::Status MappedNumericTable::releaseBlockOfColumnValues(BlockDescriptor<float> & block)
+{
+    return releaseTFeature<float>(block);
+}
+services::Status MappedNumericTable::releaseBlockOfColumnValues(BlockDescriptor<int> & block)
+{
+    return releaseTFeature<int>(block);
+}
+
+int MappedNumericTable::getSerializationTag() const
+{
+    return SOANumericTable::serializationTag();
+}
+
+services::Status MappedNumericTable::serializeImpl(InputDataArchive * arch)
+{
+    /* Same as the serialization of SOANumericTable */
+    NumericTableDictionaryPtr ddict = _ddict;
+    StorageLayout layout            = soa;
+    arch->setSharedPtrObj(ddict);
+    arch->set(_obsnum);
+    arch->set(layout);
+
+    const size_t ncols = getNumberOfColumns();
+    const size_t nrows = getNumberOfRows();
+    if (_fileLayout == columnLayout)
+    {
+        for (size_t j = 0; j < ncols; j++)
+        {
+            arch->set((char *)getLocation(j, 0), nrows * (*_ddict)[j].typeSize);
+        }
+        return services::Status();
+    }
+
+    byte * column = (byte *)daal::services::daal_malloc(nrows * sizeof(double));
+    DAAL_CHECK_MALLOC(column);
+    for (size_t j = 0; j < ncols; j++)
+    {
+        const size_t typeSize = (*_ddict)[j].typeSize;
+        const byte * src      = getLocation(j, 0);
+        for (size_t i = 0; i < nrows; i++)
+        {
+            for (size_t k = 0; k < typeSize; k++) column[i * typeSize + k] = src[i * _rowSize + k];
+        }
+        arch->set((char *)column, nrows * typeSize);
+    }
+    daal::services::daal_free(column);
+    return services::Status();
+}
+
+services::Status MappedNumericTable::deserializeImpl(const OutputDataArchive * arch)
+{
+    return services::Status(services::ErrorMethodNotSupported);
+}
+
+services::Status MappedNumericTable::setNumberOfColumnsImpl(size_t ncol)
+{
+    if (ncol == getNumberOfColumns()) return services::Status();
+    return services::Status(services::ErrorMethodNotSupported);
+}
+
+services::Status MappedNumericTable::setNumberOfRowsImpl(size_t nrow)
+{
+    if (nrow == getNumberOfRows()) return services::Status();
+    return services::Status(services::ErrorMethodNotSupported);
+}
+
+services::Status MappedNumericTable::allocateDataMemoryImpl(daal::MemType type)
+{
+    return services::Status(services::ErrorMethodNotSupported);
+}
+
+template <typename T>
+services::Status MappedNumericTable::getTBlock(size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> & block)
+{
+    const size_t ncols = getNumberOfColumns();
+    const size_t nobs  = getNumberOfRows();
+    block.setDetails(0, idx, rwFlag);
+
+    if (idx >= nobs)
+    {
+        block.resizeBuffer(ncols, 0);
+        return services::Status();
+    }
+
+    nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+    /* The rows of the row layout are referenced directly when all the features have the requested type */
+    if (_fileLayout == rowLayout && _rowSize == ncols * sizeof(T))
+    {
+        size_t j = 0;
+        for (; j < ncols && (*_ddict)[j].indexType == features::internal::getIndexNumType<T>(); j++)
+            ;
+        if (j == ncols)
+        {
+            block.setPtr(&_data, getLocation(0, idx), ncols, nrows);
+            return services::Status();
+        }
+    }
+
+    if (!block.resizeBuffer(ncols, nrows))
+    {
+        return services::Status(services::ErrorMemoryAllocationFailed);
+    }
+
+    if (!(block.getRWFlag() & (int)readOnly)) return services::Status();
+
+    T * blockPtr = block.getBlockPtr();
+    for (size_t j = 0; j < ncols; j++)
+    {
+        NumericTableFeature & f = (*_ddict)[j];
+        internal::getVectorStrideUpCast(f.indexType, internal::getConversionDataType<T>())(nrows, getLocation(j, idx), getStride(j), blockPtr + j,
+                                                                                           sizeof(T) * ncols);
+    }
+    return services::Status();
+}
+
+template <typename T>
+services::Status MappedNumericTable::releaseTBlock(BlockDescriptor<T> & block)
+{
+    /* The blocks that reference the mapped memory are modified in place */
+    if ((block.getRWFlag() & (int)writeOnly) && block.getBlockPtr() != (T *)getLocation(0, block.getRowsOffset()))
+    {
+        const size_t ncols = getNumberOfColumns();
+        const size_t nrows = block.getNumberOfRows();
+        const size_t idx   = block.getRowsOffset();
+        T * blockPtr       = block.getBlockPtr();
+
+        for (size_t j = 0; j < ncols; j++)
+        {
+            NumericTableFeature & f = (*_ddict)[j];
+            internal::getVectorStrideDownCast(f.indexType, internal::getConversionDataType<T>())(nrows, blockPtr + j, sizeof(T) * ncols,
+                                                                                                 getLocation(j, idx), getStride(j));
+        }
+    }
+    block.reset();
+    return services::Status();
+}
+
+template <typename T>
+services::Status MappedNumericTable::getTFeature(size_t feat_idx, size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> & block)
+{
+    const size_t nobs = getNumberOfRows();
+    block.setDetails(feat_idx, idx, rwFlag);
+
+    if (idx >= nobs)
+    {
+        block.resizeBuffer(1, 0);
+        return services::Status();
+    }
+
+    nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+    NumericTableFeature & f = (*_ddict)[feat_idx];
+
+    /* The columns of the column layout are referenced directly when the feature has the requested type */
+    if (_fileLayout == columnLayout && features::internal::getIndexNumType<T>() == f.indexType)
+    {
+        block.setPtr(&_data, getLocation(feat_idx, idx), 1, nrows);
+        return services::Status();
+    }
+
+    if (!block.resizeBuffer(1, nrows))
+    {
+        return services::Status(services::ErrorMemoryAllocationFailed);
+    }
+
+    if (!(block.getRWFlag() & (int)readOnly)) return services::Status();
+
+    internal::getVectorStrideUpCast(f.indexType, internal::getConversionDataType<T>())(nrows, getLocation(feat_idx, idx), getStride(feat_idx),
+                                                                                       block.getBlockPtr(), sizeof(T));
+    return services::Status();
+}
+
+template <typename T>
+services::Status MappedNumericTable::releaseTFeature(BlockDescriptor<T> & block)
+{
+    const size_t feat_idx = block.getColumnsOffset();
+    if ((block.getRWFlag() & (int)writeOnly) && block.getBlockPtr() != (T *)getLocation(feat_idx, block.getRowsOffset()))
+    {
+        NumericTableFeature & f = (*_ddict)[feat_idx];
+        internal::getVectorStrideDownCast(f.indexType, internal::getConversionDataType<T>())(block.getNumberOfRows(), block.getBlockPtr(), sizeof(T),
+                                                                                             getLocation(feat_idx, block.getRowsOffset()),
+                                                                                             getStride(feat_idx));
+    }
+    block.reset();
+    return services::Status();
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
@@ -26,6 +26,7 @@
 
 #include "homogen_numeric_table.h"
 #include "csr_numeric_table.h"
+#include "data_management/data/internal/base_arrow_numeric_table.h"
 #include "symmetric_matrix.h"
 #include "service_defines.h"
 #include "service_memory.h"
@@ -540,6 +541,32 @@ using WriteColumns = GetColumns<algorithmFPType, algorithmFPType, cpu, readWrite
 template <typename algorithmFPType, CpuType cpu, typename NumericTableType = NumericTable>
 using WriteOnlyColumns = GetColumns<algorithmFPType, algorithmFPType, cpu, writeOnly, NumericTableType>;
 
+/* Returns true if the table stores every feature contiguously as algorithmFPType values,
+   so ReadColumns references the memory of the table instead of copying the values.
+   A column of an Arrow table is contiguous only if it consists of a single chunk */
+template <typename algorithmFPType, CpuType cpu>
+bool hasColumnViews(NumericTable & table)
+{
+    const NumericTableIface::StorageLayout layout = table.getDataLayout();
+    if (layout != NumericTableIface::soa && layout != NumericTableIface::arrow) return false;
+    if (layout == NumericTableIface::arrow)
+    {
+        const ArrowNumericTable * arrowTable = dynamic_cast<const ArrowNumericTable *>(&table);
+        if (!arrowTable || !arrowTable->hasSingleChunkColumns()) return false;
+    }
+
+    NumericTableDictionaryPtr ddict = table.getDictionarySharedPtr();
+    if (!ddict) return false;
+
+    const features::IndexNumType indexType = features::internal::getIndexNumType<algorithmFPType>();
+    const size_t nFeatures                 = ddict->getNumberOfFeatures();
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        if ((*ddict)[j].indexType != indexType) return false;
+    }
+    return nFeatures > 0;
+}
+
 template <typename algorithmFPType, typename algorithmFPAccessType, CpuType cpu, ReadWriteMode mode, typename NumericTableType>
 class GetPacked
 {
@@ -852,6 +852,7 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorRleDataFormat, "Input compressed stream is in wrong format or corrupted");
     add(ErrorRleDataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
     add(ErrorRleDataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
+    add(ErrorBlockCompressionDataFormat, "Input compressed stream is not in the format of the block compression stream or is corrupted");
 
     // Min-max normalization errors: -9400..-9499
     add(ErrorLowerBoundGreaterThanOrEqualToUpperBound, "Lower bound parameter greater than or equal to upper bound");
@@ -906,6 +907,8 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorSQLstmtHandle, "ErrorSQLstmtHandle");
     add(ErrorOnFileOpen, "Error on file open");
     add(ErrorOnFileRead, "Error on file read");
+    add(ErrorOnFileWrite, "Error on file write");
+    add(ErrorMappedNumericTableFormat, "File is not in the format of the memory-mapped numeric table or is corrupted");
 
     add(ErrorKDBNoConnection, "ErrorKDBNoConnection");
     add(ErrorKDBWrongCredentials, "ErrorKDBWrongCredentials");
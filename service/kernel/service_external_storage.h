@@ -0,0 +1,99 @@
+/* file: service_external_storage.h */
+/*******************************************************************************
+* Copyright 2014-2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Storage of the intermediate data of the algorithms on the local disk,
+//  used when the data does not fit into memory
+//--
+*/
+
+#ifndef __SERVICE_EXTERNAL_STORAGE_H__
+#define __SERVICE_EXTERNAL_STORAGE_H__
+
+#include <cstdio>
+
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+/**
+ * Temporary binary file which is written and then read sequentially one or several times.
+ * The file is removed when the object is destroyed
+ */
+class TemporaryFileStorage
+{
+public:
+    TemporaryFileStorage() : _file(nullptr) {}
+    ~TemporaryFileStorage() { close(); }
+
+    services::Status open()
+    {
+        close();
+#if (defined(_MSC_VER) && (_MSC_VER >= 1400))
+        if (tmpfile_s(&_file) != 0) _file = nullptr;
+#else
+        _file = tmpfile();
+#endif
+        return _file ? services::Status() : services::Status(services::ErrorOnFileOpen);
+    }
+
+    void close()
+    {
+        if (_file) fclose(_file);
+        _file = nullptr;
+    }
+
+    bool isOpened() const { return _file != nullptr; }
+
+    /* Appends nBytes bytes to the end of the written data */
+    services::Status write(const void * ptr, size_t nBytes)
+    {
+        DAAL_CHECK(_file, services::ErrorOnFileWrite);
+        return (fwrite(ptr, 1, nBytes, _file) == nBytes) ? services::Status() : services::Status(services::ErrorOnFileWrite);
+    }
+
+    /* Moves the position to the beginning of the file, the following reads start from the first written byte */
+    services::Status rewind()
+    {
+        DAAL_CHECK(_file, services::ErrorOnFileRead);
+        return (fflush(_file) == 0 && fseek(_file, 0, SEEK_SET) == 0) ? services::Status() : services::Status(services::ErrorOnFileRead);
+    }
+
+    /* Reads the next nBytes bytes */
+    services::Status read(void * ptr, size_t nBytes)
+    {
+        DAAL_CHECK(_file, services::ErrorOnFileRead);
+        return (fread(ptr, 1, nBytes, _file) == nBytes) ? services::Status() : services::Status(services::ErrorOnFileRead);
+    }
+
+private:
+    TemporaryFileStorage(const TemporaryFileStorage &);
+    TemporaryFileStorage & operator=(const TemporaryFileStorage &);
+
+    FILE * _file;
+};
+
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif